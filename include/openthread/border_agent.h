@@ -106,10 +106,13 @@ typedef struct otBorderAgentCounters
  */
 typedef struct otBorderAgentSessionInfo
 {
-    otSockAddr mPeerSockAddr;   ///< Socket address (IPv6 address and port number) of session peer.
-    bool       mIsConnected;    ///< Indicates whether the session is connected.
-    bool       mIsCommissioner; ///< Indicates whether the session is accepted as full commissioner.
-    uint64_t   mLifetime;       ///< Milliseconds since the session was first established.
+    otSockAddr mPeerSockAddr;      ///< Socket address (IPv6 address and port number) of session peer.
+    bool       mIsConnected;       ///< Indicates whether the session is connected.
+    bool       mIsCommissioner;    ///< Indicates whether the session is accepted as full commissioner.
+    uint64_t   mLifetime;          ///< Milliseconds since the session was first established.
+    uint32_t   mHandshakeDuration; ///< Milliseconds taken by the DTLS handshake (zero if not yet connected).
+    uint32_t   mRxBytes;           ///< Number of bytes (DTLS records) received from the peer over the session.
+    uint32_t   mTxBytes;           ///< Number of bytes (DTLS records) sent to the peer over the session.
 } otBorderAgentSessionInfo;
 
 /**
@@ -163,6 +163,74 @@ const otDnsQueryConfig *otDnsClientGetDefaultConfig(otInstance *aInstance);
  */
 void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *aConfig);
 
+/**
+ * Represents the DNS client answer cache counters.
+ */
+typedef struct otDnsClientCacheCounters
+{
+    uint32_t mHits;   ///< Number of queries answered from a cached response.
+    uint32_t mMisses; ///< Number of cacheable queries sent to the server as no cached response was found.
+} otDnsClientCacheCounters;
+
+/**
+ * Enables or disables the DNS client answer cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * The cache is enabled by default. When enabled, responses are kept up to the TTL of their records (bounded by
+ * `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL`) and later queries for the same name, query type and server are
+ * answered locally. Negative responses are cached using the SOA record in the response. Disabling the cache flushes
+ * all cached responses.
+ *
+ * The cache is flushed when the DNS client is stopped (Thread interface goes down) and when the Thread partition or
+ * Extended PAN ID changes.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ * @param[in] aEnabled   TRUE to enable the cache, FALSE to disable it.
+ */
+void otDnsClientSetCacheEnabled(otInstance *aInstance, bool aEnabled);
+
+/**
+ * Indicates whether the DNS client answer cache is enabled.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ * @retval TRUE   The cache is enabled.
+ * @retval FALSE  The cache is disabled.
+ */
+bool otDnsClientIsCacheEnabled(otInstance *aInstance);
+
+/**
+ * Removes all responses from the DNS client answer cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ */
+void otDnsClientFlushCache(otInstance *aInstance);
+
+/**
+ * Gets the DNS client answer cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the cache counters.
+ */
+const otDnsClientCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the DNS client answer cache counters.
+ *
+ * Requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ */
+void otDnsClientResetCacheCounters(otInstance *aInstance);
+
 /**
  * An opaque representation of a response to an address resolution DNS query.
  *
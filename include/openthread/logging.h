@@ -123,6 +123,145 @@ otLogLevel otLoggingGetLevel(void);
  */
 otError otLoggingSetLevel(otLogLevel aLogLevel);
 
+/**
+ * Sets the log level filter of a given log module.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE=1`.
+ *
+ * Logs emitted by the module use @p aLogLevel instead of the current dynamic log level (see `otGetLogLevel()`). This
+ * allows a single module to log at a more (or less) verbose level than the rest of the stack. If the module already
+ * has a log level filter, it is updated.
+ *
+ * @param[in] aModuleName  The log module name (e.g., "Mle" or "MeshForwarder").
+ * @param[in] aLogLevel    The log level.
+ *
+ * @retval OT_ERROR_NONE          Successfully set the module log level.
+ * @retval OT_ERROR_INVALID_ARGS  @p aModuleName is empty or too long, or @p aLogLevel is invalid.
+ * @retval OT_ERROR_NO_BUFS       Already have the maximum number of module log level filters.
+ */
+otError otLoggingSetModuleLevel(const char *aModuleName, otLogLevel aLogLevel);
+
+/**
+ * Clears the log level filter of a given log module.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE=1`.
+ *
+ * @param[in] aModuleName  The log module name.
+ *
+ * @retval OT_ERROR_NONE       Successfully cleared the module log level filter.
+ * @retval OT_ERROR_NOT_FOUND  The module has no log level filter.
+ */
+otError otLoggingClearModuleLevel(const char *aModuleName);
+
+/**
+ * Clears the log level filters of all log modules.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE=1`.
+ */
+void otLoggingClearAllModuleLevels(void);
+
+/**
+ * Represents the binary log counters.
+ */
+typedef struct otLogBinaryCounters
+{
+    uint32_t mRecorded; ///< Number of log records saved in the binary log buffer.
+    uint32_t mDropped;  ///< Number of log records dropped because the binary log buffer was full.
+} otLogBinaryCounters;
+
+/**
+ * Enables or disables the binary log mode.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * When enabled, logs which pass the log level filters are not formatted and are not passed to the platform logging
+ * API. Instead each log is saved as a binary record (format string address and raw arguments) in the binary log
+ * buffer. The records can be read using `otLoggingReadBinaryRecord()` or `otLoggingReadBinaryLog()`.
+ *
+ * Disabling the binary log mode keeps the already saved records in the buffer.
+ *
+ * @param[in] aEnable  TRUE to enable the binary log mode, FALSE to disable it.
+ */
+void otLoggingSetBinaryModeEnabled(bool aEnable);
+
+/**
+ * Indicates whether or not the binary log mode is enabled.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * @retval TRUE   The binary log mode is enabled.
+ * @retval FALSE  The binary log mode is disabled.
+ */
+bool otLoggingIsBinaryModeEnabled(void);
+
+/**
+ * Reads and removes the oldest record from the binary log buffer.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * The record is intended to be passed to an offline decoder. All fields use little-endian encoding. The pointer fields
+ * use the pointer size of the device and can be mapped to strings using the firmware image. The record layout is:
+ *
+ * - `uint16_t` record length (number of bytes including this field).
+ * - `uint8_t` log level (`otLogLevel`).
+ * - `uint8_t` error (`otError`). It is not `OT_ERROR_NONE` for a "Failed to {log} - {error}" log.
+ * - `uint32_t` timestamp in milliseconds (`otPlatAlarmMilliGetNow()`).
+ * - Pointer to the log module name string.
+ * - Pointer to the format string (the format ID).
+ * - The arguments following the format string conversions:
+ *   - A `*` width or precision, or an integer or `%c` conversion without length modifier (or `hh` or `h`) is saved as
+ *     an `int`. With `l`, `ll`, `j`, `z`, or `t` length modifiers it is saved as `long`, `long long`, `intmax_t`,
+ *     `size_t`, or `ptrdiff_t`, respectively. An `hh` or `h` conversion saves the promoted `int` and a decoder must
+ *     convert it back to `char` or `short` (signed or unsigned per the conversion) before formatting it.
+ *   - A `%p` is saved as a pointer.
+ *   - A `%s` is saved as an `uint8_t` string length followed by the string chars (no null terminator). The string is
+ *     truncated to `OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_ARG_LENGTH` chars.
+ *
+ * A record can end before all conversions are saved (e.g., on an unsupported conversion or when the record reaches
+ * its maximum size).
+ *
+ * @param[out]    aBuffer   A pointer to a buffer to output the record.
+ * @param[in,out] aLength   On input, the size of @p aBuffer. On output, the length of the record.
+ *
+ * @retval OT_ERROR_NONE       Successfully read the record.
+ * @retval OT_ERROR_NOT_FOUND  The binary log buffer is empty.
+ * @retval OT_ERROR_NO_BUFS    @p aBuffer is too small. The record is not removed and @p aLength is set to its length.
+ */
+otError otLoggingReadBinaryRecord(uint8_t *aBuffer, uint16_t *aLength);
+
+/**
+ * Reads and removes the oldest record from the binary log buffer and formats it as a log string.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * The generated string starts with the record timestamp (in milliseconds) followed by the same log string which would
+ * have been emitted had the binary log mode been disabled. This function MUST be used from the same image which
+ * emitted the log since the format string and the module name are accessed from the record pointers.
+ *
+ * @param[out] aBuffer   A pointer to a buffer to output the string.
+ * @param[in]  aSize     The size of @p aBuffer (number of chars).
+ *
+ * @retval OT_ERROR_NONE       Successfully read and formatted the record. The string may be truncated.
+ * @retval OT_ERROR_NOT_FOUND  The binary log buffer is empty.
+ */
+otError otLoggingReadBinaryLog(char *aBuffer, uint16_t aSize);
+
+/**
+ * Gets the binary log counters.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ *
+ * @returns A pointer to the binary log counters.
+ */
+const otLogBinaryCounters *otLoggingGetBinaryCounters(void);
+
+/**
+ * Resets the binary log counters.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE=1`.
+ */
+void otLoggingResetBinaryCounters(void);
+
 /**
  * Emits a log message at critical log level.
  *
@@ -238,6 +238,82 @@ void otMdnsSetQuestionUnicastAllowed(otInstance *aInstance, bool aAllow);
  */
 bool otMdnsIsQuestionUnicastAllowed(otInstance *aInstance);
 
+/**
+ * Represents the mDNS counters.
+ *
+ * The counters can be used to quantify the traffic sent by the mDNS module and the traffic saved by its suppression
+ * mechanisms.
+ */
+typedef struct otMdnsCounters
+{
+    uint32_t mTxMessages;               ///< Number of mDNS messages sent (queries, probes, and responses).
+    uint32_t mTxBytes;                  ///< Number of bytes in sent mDNS messages.
+    uint32_t mKnownAnswerSuppressed;    ///< Number of answers suppressed due to known-answers in received queries.
+    uint32_t mDuplicateQuerySuppressed; ///< Number of queries suppressed due to same question from another host.
+    uint32_t mMultiPacketQueries;       ///< Number of queries sent as multi-packet with known-answer records.
+} otMdnsCounters;
+
+/**
+ * Gets the mDNS counters.
+ *
+ * @param[in]  aInstance   The OpenThread instance.
+ * @param[out] aCounters   A pointer to an `otMdnsCounters` to return the counters.
+ */
+void otMdnsGetCounters(otInstance *aInstance, otMdnsCounters *aCounters);
+
+/**
+ * Resets the mDNS counters.
+ *
+ * @param[in] aInstance   The OpenThread instance.
+ */
+void otMdnsResetCounters(otInstance *aInstance);
+
+/**
+ * Saves a snapshot of the mDNS cache.
+ *
+ * Requires `OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE`.
+ *
+ * The snapshot includes the cached PTR, SRV, TXT, and AAAA records discovered by browsers and resolvers along with
+ * their remaining TTLs. It can later be passed to `otMdnsRestoreCacheSnapshot()`, e.g., after the process running the
+ * OpenThread stack is restarted. If @p aBuffer is not large enough to contain all records, the snapshot is truncated.
+ *
+ * @param[in]     aInstance   The OpenThread instance.
+ * @param[out]    aBuffer     A pointer to a buffer to output the snapshot.
+ * @param[in,out] aLength     On input, the size of @p aBuffer. On output, the length of the snapshot.
+ *
+ * @retval OT_ERROR_NONE            Successfully saved the snapshot in @p aBuffer.
+ * @retval OT_ERROR_INVALID_STATE   mDNS module is not enabled.
+ * @retval OT_ERROR_NOT_FOUND       There is no cached record to save.
+ * @retval OT_ERROR_NO_BUFS         Could not allocate buffer to prepare the snapshot.
+ */
+otError otMdnsSaveCacheSnapshot(otInstance *aInstance, uint8_t *aBuffer, uint16_t *aLength);
+
+/**
+ * Restores the mDNS cache from a snapshot previously saved by `otMdnsSaveCacheSnapshot()`.
+ *
+ * Requires `OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE`.
+ *
+ * The TTL of every record is reduced by @p aElapsedTime, and records whose TTL is exhausted are skipped. The restored
+ * records are added as unverified entries in passive cache entries, i.e., no query is sent for them until a browser
+ * or resolver is started. They are reported to browsers and resolvers immediately, but unlike verified records they
+ * are not included as known-answers in queries and trigger initial queries when a resolver is started, so that they
+ * get revalidated.
+ *
+ * @param[in] aInstance     The OpenThread instance.
+ * @param[in] aBuffer       A pointer to a buffer containing the snapshot.
+ * @param[in] aLength       The length of the snapshot.
+ * @param[in] aElapsedTime  The time elapsed (in seconds) since the snapshot was saved.
+ *
+ * @retval OT_ERROR_NONE            Successfully restored the snapshot.
+ * @retval OT_ERROR_INVALID_STATE   mDNS module is not enabled.
+ * @retval OT_ERROR_PARSE           The snapshot is not well-formed. Records before the malformed one may be restored.
+ * @retval OT_ERROR_NO_BUFS         Could not allocate buffer to process the snapshot.
+ */
+otError otMdnsRestoreCacheSnapshot(otInstance    *aInstance,
+                                   const uint8_t *aBuffer,
+                                   uint16_t       aLength,
+                                   uint32_t       aElapsedTime);
+
 /**
  * Sets the post-registration conflict callback.
  *
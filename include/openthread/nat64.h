@@ -242,6 +242,55 @@ otError otNat64GetNextAddressMapping(otInstance                    *aInstance,
                                      otNat64AddressMappingIterator *aIterator,
                                      otNat64AddressMapping         *aMapping);
 
+/**
+ * Represents the events reported by `otNat64MappingCallback`.
+ */
+typedef enum otNat64MappingEvent
+{
+    OT_NAT64_MAPPING_EVENT_ADDED   = 0, ///< A new address mapping was created.
+    OT_NAT64_MAPPING_EVENT_REMOVED = 1, ///< An address mapping was removed (expired, evicted or translator reset).
+} otNat64MappingEvent;
+
+/**
+ * Pointer is called when a NAT64 address mapping is created or removed by the NAT64 translator.
+ *
+ * This allows a platform to mirror the mappings allocated by the translator into an external datapath (e.g., a kernel
+ * SIIT/NAT64 translator) while OpenThread remains responsible for allocating and expiring the mappings.
+ *
+ * For `OT_NAT64_MAPPING_EVENT_ADDED`, the callback returns whether the mapping was installed in the external datapath.
+ * If so, the mapping is offloaded: the outgoing IPv6 datagrams using it are no longer translated by OpenThread and are
+ * passed untranslated to the callback set by `otIp6SetReceiveCallback()`, so that the external datapath translates
+ * them. Such datagrams are still counted in the mapping and translator counters and keep the mapping alive. The
+ * incoming IPv4 datagrams are expected to be translated by the external datapath; any that are given to
+ * `otNat64Send()` are still translated by OpenThread. The return value is ignored for
+ * `OT_NAT64_MAPPING_EVENT_REMOVED`, after which the external datapath MUST no longer use the mapping.
+ *
+ * The callback is invoked synchronously, possibly while a datagram is being translated. It MUST NOT call any
+ * NAT64 API that changes the translator configuration.
+ *
+ * @param[in] aEvent    The mapping event.
+ * @param[in] aMapping  A pointer to the address mapping info. `mRemainingTimeMs` and `mCounters` are reported
+ *                      relative to the time of the event.
+ * @param[in] aContext  A pointer to application-specific context.
+ *
+ * @retval TRUE   The mapping was installed in the external datapath (offloaded).
+ * @retval FALSE  The mapping was not installed, OpenThread keeps translating its datagrams.
+ */
+typedef bool (*otNat64MappingCallback)(otNat64MappingEvent          aEvent,
+                                       const otNat64AddressMapping *aMapping,
+                                       void                        *aContext);
+
+/**
+ * Registers a callback to be notified when NAT64 address mappings are created or removed.
+ *
+ * Available when `OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aCallback   A pointer to the callback function or NULL to disable the callback.
+ * @param[in]  aContext    A pointer to application-specific context.
+ */
+void otNat64SetMappingCallback(otInstance *aInstance, otNat64MappingCallback aCallback, void *aContext);
+
 /**
  * States of NAT64.
  */
@@ -0,0 +1,148 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the OpenThread API for the packet latency tracker.
+ */
+
+#ifndef OPENTHREAD_PACKET_LATENCY_H_
+#define OPENTHREAD_PACKET_LATENCY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/error.h>
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-packet-latency
+ *
+ * @brief
+ *   This module includes functions for the packet latency tracker.
+ *
+ *   The packet latency tracker timestamps messages as they go through the transmit pipeline and aggregates the
+ *   latency of each stage, and the end-to-end latency, in histograms. The histograms are kept separately for each
+ *   message priority and for direct and indirect (to sleepy children) transmissions.
+ *
+ *   All latencies are in microseconds.
+ *
+ *   The functions in this module require `OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE` to be enabled.
+ *
+ * @{
+ */
+
+/**
+ * Number of buckets in a latency histogram.
+ *
+ * The bucket upper limits (exclusive) are 100us, 1ms, 5ms, 10ms, 50ms, 100ms and 1s. The last bucket counts the
+ * latencies of one second or longer.
+ */
+#define OT_PACKET_LATENCY_HISTOGRAM_SIZE 8
+
+/**
+ * Number of message priority levels tracked by the packet latency tracker.
+ *
+ * Priorities 0 to 2 correspond to `otMessagePriority` values. Priority 3 is used for network control messages
+ * (e.g., MLE) which are sent by OpenThread itself.
+ */
+#define OT_PACKET_LATENCY_NUM_PRIORITIES 4
+
+/**
+ * Represents a stage in the transmit pipeline.
+ */
+typedef enum otPacketLatencyStage
+{
+    OT_PACKET_LATENCY_STAGE_IP6        = 0, ///< From IPv6 layer entry to mesh forwarder send queue.
+    OT_PACKET_LATENCY_STAGE_QUEUE      = 1, ///< Waiting in send queue (or indirect queue) until the first frame.
+    OT_PACKET_LATENCY_STAGE_LOWPAN     = 2, ///< 6LoWPAN compression and fragmentation (per frame).
+    OT_PACKET_LATENCY_STAGE_MAC        = 3, ///< MAC transmission including CSMA and retries (per frame).
+    OT_PACKET_LATENCY_STAGE_END_TO_END = 4, ///< From pipeline entry to successful transmission of the last frame.
+} otPacketLatencyStage;
+
+#define OT_PACKET_LATENCY_NUM_STAGES 5 ///< Number of stages in `otPacketLatencyStage`.
+
+/**
+ * Represents the transmission mode of a message.
+ */
+typedef enum otPacketLatencyTxMode
+{
+    OT_PACKET_LATENCY_TX_MODE_DIRECT   = 0, ///< Direct transmission.
+    OT_PACKET_LATENCY_TX_MODE_INDIRECT = 1, ///< Indirect transmission (to a sleepy child).
+} otPacketLatencyTxMode;
+
+/**
+ * Represents a latency histogram.
+ */
+typedef struct otPacketLatencyHistogram
+{
+    uint32_t mCount;                                    ///< Number of recorded latencies.
+    uint32_t mMaxLatency;                               ///< The maximum latency (in usec).
+    uint64_t mTotalLatency;                             ///< The sum of all recorded latencies (in usec).
+    uint32_t mBuckets[OT_PACKET_LATENCY_HISTOGRAM_SIZE]; ///< The histogram buckets.
+} otPacketLatencyHistogram;
+
+/**
+ * Gets a latency histogram.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aStage      The pipeline stage.
+ * @param[in]  aPriority   The message priority (less than `OT_PACKET_LATENCY_NUM_PRIORITIES`).
+ * @param[in]  aTxMode     The transmission mode.
+ * @param[out] aHistogram  A pointer to output the histogram.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved the histogram.
+ * @retval OT_ERROR_INVALID_ARGS  @p aStage, @p aPriority, or @p aTxMode is not valid.
+ */
+otError otPacketLatencyGetHistogram(otInstance               *aInstance,
+                                    otPacketLatencyStage      aStage,
+                                    uint8_t                   aPriority,
+                                    otPacketLatencyTxMode     aTxMode,
+                                    otPacketLatencyHistogram *aHistogram);
+
+/**
+ * Clears all latency histograms.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ */
+void otPacketLatencyResetHistograms(otInstance *aInstance);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_PACKET_LATENCY_H_
@@ -0,0 +1,206 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the OpenThread API for the main-loop profiler.
+ */
+
+#ifndef OPENTHREAD_PROFILER_H_
+#define OPENTHREAD_PROFILER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/error.h>
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-profiler
+ *
+ * @brief
+ *   This module includes functions for the main-loop profiler.
+ *
+ *   The profiler records how often each tasklet, timer and state-changed callback handler is invoked along with its
+ *   cumulative and maximum execution time. Handlers are identified by their function address, which can be resolved
+ *   to a symbol name using the linker map or `addr2line`. The platform can also report its own handlers (by name) and
+ *   the latency of each main-loop iteration.
+ *
+ *   All times are in microseconds, measured using `otPlatTimeGet()`.
+ *
+ *   The functions in this module require `OPENTHREAD_CONFIG_PROFILER_ENABLE` to be enabled.
+ *
+ * @{
+ */
+
+#define OT_PROFILER_ITERATOR_INIT 0 ///< Value to initialize `otProfilerIterator`.
+
+typedef uint16_t otProfilerIterator; ///< Used to iterate through the profiler handler entries.
+
+/**
+ * Number of buckets in the main-loop iteration latency histogram.
+ *
+ * The bucket upper limits (exclusive) are 100us, 500us, 1ms, 5ms, 10ms, 50ms and 100ms. The last bucket counts the
+ * iterations which took 100ms or longer.
+ */
+#define OT_PROFILER_MAINLOOP_HISTOGRAM_SIZE 8
+
+/**
+ * Represents the type of a profiled handler.
+ */
+typedef enum otProfilerHandlerType
+{
+    OT_PROFILER_HANDLER_TYPE_TASKLET                = 0, ///< Tasklet handler.
+    OT_PROFILER_HANDLER_TYPE_TIMER                  = 1, ///< Timer (milli or micro) handler.
+    OT_PROFILER_HANDLER_TYPE_STATE_CHANGED_CALLBACK = 2, ///< State-changed callback (`otSetStateChangedCallback()`).
+    OT_PROFILER_HANDLER_TYPE_PLATFORM               = 3, ///< Platform handler (`otProfilerRecordPlatformHandler()`).
+} otProfilerHandlerType;
+
+/**
+ * Represents the profiling statistics of a handler.
+ */
+typedef struct otProfilerHandlerStats
+{
+    otProfilerHandlerType mType;        ///< The handler type.
+    uintptr_t             mHandler;     ///< The handler function address (or name address for platform handlers).
+    const char           *mName;        ///< The handler name for platform handlers, NULL for other types.
+    uint32_t              mInvokeCount; ///< Number of times the handler was invoked.
+    uint32_t              mMaxTime;     ///< The maximum execution time of the handler (in usec).
+    uint64_t              mTotalTime;   ///< The cumulative execution time of the handler (in usec).
+} otProfilerHandlerStats;
+
+/**
+ * Represents the main-loop iteration latency statistics.
+ */
+typedef struct otProfilerMainloopStats
+{
+    uint32_t mIterationCount;                                 ///< Number of main-loop iterations.
+    uint32_t mMaxTime;                                        ///< The maximum iteration time (in usec).
+    uint64_t mTotalTime;                                      ///< The cumulative iteration time (in usec).
+    uint32_t mHistogram[OT_PROFILER_MAINLOOP_HISTOGRAM_SIZE]; ///< Iteration time histogram.
+} otProfilerMainloopStats;
+
+/**
+ * Enables or disables recording by the profiler.
+ *
+ * Disabling the profiler does not clear the recorded statistics.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ * @param[in] aEnable    TRUE to enable, FALSE to disable.
+ */
+void otProfilerSetEnabled(otInstance *aInstance, bool aEnable);
+
+/**
+ * Indicates whether or not the profiler is recording.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ * @retval TRUE   The profiler is enabled.
+ * @retval FALSE  The profiler is disabled.
+ */
+bool otProfilerIsEnabled(otInstance *aInstance);
+
+/**
+ * Clears all the statistics recorded by the profiler.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ */
+void otProfilerReset(otInstance *aInstance);
+
+/**
+ * Gets the statistics of the next profiled handler.
+ *
+ * The entries are not sorted. The number of tracked handlers is limited by `OPENTHREAD_CONFIG_PROFILER_MAX_HANDLERS`.
+ *
+ * @param[in]     aInstance  A pointer to an OpenThread instance.
+ * @param[in,out] aIterator  A pointer to the iterator. To get the first entry, it should be set to
+ *                           OT_PROFILER_ITERATOR_INIT.
+ * @param[out]    aStats     A pointer to output the handler statistics.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the next entry.
+ * @retval OT_ERROR_NOT_FOUND  No more entries.
+ */
+otError otProfilerGetNextHandlerStats(otInstance             *aInstance,
+                                      otProfilerIterator     *aIterator,
+                                      otProfilerHandlerStats *aStats);
+
+/**
+ * Gets the number of handler invocations which were not recorded since the handler table was full.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The number of dropped handler invocations.
+ */
+uint32_t otProfilerGetDroppedCount(otInstance *aInstance);
+
+/**
+ * Gets the main-loop iteration latency statistics.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[out] aStats     A pointer to output the main-loop statistics.
+ */
+void otProfilerGetMainloopStats(otInstance *aInstance, otProfilerMainloopStats *aStats);
+
+/**
+ * Records an invocation of a platform handler.
+ *
+ * Is intended to be called by the platform to profile its own main-loop handlers (e.g., radio or netif processing).
+ * The handler is identified by the @p aName pointer (not by the string content), so @p aName MUST point to a string
+ * with static storage duration. Does nothing if the profiler is disabled.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ * @param[in] aName      The handler name.
+ * @param[in] aDuration  The execution time of the handler (in usec).
+ */
+void otProfilerRecordPlatformHandler(otInstance *aInstance, const char *aName, uint32_t aDuration);
+
+/**
+ * Records the latency of one main-loop iteration.
+ *
+ * Is intended to be called by the platform, once per iteration, with the time spent processing events (i.e.,
+ * excluding the time blocked waiting for events). Does nothing if the profiler is disabled.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ * @param[in] aDuration  The iteration processing time (in usec).
+ */
+void otProfilerRecordMainloopIteration(otInstance *aInstance, uint32_t aDuration);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_PROFILER_H_
@@ -144,6 +144,9 @@ typedef struct otSrpClientCounters
     uint32_t mHostAndServicesRemoves; ///< Number of times the host and all services were removed (notifies server).
     uint32_t mHostAndServicesClears;  ///< Number of times the host and all services were cleared (local-only).
     uint32_t mTxTotalBytes;           ///< Cumulative UDP payload bytes of transmitted SRP messages.
+    uint32_t mTxPartialUpdates;       ///< Number of transmitted updates carrying a subset of services (over MTU).
+    uint32_t mTxSkippedServices;      ///< Cumulative number of unchanged services left out of transmitted updates.
+    uint32_t mTxEstimatedFrames;      ///< Estimated cumulative number of 15.4 frames (fragments) of tx updates.
 } otSrpClientCounters;
 
 /**
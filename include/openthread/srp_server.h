@@ -142,6 +142,22 @@ typedef struct otSrpServerResponseCounters
     uint32_t mOther;         ///< The number of other responses.
 } otSrpServerResponseCounters;
 
+/**
+ * Includes the statistics of SRP update processing on the SRP server.
+ *
+ * An SRP update is pending after it is validated and until it is committed, i.e., while it is being processed by the
+ * service update handler or the Advertising Proxy.
+ */
+typedef struct otSrpServerUpdateStats
+{
+    uint32_t mNumRejectedBusy; ///< The number of updates rejected since too many updates were pending.
+    uint32_t mMaxLatency;      ///< The max latency (in msec) from receiving an update to committing it.
+    uint32_t mAvgLatency;      ///< The moving average latency (in msec) from receiving an update to committing it.
+    uint32_t mNumLeaseRuns;    ///< The number of times lease expirations were processed (lease timer runs).
+    uint16_t mNumPending;      ///< The current number of pending updates.
+    uint16_t mMaxNumPending;   ///< The max number of pending updates.
+} otSrpServerUpdateStats;
+
 /**
  * Returns the domain authorized to the SRP server.
  *
@@ -374,6 +390,39 @@ void otSrpServerGetLeaseConfig(otInstance *aInstance, otSrpServerLeaseConfig *aL
  */
 otError otSrpServerSetLeaseConfig(otInstance *aInstance, const otSrpServerLeaseConfig *aLeaseConfig);
 
+/**
+ * Gets the SRP server refresh window interval.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The refresh window interval in seconds. Zero indicates refresh windows are disabled.
+ */
+uint32_t otSrpServerGetRefreshWindow(otInstance *aInstance);
+
+/**
+ * Sets the SRP server refresh window interval.
+ *
+ * When non-zero, time is divided into consecutive refresh windows. Lease expirations are processed in batches at the
+ * start of each window, and the server includes a Refresh Window Option (using an EDNS(0) option code from the
+ * Local/Experimental Use range) in its SRP update responses as a hint for clients to align their lease refreshes to
+ * the windows. Clients that do not support the option ignore it.
+ *
+ * The interval should be small compared to the granted lease intervals since a lease may be refreshed up to one
+ * window earlier and expire up to one window later.
+ *
+ * Changing the interval restarts the windows from the current time and reschedules the lease expiration processing.
+ * Setting the current interval again has no effect.
+ *
+ * The default value is given by `OPENTHREAD_CONFIG_SRP_SERVER_DEFAULT_REFRESH_WINDOW`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aWindow    The refresh window interval in seconds. Zero to disable.
+ *
+ * @retval  OT_ERROR_NONE          Successfully set the refresh window interval.
+ * @retval  OT_ERROR_INVALID_ARGS  The @p aWindow is too long.
+ */
+otError otSrpServerSetRefreshWindow(otInstance *aInstance, uint32_t aWindow);
+
 /**
  * Handles SRP service updates.
  *
@@ -456,6 +505,18 @@ const otSrpServerHost *otSrpServerGetNextHost(otInstance *aInstance, const otSrp
  */
 const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aInstance);
 
+/**
+ * Gets the SRP update processing statistics of the SRP server.
+ *
+ * The number of pending SRP updates is limited by `OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES`. When the limit
+ * is reached, new SRP updates are rejected with a server failure response code, which causes SRP clients to retry
+ * after a back-off interval.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[out] aStats     A pointer to an `otSrpServerUpdateStats` to output the statistics.
+ */
+void otSrpServerGetUpdateStats(otInstance *aInstance, otSrpServerUpdateStats *aStats);
+
 /**
  * Tells if the SRP service host has been deleted.
  *
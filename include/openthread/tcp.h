@@ -223,7 +223,7 @@ typedef void (*otTcpDisconnected)(otTcpEndpoint *aEndpoint, otTcpDisconnectedRea
  * implementation.
  */
 #define OT_TCP_ENDPOINT_TCB_SIZE_BASE 392
-#define OT_TCP_ENDPOINT_TCB_NUM_PTR 36
+#define OT_TCP_ENDPOINT_TCB_NUM_PTR 38
 
 /**
  * Represents a TCP endpoint.
@@ -258,7 +258,13 @@ struct otTcpEndpoint
     otLinkedBuffer mReceiveLinks[2];
     otSockAddr     mSockAddr;
 
+    uint32_t mDataSegmentsSent;
+    uint32_t mDataSegmentsRetransmitted;
+
     uint8_t mPendingCallbacks;
+    uint8_t mQueuedSegments;
+    bool    mPacingEnabled;
+    bool    mOutputPaced;
 };
 
 /**
@@ -559,6 +565,72 @@ otError otTcpAbort(otTcpEndpoint *aEndpoint);
  */
 otError otTcpEndpointDeinitialize(otTcpEndpoint *aEndpoint);
 
+/**
+ * Defines the congestion control algorithms of a TCP endpoint.
+ */
+typedef enum otTcpCongestionControl
+{
+    OT_TCP_CONGESTION_CONTROL_NEW_RENO = 0, ///< Loss-based New Reno (default).
+    OT_TCP_CONGESTION_CONTROL_VEGAS    = 1, ///< Delay-based, adjusts the window to the queueing delay along the path.
+} otTcpCongestionControl;
+
+/**
+ * Sets the congestion control algorithm of a TCP endpoint.
+ *
+ * New Reno reacts to segment losses only. On multi-hop paths with lossy links
+ * it tends to fill the forwarding queues along the path and to shrink its
+ * window on losses that are not caused by congestion. The delay-based
+ * algorithm instead keeps the number of segments queued along the path small,
+ * based on the increase of the round-trip time over the lowest one observed.
+ * Both algorithms use the same (SACK-based) loss recovery.
+ *
+ * The algorithm may be changed at any time, including while a connection is
+ * established, and is kept when the connection is closed or aborted.
+ *
+ * @param[in]  aEndpoint           A pointer to the TCP endpoint.
+ * @param[in]  aCongestionControl  The congestion control algorithm.
+ *
+ * @retval OT_ERROR_NONE           Successfully set the congestion control algorithm.
+ * @retval OT_ERROR_INVALID_ARGS   @p aCongestionControl is not valid.
+ */
+otError otTcpSetCongestionControl(otTcpEndpoint *aEndpoint, otTcpCongestionControl aCongestionControl);
+
+/**
+ * Gets the congestion control algorithm of a TCP endpoint.
+ *
+ * @param[in]  aEndpoint  A pointer to the TCP endpoint.
+ *
+ * @returns The congestion control algorithm of @p aEndpoint.
+ */
+otTcpCongestionControl otTcpGetCongestionControl(const otTcpEndpoint *aEndpoint);
+
+/**
+ * Enables or disables pacing of a TCP endpoint.
+ *
+ * When pacing is enabled, new data is only handed to the IPv6 layer while
+ * fewer than `OPENTHREAD_CONFIG_TCP_PACING_MAX_QUEUED_SEGMENTS` data segments
+ * of this endpoint are waiting to be transmitted by this device. This keeps a
+ * large congestion window from being sent as a single burst, which would
+ * otherwise fill the send queue and delay other traffic. Retransmissions are
+ * never held back.
+ *
+ * Pacing is disabled by default.
+ *
+ * @param[in]  aEndpoint  A pointer to the TCP endpoint.
+ * @param[in]  aEnable    TRUE to enable pacing, FALSE to disable it.
+ */
+void otTcpSetPacingEnabled(otTcpEndpoint *aEndpoint, bool aEnable);
+
+/**
+ * Indicates whether pacing is enabled on a TCP endpoint.
+ *
+ * @param[in]  aEndpoint  A pointer to the TCP endpoint.
+ *
+ * @retval TRUE   Pacing is enabled.
+ * @retval FALSE  Pacing is disabled.
+ */
+bool otTcpIsPacingEnabled(const otTcpEndpoint *aEndpoint);
+
 typedef struct otTcpListener otTcpListener;
 
 /**
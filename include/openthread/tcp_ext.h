@@ -72,7 +72,9 @@ extern "C" {
  * attached to an otTcpEndpoint, the application should not call
  * otTcpSendByReference() or otTcpSendByExtension() on that otTcpEndpoint.
  * Instead, the application should use otTcpCircularSendBufferWrite() to add
- * data to the send buffer.
+ * data to the send buffer, or, to avoid copying the data, produce it directly
+ * into the send buffer using otTcpCircularSendBufferGetWritableSpan() and
+ * otTcpCircularSendBufferCommit().
  *
  * The otTcpForwardProgress() callback is the intended way for users to learn
  * when space becomes available in the circular send buffer. On an
@@ -109,7 +111,7 @@ typedef struct otTcpCircularSendBuffer
 void otTcpCircularSendBufferInitialize(otTcpCircularSendBuffer *aSendBuffer, void *aDataBuffer, size_t aCapacity);
 
 /**
- * Defines flags passed to @p otTcpCircularSendBufferWrite.
+ * Defines flags passed to @p otTcpCircularSendBufferWrite and @p otTcpCircularSendBufferCommit.
  */
 enum
 {
@@ -157,6 +159,50 @@ otError otTcpCircularSendBufferWrite(otTcpEndpoint           *aEndpoint,
                                      size_t                  *aWritten,
                                      uint32_t                 aFlags);
 
+/**
+ * Gets the contiguous free space at the tail of a TCP circular send buffer.
+ *
+ * Together with otTcpCircularSendBufferCommit(), this allows the application
+ * to produce data directly in the send buffer (e.g., reading a file from
+ * flash storage into it), rather than into a separate buffer that is then
+ * copied by otTcpCircularSendBufferWrite().
+ *
+ * The returned span may be shorter than the free space in the send buffer,
+ * if the free space wraps around the end of the underlying memory. After the
+ * data in the span is committed, calling this function again returns the
+ * remaining free space.
+ *
+ * This operation will always succeed.
+ *
+ * @param[in]   aSendBuffer  A pointer to the TCP circular send buffer.
+ * @param[out]  aData        Populated with a pointer to the start of the free space.
+ * @param[out]  aLength      Populated with the length of the contiguous free space at @p aData.
+ */
+void otTcpCircularSendBufferGetWritableSpan(otTcpCircularSendBuffer *aSendBuffer, uint8_t **aData, size_t *aLength);
+
+/**
+ * Sends out data which the application has placed in a TCP circular send
+ * buffer.
+ *
+ * The data MUST have been written, in order, starting at the pointer returned
+ * by otTcpCircularSendBufferGetWritableSpan(). Like
+ * otTcpCircularSendBufferWrite(), this attaches @p aSendBuffer and
+ * @p aEndpoint to each other.
+ *
+ * @param[in]  aEndpoint    The TCP endpoint on which to send out data.
+ * @param[in]  aSendBuffer  The TCP circular send buffer containing the data.
+ * @param[in]  aLength      The length of the data to send out.
+ * @param[in]  aFlags       Flags specifying options for this operation (see enumeration above).
+ *
+ * @retval OT_ERROR_NONE          Successfully sent out the data on the TCP endpoint.
+ * @retval OT_ERROR_INVALID_ARGS  @p aLength exceeds the free space in the send buffer.
+ * @retval OT_ERROR_FAILED        Failed to send out data on the TCP endpoint.
+ */
+otError otTcpCircularSendBufferCommit(otTcpEndpoint           *aEndpoint,
+                                      otTcpCircularSendBuffer *aSendBuffer,
+                                      size_t                   aLength,
+                                      uint32_t                 aFlags);
+
 /**
  * Performs circular-send-buffer-specific handling in the otTcpForwardProgress
  * callback.
@@ -2173,6 +2173,7 @@ void Interpreter::OutputBorderRouterCounters(void)
     OutputLine("RA Rx: %lu", ToUlong(brCounters->mRaRx));
     OutputLine("RA TxSuccess: %lu", ToUlong(brCounters->mRaTxSuccess));
     OutputLine("RA TxFailed: %lu", ToUlong(brCounters->mRaTxFailure));
+    OutputLine("RA TxSuppressed: %lu", ToUlong(brCounters->mRaTxSuppressed));
     OutputLine("RS Rx: %lu", ToUlong(brCounters->mRsRx));
     OutputLine("RS TxSuccess: %lu", ToUlong(brCounters->mRsTxSuccess));
     OutputLine("RS TxFailed: %lu", ToUlong(brCounters->mRsTxFailure));
@@ -2216,6 +2217,7 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
      * RA Rx: 4
      * RA TxSuccess: 2
      * RA TxFailed: 0
+     * RA TxSuppressed: 0
      * RS Rx: 0
      * RS TxSuccess: 2
      * RS TxFailed: 0
@@ -5321,6 +5323,187 @@ exit:
 template <> otError Interpreter::Process<Cmd("ping")>(Arg aArgs[]) { return mPing.Process(aArgs); }
 #endif // OPENTHREAD_CONFIG_PING_SENDER_ENABLE
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+template <> otError Interpreter::Process<Cmd("pktlatency")>(Arg aArgs[])
+{
+    static const char *const kStageStrings[] = {
+        "ip6",    // (0) OT_PACKET_LATENCY_STAGE_IP6
+        "queue",  // (1) OT_PACKET_LATENCY_STAGE_QUEUE
+        "lowpan", // (2) OT_PACKET_LATENCY_STAGE_LOWPAN
+        "mac",    // (3) OT_PACKET_LATENCY_STAGE_MAC
+        "e2e",    // (4) OT_PACKET_LATENCY_STAGE_END_TO_END
+    };
+
+    static const char *const kTxModeStrings[] = {
+        "direct",   // (0) OT_PACKET_LATENCY_TX_MODE_DIRECT
+        "indirect", // (1) OT_PACKET_LATENCY_TX_MODE_INDIRECT
+    };
+
+    static_assert(0 == OT_PACKET_LATENCY_STAGE_IP6, "STAGE_IP6 value is incorrect");
+    static_assert(1 == OT_PACKET_LATENCY_STAGE_QUEUE, "STAGE_QUEUE value is incorrect");
+    static_assert(2 == OT_PACKET_LATENCY_STAGE_LOWPAN, "STAGE_LOWPAN value is incorrect");
+    static_assert(3 == OT_PACKET_LATENCY_STAGE_MAC, "STAGE_MAC value is incorrect");
+    static_assert(4 == OT_PACKET_LATENCY_STAGE_END_TO_END, "STAGE_END_TO_END value is incorrect");
+    static_assert(GetArrayLength(kStageStrings) == OT_PACKET_LATENCY_NUM_STAGES, "kStageStrings is incorrect");
+    static_assert(0 == OT_PACKET_LATENCY_TX_MODE_DIRECT, "TX_MODE_DIRECT value is incorrect");
+    static_assert(1 == OT_PACKET_LATENCY_TX_MODE_INDIRECT, "TX_MODE_INDIRECT value is incorrect");
+
+    otError                  error = OT_ERROR_NONE;
+    otPacketLatencyHistogram histogram;
+
+    /**
+     * @cli pktlatency
+     * @code
+     * pktlatency
+     * | Stage  | Prio | Mode     | Count      | Avg(us)    | Max(us)    |
+     * +--------+------+----------+------------+------------+------------+
+     * | ip6    |    1 | direct   |         12 |         31 |         63 |
+     * | queue  |    1 | direct   |         12 |        842 |       4107 |
+     * | lowpan |    1 | direct   |         14 |         22 |         40 |
+     * | mac    |    1 | direct   |         14 |       2981 |       9876 |
+     * | e2e    |    1 | direct   |         12 |       4218 |      14032 |
+     * Done
+     * @endcode
+     * @par
+     * Outputs a summary of all the non-empty packet latency histograms, per pipeline stage, message priority and tx
+     * mode. The `lowpan` and `mac` stages are recorded per frame, the other stages per message.
+     * @sa otPacketLatencyGetHistogram
+     */
+    if (aArgs[0].IsEmpty())
+    {
+        static const char *const kTitles[]       = {"Stage", "Prio", "Mode", "Count", "Avg(us)", "Max(us)"};
+        static const uint8_t     kColumnWidths[] = {8, 6, 10, 12, 12, 12};
+
+        OutputTableHeader(kTitles, kColumnWidths);
+
+        for (uint8_t stage = 0; stage < OT_PACKET_LATENCY_NUM_STAGES; stage++)
+        {
+            for (uint8_t prio = 0; prio < OT_PACKET_LATENCY_NUM_PRIORITIES; prio++)
+            {
+                for (uint8_t mode = 0; mode < GetArrayLength(kTxModeStrings); mode++)
+                {
+                    SuccessOrExit(error = otPacketLatencyGetHistogram(
+                                      GetInstancePtr(), static_cast<otPacketLatencyStage>(stage), prio,
+                                      static_cast<otPacketLatencyTxMode>(mode), &histogram));
+
+                    if (histogram.mCount == 0)
+                    {
+                        continue;
+                    }
+
+                    OutputLine("| %-6s | %4u | %-8s | %10lu | %10lu | %10lu |", kStageStrings[stage], prio,
+                               kTxModeStrings[mode], ToUlong(histogram.mCount),
+                               ToUlong(static_cast<uint32_t>(histogram.mTotalLatency / histogram.mCount)),
+                               ToUlong(histogram.mMaxLatency));
+                }
+            }
+        }
+    }
+    /**
+     * @cli pktlatency histogram
+     * @code
+     * pktlatency histogram e2e 1 direct
+     * Count: 12
+     * Total: 50616 us
+     * Max: 14032 us
+     * Avg: 4218 us
+     * Histogram:
+     *     < 100us: 0
+     *     < 1ms: 2
+     *     < 5ms: 7
+     *     < 10ms: 2
+     *     < 50ms: 1
+     *     < 100ms: 0
+     *     < 1s: 0
+     *     >= 1s: 0
+     * Done
+     * @endcode
+     * @cparam pktlatency histogram @ca{stage} @ca{priority} @ca{direct|indirect}
+     * * `stage`: `ip6`, `queue`, `lowpan`, `mac`, or `e2e`.
+     * * `priority`: Message priority `0` (low) to `3` (network control).
+     * @par
+     * Outputs a single packet latency histogram.
+     * @sa otPacketLatencyGetHistogram
+     */
+    else if (aArgs[0] == "histogram")
+    {
+        static const char *const kBucketNames[] = {
+            "< 100us", "< 1ms", "< 5ms", "< 10ms", "< 50ms", "< 100ms", "< 1s", ">= 1s",
+        };
+
+        static_assert(GetArrayLength(kBucketNames) == OT_PACKET_LATENCY_HISTOGRAM_SIZE,
+                      "kBucketNames does not match OT_PACKET_LATENCY_HISTOGRAM_SIZE");
+
+        uint8_t            stage;
+        uint8_t            prio;
+        uint8_t            mode;
+        Uint64StringBuffer u64StringBuffer;
+
+        for (stage = 0; stage < OT_PACKET_LATENCY_NUM_STAGES; stage++)
+        {
+            if (aArgs[1] == kStageStrings[stage])
+            {
+                break;
+            }
+        }
+
+        SuccessOrExit(error = aArgs[2].ParseAsUint8(prio));
+
+        if (aArgs[3] == "direct")
+        {
+            mode = OT_PACKET_LATENCY_TX_MODE_DIRECT;
+        }
+        else if (aArgs[3] == "indirect")
+        {
+            mode = OT_PACKET_LATENCY_TX_MODE_INDIRECT;
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+
+        VerifyOrExit(aArgs[4].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+        SuccessOrExit(error = otPacketLatencyGetHistogram(GetInstancePtr(), static_cast<otPacketLatencyStage>(stage),
+                                                          prio, static_cast<otPacketLatencyTxMode>(mode), &histogram));
+
+        OutputLine("Count: %lu", ToUlong(histogram.mCount));
+        OutputLine("Total: %s us", Uint64ToString(histogram.mTotalLatency, u64StringBuffer));
+        OutputLine("Max: %lu us", ToUlong(histogram.mMaxLatency));
+        OutputLine("Avg: %lu us", ToUlong((histogram.mCount == 0)
+                                              ? 0
+                                              : static_cast<uint32_t>(histogram.mTotalLatency / histogram.mCount)));
+        OutputLine("Histogram:");
+
+        for (uint8_t i = 0; i < OT_PACKET_LATENCY_HISTOGRAM_SIZE; i++)
+        {
+            OutputLine(kIndentSize, "%s: %lu", kBucketNames[i], ToUlong(histogram.mBuckets[i]));
+        }
+    }
+    /**
+     * @cli pktlatency reset
+     * @code
+     * pktlatency reset
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otPacketLatencyResetHistograms
+     */
+    else if (aArgs[0] == "reset")
+    {
+        VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+        otPacketLatencyResetHistograms(GetInstancePtr());
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_COMMAND;
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+
 /**
  * @cli platform
  * @code
@@ -5542,6 +5725,168 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
 
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+template <> otError Interpreter::Process<Cmd("profiler")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    /**
+     * @cli profiler (enable,disable)
+     * @code
+     * profiler
+     * Disabled
+     * Done
+     * @endcode
+     * @code
+     * profiler enable
+     * Done
+     * @endcode
+     * @cparam profiler @ca{enable|disable}
+     * @sa otProfilerIsEnabled
+     * @sa otProfilerSetEnabled
+     */
+    if (ProcessEnableDisable(aArgs, otProfilerIsEnabled, otProfilerSetEnabled) == OT_ERROR_NONE)
+    {
+    }
+    /**
+     * @cli profiler reset
+     * @code
+     * profiler reset
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otProfilerReset
+     */
+    else if (aArgs[0] == "reset")
+    {
+        otProfilerReset(GetInstancePtr());
+    }
+    /**
+     * @cli profiler handlers
+     * @code
+     * profiler handlers
+     * | Type     | Handler            | Count      | Total(us)            | Max(us)    | Avg(us)    |
+     * +----------+--------------------+------------+----------------------+------------+------------+
+     * | tasklet  |         0x55d4a0c8 |        112 |                 4021 |        212 |         35 |
+     * | timer    |         0x55d49e10 |         48 |                 1830 |         97 |         38 |
+     * | platform | radio              |        903 |                 7710 |        410 |          8 |
+     * Dropped: 0
+     * Done
+     * @endcode
+     * @par
+     * Outputs the per-handler statistics recorded by the profiler. The handler address can be resolved to a function
+     * name using the linker map or `addr2line`.
+     * @sa otProfilerGetNextHandlerStats
+     * @sa otProfilerGetDroppedCount
+     */
+    else if (aArgs[0] == "handlers")
+    {
+        static const char *const kTitles[]       = {"Type", "Handler", "Count", "Total(us)", "Max(us)", "Avg(us)"};
+        static const uint8_t     kColumnWidths[] = {10, 20, 12, 22, 12, 12};
+
+        static const char *const kTypeStrings[] = {
+            "tasklet",  // (0) OT_PROFILER_HANDLER_TYPE_TASKLET
+            "timer",    // (1) OT_PROFILER_HANDLER_TYPE_TIMER
+            "callback", // (2) OT_PROFILER_HANDLER_TYPE_STATE_CHANGED_CALLBACK
+            "platform", // (3) OT_PROFILER_HANDLER_TYPE_PLATFORM
+        };
+
+        static_assert(0 == OT_PROFILER_HANDLER_TYPE_TASKLET, "TYPE_TASKLET value is incorrect");
+        static_assert(1 == OT_PROFILER_HANDLER_TYPE_TIMER, "TYPE_TIMER value is incorrect");
+        static_assert(2 == OT_PROFILER_HANDLER_TYPE_STATE_CHANGED_CALLBACK, "TYPE_STATE_CHANGED_CALLBACK is incorrect");
+        static_assert(3 == OT_PROFILER_HANDLER_TYPE_PLATFORM, "TYPE_PLATFORM value is incorrect");
+
+        otProfilerIterator     iterator = OT_PROFILER_ITERATOR_INIT;
+        otProfilerHandlerStats stats;
+        Uint64StringBuffer     u64StringBuffer;
+
+        VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+        OutputTableHeader(kTitles, kColumnWidths);
+
+        while (otProfilerGetNextHandlerStats(GetInstancePtr(), &iterator, &stats) == OT_ERROR_NONE)
+        {
+            OutputFormat("| %-8s ", Stringify(stats.mType, kTypeStrings));
+
+            if (stats.mName != nullptr)
+            {
+                OutputFormat("| %-18s ", stats.mName);
+            }
+            else
+            {
+                OutputFormat("| %#18lx ", static_cast<unsigned long>(stats.mHandler));
+            }
+
+            OutputFormat("| %10lu ", ToUlong(stats.mInvokeCount));
+            OutputFormat("| %20s ", Uint64ToString(stats.mTotalTime, u64StringBuffer));
+            OutputLine("| %10lu | %10lu |", ToUlong(stats.mMaxTime),
+                       ToUlong(static_cast<uint32_t>(stats.mTotalTime / stats.mInvokeCount)));
+        }
+
+        OutputLine("Dropped: %lu", ToUlong(otProfilerGetDroppedCount(GetInstancePtr())));
+    }
+    /**
+     * @cli profiler mainloop
+     * @code
+     * profiler mainloop
+     * Iterations: 1503
+     * Total: 98211 us
+     * Max: 12873 us
+     * Avg: 65 us
+     * Histogram:
+     *     < 100us: 1311
+     *     < 500us: 160
+     *     < 1ms: 20
+     *     < 5ms: 9
+     *     < 10ms: 2
+     *     < 50ms: 1
+     *     < 100ms: 0
+     *     >= 100ms: 0
+     * Done
+     * @endcode
+     * @par
+     * Outputs the main-loop iteration latency statistics. The iterations are reported by the platform.
+     * @sa otProfilerGetMainloopStats
+     */
+    else if (aArgs[0] == "mainloop")
+    {
+        static const char *const kBucketNames[] = {
+            "< 100us", "< 500us", "< 1ms", "< 5ms", "< 10ms", "< 50ms", "< 100ms", ">= 100ms",
+        };
+
+        static_assert(GetArrayLength(kBucketNames) == OT_PROFILER_MAINLOOP_HISTOGRAM_SIZE,
+                      "kBucketNames does not match OT_PROFILER_MAINLOOP_HISTOGRAM_SIZE");
+
+        otProfilerMainloopStats stats;
+        Uint64StringBuffer      u64StringBuffer;
+
+        VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+        otProfilerGetMainloopStats(GetInstancePtr(), &stats);
+
+        OutputLine("Iterations: %lu", ToUlong(stats.mIterationCount));
+        OutputLine("Total: %s us", Uint64ToString(stats.mTotalTime, u64StringBuffer));
+        OutputLine("Max: %lu us", ToUlong(stats.mMaxTime));
+        OutputLine("Avg: %lu us", ToUlong((stats.mIterationCount == 0)
+                                              ? 0
+                                              : static_cast<uint32_t>(stats.mTotalTime / stats.mIterationCount)));
+        OutputLine("Histogram:");
+
+        for (uint8_t i = 0; i < OT_PROFILER_MAINLOOP_HISTOGRAM_SIZE; i++)
+        {
+            OutputLine(kIndentSize, "%s: %lu", kBucketNames[i], ToUlong(stats.mHistogram[i]));
+        }
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_COMMAND;
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_PROFILER_ENABLE
+
 /**
  * @cli preferrouterid
  * @code
@@ -8698,6 +9043,9 @@ otError Interpreter::ProcessCommand(Arg aArgs[])
 #endif
 #if OPENTHREAD_CONFIG_PING_SENDER_ENABLE
         CmdEntry("ping"),
+#endif
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+        CmdEntry("pktlatency"),
 #endif
         CmdEntry("platform"),
 #if OPENTHREAD_CONFIG_PLATFORM_TCP_ENABLE && OPENTHREAD_CONFIG_CLI_PLAT_TCP_ENABLE
@@ -8709,6 +9057,9 @@ otError Interpreter::ProcessCommand(Arg aArgs[])
 #endif
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
         CmdEntry("prefix"),
+#endif
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+        CmdEntry("profiler"),
 #endif
         CmdEntry("promiscuous"),
 #if OPENTHREAD_FTD
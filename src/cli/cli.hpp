@@ -49,7 +49,9 @@
 #include <openthread/link.h>
 #include <openthread/logging.h>
 #include <openthread/netdata.h>
+#include <openthread/packet_latency.h>
 #include <openthread/ping_sender.h>
+#include <openthread/profiler.h>
 #include <openthread/sntp.h>
 #include <openthread/tcp.h>
 #include <openthread/thread.h>
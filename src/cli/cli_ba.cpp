@@ -153,7 +153,7 @@ exit:
  * @cli ba sessions
  * @code
  * ba sessions
- * [fe80:0:0:0:cc79:2a29:d311:1aea]:9202 connected:yes commissioner:no lifetime:1860
+ * [fe80:0:0:0:cc79:2a29:d311:1aea]:9202 connected:yes commissioner:no lifetime:1860 handshake:412 rx:1127 tx:1395
  * Done
  * @endcode
  * @par
@@ -162,6 +162,8 @@ exit:
  * * Whether or not the session is connected.
  * * Whether or not the session is accepted as full commissioner.
  * * Session lifetime in milliseconds (calculated from the time the session was first established).
+ * * DTLS handshake duration in milliseconds (zero if not yet connected).
+ * * Number of bytes (DTLS records) received from and sent to the peer.
  */
 template <> otError Ba::Process<Cmd("sessions")>(Arg aArgs[])
 {
@@ -179,8 +181,10 @@ template <> otError Ba::Process<Cmd("sessions")>(Arg aArgs[])
     {
         otIp6SockAddrToString(&info.mPeerSockAddr, sockAddrString, sizeof(sockAddrString));
 
-        OutputLine("%s connected:%s commissioner:%s lifetime:%s", sockAddrString, ToYesNo(info.mIsConnected),
-                   ToYesNo(info.mIsCommissioner), Uint64ToString(info.mLifetime, lifetimeString));
+        OutputLine("%s connected:%s commissioner:%s lifetime:%s handshake:%lu rx:%lu tx:%lu", sockAddrString,
+                   ToYesNo(info.mIsConnected), ToYesNo(info.mIsCommissioner),
+                   Uint64ToString(info.mLifetime, lifetimeString), ToUlong(info.mHandshakeDuration),
+                   ToUlong(info.mRxBytes), ToUlong(info.mTxBytes));
     }
 exit:
     return error;
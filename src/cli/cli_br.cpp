@@ -1186,6 +1186,7 @@ exit:
  * RA Rx: 4
  * RA TxSuccess: 2
  * RA TxFailed: 0
+ * RA TxSuppressed: 0
  * RS Rx: 0
  * RS TxSuccess: 2
  * RS TxFailed: 0
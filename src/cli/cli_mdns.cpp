@@ -74,6 +74,34 @@ exit:
     return error;
 }
 
+template <> otError Mdns::Process<Cmd("counters")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aArgs[0].IsEmpty())
+    {
+        otMdnsCounters counters;
+
+        otMdnsGetCounters(GetInstancePtr(), &counters);
+
+        OutputLine("TxMessages: %lu", ToUlong(counters.mTxMessages));
+        OutputLine("TxBytes: %lu", ToUlong(counters.mTxBytes));
+        OutputLine("KnownAnswerSuppressed: %lu", ToUlong(counters.mKnownAnswerSuppressed));
+        OutputLine("DuplicateQuerySuppressed: %lu", ToUlong(counters.mDuplicateQuerySuppressed));
+        OutputLine("MultiPacketQueries: %lu", ToUlong(counters.mMultiPacketQueries));
+    }
+    else if ((aArgs[0] == "reset") && aArgs[1].IsEmpty())
+    {
+        otMdnsResetCounters(GetInstancePtr());
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+
 template <> otError Mdns::Process<Cmd("disable")>(Arg aArgs[])
 {
     otError error = OT_ERROR_NONE;
@@ -1274,6 +1302,7 @@ otError Mdns::Process(Arg aArgs[])
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
         CmdEntry("browsers"),
 #endif
+        CmdEntry("counters"),
         CmdEntry("disable"),
         CmdEntry("enable"),
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
@@ -242,6 +242,9 @@ template <> otError SrpClient::Process<Cmd("counters")>(Arg aArgs[])
             {&otSrpClientCounters::mHostAndServicesRemoves, "Host And Services Removes"},
             {&otSrpClientCounters::mHostAndServicesClears, "Host And Services Clears"},
             {&otSrpClientCounters::mTxTotalBytes, "Tx Total Bytes"},
+            {&otSrpClientCounters::mTxPartialUpdates, "Tx Partial Updates"},
+            {&otSrpClientCounters::mTxSkippedServices, "Tx Skipped Services"},
+            {&otSrpClientCounters::mTxEstimatedFrames, "Tx Estimated Frames"},
         };
 
         static const TimeCounterEntry kTimeCounters[] = {
@@ -584,6 +584,28 @@ exit:
  */
 template <> otError SrpServer::Process<Cmd("port")>(Arg aArgs[]) { return ProcessGet(aArgs, otSrpServerGetPort); }
 
+/**
+ * @cli srp server refreshwindow (get,set)
+ * @code
+ * srp server refreshwindow 60
+ * Done
+ * @endcode
+ * @code
+ * srp server refreshwindow
+ * 60
+ * Done
+ * @endcode
+ * @cparam srp server refreshwindow [@ca{window}]
+ * @par
+ * Gets or sets the refresh window in seconds (zero disables it).
+ * @sa otSrpServerGetRefreshWindow
+ * @sa otSrpServerSetRefreshWindow
+ */
+template <> otError SrpServer::Process<Cmd("refreshwindow")>(Arg aArgs[])
+{
+    return ProcessGetSet(aArgs, otSrpServerGetRefreshWindow, otSrpServerSetRefreshWindow);
+}
+
 /**
  * @cli srp server seqnum (get,set)
  * @code
@@ -621,8 +643,8 @@ otError SrpServer::Process(Arg aArgs[])
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
         CmdEntry("faststart"),
 #endif
-        CmdEntry("host"),      CmdEntry("lease"),  CmdEntry("port"),   CmdEntry("seqnum"),
-        CmdEntry("service"),   CmdEntry("state"),  CmdEntry("ttl"),
+        CmdEntry("host"),      CmdEntry("lease"),   CmdEntry("port"),  CmdEntry("refreshwindow"),
+        CmdEntry("seqnum"),    CmdEntry("service"), CmdEntry("state"), CmdEntry("ttl"),
     };
 
     static_assert(BinarySearch::IsSorted(kCommands), "kCommands is not sorted");
@@ -460,6 +460,46 @@ exit:
     return error;
 }
 
+/**
+ * @cli tcp pacing
+ * @code
+ * tcp pacing enable
+ * Done
+ * @endcode
+ * @code
+ * tcp pacing
+ * Enabled
+ * Done
+ * @endcode
+ * @cparam tcp pacing [@ca{enable|disable}]
+ * @par
+ * Gets or sets whether the example TCP endpoint holds back new data while
+ * earlier segments are still waiting in the send queue. Pacing is disabled by
+ * `tcp init`.
+ * @sa otTcpSetPacingEnabled
+ * @sa otTcpIsPacingEnabled
+ */
+template <> otError TcpExample::Process<Cmd("pacing")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+    bool    enable;
+
+    VerifyOrExit(mInitialized, error = OT_ERROR_INVALID_STATE);
+
+    if (aArgs[0].IsEmpty())
+    {
+        OutputEnabledDisabledStatus(otTcpIsPacingEnabled(&mEndpoint));
+        ExitNow();
+    }
+
+    SuccessOrExit(error = ParseEnableOrDisable(aArgs[0], enable));
+    VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+    otTcpSetPacingEnabled(&mEndpoint, enable);
+
+exit:
+    return error;
+}
+
 /**
  * @cli tcp send
  * @code
@@ -717,6 +757,59 @@ exit:
     return error;
 }
 
+/**
+ * @cli tcp congestion
+ * @code
+ * tcp congestion vegas
+ * Done
+ * @endcode
+ * @code
+ * tcp congestion
+ * vegas
+ * Done
+ * @endcode
+ * @cparam tcp congestion [@ca{algorithm}]
+ * The `algorithm` is either `newreno` (loss-based, the default) or `vegas`
+ * (delay-based). If it is left unspecified, the current algorithm is output.
+ * @par
+ * Gets or sets the congestion control algorithm of the example TCP endpoint.
+ * The algorithm is reset to `newreno` by `tcp init`.
+ * @sa otTcpSetCongestionControl
+ * @sa otTcpGetCongestionControl
+ */
+template <> otError TcpExample::Process<Cmd("congestion")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mInitialized, error = OT_ERROR_INVALID_STATE);
+
+    if (aArgs[0].IsEmpty())
+    {
+        bool isVegas = (otTcpGetCongestionControl(&mEndpoint) == OT_TCP_CONGESTION_CONTROL_VEGAS);
+
+        OutputLine("%s", isVegas ? "vegas" : "newreno");
+        ExitNow();
+    }
+
+    VerifyOrExit(aArgs[1].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+    if (aArgs[0] == "newreno")
+    {
+        error = otTcpSetCongestionControl(&mEndpoint, OT_TCP_CONGESTION_CONTROL_NEW_RENO);
+    }
+    else if (aArgs[0] == "vegas")
+    {
+        error = otTcpSetCongestionControl(&mEndpoint, OT_TCP_CONGESTION_CONTROL_VEGAS);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    return error;
+}
+
 /**
  * @cli tcp listen
  * @code
@@ -782,8 +875,9 @@ otError TcpExample::Process(Arg aArgs[])
 #define CmdEntry(aCommandString) {aCommandString, &TcpExample::Process<Cmd(aCommandString)>}
 
     static constexpr Command kCommands[] = {
-        CmdEntry("abort"), CmdEntry("benchmark"), CmdEntry("bind"), CmdEntry("connect"), CmdEntry("deinit"),
-        CmdEntry("init"),  CmdEntry("listen"),    CmdEntry("send"), CmdEntry("sendend"), CmdEntry("stoplistening"),
+        CmdEntry("abort"),   CmdEntry("benchmark"), CmdEntry("bind"),    CmdEntry("congestion"),
+        CmdEntry("connect"), CmdEntry("deinit"),    CmdEntry("init"),    CmdEntry("listen"),
+        CmdEntry("pacing"),  CmdEntry("send"),      CmdEntry("sendend"), CmdEntry("stoplistening"),
     };
 
     static_assert(BinarySearch::IsSorted(kCommands), "kCommands is not sorted");
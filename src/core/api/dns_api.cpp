@@ -99,6 +99,32 @@ void otDnsClientSetDefaultConfig(otInstance *aInstance, const otDnsQueryConfig *
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+void otDnsClientSetCacheEnabled(otInstance *aInstance, bool aEnabled)
+{
+    AsCoreType(aInstance).Get<Dns::Client>().SetCacheEnabled(aEnabled);
+}
+
+bool otDnsClientIsCacheEnabled(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Dns::Client>().IsCacheEnabled();
+}
+
+void otDnsClientFlushCache(otInstance *aInstance) { AsCoreType(aInstance).Get<Dns::Client>().FlushCache(); }
+
+const otDnsClientCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<Dns::Client>().GetCacheCounters();
+}
+
+void otDnsClientResetCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<Dns::Client>().ResetCacheCounters();
+}
+
+#endif
+
 otError otDnsClientResolveAddress(otInstance             *aInstance,
                                   const char             *aHostName,
                                   otDnsAddressCallback    aCallback,
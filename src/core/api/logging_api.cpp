@@ -33,6 +33,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/binary_log.hpp"
 #include "instance/instance.hpp"
 
 using namespace ot;
@@ -75,6 +76,40 @@ otError otLoggingSetLevel(otLogLevel aLogLevel)
 
 #endif // OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
 
+#if OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+
+otError otLoggingSetModuleLevel(const char *aModuleName, otLogLevel aLogLevel)
+{
+    return Logger::SetModuleLogLevel(aModuleName, MapEnum(aLogLevel));
+}
+
+otError otLoggingClearModuleLevel(const char *aModuleName) { return Logger::ClearModuleLogLevel(aModuleName); }
+
+void otLoggingClearAllModuleLevels(void) { Logger::ClearAllModuleLogLevels(); }
+
+#endif // OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+
+#if OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+void otLoggingSetBinaryModeEnabled(bool aEnable) { BinaryLog::SetEnabled(aEnable); }
+
+bool otLoggingIsBinaryModeEnabled(void) { return BinaryLog::IsEnabled(); }
+
+otError otLoggingReadBinaryRecord(uint8_t *aBuffer, uint16_t *aLength)
+{
+    AssertPointerIsNotNull(aLength);
+
+    return BinaryLog::ReadRecord(aBuffer, *aLength);
+}
+
+otError otLoggingReadBinaryLog(char *aBuffer, uint16_t aSize) { return BinaryLog::ReadLog(aBuffer, aSize); }
+
+const otLogBinaryCounters *otLoggingGetBinaryCounters(void) { return &BinaryLog::GetCounters(); }
+
+void otLoggingResetBinaryCounters(void) { BinaryLog::ResetCounters(); }
+
+#endif // OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
 static const char kPlatformModuleName[] = "Platform";
 
 void otLogCritPlat(const char *aFormat, ...)
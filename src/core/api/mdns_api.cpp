@@ -68,6 +68,30 @@ bool otMdnsIsQuestionUnicastAllowed(otInstance *aInstance)
     return AsCoreType(aInstance).Get<Dns::Multicast::Core>().IsQuestionUnicastAllowed();
 }
 
+void otMdnsGetCounters(otInstance *aInstance, otMdnsCounters *aCounters)
+{
+    *aCounters = AsCoreType(aInstance).Get<Dns::Multicast::Core>().GetCounters();
+}
+
+void otMdnsResetCounters(otInstance *aInstance) { AsCoreType(aInstance).Get<Dns::Multicast::Core>().ResetCounters(); }
+
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+otError otMdnsSaveCacheSnapshot(otInstance *aInstance, uint8_t *aBuffer, uint16_t *aLength)
+{
+    return AsCoreType(aInstance).Get<Dns::Multicast::Core>().SaveCacheSnapshot(aBuffer, *aLength);
+}
+
+otError otMdnsRestoreCacheSnapshot(otInstance    *aInstance,
+                                   const uint8_t *aBuffer,
+                                   uint16_t       aLength,
+                                   uint32_t       aElapsedTime)
+{
+    return AsCoreType(aInstance).Get<Dns::Multicast::Core>().RestoreCacheSnapshot(aBuffer, aLength, aElapsedTime);
+}
+
+#endif
+
 void otMdnsSetConflictCallback(otInstance *aInstance, otMdnsConflictCallback aCallback)
 {
     AsCoreType(aInstance).Get<Dns::Multicast::Core>().SetConflictCallback(aCallback);
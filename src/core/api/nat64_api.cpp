@@ -66,6 +66,11 @@ void otNat64SetReceiveIp4Callback(otInstance *aInstance, otNat64ReceiveIp4Callba
     AsCoreType(aInstance).Get<Ip6::Ip6>().SetNat64ReceiveIp4Callback(aCallback, aContext);
 }
 
+void otNat64SetMappingCallback(otInstance *aInstance, otNat64MappingCallback aCallback, void *aContext)
+{
+    AsCoreType(aInstance).Get<Nat64::Translator>().SetMappingCallback(aCallback, aContext);
+}
+
 void otNat64InitAddressMappingIterator(otInstance *aInstance, otNat64AddressMappingIterator *aIterator)
 {
     AsCoreType(aIterator).Init(AsCoreType(aInstance));
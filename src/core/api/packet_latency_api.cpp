@@ -0,0 +1,57 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread packet latency tracker API.
+ */
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+
+#include "instance/instance.hpp"
+
+using namespace ot;
+
+otError otPacketLatencyGetHistogram(otInstance               *aInstance,
+                                    otPacketLatencyStage      aStage,
+                                    uint8_t                   aPriority,
+                                    otPacketLatencyTxMode     aTxMode,
+                                    otPacketLatencyHistogram *aHistogram)
+{
+    return AsCoreType(aInstance).Get<Utils::PacketLatencyTracker>().GetHistogram(
+        MapEnum(aStage), aPriority, MapEnum(aTxMode), AsCoreType(aHistogram));
+}
+
+void otPacketLatencyResetHistograms(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<Utils::PacketLatencyTracker>().Reset();
+}
+
+#endif // OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
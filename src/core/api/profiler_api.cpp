@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread main-loop profiler API.
+ */
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+
+#include "instance/instance.hpp"
+
+using namespace ot;
+
+void otProfilerSetEnabled(otInstance *aInstance, bool aEnable)
+{
+    AsCoreType(aInstance).Get<Utils::Profiler>().SetEnabled(aEnable);
+}
+
+bool otProfilerIsEnabled(otInstance *aInstance) { return AsCoreType(aInstance).Get<Utils::Profiler>().IsEnabled(); }
+
+void otProfilerReset(otInstance *aInstance) { AsCoreType(aInstance).Get<Utils::Profiler>().Reset(); }
+
+otError otProfilerGetNextHandlerStats(otInstance             *aInstance,
+                                      otProfilerIterator     *aIterator,
+                                      otProfilerHandlerStats *aStats)
+{
+    return AsCoreType(aInstance).Get<Utils::Profiler>().GetNextHandlerStats(*aIterator, AsCoreType(aStats));
+}
+
+uint32_t otProfilerGetDroppedCount(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Utils::Profiler>().GetDroppedCount();
+}
+
+void otProfilerGetMainloopStats(otInstance *aInstance, otProfilerMainloopStats *aStats)
+{
+    AsCoreType(aStats) = AsCoreType(aInstance).Get<Utils::Profiler>().GetMainloopStats();
+}
+
+void otProfilerRecordPlatformHandler(otInstance *aInstance, const char *aName, uint32_t aDuration)
+{
+    AsCoreType(aInstance).Get<Utils::Profiler>().RecordPlatformHandler(aName, aDuration);
+}
+
+void otProfilerRecordMainloopIteration(otInstance *aInstance, uint32_t aDuration)
+{
+    AsCoreType(aInstance).Get<Utils::Profiler>().RecordMainloopIteration(aDuration);
+}
+
+#endif // OPENTHREAD_CONFIG_PROFILER_ENABLE
@@ -122,6 +122,16 @@ otError otSrpServerSetLeaseConfig(otInstance *aInstance, const otSrpServerLeaseC
     return AsCoreType(aInstance).Get<Srp::Server>().SetLeaseConfig(AsCoreType(aLeaseConfig));
 }
 
+uint32_t otSrpServerGetRefreshWindow(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Srp::Server>().GetRefreshWindow();
+}
+
+otError otSrpServerSetRefreshWindow(otInstance *aInstance, uint32_t aWindow)
+{
+    return AsCoreType(aInstance).Get<Srp::Server>().SetRefreshWindow(aWindow);
+}
+
 void otSrpServerSetServiceUpdateHandler(otInstance                     *aInstance,
                                         otSrpServerServiceUpdateHandler aServiceHandler,
                                         void                           *aContext)
@@ -144,6 +154,11 @@ const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aI
     return AsCoreType(aInstance).Get<Srp::Server>().GetResponseCounters();
 }
 
+void otSrpServerGetUpdateStats(otInstance *aInstance, otSrpServerUpdateStats *aStats)
+{
+    AsCoreType(aInstance).Get<Srp::Server>().GetUpdateStats(*aStats);
+}
+
 bool otSrpServerHostIsDeleted(const otSrpServerHost *aHost) { return AsCoreType(aHost).IsDeleted(); }
 
 const char *otSrpServerHostGetFullName(const otSrpServerHost *aHost) { return AsCoreType(aHost).GetFullName(); }
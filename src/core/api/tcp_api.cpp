@@ -98,6 +98,20 @@ otError otTcpAbort(otTcpEndpoint *aEndpoint) { return AsCoreType(aEndpoint).Abor
 
 otError otTcpEndpointDeinitialize(otTcpEndpoint *aEndpoint) { return AsCoreType(aEndpoint).Deinitialize(); }
 
+otError otTcpSetCongestionControl(otTcpEndpoint *aEndpoint, otTcpCongestionControl aCongestionControl)
+{
+    return AsCoreType(aEndpoint).SetCongestionControl(MapEnum(aCongestionControl));
+}
+
+otTcpCongestionControl otTcpGetCongestionControl(const otTcpEndpoint *aEndpoint)
+{
+    return MapEnum(AsCoreType(aEndpoint).GetCongestionControl());
+}
+
+void otTcpSetPacingEnabled(otTcpEndpoint *aEndpoint, bool aEnable) { AsCoreType(aEndpoint).SetPacingEnabled(aEnable); }
+
+bool otTcpIsPacingEnabled(const otTcpEndpoint *aEndpoint) { return AsCoreType(aEndpoint).IsPacingEnabled(); }
+
 otError otTcpListenerInitialize(otInstance                        *aInstance,
                                 otTcpListener                     *aListener,
                                 const otTcpListenerInitializeArgs *aArgs)
@@ -64,6 +64,21 @@ otError otTcpCircularSendBufferWrite(otTcpEndpoint           *aEndpoint,
     return AsCoreType(aSendBuffer).Write(AsCoreType(aEndpoint), aData, aLength, *aWritten, aFlags);
 }
 
+void otTcpCircularSendBufferGetWritableSpan(otTcpCircularSendBuffer *aSendBuffer, uint8_t **aData, size_t *aLength)
+{
+    AssertPointerIsNotNull(aData);
+    AssertPointerIsNotNull(aLength);
+    AsCoreType(aSendBuffer).GetWritableSpan(*aData, *aLength);
+}
+
+otError otTcpCircularSendBufferCommit(otTcpEndpoint           *aEndpoint,
+                                      otTcpCircularSendBuffer *aSendBuffer,
+                                      size_t                   aLength,
+                                      uint32_t                 aFlags)
+{
+    return AsCoreType(aSendBuffer).Commit(AsCoreType(aEndpoint), aLength, aFlags);
+}
+
 void otTcpCircularSendBufferHandleForwardProgress(otTcpCircularSendBuffer *aSendBuffer, size_t aInSendBuffer)
 {
     AsCoreType(aSendBuffer).HandleForwardProgress(aInSendBuffer);
@@ -35,6 +35,7 @@
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE
 
+#include "common/crc.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -51,31 +52,36 @@ MulticastListenersTable::MulticastListenersTable(Instance &aInstance)
 
 Error MulticastListenersTable::Add(const Ip6::Address &aAddress, Time aExpireTime)
 {
-    Error     error = kErrorNone;
-    bool      isNew = false;
-    Listener *entry;
+    Error                 error  = kErrorNone;
+    LinkedList<Listener> &bucket = GetBucketFor(aAddress);
+    Listener             *entry;
 
     VerifyOrExit(aAddress.IsMulticastLargerThanRealmLocal(), error = kErrorInvalidArgs);
 
-    entry = mListeners.FindMatching(aAddress);
+    entry = bucket.FindMatching(aAddress);
 
-    if (entry == nullptr)
+    if (entry != nullptr)
     {
-        entry = mListeners.PushBack();
-        isNew = true;
+        entry->mExpireTime = aExpireTime;
+        HeapUpdate(entry->mHeapIndex);
+        mTimer.FireAtIfEarlier(aExpireTime);
+        ExitNow();
     }
 
+    entry = mListenerPool.Allocate();
     VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
 
     entry->mAddress    = aAddress;
     entry->mExpireTime = aExpireTime;
+    entry->mHeapIndex  = mExpireHeap.GetLength();
+
+    bucket.Push(*entry);
+    SuccessOrAssert(mExpireHeap.PushBack(entry));
+    HeapSiftUp(entry->mHeapIndex);
 
     mTimer.FireAtIfEarlier(aExpireTime);
 
-    if (isNew)
-    {
-        InvokeCallback(kEventAdded, aAddress);
-    }
+    InvokeCallback(kEventAdded, aAddress);
 
 exit:
     Log(kAdd, aAddress, aExpireTime, error);
@@ -87,10 +93,10 @@ void MulticastListenersTable::Remove(const Ip6::Address &aAddress)
     Error     error = kErrorNone;
     Listener *entry;
 
-    entry = mListeners.FindMatching(aAddress);
+    entry = GetBucketFor(aAddress).FindMatching(aAddress);
     VerifyOrExit(entry != nullptr, error = kErrorNotFound);
 
-    mListeners.Remove(*entry);
+    RemoveListener(*entry);
 
     InvokeCallback(kEventRemoved, aAddress);
 
@@ -100,34 +106,132 @@ exit:
 
 void MulticastListenersTable::HandleTimer(void)
 {
-    TimeMilli    now = TimerMilli::GetNow();
-    NextFireTime nextTime(now);
+    TimeMilli now = TimerMilli::GetNow();
+
+    // The heap root is always the listener with the earliest expire
+    // time, so we only remove entries from the root until we reach
+    // one which has not yet expired.
+
+    while (!mExpireHeap.IsEmpty() && (mExpireHeap[0]->mExpireTime <= now))
+    {
+        Ip6::Address address    = mExpireHeap[0]->mAddress;
+        TimeMilli    expireTime = mExpireHeap[0]->mExpireTime;
+
+        RemoveListener(*mExpireHeap[0]);
+        Log(kExpire, address, expireTime, kErrorNone);
+        InvokeCallback(kEventRemoved, address);
+    }
+
+    if (!mExpireHeap.IsEmpty())
+    {
+        mTimer.FireAt(mExpireHeap[0]->mExpireTime);
+    }
+}
+
+bool MulticastListenersTable::Has(const Ip6::Address &aAddress) const
+{
+    return GetBucketFor(aAddress).ContainsMatching(aAddress);
+}
+
+LinkedList<MulticastListenersTable::Listener> &MulticastListenersTable::GetBucketFor(const Ip6::Address &aAddress)
+{
+    return AsNonConst(AsConst(this)->GetBucketFor(aAddress));
+}
+
+const LinkedList<MulticastListenersTable::Listener> &MulticastListenersTable::GetBucketFor(
+    const Ip6::Address &aAddress) const
+{
+    return mBuckets[CrcCalculator<uint16_t>(kCrc16CcittPolynomial).Feed(aAddress) % kNumBuckets];
+}
+
+void MulticastListenersTable::RemoveListener(Listener &aListener)
+{
+    uint16_t index = aListener.mHeapIndex;
+
+    SuccessOrAssert(GetBucketFor(aListener.mAddress).Remove(aListener));
+
+    // Move the last heap entry into the removed slot and restore
+    // the heap order from there.
+
+    mExpireHeap[index]             = *mExpireHeap.Back();
+    mExpireHeap[index]->mHeapIndex = index;
+    mExpireHeap.PopBack();
 
-    for (uint16_t i = 0; i < mListeners.GetLength();)
+    if (index < mExpireHeap.GetLength())
     {
-        if (mListeners[i].mExpireTime <= now)
+        HeapUpdate(index);
+    }
+
+    mListenerPool.Free(aListener);
+}
+
+void MulticastListenersTable::HeapSiftUp(uint16_t aIndex)
+{
+    while (aIndex > 0)
+    {
+        uint16_t parent = (aIndex - 1) / 2;
+
+        if (!(mExpireHeap[aIndex]->mExpireTime < mExpireHeap[parent]->mExpireTime))
         {
-            Ip6::Address address = mListeners[i].mAddress;
+            break;
+        }
 
-            Log(kExpire, address, mListeners[i].mExpireTime, kErrorNone);
-            mListeners.Remove(mListeners[i]);
-            InvokeCallback(kEventRemoved, address);
+        HeapSwap(aIndex, parent);
+        aIndex = parent;
+    }
+}
+
+void MulticastListenersTable::HeapSiftDown(uint16_t aIndex)
+{
+    uint16_t length = mExpireHeap.GetLength();
 
-            // When the entry is removed from the array it is replaced
-            // with the last element. In this case, we do not
-            // increment `i`.
+    while (true)
+    {
+        uint16_t smallest = aIndex;
+        uint16_t left     = 2 * aIndex + 1;
+        uint16_t right    = left + 1;
+
+        if ((left < length) && (mExpireHeap[left]->mExpireTime < mExpireHeap[smallest]->mExpireTime))
+        {
+            smallest = left;
         }
-        else
+
+        if ((right < length) && (mExpireHeap[right]->mExpireTime < mExpireHeap[smallest]->mExpireTime))
+        {
+            smallest = right;
+        }
+
+        if (smallest == aIndex)
         {
-            nextTime.UpdateIfEarlier(mListeners[i].mExpireTime);
-            i++;
+            break;
         }
+
+        HeapSwap(aIndex, smallest);
+        aIndex = smallest;
     }
+}
+
+void MulticastListenersTable::HeapUpdate(uint16_t aIndex)
+{
+    // The entry at `aIndex` has a changed expire time, so it may need
+    // to move either up or down (at most one of them does anything).
+
+    Listener *listener = mExpireHeap[aIndex];
 
-    mTimer.FireAtIfEarlier(nextTime);
+    HeapSiftUp(aIndex);
+    HeapSiftDown(listener->mHeapIndex);
 }
 
-bool MulticastListenersTable::Has(const Ip6::Address &aAddress) const { return mListeners.ContainsMatching(aAddress); }
+void MulticastListenersTable::HeapSwap(uint16_t aIndex1, uint16_t aIndex2)
+{
+    Listener *listener = mExpireHeap[aIndex1];
+
+    mExpireHeap[aIndex1] = mExpireHeap[aIndex2];
+    mExpireHeap[aIndex2] = listener;
+
+    mExpireHeap[aIndex1]->mHeapIndex = aIndex1;
+    mExpireHeap[aIndex2]->mHeapIndex = aIndex2;
+}
 
 void MulticastListenersTable::InvokeCallback(Event aEvent, const Ip6::Address &aAddress) const
 {
@@ -156,11 +260,11 @@ void MulticastListenersTable::Log(Action, const Ip6::Address &, TimeMilli, Error
 
 void MulticastListenersTable::Clear(void)
 {
-    while (!mListeners.IsEmpty())
+    while (!mExpireHeap.IsEmpty())
     {
-        Ip6::Address address = mListeners.Back()->mAddress;
+        Ip6::Address address = (*mExpireHeap.Back())->mAddress;
 
-        mListeners.PopBack();
+        RemoveListener(**mExpireHeap.Back());
         InvokeCallback(kEventRemoved, address);
     }
 
@@ -173,24 +277,26 @@ void MulticastListenersTable::SetCallback(ListenerCallback aCallback, void *aCon
 
     if (mCallback.IsSet())
     {
-        for (const Listener &listener : mListeners)
+        for (const Listener *listener : mExpireHeap)
         {
-            InvokeCallback(kEventAdded, listener.mAddress);
+            InvokeCallback(kEventAdded, listener->mAddress);
         }
     }
 }
 
 Error MulticastListenersTable::GetNext(ListenerIterator &aIterator, ListenerInfo &aInfo)
 {
-    Error     error = kErrorNone;
-    TimeMilli now;
+    Error           error = kErrorNone;
+    TimeMilli       now;
+    const Listener *listener;
 
-    VerifyOrExit(aIterator < mListeners.GetLength(), error = kErrorNotFound);
+    VerifyOrExit(aIterator < mExpireHeap.GetLength(), error = kErrorNotFound);
 
-    now = TimerMilli::GetNow();
+    now      = TimerMilli::GetNow();
+    listener = mExpireHeap[aIterator];
 
-    aInfo.mAddress = mListeners[aIterator].mAddress;
-    aInfo.mTimeout = Time::MsecToSec(mListeners[aIterator].mExpireTime.DetermineRemainingDurationFrom(now));
+    aInfo.mAddress = listener->mAddress;
+    aInfo.mTimeout = Time::MsecToSec(listener->mExpireTime.DetermineRemainingDurationFrom(now));
 
     aIterator++;
 
@@ -43,8 +43,10 @@
 #include "common/array.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
+#include "common/linked_list.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
+#include "common/pool.hpp"
 #include "common/time.hpp"
 #include "common/timer.hpp"
 #include "net/ip6_address.hpp"
@@ -94,7 +96,7 @@ public:
      *
      * @returns The number of valid Multicast Listeners.
      */
-    uint16_t Count(void) const { return mListeners.GetLength(); }
+    uint16_t Count(void) const { return mExpireHeap.GetLength(); }
 
     /**
      * Indicates whether or not the Multicast Listeners Table contains the given address.
@@ -147,22 +149,44 @@ private:
         kExpire,
     };
 
-    struct Listener
+    // Listeners are allocated from a pool and indexed in two ways: a
+    // hash table keyed by the address (for `Has()`, `Add()` and
+    // `Remove()`), and a binary min-heap ordered by expire time so
+    // that the timer only needs to look at the earliest entries.
+    // While a listener is in use, its `mNext` links it in its hash
+    // bucket list.
+
+    static constexpr uint16_t kNumBuckets = (kTableSize + 1) / 2;
+
+    struct Listener : public LinkedListEntry<Listener>
     {
         bool Matches(const Ip6::Address &aAddress) const { return mAddress == aAddress; }
 
+        Listener    *mNext;
         Ip6::Address mAddress;
         TimeMilli    mExpireTime;
+        uint16_t     mHeapIndex;
     };
 
+    LinkedList<Listener>       &GetBucketFor(const Ip6::Address &aAddress);
+    const LinkedList<Listener> &GetBucketFor(const Ip6::Address &aAddress) const;
+    void                        RemoveListener(Listener &aListener);
+    void                        HeapSiftUp(uint16_t aIndex);
+    void                        HeapSiftDown(uint16_t aIndex);
+    void                        HeapUpdate(uint16_t aIndex);
+    void                        HeapSwap(uint16_t aIndex1, uint16_t aIndex2);
+
     void InvokeCallback(Event aEvent, const Ip6::Address &aAddress) const;
     void HandleTimer(void);
     void Log(Action aAction, const Ip6::Address &aAddress, TimeMilli aExpireTime, Error aError) const;
 
-    using ListenerArray = Array<Listener, kTableSize, uint16_t>;
-    using ExpireTimer   = TimerMilliIn<MulticastListenersTable, &MulticastListenersTable::HandleTimer>;
+    using ListenerPool = Pool<Listener, kTableSize>;
+    using ExpireHeap   = Array<Listener *, kTableSize, uint16_t>;
+    using ExpireTimer  = TimerMilliIn<MulticastListenersTable, &MulticastListenersTable::HandleTimer>;
 
-    ListenerArray              mListeners;
+    ListenerPool               mListenerPool;
+    LinkedList<Listener>       mBuckets[kNumBuckets];
+    ExpireHeap                 mExpireHeap;
     ExpireTimer                mTimer;
     Callback<ListenerCallback> mCallback;
 };
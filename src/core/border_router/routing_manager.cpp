@@ -286,7 +286,10 @@ void RoutingManager::Stop(void)
 
     Get<RxRaTracker>().SetEnabled(false, RxRaTracker::kRequesterRoutingManager);
 
-    mTxRaInfo.mTxCount = 0;
+    mTxRaInfo.mTxCount          = 0;
+    mTxRaInfo.mLastTxSucceeded  = false;
+    mTxRaInfo.mLastTxSuppressed = false;
+    mTxRaInfo.mRsReplyPending   = false;
 
     mRoutingPolicyTimer.Stop();
 
@@ -456,8 +459,9 @@ void RoutingManager::ScheduleRoutingPolicyEvaluation(ScheduleMode aMode)
         break;
 
     case kToReplyToRs:
-        interval = kRsReplyInterval;
-        jitter   = kRsReplyJitter;
+        interval                  = kRsReplyInterval;
+        jitter                    = kRsReplyJitter;
+        mTxRaInfo.mRsReplyPending = true;
         break;
     }
 
@@ -466,6 +470,23 @@ void RoutingManager::ScheduleRoutingPolicyEvaluation(ScheduleMode aMode)
     // Ensure we wait a min delay after last RA tx
     evaluateTime = Max(now + delay, mTxRaInfo.mLastTxTime + kMinDelayBetweenRas);
 
+    if (aMode == kForNextRa)
+    {
+        // If the last RA was suppressed (unchanged from the one sent
+        // before), keep the beacon time determined after the last
+        // actual RA tx so that the periodic beacon is not postponed
+        // by event-driven evaluations.
+
+        if (mTxRaInfo.mLastTxSuppressed)
+        {
+            evaluateTime = Max(now, mTxRaInfo.mNextBeaconTime);
+        }
+        else
+        {
+            mTxRaInfo.mNextBeaconTime = evaluateTime;
+        }
+    }
+
     mRoutingPolicyTimer.FireAtIfEarlier(evaluateTime);
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
@@ -546,11 +567,23 @@ void RoutingManager::SendRouterAdvertisement(RouterAdvTxMode aRaTxMode)
 
     raMsg.GetAsPacket(packet);
 
+    if ((aRaTxMode == kAdvPrefixesFromNetData) && mTxRaInfo.CanSuppress(packet))
+    {
+        mTxRaInfo.mLastTxSuppressed = true;
+        Get<Ip6::Ip6>().GetBorderRoutingCounters().mRaTxSuppressed++;
+        LogInfo("RA is unchanged, skip sending it before next beacon");
+        ExitNow();
+    }
+
     mTxRaInfo.IncrementTxCountAndSaveHash(packet);
+    mTxRaInfo.mLastTxSuppressed = false;
+    mTxRaInfo.mRsReplyPending   = false;
+    mTxRaInfo.mLastTxSucceeded  = false;
 
     SuccessOrExit(error = Get<InfraIf>().Send(packet, Ip6::Address::GetLinkLocalAllNodesMulticast()));
 
-    mTxRaInfo.mLastTxTime = TimerMilli::GetNow();
+    mTxRaInfo.mLastTxSucceeded = true;
+    mTxRaInfo.mLastTxTime      = TimerMilli::GetNow();
     Get<Ip6::Ip6>().GetBorderRoutingCounters().mRaTxSuccess++;
     LogInfo("Sent RA on %s", Get<InfraIf>().ToString().AsCString());
     DumpDebg("[BR-CERT] direction=send | type=RA |", packet.GetBytes(), packet.GetLength());
@@ -2586,6 +2619,28 @@ bool RoutingManager::TxRaInfo::IsRaFromManager(const RouterAdvert::RxMessage &aR
     return isFromManager;
 }
 
+bool RoutingManager::TxRaInfo::CanSuppress(const InfraIf::Icmp6Packet &aRaMessage) const
+{
+    // Determines whether an RA can be skipped. This is the case when
+    // the new RA is identical to the last successfully sent one, we
+    // are past the initial RA transmissions, there is no pending
+    // reply to a received RS, and the next beacon time is not yet
+    // reached.
+
+    bool canSuppress = false;
+    Hash hash;
+
+    VerifyOrExit(mLastTxSucceeded && !mRsReplyPending);
+    VerifyOrExit(mTxCount > kInitialRaTxCount);
+    VerifyOrExit(TimerMilli::GetNow() < mNextBeaconTime);
+
+    CalculateHash(RouterAdvert::RxMessage(aRaMessage), hash);
+    canSuppress = (hash == mHashes[mLastHashIndex]);
+
+exit:
+    return canSuppress;
+}
+
 void RoutingManager::TxRaInfo::CalculateHash(const RouterAdvert::RxMessage &aRaMessage, Hash &aHash)
 {
     RouterAdvert::Header header;
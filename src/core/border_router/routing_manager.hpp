@@ -947,6 +947,8 @@ private:
         // - Last RA TX time
         // - Hashes of last TX RAs (to tell if a received RA is from
         //   `RoutingManager` itself).
+        // - Next RA beacon time and whether an RA can be skipped
+        //   when it is the same as the last one sent.
 
         typedef Crypto::Sha256::Hash Hash;
 
@@ -956,17 +958,25 @@ private:
             : mTxCount(0)
             , mLastTxTime(TimerMilli::GetNow() - kMinDelayBetweenRas)
             , mLastHashIndex(0)
+            , mLastTxSucceeded(false)
+            , mLastTxSuppressed(false)
+            , mRsReplyPending(false)
         {
         }
 
         void        IncrementTxCountAndSaveHash(const InfraIf::Icmp6Packet &aRaMessage);
         bool        IsRaFromManager(const RouterAdvert::RxMessage &aRaMessage) const;
+        bool        CanSuppress(const InfraIf::Icmp6Packet &aRaMessage) const;
         static void CalculateHash(const RouterAdvert::RxMessage &aRaMessage, Hash &aHash);
 
         uint32_t  mTxCount;
         TimeMilli mLastTxTime;
+        TimeMilli mNextBeaconTime;
         Hash      mHashes[kNumHashEntries];
         uint16_t  mLastHashIndex;
+        bool      mLastTxSucceeded : 1;
+        bool      mLastTxSuppressed : 1;
+        bool      mRsReplyPending : 1;
     };
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
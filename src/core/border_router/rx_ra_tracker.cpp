@@ -36,6 +36,7 @@
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
 #include "border_router/br_log.hpp"
+#include "common/crc.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -62,6 +63,7 @@ RxRaTracker::RxRaTracker(Instance &aInstance)
 {
     mLocalRaHeader.Clear();
     mPendingEvents.Clear();
+    ClearAllBytes(mRouterBuckets);
 }
 
 void RxRaTracker::SetEnabled(bool aEnable, Requester aRequester)
@@ -130,6 +132,7 @@ void RxRaTracker::Stop(void)
     mIsRunning = false;
 
     mRouters.Free();
+    ClearAllBytes(mRouterBuckets);
     mIfAddresses.Free();
     mLocalRaHeader.Clear();
     mDecisionFactors.Clear();
@@ -203,7 +206,7 @@ void RxRaTracker::HandleRouterAdvertisement(const InfraIf::Icmp6Packet &aPacket,
 
     VerifyOrExit(origin != kThisBrRoutingManager);
 
-    router = mRouters.FindMatching(aSrcAddress);
+    router = FindRouter(aSrcAddress);
 
     if (router == nullptr)
     {
@@ -221,6 +224,7 @@ void RxRaTracker::HandleRouterAdvertisement(const InfraIf::Icmp6Packet &aPacket,
         router->mAddress      = aSrcAddress;
 
         mRouters.Push(*newEntry);
+        AddRouterToIndex(*newEntry);
     }
 
     // RA message can indicate router provides default route in the RA
@@ -801,12 +805,14 @@ void RxRaTracker::Evaluate(void)
 
     mRouters.RemoveAllMatching(removedRouters, Router::EmptyChecker());
 
-#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
-    for (Router &router : removedRouters)
+    for (Entry<Router> &router : removedRouters)
     {
+        RemoveRouterFromIndex(router);
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
         ReportChangesToHistoryTracker(router, /* aRemoved */ true);
-    }
 #endif
+    }
 
     removedRouters.Free();
 
@@ -878,8 +884,11 @@ void RxRaTracker::Evaluate(void)
     // flag is cleared on all entries. As we iterate over routers and
     // their entries, `DetermineStaleTimeFor()` will consider all
     // matching entries and mark "StaleTimeCalculated" flag on them.
+    // Since any matching entry in an earlier router would have already
+    // marked the flag, `DetermineStaleTimeFor()` only needs to check
+    // the routers starting from the current one.
 
-    for (Router &router : mRouters)
+    for (Entry<Router> &router : mRouters)
     {
         if (router.ShouldCheckReachability())
         {
@@ -893,7 +902,7 @@ void RxRaTracker::Evaluate(void)
 
             if (!entry.IsStaleTimeCalculated())
             {
-                DetermineStaleTimeFor(entry, staleTime);
+                DetermineStaleTimeFor(entry, router, staleTime);
             }
         }
 
@@ -903,7 +912,7 @@ void RxRaTracker::Evaluate(void)
 
             if (!entry.IsStaleTimeCalculated())
             {
-                DetermineStaleTimeFor(entry, staleTime);
+                DetermineStaleTimeFor(entry, router, staleTime);
             }
         }
 
@@ -949,14 +958,14 @@ void RxRaTracker::Evaluate(void)
 #endif
 }
 
-void RxRaTracker::DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime)
+void RxRaTracker::DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, Entry<Router> &aRouter, NextFireTime &aStaleTime)
 {
     TimeMilli prefixStaleTime = aStaleTime.GetNow();
     bool      found           = false;
 
-    for (Router &router : mRouters)
+    for (Entry<Router> *router = &aRouter; router != nullptr; router = router->GetNext())
     {
-        for (OnLinkPrefix &entry : router.mOnLinkPrefixes)
+        for (OnLinkPrefix &entry : router->mOnLinkPrefixes)
         {
             if (!entry.Matches(aPrefix.GetPrefix()))
             {
@@ -981,14 +990,14 @@ void RxRaTracker::DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTim
     }
 }
 
-void RxRaTracker::DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime &aStaleTime)
+void RxRaTracker::DetermineStaleTimeFor(const RoutePrefix &aPrefix, Entry<Router> &aRouter, NextFireTime &aStaleTime)
 {
     TimeMilli prefixStaleTime = aStaleTime.GetNow();
     bool      found           = false;
 
-    for (Router &router : mRouters)
+    for (Entry<Router> *router = &aRouter; router != nullptr; router = router->GetNext())
     {
-        for (RoutePrefix &entry : router.mRoutePrefixes)
+        for (RoutePrefix &entry : router->mRoutePrefixes)
         {
             if (!entry.Matches(aPrefix.GetPrefix()))
             {
@@ -1008,6 +1017,47 @@ void RxRaTracker::DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime
     }
 }
 
+RxRaTracker::Entry<RxRaTracker::Router> *RxRaTracker::FindRouter(const Ip6::Address &aAddress)
+{
+    Entry<Router> *router = mRouterBuckets[GetRouterBucketIndex(aAddress)];
+
+    while ((router != nullptr) && !router->Matches(aAddress))
+    {
+        router = router->mNextInBucket;
+    }
+
+    return router;
+}
+
+void RxRaTracker::AddRouterToIndex(Entry<Router> &aRouter)
+{
+    Entry<Router> *&head = mRouterBuckets[GetRouterBucketIndex(aRouter.mAddress)];
+
+    aRouter.mNextInBucket = head;
+    head                  = &aRouter;
+}
+
+void RxRaTracker::RemoveRouterFromIndex(const Entry<Router> &aRouter)
+{
+    Entry<Router> **link = &mRouterBuckets[GetRouterBucketIndex(aRouter.mAddress)];
+
+    while (*link != nullptr)
+    {
+        if (*link == &aRouter)
+        {
+            *link = aRouter.mNextInBucket;
+            break;
+        }
+
+        link = &(*link)->mNextInBucket;
+    }
+}
+
+uint16_t RxRaTracker::GetRouterBucketIndex(const Ip6::Address &aAddress)
+{
+    return CrcCalculator<uint16_t>(kCrc16CcittPolynomial).Feed(aAddress) % kNumRouterBuckets;
+}
+
 void RxRaTracker::HandleStaleTimer(void)
 {
     VerifyOrExit(mIsRunning);
@@ -1054,7 +1104,7 @@ void RxRaTracker::HandleNeighborAdvertisement(const InfraIf::Icmp6Packet &aPacke
 
     VerifyOrExit(naMsg->IsValid());
 
-    router = mRouters.FindMatching(naMsg->GetTargetAddress());
+    router = FindRouter(naMsg->GetTargetAddress());
     VerifyOrExit(router != nullptr);
 
     LogInfo("Received NA from router %s", router->mAddress.ToString().AsCString());
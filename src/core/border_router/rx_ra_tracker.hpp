@@ -333,6 +333,12 @@ public:
 private:
     static constexpr uint32_t kStaleTime = 600; // 10 minutes.
 
+    // Discovered routers are also indexed by their address in a
+    // small hash table so that a received RA or NA can find its
+    // router entry without walking the full `mRouters` list.
+
+    static constexpr uint16_t kNumRouterBuckets = 16;
+
     typedef Ip6::Nd::Option    Option;
     typedef Ip6::Nd::TxMessage TxMessage;
 
@@ -432,8 +438,12 @@ private:
         // NA was received from this router. It is bounded due to
         // the frequency of reachability checks, so we can safely
         // use `TimeMilli` for it.
+        //
+        // `mNextInBucket` links the router in its hash bucket list
+        // (keyed by `mAddress`).
 
         Ip6::Address     mAddress;
+        Entry<Router>   *mNextInBucket;
         OnLinkPrefixList mOnLinkPrefixes;
         RoutePrefixList  mRoutePrefixes;
 #if OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE
@@ -612,8 +622,8 @@ private:
     void UpdateIfAddresses(const Ip6::Address &aAddress);
     void RemoveOrDeprecateOldEntries(TimeMilli aTimeThreshold);
     void Evaluate(void);
-    void DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, NextFireTime &aStaleTime);
-    void DetermineStaleTimeFor(const RoutePrefix &aPrefix, NextFireTime &aStaleTime);
+    void DetermineStaleTimeFor(const OnLinkPrefix &aPrefix, Entry<Router> &aRouter, NextFireTime &aStaleTime);
+    void DetermineStaleTimeFor(const RoutePrefix &aPrefix, Entry<Router> &aRouter, NextFireTime &aStaleTime);
     void SendNeighborSolicitToRouter(const Router &aRouter);
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_MULTI_AIL_DETECTION_ENABLE
     uint16_t CountReachablePeerBrs(void) const;
@@ -624,6 +634,11 @@ private:
     void HandleNotifierEvents(ot::Events aEvents);
     void HandleNetDataChange(void);
 
+    Entry<Router>  *FindRouter(const Ip6::Address &aAddress);
+    void            AddRouterToIndex(Entry<Router> &aRouter);
+    void            RemoveRouterFromIndex(const Entry<Router> &aRouter);
+    static uint16_t GetRouterBucketIndex(const Ip6::Address &aAddress);
+
     // Callbacks from `InfraIf`
     void HandleInfraIfStateChanged(void) { UpdateState(); }
     void HandleRouterAdvertisement(const InfraIf::Icmp6Packet &aPacket, const Ip6::Address &aSrcAddress);
@@ -663,6 +678,7 @@ private:
     RsSender             mRsSender;
     DecisionFactors      mDecisionFactors;
     RouterList           mRouters;
+    Entry<Router>       *mRouterBuckets[kNumRouterBuckets];
     IfAddressList        mIfAddresses;
     ExpirationTimer      mExpirationTimer;
     StaleTimer           mStaleTimer;
@@ -0,0 +1,693 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary log mode.
+ */
+
+#include "binary_log.hpp"
+
+#if OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/bit_utils.hpp"
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "common/num_utils.hpp"
+#include "common/timer.hpp"
+
+namespace ot {
+
+bool                BinaryLog::sEnabled    = false;
+uint16_t            BinaryLog::sReadIndex  = 0;
+uint16_t            BinaryLog::sUsedLength = 0;
+BinaryLog::Counters BinaryLog::sCounters;
+uint8_t             BinaryLog::sBuffer[kBufferSize];
+
+// Formats a single (already validated) conversion spec. The spec is
+// passed as a `va_list` format so it is not required to be a literal.
+static void AppendFormattedArg(StringWriter &aWriter, const char *aSpec, ...)
+{
+    va_list args;
+
+    va_start(args, aSpec);
+    aWriter.AppendVarArgs(aSpec, args);
+    va_end(args);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Recording
+
+void BinaryLog::Record(const char *aModuleName, LogLevel aLogLevel, Error aError, const char *aFormat, va_list aArgs)
+{
+    uint8_t      record[kMaxRecordSize];
+    FrameBuilder builder;
+    va_list      args;
+
+    builder.Init(record, sizeof(record));
+
+    // The header always fits since `kMaxRecordSize` is at least
+    // `OPENTHREAD_CONFIG_LOG_MAX_SIZE`. The record length is written
+    // once all the arguments are appended.
+
+    IgnoreError(AppendUint(builder, 0, sizeof(uint16_t)));
+    IgnoreError(builder.AppendUint8(aLogLevel));
+    IgnoreError(builder.AppendUint8(aError));
+    IgnoreError(AppendUint(builder, TimerMilli::GetNow().GetValue(), sizeof(uint32_t)));
+    IgnoreError(AppendUint(builder, reinterpret_cast<uintptr_t>(aModuleName), sizeof(uintptr_t)));
+    IgnoreError(AppendUint(builder, reinterpret_cast<uintptr_t>(aFormat), sizeof(uintptr_t)));
+
+    va_copy(args, aArgs);
+
+    for (const char *cur = aFormat; *cur != '\0';)
+    {
+        FormatSpec spec;
+
+        if (*cur++ != '%')
+        {
+            continue;
+        }
+
+        cur = spec.Parse(cur);
+
+        if (AppendArg(builder, spec, args) != kErrorNone)
+        {
+            break;
+        }
+    }
+
+    va_end(args);
+
+    builder.Write<uint16_t>(0, LittleEndian::HostSwap16(builder.GetLength()));
+
+    if (builder.GetLength() > kBufferSize - sUsedLength)
+    {
+        sCounters.mDropped++;
+        ExitNow();
+    }
+
+    WriteBytes(record, builder.GetLength());
+    sCounters.mRecorded++;
+
+exit:
+    return;
+}
+
+Error BinaryLog::AppendArg(FrameBuilder &aBuilder, const FormatSpec &aSpec, va_list &aArgs)
+{
+    Error    error     = kErrorNone;
+    int      precision = -1;
+    uint64_t value     = 0;
+
+    VerifyOrExit(aSpec.mArgType != kArgUnsupported, error = kErrorNotCapable);
+
+    for (uint8_t numStars = 0; numStars < aSpec.mNumStars; numStars++)
+    {
+        // When there are stars, the last one is the precision if the
+        // spec has one (e.g. "%.*s" or "%*.*s").
+
+        precision = va_arg(aArgs, int);
+        SuccessOrExit(error = AppendUint(aBuilder, static_cast<uint64_t>(precision), sizeof(int)));
+    }
+
+    if (!aSpec.mHasStarPrecision)
+    {
+        precision = aSpec.mPrecision;
+    }
+
+    switch (aSpec.mArgType)
+    {
+    case kArgNone:
+        ExitNow();
+
+    case kArgInt:
+        value = static_cast<uint64_t>(va_arg(aArgs, int));
+        break;
+
+    case kArgLong:
+        value = static_cast<uint64_t>(va_arg(aArgs, long));
+        break;
+
+    case kArgLongLong:
+        value = static_cast<uint64_t>(va_arg(aArgs, long long));
+        break;
+
+    case kArgIntMax:
+        value = static_cast<uint64_t>(va_arg(aArgs, intmax_t));
+        break;
+
+    case kArgSize:
+        value = static_cast<uint64_t>(va_arg(aArgs, size_t));
+        break;
+
+    case kArgPtrDiff:
+        value = static_cast<uint64_t>(va_arg(aArgs, ptrdiff_t));
+        break;
+
+    case kArgPointer:
+        value = reinterpret_cast<uintptr_t>(va_arg(aArgs, void *));
+        break;
+
+    case kArgString:
+    {
+        const char *string    = va_arg(aArgs, const char *);
+        uint16_t    maxLength = kMaxStringLength;
+        uint8_t     length;
+
+        if (string == nullptr)
+        {
+            string = "";
+        }
+
+        if (precision >= 0)
+        {
+            maxLength = Min<uint16_t>(maxLength, static_cast<uint16_t>(Min(precision, 0xffff)));
+        }
+
+        length = static_cast<uint8_t>(StringLength(string, maxLength));
+
+        SuccessOrExit(error = aBuilder.AppendUint8(length));
+        error = aBuilder.AppendBytes(string, length);
+        ExitNow();
+    }
+
+    case kArgUnsupported:
+        break;
+    }
+
+    error = AppendUint(aBuilder, value, aSpec.GetArgSize());
+
+exit:
+    return error;
+}
+
+Error BinaryLog::AppendUint(FrameBuilder &aBuilder, uint64_t aValue, uint8_t aSize)
+{
+    // Appends the `aSize` least significant bytes of `aValue` in
+    // little-endian order.
+
+    Error error = kErrorNone;
+
+    VerifyOrExit(aBuilder.CanAppend(aSize), error = kErrorNoBufs);
+
+    for (uint8_t index = 0; index < aSize; index++)
+    {
+        IgnoreError(aBuilder.AppendUint8(static_cast<uint8_t>(aValue >> (index * kBitsPerByte))));
+    }
+
+exit:
+    return error;
+}
+
+void BinaryLog::WriteBytes(const uint8_t *aBytes, uint16_t aLength)
+{
+    uint16_t writeIndex = (sReadIndex + sUsedLength) % kBufferSize;
+    uint16_t length     = Min<uint16_t>(aLength, kBufferSize - writeIndex);
+
+    memcpy(&sBuffer[writeIndex], aBytes, length);
+    memcpy(&sBuffer[0], aBytes + length, aLength - length);
+
+    sUsedLength += aLength;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Reading
+
+Error BinaryLog::ReadRecord(uint8_t *aBuffer, uint16_t &aLength)
+{
+    Error    error = kErrorNone;
+    uint16_t length;
+
+    VerifyOrExit(sUsedLength > 0, error = kErrorNotFound);
+
+    length = PeekRecordLength();
+
+    if (length > aLength)
+    {
+        aLength = length;
+        ExitNow(error = kErrorNoBufs);
+    }
+
+    ReadBytes(aBuffer, length);
+    aLength = length;
+
+exit:
+    return error;
+}
+
+Error BinaryLog::ReadLog(char *aBuffer, uint16_t aSize)
+{
+    Error        error;
+    uint8_t      record[kMaxRecordSize];
+    uint16_t     length = sizeof(record);
+    FrameData    frameData;
+    Header       header;
+    StringWriter writer(aBuffer, aSize);
+
+    SuccessOrExit(error = ReadRecord(record, length));
+
+    frameData.Init(record, length);
+    SuccessOrExit(error = ParseHeader(frameData, header));
+
+    writer.Append("%lu ", ToUlong(header.mTimestamp));
+    Logger::AppendPrefix(writer, header.mModuleName, header.mLogLevel, header.mError);
+    FormatArgs(writer, header.mFormat, frameData);
+    Logger::AppendSuffix(writer, header.mError);
+
+exit:
+    return error;
+}
+
+uint16_t BinaryLog::PeekRecordLength(void)
+{
+    return static_cast<uint16_t>(sBuffer[sReadIndex] | (sBuffer[(sReadIndex + 1) % kBufferSize] << kBitsPerByte));
+}
+
+void BinaryLog::ReadBytes(uint8_t *aBytes, uint16_t aLength)
+{
+    uint16_t length = Min<uint16_t>(aLength, kBufferSize - sReadIndex);
+
+    memcpy(aBytes, &sBuffer[sReadIndex], length);
+    memcpy(aBytes + length, &sBuffer[0], aLength - length);
+
+    sReadIndex = (sReadIndex + aLength) % kBufferSize;
+    sUsedLength -= aLength;
+}
+
+Error BinaryLog::ReadUint(FrameData &aFrameData, uint64_t &aValue, uint8_t aSize)
+{
+    Error   error = kErrorNone;
+    uint8_t byte;
+
+    aValue = 0;
+
+    VerifyOrExit(aFrameData.CanRead(aSize), error = kErrorParse);
+
+    for (uint8_t index = 0; index < aSize; index++)
+    {
+        IgnoreError(aFrameData.ReadUint8(byte));
+        aValue |= static_cast<uint64_t>(byte) << (index * kBitsPerByte);
+    }
+
+exit:
+    return error;
+}
+
+Error BinaryLog::ParseHeader(FrameData &aFrameData, Header &aHeader)
+{
+    Error    error;
+    uint64_t value;
+
+    SuccessOrExit(error = ReadUint(aFrameData, value, sizeof(uint16_t)));
+    SuccessOrExit(error = ReadUint(aFrameData, value, sizeof(uint8_t)));
+    aHeader.mLogLevel = static_cast<LogLevel>(value);
+    SuccessOrExit(error = ReadUint(aFrameData, value, sizeof(uint8_t)));
+    aHeader.mError = static_cast<Error>(value);
+    SuccessOrExit(error = ReadUint(aFrameData, value, sizeof(uint32_t)));
+    aHeader.mTimestamp = static_cast<uint32_t>(value);
+    SuccessOrExit(error = ReadUint(aFrameData, value, sizeof(uintptr_t)));
+    aHeader.mModuleName = reinterpret_cast<const char *>(static_cast<uintptr_t>(value));
+    SuccessOrExit(error = ReadUint(aFrameData, value, sizeof(uintptr_t)));
+    aHeader.mFormat = reinterpret_cast<const char *>(static_cast<uintptr_t>(value));
+
+exit:
+    return error;
+}
+
+void BinaryLog::FormatArgs(StringWriter &aWriter, const char *aFormat, FrameData &aFrameData)
+{
+    // Walks the format string in the same way as `Record()`,
+    // appending the literal parts as is and formatting each
+    // conversion spec using the next saved argument. Stops if the
+    // record ends before all the conversions are formatted.
+
+    const char *cur = aFormat;
+
+    while (*cur != '\0')
+    {
+        const char *start = cur;
+        FormatSpec  spec;
+
+        while ((*cur != '\0') && (*cur != '%'))
+        {
+            cur++;
+        }
+
+        aWriter.Append("%.*s", static_cast<int>(cur - start), start);
+
+        VerifyOrExit(*cur == '%');
+
+        cur = spec.Parse(cur + 1);
+        SuccessOrExit(FormatArg(aWriter, spec, aFrameData));
+    }
+
+exit:
+    return;
+}
+
+Error BinaryLog::FormatArg(StringWriter &aWriter, const FormatSpec &aSpec, FrameData &aFrameData)
+{
+    static constexpr uint8_t kSpecStringSize = 2 * kMaxSpecLength;
+
+    Error        error = kErrorNone;
+    char         specString[kSpecStringSize];
+    StringWriter specWriter(specString, sizeof(specString));
+    uint64_t     value;
+
+    VerifyOrExit(aSpec.mArgType != kArgUnsupported, error = kErrorNotCapable);
+
+    if (aSpec.mArgType == kArgNone)
+    {
+        aWriter.Append("%%");
+        ExitNow();
+    }
+
+    // Rebuild the spec (without the length modifier) replacing any
+    // '*' with its saved width or precision value.
+
+    for (uint8_t index = 0; index < aSpec.mPrefixLength; index++)
+    {
+        char c = aSpec.mStart[index];
+
+        if (c == '*')
+        {
+            SuccessOrExit(error = ReadUint(aFrameData, value, sizeof(int)));
+            specWriter.Append("%d", static_cast<int>(SignExtend(value, sizeof(int))));
+        }
+        else
+        {
+            specWriter.Append("%c", c);
+        }
+    }
+
+    switch (aSpec.mArgType)
+    {
+    case kArgString:
+    {
+        char    string[kMaxStringLength + 1];
+        uint8_t length;
+
+        SuccessOrExit(error = aFrameData.ReadUint8(length));
+        VerifyOrExit(length <= kMaxStringLength, error = kErrorParse);
+        SuccessOrExit(error = aFrameData.ReadBytes(string, length));
+        string[length] = '\0';
+
+        specWriter.Append("s");
+        VerifyOrExit(!specWriter.IsTruncated(), error = kErrorNoBufs);
+        AppendFormattedArg(aWriter, specString, string);
+        break;
+    }
+
+    case kArgPointer:
+        SuccessOrExit(error = ReadUint(aFrameData, value, sizeof(uintptr_t)));
+
+        specWriter.Append("p");
+        VerifyOrExit(!specWriter.IsTruncated(), error = kErrorNoBufs);
+        AppendFormattedArg(aWriter, specString, reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+        break;
+
+    default:
+        SuccessOrExit(error = ReadUint(aFrameData, value, aSpec.GetArgSize()));
+
+        if (aSpec.mConversion == 'c')
+        {
+            specWriter.Append("c");
+            VerifyOrExit(!specWriter.IsTruncated(), error = kErrorNoBufs);
+            AppendFormattedArg(aWriter, specString, static_cast<int>(value));
+        }
+        else if (aSpec.IsSigned())
+        {
+            long long arg = static_cast<long long>(SignExtend(value, aSpec.GetArgSize()));
+
+            // Like `printf()`, `hh` and `h` convert the promoted `int`
+            // back to `char` or `short` before formatting it.
+
+            if (aSpec.mArgType == kArgChar)
+            {
+                arg = static_cast<signed char>(arg);
+            }
+            else if (aSpec.mArgType == kArgShort)
+            {
+                arg = static_cast<short>(arg);
+            }
+
+            specWriter.Append("ll%c", aSpec.mConversion);
+            VerifyOrExit(!specWriter.IsTruncated(), error = kErrorNoBufs);
+            AppendFormattedArg(aWriter, specString, arg);
+        }
+        else
+        {
+            unsigned long long arg = static_cast<unsigned long long>(value);
+
+            if (aSpec.mArgType == kArgChar)
+            {
+                arg = static_cast<unsigned char>(arg);
+            }
+            else if (aSpec.mArgType == kArgShort)
+            {
+                arg = static_cast<unsigned short>(arg);
+            }
+
+            specWriter.Append("ll%c", aSpec.mConversion);
+            VerifyOrExit(!specWriter.IsTruncated(), error = kErrorNoBufs);
+            AppendFormattedArg(aWriter, specString, arg);
+        }
+
+        break;
+    }
+
+exit:
+    return error;
+}
+
+int64_t BinaryLog::SignExtend(uint64_t aValue, uint8_t aSize)
+{
+    uint8_t numBits = aSize * kBitsPerByte;
+
+    if ((numBits < 64) && ((aValue >> (numBits - 1)) & 1))
+    {
+        aValue |= (~static_cast<uint64_t>(0)) << numBits;
+    }
+
+    return static_cast<int64_t>(aValue);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// FormatSpec
+
+const char *BinaryLog::FormatSpec::Parse(const char *aFormat)
+{
+    const char *cur     = aFormat;
+    ArgType     intType = kArgInt;
+    bool        hasLengthModifier;
+
+    mStart            = aFormat - 1;
+    mNumStars         = 0;
+    mHasStarPrecision = false;
+    mPrecision        = -1;
+    mArgType          = kArgUnsupported;
+
+    while ((*cur == '-') || (*cur == '+') || (*cur == ' ') || (*cur == '#') || (*cur == '0'))
+    {
+        cur++;
+    }
+
+    if (*cur == '*')
+    {
+        mNumStars++;
+        cur++;
+    }
+
+    while ((*cur >= '0') && (*cur <= '9'))
+    {
+        cur++;
+    }
+
+    if (*cur == '.')
+    {
+        cur++;
+
+        if (*cur == '*')
+        {
+            mNumStars++;
+            mHasStarPrecision = true;
+            cur++;
+        }
+        else
+        {
+            mPrecision = 0;
+
+            while ((*cur >= '0') && (*cur <= '9'))
+            {
+                mPrecision = Min(mPrecision * 10 + (*cur - '0'), 0xffff);
+                cur++;
+            }
+        }
+    }
+
+    mPrefixLength     = static_cast<uint8_t>(Min<ptrdiff_t>(cur - mStart, kMaxSpecLength));
+    hasLengthModifier = true;
+
+    switch (*cur)
+    {
+    case 'h':
+        cur++;
+        intType = kArgShort;
+
+        if (*cur == 'h')
+        {
+            cur++;
+            intType = kArgChar;
+        }
+
+        break;
+
+    case 'l':
+        cur++;
+        intType = kArgLong;
+
+        if (*cur == 'l')
+        {
+            cur++;
+            intType = kArgLongLong;
+        }
+
+        break;
+
+    case 'j':
+        cur++;
+        intType = kArgIntMax;
+        break;
+
+    case 'z':
+        cur++;
+        intType = kArgSize;
+        break;
+
+    case 't':
+        cur++;
+        intType = kArgPtrDiff;
+        break;
+
+    default:
+        hasLengthModifier = false;
+        break;
+    }
+
+    mConversion = *cur;
+
+    switch (mConversion)
+    {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+        mArgType = intType;
+        break;
+
+    case 'c':
+        mArgType = hasLengthModifier ? kArgUnsupported : kArgInt;
+        break;
+
+    case 's':
+        mArgType = hasLengthModifier ? kArgUnsupported : kArgString;
+        break;
+
+    case 'p':
+        mArgType = hasLengthModifier ? kArgUnsupported : kArgPointer;
+        break;
+
+    case '%':
+        mArgType = (cur == aFormat) ? kArgNone : kArgUnsupported;
+        break;
+
+    default:
+        break;
+    }
+
+    if (cur - mStart >= kMaxSpecLength)
+    {
+        mArgType = kArgUnsupported;
+    }
+
+    if (mConversion != '\0')
+    {
+        cur++;
+    }
+
+    return cur;
+}
+
+uint8_t BinaryLog::FormatSpec::GetArgSize(void) const
+{
+    uint8_t size = 0;
+
+    switch (mArgType)
+    {
+    case kArgChar:
+    case kArgShort:
+    case kArgInt:
+        // `char` and `short` arguments are promoted to `int`.
+        size = sizeof(int);
+        break;
+    case kArgLong:
+        size = sizeof(long);
+        break;
+    case kArgLongLong:
+        size = sizeof(long long);
+        break;
+    case kArgIntMax:
+        size = sizeof(intmax_t);
+        break;
+    case kArgSize:
+        size = sizeof(size_t);
+        break;
+    case kArgPtrDiff:
+        size = sizeof(ptrdiff_t);
+        break;
+    case kArgPointer:
+        size = sizeof(uintptr_t);
+        break;
+    case kArgString:
+    case kArgNone:
+    case kArgUnsupported:
+        break;
+    }
+
+    return size;
+}
+
+} // namespace ot
+
+#endif // OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
@@ -0,0 +1,202 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the binary log mode.
+ */
+
+#ifndef OT_CORE_COMMON_BINARY_LOG_HPP_
+#define OT_CORE_COMMON_BINARY_LOG_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdarg.h>
+
+#include <openthread/logging.h>
+
+#include "common/clearable.hpp"
+#include "common/error.hpp"
+#include "common/frame_builder.hpp"
+#include "common/frame_data.hpp"
+#include "common/log.hpp"
+#include "common/string.hpp"
+
+namespace ot {
+
+#if OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+/**
+ * Implements the binary log mode.
+ *
+ * In binary log mode, a log is saved as a record containing the format string address (as the format ID) and the raw
+ * arguments instead of being formatted. Formatting is deferred to the reader (`ReadLog()`) or to an offline decoder
+ * (`ReadRecord()`). See `otLoggingReadBinaryRecord()` for the record layout.
+ *
+ * Similar to `Logger`, the `BinaryLog` methods are static and the records from all instances share the same buffer.
+ */
+class BinaryLog
+{
+    friend class Logger;
+
+public:
+    /**
+     * Represents the binary log counters.
+     */
+    class Counters : public otLogBinaryCounters, public Clearable<Counters>
+    {
+        friend class BinaryLog;
+    };
+
+    /**
+     * Enables or disables the binary log mode.
+     *
+     * @param[in] aEnable  TRUE to enable, FALSE to disable.
+     */
+    static void SetEnabled(bool aEnable) { sEnabled = aEnable; }
+
+    /**
+     * Indicates whether or not the binary log mode is enabled.
+     *
+     * @retval TRUE   The binary log mode is enabled.
+     * @retval FALSE  The binary log mode is disabled.
+     */
+    static bool IsEnabled(void) { return sEnabled; }
+
+    /**
+     * Reads and removes the oldest record from the binary log buffer.
+     *
+     * @param[out]    aBuffer   A pointer to a buffer to output the record.
+     * @param[in,out] aLength   On input, the size of @p aBuffer. On output, the length of the record.
+     *
+     * @retval kErrorNone      Successfully read the record.
+     * @retval kErrorNotFound  The buffer is empty.
+     * @retval kErrorNoBufs    @p aBuffer is too small, @p aLength is updated to the record length.
+     */
+    static Error ReadRecord(uint8_t *aBuffer, uint16_t &aLength);
+
+    /**
+     * Reads and removes the oldest record from the binary log buffer and formats it as a log string.
+     *
+     * @param[out] aBuffer   A pointer to a buffer to output the string.
+     * @param[in]  aSize     The size of @p aBuffer.
+     *
+     * @retval kErrorNone      Successfully read and formatted the record.
+     * @retval kErrorNotFound  The buffer is empty.
+     */
+    static Error ReadLog(char *aBuffer, uint16_t aSize);
+
+    /**
+     * Gets the binary log counters.
+     *
+     * @returns The binary log counters.
+     */
+    static const Counters &GetCounters(void) { return sCounters; }
+
+    /**
+     * Resets the binary log counters.
+     */
+    static void ResetCounters(void) { sCounters.Clear(); }
+
+private:
+    static constexpr uint16_t kBufferSize      = OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE;
+    static constexpr uint16_t kMaxRecordSize   = OPENTHREAD_CONFIG_LOG_MAX_SIZE;
+    static constexpr uint8_t  kMaxStringLength = OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_ARG_LENGTH;
+    static constexpr uint8_t  kMaxSpecLength   = 24;
+
+    static_assert(kBufferSize >= kMaxRecordSize, "LOG_BINARY_BUFFER_SIZE is smaller than LOG_MAX_SIZE");
+    static_assert(kMaxStringLength < kMaxRecordSize, "LOG_BINARY_MAX_STRING_ARG_LENGTH is too long");
+
+    enum ArgType : uint8_t
+    {
+        kArgChar,
+        kArgShort,
+        kArgInt,
+        kArgLong,
+        kArgLongLong,
+        kArgIntMax,
+        kArgSize,
+        kArgPtrDiff,
+        kArgPointer,
+        kArgString,
+        kArgNone,
+        kArgUnsupported,
+    };
+
+    struct FormatSpec
+    {
+        // Parses a conversion spec starting right after its '%' char.
+        // Returns a pointer to the char following the spec.
+        const char *Parse(const char *aFormat);
+
+        uint8_t GetArgSize(void) const;
+        bool    IsSigned(void) const { return (mConversion == 'd') || (mConversion == 'i'); }
+
+        const char *mStart;        // Points to the '%' char.
+        uint8_t     mPrefixLength; // Length of flags, width and precision (including the '%' char).
+        uint8_t     mNumStars;     // Number of '*' width or precision.
+        bool        mHasStarPrecision;
+        int         mPrecision; // Precision value if it is given in the spec, or -1.
+        char        mConversion;
+        ArgType     mArgType;
+    };
+
+    struct Header
+    {
+        LogLevel    mLogLevel;
+        Error       mError;
+        uint32_t    mTimestamp;
+        const char *mModuleName;
+        const char *mFormat;
+    };
+
+    static void Record(const char *aModuleName, LogLevel aLogLevel, Error aError, const char *aFormat, va_list aArgs);
+
+    static Error    AppendArg(FrameBuilder &aBuilder, const FormatSpec &aSpec, va_list &aArgs);
+    static Error    AppendUint(FrameBuilder &aBuilder, uint64_t aValue, uint8_t aSize);
+    static Error    ReadUint(FrameData &aFrameData, uint64_t &aValue, uint8_t aSize);
+    static Error    ParseHeader(FrameData &aFrameData, Header &aHeader);
+    static void     FormatArgs(StringWriter &aWriter, const char *aFormat, FrameData &aFrameData);
+    static Error    FormatArg(StringWriter &aWriter, const FormatSpec &aSpec, FrameData &aFrameData);
+    static int64_t  SignExtend(uint64_t aValue, uint8_t aSize);
+    static uint16_t PeekRecordLength(void);
+    static void     WriteBytes(const uint8_t *aBytes, uint16_t aLength);
+    static void     ReadBytes(uint8_t *aBytes, uint16_t aLength);
+
+    static bool     sEnabled;
+    static uint16_t sReadIndex;
+    static uint16_t sUsedLength;
+    static Counters sCounters;
+    static uint8_t  sBuffer[kBufferSize];
+};
+
+#endif // OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+} // namespace ot
+
+#endif // OT_CORE_COMMON_BINARY_LOG_HPP_
@@ -34,9 +34,11 @@
 #include "log.hpp"
 
 #include <ctype.h>
+#include <string.h>
 
 #include <openthread/platform/logging.h>
 
+#include "common/binary_log.hpp"
 #include "common/code_utils.hpp"
 #include "common/num_utils.hpp"
 #include "common/numeric_limits.hpp"
@@ -56,6 +58,10 @@
 #error "OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME requires OPENTHREAD_CONFIG_UPTIME_ENABLE"
 #endif
 
+#if OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE && !OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+#error "OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE requires OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE"
+#endif
+
 namespace ot {
 
 #if OT_SHOULD_LOG
@@ -115,11 +121,19 @@ void Logger::LogVarArgs(const char *aModuleName, LogLevel aLogLevel, const char
 
 void Logger::Log(const char *aModuleName, LogLevel aLogLevel, Error aError, const char *aFormat, va_list aArgs)
 {
-    static const char kModuleNamePadding[] = "--------------";
-
     ot::String<OPENTHREAD_CONFIG_LOG_MAX_SIZE> logString;
 
-    static_assert(sizeof(kModuleNamePadding) == kMaxLogModuleNameLength + 1, "Padding string is not correct");
+#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+    VerifyOrExit(GetLogLevel(aModuleName) >= aLogLevel);
+#endif
+
+#if OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    if (BinaryLog::IsEnabled())
+    {
+        BinaryLog::Record(aModuleName, aLogLevel, aError, aFormat, aArgs);
+        ExitNow();
+    }
+#endif
 
 #if OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME
     {
@@ -145,36 +159,38 @@ void Logger::Log(const char *aModuleName, LogLevel aLogLevel, Error aError, cons
     }
 #endif
 
-#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+    AppendPrefix(logString, aModuleName, aLogLevel, aError);
+    logString.AppendVarArgs(aFormat, aArgs);
+    AppendSuffix(logString, aError);
 
-#if !OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
-    if (Instance::Get().IsInitialized())
-    {
-        VerifyOrExit(Instance::Get().GetLogLevel() >= aLogLevel);
-    }
-    else
-    {
-        VerifyOrExit(OPENTHREAD_CONFIG_LOG_LEVEL_INIT >= aLogLevel);
-    }
-#elif !OPENTHREAD_CONFIG_LOG_INSTANCE_AWARE_API_ENABLE
-    VerifyOrExit(Instance::GetGlobalLogLevel() >= aLogLevel);
-#else
+#if OPENTHREAD_CONFIG_LOG_INSTANCE_AWARE_API_ENABLE
     {
-        Instance *instance = Instance::GetActiveInstance();
+        Instance *instance;
 
+#if OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+        instance = Instance::GetActiveInstance();
         VerifyOrExit(instance != nullptr);
-        if (instance->IsInitialized())
-        {
-            VerifyOrExit(instance->GetLogLevel() >= aLogLevel);
-        }
-        else
-        {
-            VerifyOrExit(OPENTHREAD_CONFIG_LOG_LEVEL_INIT >= aLogLevel);
-        }
+#else
+        instance = &Instance::Get();
+#endif
+
+        otPlatLogOutput(instance, aLogLevel, logString.AsCString());
     }
+#else
+    otPlatLog(aLogLevel, OT_LOG_REGION_CORE, "%s", logString.AsCString());
 #endif
 
-#endif // OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+    ExitNow();
+
+exit:
+    return;
+}
+
+void Logger::AppendPrefix(StringWriter &aWriter, const char *aModuleName, LogLevel aLogLevel, Error aError)
+{
+    static const char kModuleNamePadding[] = "--------------";
+
+    static_assert(sizeof(kModuleNamePadding) == kMaxLogModuleNameLength + 1, "Padding string is not correct");
 
 #if OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL
     {
@@ -187,50 +203,157 @@ void Logger::Log(const char *aModuleName, LogLevel aLogLevel, Error aError, cons
             'D', /* kLogLevelDebg */
         };
 
-        logString.Append("[%c] ", kLevelChars[aLogLevel]);
+        aWriter.Append("[%c] ", kLevelChars[aLogLevel]);
     }
+#else
+    OT_UNUSED_VARIABLE(aLogLevel);
 #endif
 
-    logString.Append("%.*s%s: ", kMaxLogModuleNameLength, aModuleName,
-                     &kModuleNamePadding[StringLength(aModuleName, kMaxLogModuleNameLength)]);
+    aWriter.Append("%.*s%s: ", kMaxLogModuleNameLength, aModuleName,
+                   &kModuleNamePadding[StringLength(aModuleName, kMaxLogModuleNameLength)]);
 
     if (aError != kErrorNone)
     {
-        logString.Append("Failed to ");
+        aWriter.Append("Failed to ");
     }
+}
 
-    logString.AppendVarArgs(aFormat, aArgs);
-
+void Logger::AppendSuffix(StringWriter &aWriter, Error aError)
+{
     if (aError != kErrorNone)
     {
-        logString.Append(" - %s", ErrorToString(aError));
+        aWriter.Append(" - %s", ErrorToString(aError));
     }
 
-    logString.Append("%s", OPENTHREAD_CONFIG_LOG_SUFFIX);
+    aWriter.Append("%s", OPENTHREAD_CONFIG_LOG_SUFFIX);
+}
 
-#if OPENTHREAD_CONFIG_LOG_INSTANCE_AWARE_API_ENABLE
+#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+
+LogLevel Logger::GetLogLevel(const char *aModuleName)
+{
+    // Returns the log level to use for logs from `aModuleName`, i.e.,
+    // the module log level (if set), otherwise the current dynamic
+    // log level.
+
+    LogLevel logLevel = kLogLevelNone;
+
+#if OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
     {
-        Instance *instance;
+        const ModuleLogLevel *entry = FindModuleLogLevel(aModuleName);
 
-#if OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
-        instance = Instance::GetActiveInstance();
-        VerifyOrExit(instance != nullptr);
+        if (entry != nullptr)
+        {
+            ExitNow(logLevel = entry->mLogLevel);
+        }
+    }
 #else
-        instance = &Instance::Get();
+    OT_UNUSED_VARIABLE(aModuleName);
 #endif
 
-        otPlatLogOutput(instance, aLogLevel, logString.AsCString());
+#if !OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+    if (Instance::Get().IsInitialized())
+    {
+        logLevel = Instance::Get().GetLogLevel();
     }
+    else
+    {
+        logLevel = static_cast<LogLevel>(OPENTHREAD_CONFIG_LOG_LEVEL_INIT);
+    }
+#elif !OPENTHREAD_CONFIG_LOG_INSTANCE_AWARE_API_ENABLE
+    logLevel = Instance::GetGlobalLogLevel();
 #else
-    otPlatLog(aLogLevel, OT_LOG_REGION_CORE, "%s", logString.AsCString());
+    {
+        Instance *instance = Instance::GetActiveInstance();
+
+        VerifyOrExit(instance != nullptr);
+
+        if (instance->IsInitialized())
+        {
+            logLevel = instance->GetLogLevel();
+        }
+        else
+        {
+            logLevel = static_cast<LogLevel>(OPENTHREAD_CONFIG_LOG_LEVEL_INIT);
+        }
+    }
 #endif
 
     ExitNow();
 
 exit:
-    return;
+    return logLevel;
+}
+
+#endif // OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+
+#if OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+
+Logger::ModuleLogLevel Logger::sModuleLogLevels[kMaxModuleLogLevels];
+uint8_t                Logger::sNumModuleLogLevels = 0;
+
+Error Logger::SetModuleLogLevel(const char *aModuleName, LogLevel aLogLevel)
+{
+    Error           error = kErrorNone;
+    ModuleLogLevel *entry;
+    uint16_t        length;
+
+    VerifyOrExit(aLogLevel <= kLogLevelDebg, error = kErrorInvalidArgs);
+
+    length = StringLength(aModuleName, kMaxLogModuleNameLength + 1);
+    VerifyOrExit((length > 0) && (length <= kMaxLogModuleNameLength), error = kErrorInvalidArgs);
+
+    entry = FindModuleLogLevel(aModuleName);
+
+    if (entry == nullptr)
+    {
+        VerifyOrExit(sNumModuleLogLevels < kMaxModuleLogLevels, error = kErrorNoBufs);
+
+        entry = &sModuleLogLevels[sNumModuleLogLevels++];
+        memcpy(entry->mModuleName, aModuleName, length);
+        entry->mModuleName[length] = kNullChar;
+    }
+
+    entry->mLogLevel = aLogLevel;
+
+exit:
+    return error;
 }
 
+Error Logger::ClearModuleLogLevel(const char *aModuleName)
+{
+    Error           error = kErrorNone;
+    ModuleLogLevel *entry = FindModuleLogLevel(aModuleName);
+
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
+
+    // Move the last entry into the removed entry's slot.
+    *entry = sModuleLogLevels[--sNumModuleLogLevels];
+
+exit:
+    return error;
+}
+
+void Logger::ClearAllModuleLogLevels(void) { sNumModuleLogLevels = 0; }
+
+Logger::ModuleLogLevel *Logger::FindModuleLogLevel(const char *aModuleName)
+{
+    ModuleLogLevel *match = nullptr;
+
+    for (uint8_t index = 0; index < sNumModuleLogLevels; index++)
+    {
+        if (StringMatch(sModuleLogLevels[index].mModuleName, aModuleName))
+        {
+            match = &sModuleLogLevels[index];
+            break;
+        }
+    }
+
+    return match;
+}
+
+#endif // OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+
 #if OPENTHREAD_CONFIG_LOG_PKT_DUMP
 
 template <LogLevel kLogLevel>
@@ -273,7 +396,11 @@ void Logger::DumpInModule(const char *aModuleName,
 {
     HexDumpInfo info;
 
+#if OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+    VerifyOrExit(GetLogLevel(aModuleName) >= aLogLevel);
+#else
     VerifyOrExit(otLoggingGetLevel() >= aLogLevel);
+#endif
 
     info.mDataBytes  = reinterpret_cast<const uint8_t *>(aData);
     info.mDataLength = aDataLength;
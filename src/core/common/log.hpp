@@ -347,6 +347,9 @@ constexpr uint16_t kMaxLogStringSize = OPENTHREAD_CONFIG_LOG_MAX_SIZE; ///< Max
 
 #if OT_SHOULD_LOG
 
+class BinaryLog;
+class StringWriter;
+
 class Logger
 {
     // The `Logger` class implements the logging methods.
@@ -389,9 +392,40 @@ public:
     static void DumpAtLevel(const char *aModuleName, const char *aText, const void *aData, uint16_t aDataLength);
 #endif
 
+#if OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+    static Error SetModuleLogLevel(const char *aModuleName, LogLevel aLogLevel);
+    static Error ClearModuleLogLevel(const char *aModuleName);
+    static void  ClearAllModuleLogLevels(void);
+#endif
+
 private:
+    friend class BinaryLog;
+
+#if OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+    static constexpr uint8_t kMaxModuleLogLevels = OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_MAX_ENTRIES;
+
+    struct ModuleLogLevel
+    {
+        char     mModuleName[kMaxLogModuleNameLength + 1];
+        LogLevel mLogLevel;
+    };
+#endif
+
     static void Log(const char *aModuleName, LogLevel aLogLevel, Error aError, const char *aFormat, va_list aArgs)
         OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(4, 0);
+    static void AppendPrefix(StringWriter &aWriter, const char *aModuleName, LogLevel aLogLevel, Error aError);
+    static void AppendSuffix(StringWriter &aWriter, Error aError);
+
+#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+    static LogLevel GetLogLevel(const char *aModuleName);
+#endif
+
+#if OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+    static ModuleLogLevel *FindModuleLogLevel(const char *aModuleName);
+
+    static ModuleLogLevel sModuleLogLevels[kMaxModuleLogLevels];
+    static uint8_t        sNumModuleLogLevels;
+#endif
 };
 
 extern template void Logger::LogAtLevel<kLogLevelNone>(const char *aModuleName, const char *aFormat, ...);
@@ -349,6 +349,19 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+void Message::StartLatencyTrace(uint32_t aTime)
+{
+    VerifyOrExit(!GetMetadata().mLatencyTraceStarted);
+
+    GetMetadata().mLatencyTraceStarted = true;
+    GetMetadata().mLatencyStartTime    = aTime;
+
+exit:
+    return;
+}
+#endif
+
 const char *Message::PriorityToString(Priority aPriority)
 {
 #define PriorityMapList(_)       \
@@ -818,6 +831,12 @@ Message *Message::Clone(uint16_t aLength, uint16_t aReserveHeader) const
     clone->SetLoopbackToHostAllowed(IsLoopbackToHostAllowed());
     clone->SetOrigin(GetOrigin());
     clone->SetTimestamp(GetTimestamp());
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    if (IsLatencyTraceStarted())
+    {
+        clone->StartLatencyTrace(GetLatencyTraceStartTime());
+    }
+#endif
     clone->SetMeshDest(GetMeshDest());
     clone->SetPanId(GetPanId());
     clone->SetChannel(GetChannel());
@@ -222,6 +222,9 @@ protected:
 #endif
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         bool mTimeSync : 1; // Whether the message is also used for time sync purpose.
+#endif
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+        bool mLatencyTraceStarted : 1; // Whether the latency trace start time is set.
 #endif
         uint8_t mPriority : 2; // The message priority level (higher value is higher priority).
         uint8_t mOrigin : 2;   // The origin of the message.
@@ -244,6 +247,10 @@ protected:
         uint32_t mDatagramTag; // The datagram tag used for 6LoWPAN frags or IPv6fragmentation.
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         int64_t mNetworkTimeOffset; // The time offset to the Thread network time, in microseconds.
+#endif
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+        uint32_t mLatencyStartTime; // The time the message entered the tx pipeline (latency tracker time).
+        uint32_t mLatencyQueueTime; // The time the message was added to the send queue (latency tracker time).
 #endif
         TimeMilli   mTimestamp;   // The message timestamp.
         Message    *mNext;        // Next message in a doubly linked list.
@@ -1304,6 +1311,46 @@ public:
      */
     void SetTimestampToNow(void) { SetTimestamp(TimerMilli::GetNow()); }
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    /**
+     * Indicates whether or not the latency trace of the message is started.
+     *
+     * @retval TRUE   The latency trace is started.
+     * @retval FALSE  The latency trace is not started.
+     */
+    bool IsLatencyTraceStarted(void) const { return GetMetadata().mLatencyTraceStarted; }
+
+    /**
+     * Starts the latency trace of the message, if it is not already started.
+     *
+     * @param[in] aTime  The time the message entered the tx pipeline (in `Utils::PacketLatencyTracker` time base).
+     */
+    void StartLatencyTrace(uint32_t aTime);
+
+    /**
+     * Gets the time the message entered the tx pipeline.
+     *
+     * MUST be used when `IsLatencyTraceStarted()` is TRUE.
+     *
+     * @returns The latency trace start time.
+     */
+    uint32_t GetLatencyTraceStartTime(void) const { return GetMetadata().mLatencyStartTime; }
+
+    /**
+     * Gets the time the message was added to the send queue.
+     *
+     * @returns The latency trace queue time.
+     */
+    uint32_t GetLatencyTraceQueueTime(void) const { return GetMetadata().mLatencyQueueTime; }
+
+    /**
+     * Sets the time the message was added to the send queue.
+     *
+     * @param[in] aTime  The queue time (in `Utils::PacketLatencyTracker` time base).
+     */
+    void SetLatencyTraceQueueTime(uint32_t aTime) { GetMetadata().mLatencyQueueTime = aTime; }
+#endif
+
     /**
      * Returns whether or not message forwarding is scheduled for direct transmission.
      *
@@ -181,6 +181,9 @@ void Notifier::EmitEvents(void)
 #if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
     Get<Srp::Client>().HandleNotifierEvents(events);
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    Get<Dns::Client>().HandleNotifierEvents(events);
+#endif
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     Get<Srp::Server>().HandleNotifierEvents(events);
 #endif
@@ -197,6 +200,10 @@ void Notifier::EmitEvents(void)
 
     for (ExternalCallback &callback : mExternalCallbacks)
     {
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+        Utils::Profiler::HandlerSample sample(Get<Utils::Profiler>(), Utils::Profiler::kTypeStateChangedCallback,
+                                              callback.GetHandler());
+#endif
         callback.InvokeIfSet(events.GetAsFlags());
     }
 
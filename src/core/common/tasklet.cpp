@@ -133,6 +133,10 @@ void Tasklet::Scheduler::ProcessQueuedTasklets(void)
 
     while ((tasklet = mRunningQueue.PopTasklet()) != nullptr)
     {
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+        Utils::Profiler::HandlerSample sample(tasklet->Get<Utils::Profiler>(), Utils::Profiler::kTypeTasklet,
+                                              tasklet->mHandler);
+#endif
         tasklet->RunTask();
     }
 }
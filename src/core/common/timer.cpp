@@ -228,6 +228,12 @@ void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
         if (now >= timer->mFireTime)
         {
             Remove(*timer, aAlarmApi); // `Remove()` will `SetAlarm` for next timer if there is any.
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+            // The handler is captured before firing since the timer
+            // object may be freed from its own handler.
+            Utils::Profiler::HandlerSample sample(Get<Utils::Profiler>(), Utils::Profiler::kTypeTimer,
+                                                  timer->mHandler);
+#endif
             timer->Fired();
             ExitNow();
         }
@@ -82,6 +82,9 @@
  * Note: According to Thread Conformance v1.2.0, a Thread Border Router MUST be able to hold a Multicast Listeners Table
  * in memory with at least seventy five (75) entries.
  *
+ * Listeners are hashed by address and kept in an expiry heap, so larger values only cost memory (about 40 bytes per
+ * listener).
+ *
  * @sa MulticastListenersTable
  */
 #ifndef OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS
@@ -134,6 +134,18 @@
 #define OPENTHREAD_CONFIG_BORDER_AGENT_COMMISSIONER_EVICTION_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_BORDER_AGENT_MAX_SESSIONS
+ *
+ * Specifies the maximum number of concurrent secure sessions accepted by the Border Agent.
+ *
+ * Sessions are allocated from the heap when a new DTLS connection request is received. A new connection request is
+ * rejected when this limit is reached.
+ */
+#ifndef OPENTHREAD_CONFIG_BORDER_AGENT_MAX_SESSIONS
+#define OPENTHREAD_CONFIG_BORDER_AGENT_MAX_SESSIONS 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_BORDER_AGENT_TRACKER_ENABLE
  *
@@ -199,6 +199,39 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_QUERY_MAX_SIZE 1024
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define as 1 to enable the DNS client answer cache.
+ *
+ * When enabled, responses to address, browse, service and record queries are kept (up to the TTL of their records)
+ * and later identical queries to the same server are answered locally without sending a query message. Negative
+ * responses (NXDOMAIN or no data) are cached using the SOA record from the authority section (RFC 2308).
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of responses kept in the DNS client answer cache. When the cache is full, the least
+ * recently used entry is evicted.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+ *
+ * Specifies the maximum time (in seconds) a response is kept in the DNS client answer cache, regardless of the TTL of
+ * its records.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL 3600
+#endif
+
 /**
  * @}
  */
@@ -74,9 +74,26 @@
  * @def OPENTHREAD_CONFIG_DNS_DSO_MAX_PENDING_REQUESTS
  *
  * Specifies the maximum number of pending requests per DSO session.
+ *
+ * The pending requests table is allocated from heap as requests are sent, so this only limits the number of requests
+ * that can be pipelined on a session (waiting for their responses).
  */
 #ifndef OPENTHREAD_CONFIG_DNS_DSO_MAX_PENDING_REQUESTS
-#define OPENTHREAD_CONFIG_DNS_DSO_MAX_PENDING_REQUESTS 3
+#define OPENTHREAD_CONFIG_DNS_DSO_MAX_PENDING_REQUESTS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_DSO_SLEEPY_KEEP_ALIVE_INTERVAL
+ *
+ * Specifies the minimum Keep Alive interval (in msec) requested by a DSO client when the device is in rx-off-when-idle
+ * mode (sleepy).
+ *
+ * Every Keep Alive exchange wakes a sleepy device and the response needs to be held by its parent until the next data
+ * poll, so a sleepy client asks the server for a longer interval. The server may still grant a shorter one. Set to
+ * zero to request the same interval regardless of the device mode.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_DSO_SLEEPY_KEEP_ALIVE_INTERVAL
+#define OPENTHREAD_CONFIG_DNS_DSO_SLEEPY_KEEP_ALIVE_INTERVAL (5 * 60 * 1000)
 #endif
 
 /**
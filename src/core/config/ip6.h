@@ -216,6 +216,16 @@
 #define OPENTHREAD_CONFIG_TCP_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TCP_PACING_MAX_QUEUED_SEGMENTS
+ *
+ * Specifies the maximum number of data segments of a TCP endpoint with pacing enabled that can be waiting in the
+ * send queue. New data is held back until the number of queued segments drops below this limit.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_PACING_MAX_QUEUED_SEGMENTS
+#define OPENTHREAD_CONFIG_TCP_PACING_MAX_QUEUED_SEGMENTS 2
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TLS_ENABLE
  *
@@ -211,6 +211,69 @@
 #define OPENTHREAD_CONFIG_LOG_LEVEL_OVERRIDE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+ *
+ * Define to 1 to enable per-module dynamic log level filters and their associated APIs.
+ *
+ * This feature requires `OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE`. A log level set for a module replaces the
+ * current dynamic log level for logs emitted by that module, e.g., to capture debug logs from a single module without
+ * raising the log level of the whole stack. The compile-time `OPENTHREAD_CONFIG_LOG_LEVEL` still limits which logs are
+ * included in the build.
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+#define OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_MAX_ENTRIES
+ *
+ * Specifies the maximum number of modules with a log level filter.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_MAX_ENTRIES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+ *
+ * Define to 1 to enable the binary log mode and its associated APIs.
+ *
+ * When the binary log mode is enabled at run-time (see `otLoggingSetBinaryModeEnabled()`), logs are not formatted
+ * on the device. Instead the format string address (used as the format ID) and the raw arguments are saved as a
+ * binary record in a ring buffer. Records are later read and either formatted by the reader or passed as-is to an
+ * offline decoder which maps the format ID to the format string in the firmware image.
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+#define OPENTHREAD_CONFIG_LOG_BINARY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+ *
+ * Specifies the size (number of bytes) of the ring buffer storing binary log records.
+ *
+ * Applicable when `OPENTHREAD_CONFIG_LOG_BINARY_ENABLE` is enabled. When the buffer is full new records are dropped
+ * (and counted) until the reader frees up space.
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE 2048
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_ARG_LENGTH
+ *
+ * Specifies the maximum number of chars saved for a string (`%s`) argument in a binary log record.
+ *
+ * String arguments are copied into the record since the string may not remain valid until the record is read.
+ * Longer strings are truncated.
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_ARG_LENGTH
+#define OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_ARG_LENGTH 48
+#endif
+
 /**
  * @}
  */
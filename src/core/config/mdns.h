@@ -114,6 +114,19 @@
 #define OPENTHREAD_CONFIG_MULTICAST_DNS_PERSIST_STATE_ON_POST_PROBE_CONFLICT 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+ *
+ * Define to 1 to allow the mDNS module to save a snapshot of its cached records (from browsers and resolvers) and to
+ * restore it later, e.g., across a restart of the process running the OpenThread stack.
+ *
+ * Restored records are treated as unverified. They are reported to browsers and resolvers right away, but are not used
+ * as known-answers in queries, and are revalidated once a browser or resolver is started for them.
+ */
+#ifndef OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+#define OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MULTICAST_DNS_VERBOSE_LOGGING_ENABLE
  *
@@ -88,6 +88,16 @@
 #define OPENTHREAD_CONFIG_NAT64_BORDER_ROUTING_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE
+ *
+ * Specifies the number of hash buckets used by NAT64 translator to index active mappings (by IPv6 source and by
+ * translated IPv4 destination). MUST be a power of two.
+ */
+#ifndef OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE
+#define OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE 64
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
  *
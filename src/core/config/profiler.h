@@ -0,0 +1,85 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes compile-time configurations for the main-loop profiler.
+ */
+
+#ifndef OT_CORE_CONFIG_PROFILER_H_
+#define OT_CORE_CONFIG_PROFILER_H_
+
+/**
+ * @addtogroup config-profiler
+ *
+ * @brief
+ *   This module includes configuration variables for the main-loop profiler.
+ *
+ * @{
+ */
+
+/**
+ * @def OPENTHREAD_CONFIG_PROFILER_ENABLE
+ *
+ * Define to 1 to enable the main-loop profiler.
+ *
+ * The profiler records the invocation count and the cumulative and maximum execution time of tasklet, timer and
+ * state-changed callback handlers, along with a histogram of the main-loop iteration latency reported by the platform.
+ *
+ * When disabled, no code is added to the tasklet and timer schedulers.
+ */
+#ifndef OPENTHREAD_CONFIG_PROFILER_ENABLE
+#define OPENTHREAD_CONFIG_PROFILER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PROFILER_MAX_HANDLERS
+ *
+ * Specifies the maximum number of distinct handlers tracked by the profiler.
+ *
+ * Invocations of handlers which do not fit in the table are counted as dropped.
+ */
+#ifndef OPENTHREAD_CONFIG_PROFILER_MAX_HANDLERS
+#define OPENTHREAD_CONFIG_PROFILER_MAX_HANDLERS 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PROFILER_ENABLED_BY_DEFAULT
+ *
+ * Define to 1 to start recording when the OpenThread instance is initialized. Otherwise, recording is started using
+ * `otProfilerSetEnabled()`.
+ */
+#ifndef OPENTHREAD_CONFIG_PROFILER_ENABLED_BY_DEFAULT
+#define OPENTHREAD_CONFIG_PROFILER_ENABLED_BY_DEFAULT 0
+#endif
+
+/**
+ * @}
+ */
+
+#endif // OT_CORE_CONFIG_PROFILER_H_
@@ -68,6 +68,58 @@
      OPENTHREAD_CONFIG_COMMISSIONER_ENABLE || OPENTHREAD_CONFIG_JOINER_ENABLE || OPENTHREAD_CONFIG_BLE_TCAT_ENABLE)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+ *
+ * Specifies the maximum number of basic elliptic curve operations performed by mbedTLS in one step of a DTLS/TLS
+ * handshake.
+ *
+ * When non-zero, mbedTLS restartable ECC (`MBEDTLS_ECP_RESTARTABLE`) is used so that an expensive EC computation
+ * (e.g., ECDHE key generation or ECDSA signature verification) is split into bounded steps. The handshake is then
+ * resumed from a tasklet, allowing other OpenThread events (e.g., frame reception and forwarding) to be processed in
+ * between. The mbedTLS library must be built with `MBEDTLS_ECP_RESTARTABLE`.
+ *
+ * mbedTLS applies restartable ECC only to the key exchanges supporting it, and only on the client side of an
+ * ECDHE-ECDSA handshake (e.g., a CoAPS client using X.509 certificates). It does not help the EC-JPAKE handshakes used
+ * by the Border Agent, Commissioner and Joiner, nor TLS server roles such as TCAT. These are always performed in a
+ * single step.
+ *
+ * The limit is set through `mbedtls_ecp_set_max_ops()` which is a process-global mbedTLS setting. It is applied only
+ * while a handshake step runs and reset to zero afterwards. On platforms where other threads use mbedTLS TLS clients
+ * concurrently, those may observe the limit while a handshake step is running.
+ *
+ * Set to zero to disable this behavior.
+ */
+#ifndef OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+ *
+ * Define to 1 to enable TLS session tickets (RFC 5077) on secure transports that opt in (e.g., Border Agent).
+ *
+ * When enabled, a server session issues a session ticket to its peer at the end of a full handshake. A peer that
+ * reconnects presenting a valid ticket resumes the session with an abbreviated handshake, skipping the EC-JPAKE key
+ * exchange. The ticket keys are regenerated whenever the transport PSK is changed or the transport is closed, which
+ * invalidates all previously issued tickets.
+ *
+ * A client transport that opts in keeps the session established with its peer and offers its ticket on the next
+ * connection to the same peer. The kept session is discarded when the PSK is changed or the transport is closed.
+ */
+#ifndef OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_LIFETIME
+ *
+ * Specifies the lifetime (in seconds) of session tickets issued when `SESSION_TICKET_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_LIFETIME
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_LIFETIME (60 * 60)
+#endif
+
 /**
  * @}
  */
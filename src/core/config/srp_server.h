@@ -111,6 +111,44 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT ((4 * 250u) + 250u)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES
+ *
+ * Specifies the maximum number of pending SRP updates, i.e., updates which are validated and being processed by the
+ * service update handler or the Advertising Proxy but not yet committed.
+ *
+ * When the limit is reached, a newly received SRP update is rejected (before its signature is verified) with a server
+ * failure response code. SRP clients then retry after a back-off interval. This bounds the amount of memory and
+ * processing used when many clients register at the same time (e.g., after the Border Router restarts).
+ *
+ * Note that this changes the behavior of existing deployments, where previously all received updates were processed
+ * regardless of how many were pending. With the default limit, a Border Router serving a large number of SRP clients
+ * may now respond with server failure to some clients during a registration burst, and these clients register later
+ * after their retry back-off. The number of such rejected updates is reported by `otSrpServerGetUpdateStats()`
+ * (`mNumRejectedBusy`).
+ *
+ * Set to zero to disable the limit and keep the previous behavior.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES
+#define OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_DEFAULT_REFRESH_WINDOW
+ *
+ * Specifies the default refresh window interval (in seconds) of the SRP server.
+ *
+ * When non-zero, time is divided into consecutive refresh windows. The server processes lease expirations in batches
+ * at the start of each window (one lease timer run per window, independent of the number of hosts), and includes a
+ * Refresh Window Option in its responses so that clients align their lease refreshes to the windows.
+ *
+ * The interval should be small compared to the granted lease intervals since a lease may be refreshed up to one
+ * window earlier and expire up to one window later. Set to zero to disable.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_DEFAULT_REFRESH_WINDOW
+#define OPENTHREAD_CONFIG_SRP_SERVER_DEFAULT_REFRESH_WINDOW 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
  *
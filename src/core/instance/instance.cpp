@@ -90,6 +90,9 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_OTNS_ENABLE
     , mOtns(*this)
 #endif
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+    , mProfiler(*this)
+#endif
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     , mNotifier(*this)
     , mTimeTicker(*this)
@@ -278,6 +281,9 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_LINK_METRICS_MANAGER_ENABLE
     , mLinkMetricsManager(*this)
 #endif
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    , mPacketLatencyTracker(*this)
+#endif
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
     , mDatasetUpdater(*this)
 #endif
@@ -70,6 +70,7 @@
 #include "radio/radio.hpp"
 #include "utils/otns.hpp"
 #include "utils/power_calibration.hpp"
+#include "utils/profiler.hpp"
 #include "utils/static_counter.hpp"
 
 #if OPENTHREAD_FTD || OPENTHREAD_MTD
@@ -157,6 +158,7 @@
 #include "utils/jam_detector.hpp"
 #include "utils/link_metrics_manager.hpp"
 #include "utils/mesh_diag.hpp"
+#include "utils/packet_latency_tracker.hpp"
 #include "utils/ping_sender.hpp"
 #include "utils/srp_client_buffers.hpp"
 #endif // OPENTHREAD_FTD || OPENTHREAD_MTD
@@ -605,6 +607,10 @@ private:
     Utils::Otns mOtns;
 #endif
 
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+    Utils::Profiler mProfiler;
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     // Notifier, TimeTicker, Settings, and MessagePool are initialized
     // before other member variables since other classes/objects from
@@ -849,6 +855,10 @@ private:
     Utils::LinkMetricsManager mLinkMetricsManager;
 #endif
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    Utils::PacketLatencyTracker mPacketLatencyTracker;
+#endif
+
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
     MeshCoP::DatasetUpdater mDatasetUpdater;
 #endif
@@ -937,6 +947,10 @@ template <> inline UptimeTracker &Instance::Get(void) { return mUptimeTracker; }
 template <> inline Utils::Otns &Instance::Get(void) { return mOtns; }
 #endif
 
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+template <> inline Utils::Profiler &Instance::Get(void) { return mProfiler; }
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
 template <> inline Notifier &Instance::Get(void) { return mNotifier; }
 
@@ -1201,6 +1215,10 @@ template <> inline HistoryTracker::Client &Instance::Get(void) { return mHistory
 template <> inline Utils::LinkMetricsManager &Instance::Get(void) { return mLinkMetricsManager; }
 #endif
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+template <> inline Utils::PacketLatencyTracker &Instance::Get(void) { return mPacketLatencyTracker; }
+#endif
+
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
 template <> inline MeshCoP::DatasetUpdater &Instance::Get(void) { return mDatasetUpdater; }
 #endif
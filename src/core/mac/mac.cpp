@@ -1565,34 +1565,40 @@ void Mac::HandleTimer(void)
 
 const KeyMaterial *Mac::DetermineMode1Key(const Frame &aFrame) const
 {
-    uint32_t keySequence;
+    const KeyMaterial *key = nullptr;
+    uint8_t            keyIndex;
+    uint32_t           keySequence;
+
+    SuccessOrExit(aFrame.GetKeyIndex(keyIndex));
+    key = DetermineMode1KeyAndSequence(aFrame, keyIndex, keySequence);
 
-    return DetermineMode1KeyAndSequence(aFrame, keySequence);
+exit:
+    return key;
 }
 
-const KeyMaterial *Mac::DetermineMode1KeyAndSequence(const Frame &aFrame, uint32_t &aKeySequence) const
+const KeyMaterial *Mac::DetermineMode1KeyAndSequence(const Frame &aFrame,
+                                                     uint8_t      aKeyIndex,
+                                                     uint32_t    &aKeySequence) const
 {
-    // Determines the MAC key and key sequence for given `aFrame`.
-    // The caller MUST already ensure that the frame's Key ID Mode
-    // is Mode 1.
+    // Determines the MAC key and key sequence for given `aFrame`
+    // from its `aKeyIndex`. The caller MUST already ensure that the
+    // frame's Key ID Mode is Mode 1.
 
     const KeyMaterial *key = nullptr;
-    uint8_t            keyIndex;
     KeyTrio::Type      keyType;
 
-    SuccessOrExit(aFrame.GetKeyIndex(keyIndex));
     aKeySequence = Get<KeyManager>().GetCurrentKeySequence();
 
-    if (keyIndex == DetermineKeyIndexFor(aKeySequence))
+    if (aKeyIndex == DetermineKeyIndexFor(aKeySequence))
     {
         keyType = KeyTrio::kCur;
     }
-    else if (keyIndex == DetermineKeyIndexFor(aKeySequence + 1))
+    else if (aKeyIndex == DetermineKeyIndexFor(aKeySequence + 1))
     {
         aKeySequence++;
         keyType = KeyTrio::kNext;
     }
-    else if (keyIndex == DetermineKeyIndexFor(aKeySequence - 1))
+    else if (aKeyIndex == DetermineKeyIndexFor(aKeySequence - 1))
     {
         aKeySequence--;
         keyType = KeyTrio::kPrev;
@@ -1635,24 +1641,30 @@ exit:
     return key;
 }
 
-Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor)
+Error Mac::ProcessReceiveSecurity(RxFrame                  &aFrame,
+                                  const RxFrame::HeaderView &aHeaderView,
+                                  const Address             &aSrcAddr,
+                                  Neighbor                  *aNeighbor)
 {
-    KeyManager        &keyManager = Get<KeyManager>();
-    Error              error      = kErrorSecurity;
-    Frame::KeyIdMode   keyIdMode;
-    uint32_t           frameCounter;
-    uint32_t           keySequence = 0;
-    const KeyMaterial *macKey;
-    const ExtAddress  *extAddress;
+    KeyManager          &keyManager = Get<KeyManager>();
+    Error                error      = kErrorSecurity;
+    Frame::SecurityLevel securityLevel;
+    Frame::KeyIdMode     keyIdMode;
+    uint8_t              keyIndex;
+    uint32_t             frameCounter;
+    uint32_t             keySequence = 0;
+    const KeyMaterial   *macKey;
+    const ExtAddress    *extAddress;
 
-    VerifyOrExit(aFrame.GetSecurityEnabled(), error = kErrorNone);
+    VerifyOrExit(aHeaderView.GetSecurityEnabled(), error = kErrorNone);
 
-    VerifyOrExit(aFrame.HasSecurityLevel(Frame::kSecurityEncMic32));
+    SuccessOrExit(aHeaderView.GetSecurityLevel(securityLevel));
+    VerifyOrExit(securityLevel == Frame::kSecurityEncMic32);
 
-    IgnoreError(aFrame.GetFrameCounter(frameCounter));
+    IgnoreError(aHeaderView.GetFrameCounter(frameCounter));
     LogDebg("Rx security - frame counter %lu", ToUlong(frameCounter));
 
-    SuccessOrExit(aFrame.GetKeyIdMode(keyIdMode));
+    SuccessOrExit(aHeaderView.GetKeyIdMode(keyIdMode));
 
     switch (keyIdMode)
     {
@@ -1665,7 +1677,8 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
     case Frame::kKeyIdMode1:
         VerifyOrExit(aNeighbor != nullptr);
 
-        macKey = DetermineMode1KeyAndSequence(aFrame, keySequence);
+        SuccessOrExit(aHeaderView.GetKeyIndex(keyIndex));
+        macKey = DetermineMode1KeyAndSequence(aFrame, keyIndex, keySequence);
         VerifyOrExit(macKey != nullptr);
 
         // If the frame is from a neighbor not in valid state (e.g., it is from a child being
@@ -1707,7 +1720,7 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         ExitNow();
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    SuccessOrExit(aFrame.ProcessReceiveAesCcm(aHeaderView, *extAddress, *macKey));
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1867,11 +1880,12 @@ exit:
 
 void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
 {
-    Error     error = aError;
-    Address   srcAddr;
-    Address   dstAddr;
-    PanId     panId;
-    Neighbor *neighbor;
+    Error               error = aError;
+    RxFrame::HeaderView headerView;
+    Address             srcAddr;
+    Address             dstAddr;
+    PanId               panId;
+    Neighbor           *neighbor;
 
     mCounters.mRxTotal++;
 
@@ -1880,11 +1894,12 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     VerifyOrExit(IsEnabled(), error = kErrorInvalidState);
 
     // Ensure we have a valid frame before attempting to read any contents of
-    // the buffer received from the radio.
-    SuccessOrExit(error = aFrame->ValidatePsdu());
+    // the buffer received from the radio. The MAC header is parsed once here
+    // and `headerView` is used for all subsequent header field accesses.
+    SuccessOrExit(error = aFrame->ParseHeader(headerView));
 
-    IgnoreError(aFrame->GetSrcAddr(srcAddr));
-    IgnoreError(aFrame->GetDstAddr(dstAddr));
+    srcAddr = headerView.GetSrcAddr();
+    dstAddr = headerView.GetDstAddr();
     neighbor = !srcAddr.IsNone() ? Get<NeighborTable>().FindNeighbor(srcAddr) : nullptr;
 
     // Destination Address Filtering
@@ -1912,7 +1927,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     }
 
     // Verify destination PAN ID if present
-    if (kErrorNone == aFrame->GetDstPanId(panId))
+    if (kErrorNone == headerView.GetDstPanId(panId))
     {
         VerifyOrExit(panId == kShortAddrBroadcast || panId == mPanId, error = kErrorDestinationAddressFiltered);
     }
@@ -1953,7 +1968,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
         mCounters.mRxUnicast++;
     }
 
-    error = ProcessReceiveSecurity(*aFrame, srcAddr, neighbor);
+    error = ProcessReceiveSecurity(*aFrame, headerView, srcAddr, neighbor);
 
     switch (error)
     {
@@ -1993,9 +2008,9 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     {
         UpdateNeighborLinkInfo(*neighbor, *aFrame);
 
-        if (aFrame->GetSecurityEnabled())
+        if (headerView.GetSecurityEnabled())
         {
-            if (aFrame->HasKeyIdMode(Frame::kKeyIdMode1))
+            if (headerView.HasKeyIdMode(Frame::kKeyIdMode1))
             {
                 switch (neighbor->GetState())
                 {
@@ -2006,7 +2021,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
                 case Neighbor::kStateChildUpdateRequest:
 
                     // Only accept a "MAC Data Request" frame from a child being restored.
-                    VerifyOrExit(aFrame->IsDataRequestCommand(), error = kErrorDrop);
+                    VerifyOrExit(headerView.IsDataRequestCommand(), error = kErrorDrop);
                     break;
 
                 default:
@@ -2015,7 +2030,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2 && OPENTHREAD_FTD
                 // From Thread 1.2, MAC Data Frame can also act as keep-alive message if child supports
-                if (aFrame->GetType() == Frame::kTypeData && !neighbor->IsRxOnWhenIdle() &&
+                if (headerView.GetType() == Frame::kTypeData && !neighbor->IsRxOnWhenIdle() &&
                     neighbor->IsEnhancedKeepAliveSupported())
                 {
                     neighbor->SetLastHeard(TimerMilli::GetNow());
@@ -2033,7 +2048,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     {
     case kOperationActiveScan:
 
-        if (aFrame->GetType() == Frame::kTypeBeacon)
+        if (headerView.GetType() == Frame::kTypeBeacon)
         {
             mCounters.mRxBeacon++;
             ReportActiveScanResult(aFrame);
@@ -2058,7 +2073,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
             mTimer.Stop();
 
 #if OPENTHREAD_CONFIG_MAC_STAY_AWAKE_BETWEEN_FRAGMENTS
-            if (!mRxOnWhenIdle && !mPromiscuous && aFrame->GetFramePending())
+            if (!mRxOnWhenIdle && !mPromiscuous && headerView.GetFramePending())
             {
                 mShouldDelaySleep = true;
                 LogDebg("Delay sleep for pending rx");
@@ -2076,10 +2091,10 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
         break;
     }
 
-    switch (aFrame->GetType())
+    switch (headerView.GetType())
     {
     case Frame::kTypeMacCmd:
-        if (HandleMacCommand(*aFrame)) // returns `true` when handled
+        if (HandleMacCommand(*aFrame, headerView)) // returns `true` when handled
         {
             ExitNow(error = kErrorNone);
         }
@@ -2100,7 +2115,7 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     }
 
     DumpDebg("RX", aFrame->GetPsdu(), aFrame->GetLength());
-    Get<MeshForwarder>().HandleReceivedFrame(*aFrame);
+    Get<MeshForwarder>().HandleReceivedFrame(*aFrame, headerView);
 
     UpdateIdleMode();
 
@@ -2202,12 +2217,12 @@ exit:
     return;
 }
 
-bool Mac::HandleMacCommand(RxFrame &aFrame)
+bool Mac::HandleMacCommand(RxFrame &aFrame, const RxFrame::HeaderView &aHeaderView)
 {
     bool    didHandle = false;
     uint8_t commandId;
 
-    IgnoreError(aFrame.GetCommandId(commandId));
+    IgnoreError(aHeaderView.GetCommandId(commandId));
 
     switch (commandId)
     {
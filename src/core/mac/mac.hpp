@@ -767,13 +767,18 @@ private:
     void HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, Error aError);
     void EnergyScanDone(int8_t aEnergyScanMaxRssi);
 
-    Error ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor);
+    Error ProcessReceiveSecurity(RxFrame                  &aFrame,
+                                 const RxFrame::HeaderView &aHeaderView,
+                                 const Address             &aSrcAddr,
+                                 Neighbor                  *aNeighbor);
     void  ProcessTransmitSecurity(TxFrame &aFrame);
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
     Error ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame);
 #endif
     const KeyMaterial *DetermineMode1Key(const Frame &aFrame) const;
-    const KeyMaterial *DetermineMode1KeyAndSequence(const Frame &aFrame, uint32_t &aKeySequence) const;
+    const KeyMaterial *DetermineMode1KeyAndSequence(const Frame &aFrame,
+                                                    uint8_t      aKeyIndex,
+                                                    uint32_t    &aKeySequence) const;
 
     void     UpdateIdleMode(void);
     bool     IsPending(Operation aOperation) const { return mPendingOperations & (1U << aOperation); }
@@ -790,7 +795,7 @@ private:
     void     BeginTransmit(void);
     Error    FilterDestShortAddress(ShortAddress aDestAddress) const;
     void     UpdateNeighborLinkInfo(Neighbor &aNeighbor, const RxFrame &aRxFrame);
-    bool     HandleMacCommand(RxFrame &aFrame);
+    bool     HandleMacCommand(RxFrame &aFrame, const RxFrame::HeaderView &aHeaderView);
     void     HandleTimer(void);
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     Error ProcessTxDone(TxFrame &aFrame, RxFrame *aAckFrame, Error &aError);
@@ -1183,13 +1183,117 @@ exit:
 
 bool RxFrame::IsSecuredWith(KeyIdModeFlags aFlags) const
 {
-    bool      isSecure = false;
-    KeyIdMode keyIdMode;
+    bool       isSecure = false;
+    HeaderView headerView;
 
     VerifyOrExit(GetSecurityEnabled());
-    SuccessOrExit(GetKeyIdMode(keyIdMode));
+    SuccessOrExit(headerView.ParseFrom(*this, kParseSecurityHeader));
+    isSecure = headerView.IsSecuredWith(aFlags);
+
+exit:
+    return isSecure;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// RxFrame::HeaderView
+
+Error RxFrame::HeaderView::GetDstPanId(PanId &aPanId) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mPanIds.IsDestinationPresent(), error = kErrorNotFound);
+    aPanId = mPanIds.GetDestination();
+
+exit:
+    return error;
+}
+
+Error RxFrame::HeaderView::GetSrcPanId(PanId &aPanId) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mPanIds.IsSourcePresent(), error = kErrorNotFound);
+    aPanId = mPanIds.GetSource();
+
+exit:
+    return error;
+}
+
+Error RxFrame::HeaderView::GetSecurityLevel(SecurityLevel &aSecurityLevel) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mIsSecurityEnabled, error = kErrorNotFound);
+    aSecurityLevel = mSecurityLevel;
+
+exit:
+    return error;
+}
+
+Error RxFrame::HeaderView::GetKeyIdMode(KeyIdMode &aKeyIdMode) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mIsSecurityEnabled, error = kErrorNotFound);
+    aKeyIdMode = mKeyIdMode;
 
-    switch (keyIdMode)
+exit:
+    return error;
+}
+
+Error RxFrame::HeaderView::GetFrameCounter(uint32_t &aFrameCounter) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mIsSecurityEnabled, error = kErrorNotFound);
+    aFrameCounter = mFrameCounter;
+
+exit:
+    return error;
+}
+
+Error RxFrame::HeaderView::GetKeyIndex(uint8_t &aKeyIndex) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mIsSecurityEnabled && (mKeyIdMode != kKeyIdMode0), error = kErrorNotFound);
+    aKeyIndex = mKeyIndex;
+
+exit:
+    return error;
+}
+
+Error RxFrame::HeaderView::GetCommandId(uint8_t &aCommandId) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mType == kTypeMacCmd, error = kErrorNotFound);
+
+    // In the 2015 version, the Command ID is the first byte of the
+    // payload which may be decrypted in place after the header is
+    // parsed, so it is read from the frame rather than from the
+    // value captured during parsing.
+
+    aCommandId = (mVersion == kVersion2015) ? mPayload.GetBytes()[0] : mCommandId;
+
+exit:
+    return error;
+}
+
+bool RxFrame::HeaderView::IsDataRequestCommand(void) const
+{
+    uint8_t commandId;
+
+    return (GetCommandId(commandId) == kErrorNone) && (commandId == kMacCmdDataRequest);
+}
+
+bool RxFrame::HeaderView::IsSecuredWith(KeyIdModeFlags aFlags) const
+{
+    bool isSecure = false;
+
+    VerifyOrExit(mIsSecurityEnabled);
+
+    switch (mKeyIdMode)
     {
     case kKeyIdMode0:
         VerifyOrExit(aFlags & kAllowKeyIdMode0);
@@ -1211,28 +1315,42 @@ exit:
 
 Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey)
 {
-    Error                 error = kErrorSecurity;
-    ParseInfo             info;
-    Crypto::AesCcm        aesCcm;
-    Crypto::AesCcm::Nonce nonce;
+    Error      error = kErrorSecurity;
+    HeaderView headerView;
 
     VerifyOrExit(GetSecurityEnabled(), error = kErrorNone);
 
-    SuccessOrExit(info.ParseFrom(*this, kParseFully));
+    SuccessOrExit(ParseHeader(headerView));
+    error = ProcessReceiveAesCcm(headerView, aExtAddress, aMacKey);
 
-    nonce.InitFrom(aExtAddress, info.mFrameCounter, info.mSecurityLevel);
+exit:
+    return error;
+}
+
+Error RxFrame::ProcessReceiveAesCcm(const HeaderView  &aHeaderView,
+                                    const ExtAddress  &aExtAddress,
+                                    const KeyMaterial &aMacKey)
+{
+    Error                 error = kErrorNone;
+    Crypto::AesCcm        aesCcm;
+    Crypto::AesCcm::Nonce nonce;
+
+    VerifyOrExit(aHeaderView.mIsSecurityEnabled);
+
+    nonce.InitFrom(aExtAddress, aHeaderView.mFrameCounter, aHeaderView.mSecurityLevel);
 
     aesCcm.SetKey(aMacKey);
     aesCcm.SetNonce(nonce);
-    aesCcm.SetAuthData(info.mHeader.GetBytes(), info.mHeader.GetLength());
-    aesCcm.SetTagLength(info.mMicSize);
+    aesCcm.SetAuthData(aHeaderView.mHeader.GetBytes(), aHeaderView.mHeader.GetLength());
+    aesCcm.SetTagLength(aHeaderView.mMicSize);
 
 #ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     // Do not decrypt when fuzzing
     ExitNow(error = kErrorNone);
 #endif
 
-    error = aesCcm.Process(Crypto::AesCcm::kDecrypt, AsNonConst(info.mPayload.GetBytes()), info.mPayload.GetLength());
+    error = aesCcm.Process(Crypto::AesCcm::kDecrypt, AsNonConst(aHeaderView.mPayload.GetBytes()),
+                           aHeaderView.mPayload.GetLength());
 
 exit:
     return error;
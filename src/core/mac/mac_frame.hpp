@@ -724,6 +724,185 @@ public:
      */
     typedef uint8_t KeyIdModeFlags;
 
+    /**
+     * Represents a parsed view of the MAC header of a received frame.
+     *
+     * The view is populated once by `RxFrame::ParseHeader()`, which parses and validates the full MAC header. All
+     * accessors then return the cached fields without re-parsing the PSDU.
+     *
+     * The view remains valid as long as the frame header is not modified. In-place decryption of the payload by
+     * `ProcessReceiveAesCcm()` is allowed and is reflected in the payload and 2015 MAC Command ID.
+     */
+    class HeaderView : private ParseInfo
+    {
+        friend class RxFrame;
+
+    public:
+        /**
+         * Returns the IEEE 802.15.4 Frame Type.
+         *
+         * @returns The IEEE 802.15.4 Frame Type.
+         */
+        uint8_t GetType(void) const { return mType; }
+
+        /**
+         * Returns the IEEE 802.15.4 Frame Version.
+         *
+         * @returns The IEEE 802.15.4 Frame Version.
+         */
+        uint8_t GetVersion(void) const { return mVersion; }
+
+        /**
+         * Indicates whether or not security is enabled.
+         *
+         * @retval TRUE   If security is enabled.
+         * @retval FALSE  If security is not enabled.
+         */
+        bool GetSecurityEnabled(void) const { return mIsSecurityEnabled; }
+
+        /**
+         * Indicates whether or not the Frame Pending bit is set.
+         *
+         * @retval TRUE   If the Frame Pending bit is set.
+         * @retval FALSE  If the Frame Pending bit is not set.
+         */
+        bool GetFramePending(void) const { return mIsFramePending; }
+
+        /**
+         * Gets the Destination PAN Identifier.
+         *
+         * @param[out]  aPanId  The Destination PAN Identifier.
+         *
+         * @retval kErrorNone      Successfully retrieved the Destination PAN Identifier.
+         * @retval kErrorNotFound  Destination PAN Identifier is not present in the frame.
+         */
+        Error GetDstPanId(PanId &aPanId) const;
+
+        /**
+         * Gets the Destination Address.
+         *
+         * @returns The Destination Address.
+         */
+        const Address &GetDstAddr(void) const { return mAddrs.mDestination; }
+
+        /**
+         * Gets the Source PAN Identifier.
+         *
+         * @param[out]  aPanId  The Source PAN Identifier.
+         *
+         * @retval kErrorNone      Successfully retrieved the Source PAN Identifier.
+         * @retval kErrorNotFound  Source PAN Identifier is not present in the frame.
+         */
+        Error GetSrcPanId(PanId &aPanId) const;
+
+        /**
+         * Gets the Source Address.
+         *
+         * @returns The Source Address.
+         */
+        const Address &GetSrcAddr(void) const { return mAddrs.mSource; }
+
+        /**
+         * Gets the Security Level Identifier.
+         *
+         * @param[out]  aSecurityLevel  The Security Level Identifier.
+         *
+         * @retval kErrorNone      Successfully retrieved the Security Level Identifier.
+         * @retval kErrorNotFound  Frame does not have a security header (security is not enabled).
+         */
+        Error GetSecurityLevel(SecurityLevel &aSecurityLevel) const;
+
+        /**
+         * Gets the Key Identifier Mode.
+         *
+         * @param[out]  aKeyIdMode  The Key Identifier Mode.
+         *
+         * @retval kErrorNone      Successfully retrieved the Key Identifier Mode.
+         * @retval kErrorNotFound  Frame does not have a security header (security is not enabled).
+         */
+        Error GetKeyIdMode(KeyIdMode &aKeyIdMode) const;
+
+        /**
+         * Indicates whether or not the frame has a specific Key Identifier Mode.
+         *
+         * @param[in]  aKeyIdMode  The Key Identifier Mode to check.
+         *
+         * @retval TRUE   The frame has a security header matching @p aKeyIdMode.
+         * @retval FALSE  The frame does not have a security header or it does not match @p aKeyIdMode.
+         */
+        bool HasKeyIdMode(KeyIdMode aKeyIdMode) const { return mIsSecurityEnabled && (mKeyIdMode == aKeyIdMode); }
+
+        /**
+         * Indicates whether the frame is secured with a given set of allowed Key ID Modes.
+         *
+         * @param[in] aFlags  A bitmask of `KeyIdModeFlags` specifying the allowed modes.
+         *
+         * @retval TRUE   The frame has security enabled and uses one of the allowed Key ID Modes.
+         * @retval FALSE  The frame does not have security enabled, or its Key ID Mode is not allowed.
+         */
+        bool IsSecuredWith(KeyIdModeFlags aFlags) const;
+
+        /**
+         * Gets the Frame Counter.
+         *
+         * @param[out]  aFrameCounter  The Frame Counter.
+         *
+         * @retval kErrorNone      Successfully retrieved the Frame Counter.
+         * @retval kErrorNotFound  Frame does not have a security header (security is not enabled).
+         */
+        Error GetFrameCounter(uint32_t &aFrameCounter) const;
+
+        /**
+         * Gets the Key Index (sub-field of Key ID).
+         *
+         * @param[out]  aKeyIndex  The Key Index
+         *
+         * @retval kErrorNone      Successfully retrieved the Key Index.
+         * @retval kErrorNotFound  Frame does not have a security header or is using `kKeyIdMode0`.
+         */
+        Error GetKeyIndex(uint8_t &aKeyIndex) const;
+
+        /**
+         * Gets the Command ID.
+         *
+         * For 2015 version frames, the Command ID is read from the (possibly decrypted) payload.
+         *
+         * @param[out]  aCommandId  The Command ID.
+         *
+         * @retval kErrorNone      Successfully retrieved the Command ID.
+         * @retval kErrorNotFound  The frame is not a MAC command.
+         */
+        Error GetCommandId(uint8_t &aCommandId) const;
+
+        /**
+         * Indicates whether the frame is a MAC Data Request command (data poll).
+         *
+         * For 802.15.4-2015 and above frame, the frame should be already decrypted.
+         *
+         * @returns TRUE if frame is a MAC Data Request command, FALSE otherwise.
+         */
+        bool IsDataRequestCommand(void) const;
+
+        /**
+         * Gets the frame payload as `FrameData`.
+         *
+         * See `Frame::GetPayload()` for the treatment of the Command ID field in MAC Command frames.
+         *
+         * @returns The frame payload.
+         */
+        const FrameData &GetPayload(void) const { return mPayload; }
+    };
+
+    /**
+     * Parses and validates the full MAC header of the frame and populates a `HeaderView`.
+     *
+     * @param[out] aHeaderView  A reference to a `HeaderView` to populate.
+     *
+     * @retval kErrorNone   Successfully parsed the MAC header.
+     * @retval kErrorParse  Failed to parse through the MAC header.
+     */
+    Error ParseHeader(HeaderView &aHeaderView) const { return aHeaderView.ParseFrom(*this, kParseFully); }
+
     /**
      * Indicates whether the frame is secured with a given set of allowed Key ID Modes.
      *
@@ -746,6 +925,21 @@ public:
      * @retval kErrorSecurity  Received frame MIC check failed.
      */
     Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey);
+
+    /**
+     * Performs AES CCM on the frame which is received, using an already parsed header.
+     *
+     * @param[in]  aHeaderView  The `HeaderView` populated from this frame by `ParseHeader()`.
+     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
+     *                          for AES CCM computation.
+     * @param[in]  aMacKey      A reference to the MAC key to decrypt the received frame.
+     *
+     * @retval kErrorNone      Process of received frame AES CCM succeeded.
+     * @retval kErrorSecurity  Received frame MIC check failed.
+     */
+    Error ProcessReceiveAesCcm(const HeaderView  &aHeaderView,
+                               const ExtAddress  &aExtAddress,
+                               const KeyMaterial &aMacKey);
 #endif
 };
 
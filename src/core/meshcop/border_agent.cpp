@@ -174,6 +174,12 @@ void Manager::Start(void)
 
     SuccessOrExit(error = mDtlsTransport.Open(kUdpPort));
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    // Allow commissioners reconnecting frequently to resume their
+    // previous session and skip the full EC-JPAKE handshake.
+    mDtlsTransport.SetSessionTicketsEnabled(true);
+#endif
+
     Get<KeyManager>().GetPskc(pskc);
     SuccessOrExit(error = mDtlsTransport.SetPsk(pskc.m8, Pskc::kSize));
     pskc.Clear();
@@ -586,6 +592,7 @@ Manager::CoapDtlsSession::CoapDtlsSession(Instance &aInstance, Dtls::Transport &
     : Coap::SecureSession(aInstance, aDtlsTransport)
     , mTimer(aInstance, HandleTimer, this)
     , mAllocationTime(aInstance.Get<UptimeTracker>().GetUptime())
+    , mHandshakeDuration(0)
     , mIndex(aInstance.Get<Manager>().GetNextSessionIndex())
 {
     SetResourceHandler(&HandleResource);
@@ -693,7 +700,8 @@ void Manager::CoapDtlsSession::HandleConnected(ConnectEvent aEvent)
 {
     if (aEvent == kConnected)
     {
-        LogInfo("Session %u connected", mIndex);
+        mHandshakeDuration = static_cast<uint32_t>(Get<UptimeTracker>().GetUptime() - mAllocationTime);
+        LogInfo("Session %u connected - handshake took %lu ms", mIndex, ToUlong(mHandshakeDuration));
         mTimer.Start(kKeepAliveTimeout);
         Get<Manager>().HandleSessionConnected(*this);
     }
@@ -1174,6 +1182,9 @@ void Manager::CoapDtlsSession::CopyInfoTo(SessionInfo &aInfo, UptimeMsec aUptime
     aInfo.mIsConnected           = IsConnected();
     aInfo.mIsCommissioner        = IsActiveCommissioner();
     aInfo.mLifetime              = aUptimeNow - GetAllocationTime();
+    aInfo.mHandshakeDuration     = mHandshakeDuration;
+    aInfo.mRxBytes               = GetRxByteCount();
+    aInfo.mTxBytes               = GetTxByteCount();
 }
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
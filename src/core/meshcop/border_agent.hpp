@@ -226,6 +226,15 @@ public:
      */
     uint16_t GetUdpPort(void) const;
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    /**
+     * Gets the number of secure sessions resumed by a candidate using a session ticket.
+     *
+     * @returns The number of resumed sessions.
+     */
+    uint32_t GetResumedSessionCount(void) const { return mDtlsTransport.GetResumedSessionCount(); }
+#endif
+
 #if OPENTHREAD_CONFIG_BORDER_AGENT_MESHCOP_SERVICE_ENABLE
     /**
      * Sets the base name to construct the service instance name used when advertising the mDNS `_meshcop._udp` service
@@ -265,7 +274,7 @@ private:
     static constexpr uint16_t kUdpPort          = OPENTHREAD_CONFIG_BORDER_AGENT_UDP_PORT;
     static constexpr uint32_t kKeepAliveTimeout = 50 * 1000; // Timeout to reject a commissioner (in msec)
     static constexpr uint32_t kHandshakeTimeout = 15 * 1000; // Handshake timeout (in msec)
-    static constexpr uint32_t kMaxSessions      = 16;        // Max concurrent secure sessions
+    static constexpr uint32_t kMaxSessions      = OPENTHREAD_CONFIG_BORDER_AGENT_MAX_SESSIONS;
 
 #if OPENTHREAD_CONFIG_BORDER_AGENT_MESHCOP_SERVICE_ENABLE
     static constexpr uint16_t kDummyUdpPort          = 49152;
@@ -365,6 +374,7 @@ private:
         LinkedList<ForwardContext> mForwardContexts;
         TimerMilliContext          mTimer;
         UptimeMsec                 mAllocationTime;
+        uint32_t                   mHandshakeDuration;
         uint16_t                   mIndex;
     };
 
@@ -58,12 +58,15 @@ SecureSession::SecureSession(SecureTransport &aTransport)
 
 void SecureSession::Init(void)
 {
-    mTimerSet       = false;
-    mIsServer       = false;
-    mState          = kStateDisconnected;
-    mMessageSubType = Message::kSubTypeNone;
-    mConnectEvent   = kDisconnectedError;
-    mReceiveMessage = nullptr;
+    mTimerSet         = false;
+    mIsServer         = false;
+    mCryptoInProgress = false;
+    mState            = kStateDisconnected;
+    mMessageSubType   = Message::kSubTypeNone;
+    mConnectEvent     = kDisconnectedError;
+    mReceiveMessage   = nullptr;
+    mRxByteCount      = 0;
+    mTxByteCount      = 0;
     mMessageInfo.Clear();
 
     MarkAsNotUsed();
@@ -149,6 +152,8 @@ void SecureSession::HandleTransportReceive(Message &aMessage)
     }
 #endif
 
+    mRxByteCount += aMessage.GetLength() - aMessage.GetOffset();
+
     mReceiveMessage = &aMessage;
     Process();
     mReceiveMessage = nullptr;
@@ -292,6 +297,29 @@ Error SecureSession::Setup(void)
     }
 #endif
 
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Setup the session tickets.
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    if (mIsServer)
+    {
+        if (mTransport.mSessionTicketsEnabled)
+        {
+            rval = mTransport.SetupSessionTicketContext();
+            VerifyOrExit(rval == 0);
+
+            mbedtls_ssl_conf_session_tickets_cb(&mConf, SecureTransport::HandleMbedtlsTicketWrite,
+                                                SecureTransport::HandleMbedtlsTicketParse, &mTransport);
+        }
+    }
+    else
+    {
+        mbedtls_ssl_conf_session_tickets(&mConf, mTransport.mSessionTicketsEnabled
+                                                     ? MBEDTLS_SSL_SESSION_TICKETS_ENABLED
+                                                     : MBEDTLS_SSL_SESSION_TICKETS_DISABLED);
+    }
+#endif
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Setup the mbedtls_ssl_context `mSsl`.
 
@@ -324,6 +352,17 @@ Error SecureSession::Setup(void)
     }
 #endif
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    if (!mIsServer && mTransport.HasClientSessionFor(mMessageInfo))
+    {
+        // Offer the session (and its ticket) from the previous
+        // connection to the same peer, so that it can be resumed
+        // with an abbreviated handshake.
+        rval = mbedtls_ssl_set_session(&mSsl, &mTransport.mClientSession);
+        VerifyOrExit(rval == 0);
+    }
+#endif
+
     mReceiveMessage = nullptr;
     mMessageSubType = Message::kSubTypeNone;
 
@@ -400,10 +439,18 @@ int SecureSession::HandleMbedtlsTransmit(void *aContext, const unsigned char *aB
 int SecureSession::HandleMbedtlsTransmit(const unsigned char *aBuf, size_t aLength)
 {
     Message::SubType msgSubType = mMessageSubType;
+    int              rval;
 
     mMessageSubType = Message::kSubTypeNone;
 
-    return mTransport.Transmit(aBuf, aLength, mMessageInfo, msgSubType);
+    rval = mTransport.Transmit(aBuf, aLength, mMessageInfo, msgSubType);
+
+    if (rval > 0)
+    {
+        mTxByteCount += static_cast<uint32_t>(rval);
+    }
+
+    return rval;
 }
 
 int SecureSession::HandleMbedtlsReceive(void *aContext, unsigned char *aBuf, size_t aLength)
@@ -526,14 +573,32 @@ void SecureSession::Process(void)
     ConnectEvent disconnectEvent;
     bool         shouldReset;
 
+    mCryptoInProgress = false;
+
     while (IsConnectingOrConnected())
     {
         if (IsConnecting())
         {
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+            // The max number of EC operations is a global mbedTLS
+            // setting. It is applied only while this handshake step
+            // runs and restored afterwards so that other mbedTLS users
+            // in the process are not affected.
+            mbedtls_ecp_set_max_ops(OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS);
+            rval = mbedtls_ssl_handshake(&mSsl);
+            mbedtls_ecp_set_max_ops(0);
+#else
             rval = mbedtls_ssl_handshake(&mSsl);
+#endif
 
             if (IsMbedtlsHandshakeOver(&mSsl))
             {
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+                if (!mIsServer)
+                {
+                    mTransport.SaveClientSession(*this);
+                }
+#endif
                 SetState(kStateConnected);
                 mConnectEvent = kConnected;
                 mConnectedCallback.InvokeIfSet(mConnectEvent);
@@ -564,6 +629,18 @@ void SecureSession::Process(void)
             shouldReset = false;
             break;
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+        case MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS:
+            // An EC operation was paused after reaching the max number
+            // of operations. The handshake is resumed from the update
+            // tasklet so that other pending events are processed first.
+            mCryptoInProgress = true;
+            mTransport.mHandshakeResumeCount++;
+            mTransport.mUpdateTask.Post();
+            shouldReset = false;
+            break;
+#endif
+
         case MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY:
             disconnectEvent = kDisconnectedPeerClosed;
             break;
@@ -665,6 +742,9 @@ SecureTransport::SecureTransport(Instance &aInstance, LinkSecurityMode aLayerTwo
     , mIsOpen(false)
     , mIsClosing(false)
     , mVerifyPeerCertificate(true)
+    , mSessionTicketsEnabled(false)
+    , mSessionTicketContextReady(false)
+    , mClientSessionValid(false)
     , mCipherSuite(kUnspecifiedCipherSuite)
     , mPskLength(0)
     , mMaxConnectionAttempts(0)
@@ -672,12 +752,21 @@ SecureTransport::SecureTransport(Instance &aInstance, LinkSecurityMode aLayerTwo
     , mSocket(aInstance, *this)
     , mTimer(aInstance, HandleTimer, this)
     , mUpdateTask(aInstance, HandleUpdateTask, this)
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+    , mHandshakeResumeCount(0)
+#endif
 #if OPENTHREAD_CONFIG_TLS_API_ENABLE
     , mExtension(nullptr)
 #endif
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    , mResumedSessionCount(0)
+#endif
 {
     ClearAllBytes(mPsk);
     OT_UNUSED_VARIABLE(mVerifyPeerCertificate);
+    OT_UNUSED_VARIABLE(mSessionTicketsEnabled);
+    OT_UNUSED_VARIABLE(mSessionTicketContextReady);
+    OT_UNUSED_VARIABLE(mClientSessionValid);
 }
 
 Error SecureTransport::Open(uint16_t aPort, Ip6::NetifIdentifier aNetifIdentifier)
@@ -796,6 +885,11 @@ void SecureTransport::Close(void)
     mIsClosing = false;
     mTimer.Stop();
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    FreeSessionTicketContext();
+    FreeClientSession();
+#endif
+
 exit:
     return;
 }
@@ -816,6 +910,29 @@ void SecureTransport::RemoveDisconnectedSessions(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+
+void SecureTransport::ResumeInProgressHandshakes(void)
+{
+    // Each session with a paused handshake performs one more step,
+    // so concurrent handshakes progress in a round-robin manner.
+
+    VerifyOrExit(mIsOpen);
+
+    for (SecureSession &session : mSessions)
+    {
+        if (session.IsCryptoInProgress() && session.IsConnecting())
+        {
+            session.Process();
+        }
+    }
+
+exit:
+    return;
+}
+
+#endif
+
 void SecureTransport::DecremenetRemainingConnectionAttempts(void)
 {
     if (mRemainingConnectionAttempts > 0)
@@ -829,6 +946,122 @@ bool SecureTransport::HasNoRemainingConnectionAttempts(void) const
     return (mMaxConnectionAttempts > 0) && (mRemainingConnectionAttempts == 0);
 }
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+
+int SecureTransport::SetupSessionTicketContext(void)
+{
+    int rval = 0;
+
+    VerifyOrExit(!mSessionTicketContextReady);
+
+    mbedtls_ssl_ticket_init(&mSessionTicketContext);
+
+#if (MBEDTLS_VERSION_NUMBER < 0x04000000)
+    rval = mbedtls_ssl_ticket_setup(&mSessionTicketContext, Crypto::MbedTls::CryptoSecurePrng, nullptr,
+                                    MBEDTLS_CIPHER_AES_128_CCM, kSessionTicketLifetime);
+#else
+    rval = mbedtls_ssl_ticket_setup(&mSessionTicketContext, PSA_ALG_CCM, PSA_KEY_TYPE_AES, 128, kSessionTicketLifetime);
+#endif
+
+    if (rval != 0)
+    {
+        mbedtls_ssl_ticket_free(&mSessionTicketContext);
+        ExitNow();
+    }
+
+    mSessionTicketContextReady = true;
+
+exit:
+    return rval;
+}
+
+void SecureTransport::FreeSessionTicketContext(void)
+{
+    VerifyOrExit(mSessionTicketContextReady);
+
+    mbedtls_ssl_ticket_free(&mSessionTicketContext);
+    mSessionTicketContextReady = false;
+
+exit:
+    return;
+}
+
+int SecureTransport::HandleMbedtlsTicketWrite(void                      *aContext,
+                                              const mbedtls_ssl_session *aSession,
+                                              unsigned char             *aStart,
+                                              const unsigned char       *aEnd,
+                                              size_t                    *aLength,
+                                              uint32_t                  *aLifetime)
+{
+    return mbedtls_ssl_ticket_write(&static_cast<SecureTransport *>(aContext)->mSessionTicketContext, aSession, aStart,
+                                    aEnd, aLength, aLifetime);
+}
+
+int SecureTransport::HandleMbedtlsTicketParse(void                *aContext,
+                                              mbedtls_ssl_session *aSession,
+                                              unsigned char       *aBuf,
+                                              size_t               aLength)
+{
+    return static_cast<SecureTransport *>(aContext)->HandleMbedtlsTicketParse(aSession, aBuf, aLength);
+}
+
+int SecureTransport::HandleMbedtlsTicketParse(mbedtls_ssl_session *aSession, unsigned char *aBuf, size_t aLength)
+{
+    int rval = mbedtls_ssl_ticket_parse(&mSessionTicketContext, aSession, aBuf, aLength);
+
+    // A successfully parsed ticket means mbedTLS resumes the session
+    // and skips the key exchange.
+
+    if (rval == 0)
+    {
+        mResumedSessionCount++;
+        LogInfo("Resuming session using ticket");
+    }
+
+    return rval;
+}
+
+bool SecureTransport::HasClientSessionFor(const Ip6::MessageInfo &aMessageInfo) const
+{
+    return mSessionTicketsEnabled && mClientSessionValid && (mClientSessionPeer == aMessageInfo.GetPeerAddr()) &&
+           (mClientSessionPeerPort == aMessageInfo.GetPeerPort());
+}
+
+void SecureTransport::SaveClientSession(SecureSession &aSession)
+{
+    VerifyOrExit(mSessionTicketsEnabled);
+
+    FreeClientSession();
+
+    mbedtls_ssl_session_init(&mClientSession);
+
+    if (mbedtls_ssl_get_session(&aSession.mSsl, &mClientSession) != 0)
+    {
+        mbedtls_ssl_session_free(&mClientSession);
+        ExitNow();
+    }
+
+    mClientSessionPeer     = aSession.mMessageInfo.GetPeerAddr();
+    mClientSessionPeerPort = aSession.mMessageInfo.GetPeerPort();
+    mClientSessionValid    = true;
+
+exit:
+    return;
+}
+
+void SecureTransport::FreeClientSession(void)
+{
+    VerifyOrExit(mClientSessionValid);
+
+    mbedtls_ssl_session_free(&mClientSession);
+    mClientSessionValid = false;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+
 Error SecureTransport::SetPsk(const uint8_t *aPsk, uint8_t aPskLength)
 {
     Error error = kErrorNone;
@@ -839,6 +1072,25 @@ Error SecureTransport::SetPsk(const uint8_t *aPsk, uint8_t aPskLength)
     mPskLength   = aPskLength;
     mCipherSuite = kEcjpakeWithAes128Ccm8;
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    // Tickets issued for sessions established with the previous PSK
+    // must not be accepted anymore. If there is a session still in
+    // the middle of its handshake, the ticket context is set up again
+    // right away, since its `mConf` refers to it.
+
+    FreeSessionTicketContext();
+    FreeClientSession();
+
+    for (SecureSession &session : mSessions)
+    {
+        if (session.mIsServer && session.IsConnecting())
+        {
+            IgnoreReturnValue(SetupSessionTicketContext());
+            break;
+        }
+    }
+#endif
+
 exit:
     return error;
 }
@@ -988,6 +1240,10 @@ void SecureTransport::HandleUpdateTask(Tasklet &aTasklet)
 
 void SecureTransport::HandleUpdateTask(void)
 {
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+    ResumeInProgressHandshakes();
+#endif
+
     RemoveDisconnectedSessions();
 
     if (mSessions.IsEmpty() && HasNoRemainingConnectionAttempts())
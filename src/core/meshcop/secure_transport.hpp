@@ -52,6 +52,21 @@
 #include <mbedtls/ssl_cookie.h>
 #endif
 #include <mbedtls/version.h>
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+#include <mbedtls/ecp.h>
+#endif
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+#include <mbedtls/ssl_ticket.h>
+#endif
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS && !defined(MBEDTLS_ECP_RESTARTABLE)
+#error "OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS requires MBEDTLS_ECP_RESTARTABLE"
+#endif
+
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE && \
+    !(defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C))
+#error "OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE requires MBEDTLS_SSL_SESSION_TICKETS and MBEDTLS_SSL_TICKET_C"
+#endif
 
 #ifdef OPENTHREAD_CONFIG_MBEDTLS_PROVIDES_SSL_KEY_EXPORT
 #error \
@@ -230,6 +245,24 @@ public:
      */
     bool IsConnected(void) const { return (mState == kStateConnected); }
 
+    /**
+     * Gets the number of bytes received from the peer over this session.
+     *
+     * This includes all DTLS/TLS records (handshake and application data) received since the session was set up.
+     *
+     * @returns The number of received bytes.
+     */
+    uint32_t GetRxByteCount(void) const { return mRxByteCount; }
+
+    /**
+     * Gets the number of bytes sent to the peer over this session.
+     *
+     * This includes all DTLS/TLS records (handshake and application data) sent since the session was set up.
+     *
+     * @returns The number of sent bytes.
+     */
+    uint32_t GetTxByteCount(void) const { return mTxByteCount; }
+
     /**
      * Gets the `SecureTransport` used by this session.
      *
@@ -279,6 +312,9 @@ private:
     void  HandleTimer(TimeMilli aNow);
     void  Process(void);
     void  FreeMbedtls(void);
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+    bool IsCryptoInProgress(void) const { return mCryptoInProgress; }
+#endif
 
     static int  HandleMbedtlsGetTimer(void *aContext);
     int         HandleMbedtlsGetTimer(void);
@@ -297,11 +333,14 @@ private:
 
     bool                     mTimerSet : 1;
     bool                     mIsServer : 1;
+    bool                     mCryptoInProgress : 1;
     State                    mState;
     Message::SubType         mMessageSubType;
     ConnectEvent             mConnectEvent;
     TimeMilli                mTimerIntermediate;
     TimeMilli                mTimerFinish;
+    uint32_t                 mRxByteCount;
+    uint32_t                 mTxByteCount;
     SecureSession           *mNext;
     SecureTransport         &mTransport;
     Message                 *mReceiveMessage;
@@ -708,6 +747,15 @@ public:
      */
     bool IsClosed(void) const { return !mIsOpen; }
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+    /**
+     * Gets the number of times a handshake was paused due to the max number of EC operations being reached.
+     *
+     * @returns The number of paused handshake steps.
+     */
+    uint32_t GetHandshakeResumeCount(void) const { return mHandshakeResumeCount; }
+#endif
+
     /**
      * Closes the transport.
      */
@@ -748,6 +796,27 @@ public:
      */
     LinkedList<SecureSession> &GetSessions(void) { return mSessions; }
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    /**
+     * Enables or disables TLS session tickets.
+     *
+     * When enabled on a server, sessions issue and accept tickets, so a peer reconnecting with a ticket from a previous
+     * session can resume it using an abbreviated handshake. When enabled on a client, the session established with a
+     * peer is kept and offered again on the next connection to the same peer. The change applies to sessions set up
+     * after this call.
+     *
+     * @param[in] aEnabled  TRUE to enable session tickets, FALSE to disable.
+     */
+    void SetSessionTicketsEnabled(bool aEnabled) { mSessionTicketsEnabled = aEnabled; }
+
+    /**
+     * Gets the number of server sessions resumed using a session ticket (abbreviated handshake).
+     *
+     * @returns The number of resumed sessions.
+     */
+    uint32_t GetResumedSessionCount(void) const { return mResumedSessionCount; }
+#endif
+
 #if OPENTHREAD_CONFIG_MBEDTLS_PROVIDES_SSL_KEY_EXPORT
     /**
      * Defines the keylog callback.
@@ -791,9 +860,35 @@ private:
         kUnspecifiedCipherSuite,
     };
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    static constexpr uint32_t kSessionTicketLifetime = OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_LIFETIME;
+#endif
+
     void RemoveDisconnectedSessions(void);
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+    void ResumeInProgressHandshakes(void);
+#endif
     void DecremenetRemainingConnectionAttempts(void);
     bool HasNoRemainingConnectionAttempts(void) const;
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    int  SetupSessionTicketContext(void);
+    void FreeSessionTicketContext(void);
+    bool HasClientSessionFor(const Ip6::MessageInfo &aMessageInfo) const;
+    void SaveClientSession(SecureSession &aSession);
+    void FreeClientSession(void);
+
+    static int HandleMbedtlsTicketWrite(void                      *aContext,
+                                        const mbedtls_ssl_session *aSession,
+                                        unsigned char             *aStart,
+                                        const unsigned char       *aEnd,
+                                        size_t                    *aLength,
+                                        uint32_t                  *aLifetime);
+    static int HandleMbedtlsTicketParse(void                *aContext,
+                                        mbedtls_ssl_session *aSession,
+                                        unsigned char       *aBuf,
+                                        size_t               aLength);
+    int        HandleMbedtlsTicketParse(mbedtls_ssl_session *aSession, unsigned char *aBuf, size_t aLength);
+#endif
     int  Transmit(const unsigned char    *aBuf,
                   size_t                  aLength,
                   const Ip6::MessageInfo &aMessageInfo,
@@ -862,6 +957,9 @@ private:
     bool                            mIsOpen : 1;
     bool                            mIsClosing : 1;
     bool                            mVerifyPeerCertificate : 1;
+    bool                            mSessionTicketsEnabled : 1;
+    bool                            mSessionTicketContextReady : 1;
+    bool                            mClientSessionValid : 1;
     CipherSuite                     mCipherSuite;
     uint8_t                         mPskLength;
     uint16_t                        mMaxConnectionAttempts;
@@ -871,6 +969,9 @@ private:
     uint8_t                         mPsk[kPskMaxLength];
     TimerMilliContext               mTimer;
     TaskletContext                  mUpdateTask;
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+    uint32_t                        mHandshakeResumeCount;
+#endif
     Callback<AutoCloseCallback>     mAutoCloseCallback;
     Callback<AcceptCallback>        mAcceptCallback;
     Callback<RemoveSessionCallback> mRemoveSessionCallback;
@@ -881,6 +982,13 @@ private:
 #if OPENTHREAD_CONFIG_TLS_API_ENABLE
     Extension *mExtension;
 #endif
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    mbedtls_ssl_ticket_context mSessionTicketContext;
+    mbedtls_ssl_session        mClientSession;
+    Ip6::Address               mClientSessionPeer;
+    uint16_t                   mClientSessionPeerPort;
+    uint32_t                   mResumedSessionCount;
+#endif
 };
 
 /**
@@ -766,6 +766,10 @@ Client::Client(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     , mUserDidSetDefaultAddress(false)
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    , mCacheEnabled(true)
+    , mCacheTask(aInstance)
+#endif
 {
     struct QueryTypeChecker
     {
@@ -822,6 +826,10 @@ void Client::Stop(void)
 #endif
 
     mLimitedQueryServers.Clear();
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    FlushCache();
+#endif
 }
 
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
@@ -1049,10 +1057,21 @@ Error Client::StartQuery(QueryInfo &aInfo, const char *aLabel, const char *aName
     }
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    aInfo.mRequestedType = aInfo.mQueryType;
+#endif
+
     SuccessOrExit(error = AllocateQuery(aInfo, aLabel, aName, query));
 
     mMainQueries.Enqueue(*query);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    if ((aSecondType == kNoQuery) && AnswerFromCache(*query, aInfo))
+    {
+        ExitNow();
+    }
+#endif
+
     error = SendQuery(*query, aInfo, /* aUpdateTimer */ true);
     VerifyOrExit(error == kErrorNone, FreeQuery(*query));
 
@@ -1455,6 +1474,9 @@ void Client::ProcessResponse(const Message &aResponseMessage)
         }
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        SaveToCache(*query, aResponseMessage);
+#endif
         FinalizeQuery(*query, responseError);
         ExitNow();
     }
@@ -1471,6 +1493,10 @@ void Client::ProcessResponse(const Message &aResponseMessage)
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    SaveToCache(*query, aResponseMessage);
+#endif
+
     PrepareResponseAndFinalize(FindMainQuery(*query), aResponseMessage, nullptr);
 
 exit:
@@ -1695,6 +1721,395 @@ void Client::HandleTimer(void)
 #endif
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+void Client::SetCacheEnabled(bool aEnabled)
+{
+    VerifyOrExit(mCacheEnabled != aEnabled);
+    mCacheEnabled = aEnabled;
+
+    LogInfo("Answer cache %s", mCacheEnabled ? "enabled" : "disabled");
+
+    if (!mCacheEnabled)
+    {
+        FlushCache();
+    }
+
+exit:
+    return;
+}
+
+void Client::FlushCache(void)
+{
+    CacheEntry *entry;
+
+    while ((entry = mCacheList.Pop()) != nullptr)
+    {
+        FreeMessage(entry->mResponse);
+        mCachePool.Free(*entry);
+    }
+}
+
+void Client::HandleNotifierEvents(Events aEvents)
+{
+    // Cached responses may no longer be valid once we move to a
+    // different network or partition (e.g., different DNS server
+    // or different set of registered services).
+
+    if (aEvents.ContainsAny(kEventThreadPartitionIdChanged | kEventThreadExtPanIdChanged))
+    {
+        FlushCache();
+    }
+}
+
+bool Client::IsCacheable(const QueryInfo &aInfo)
+{
+    // A service resolution which may need a follow-up host address
+    // query (based on the content of the response) is not cached.
+
+    return !aInfo.mShouldResolveHostAddr;
+}
+
+bool Client::AnswerFromCache(Query &aQuery, const QueryInfo &aInfo)
+{
+    bool        answered = false;
+    CacheEntry *entry;
+    Name        queryName;
+    QueryInfo   info;
+    uint32_t    elapsedTime;
+
+    VerifyOrExit(mCacheEnabled && IsCacheable(aInfo));
+
+    queryName.SetFromMessage(aQuery, kNameOffsetInQuery);
+
+    entry = FindCacheEntry(aInfo, queryName);
+
+    if (entry == nullptr)
+    {
+        mCacheCounters.mMisses++;
+        ExitNow();
+    }
+
+    // Move the entry to the head of the list to keep the list in
+    // most recently used order.
+
+    IgnoreError(mCacheList.Remove(*entry));
+    mCacheList.Push(*entry);
+
+    info.ReadFrom(aQuery);
+    info.mQueryType     = entry->mResponseType;
+    info.mSavedResponse = entry->mResponse->Clone<kNoReservedHeader>();
+    VerifyOrExit(info.mSavedResponse != nullptr);
+
+    elapsedTime = Time::MsecToSec(TimerMilli::GetNow() - entry->mSaveTime);
+    AgeRecordTtls(*info.mSavedResponse, elapsedTime);
+
+    UpdateQuery(aQuery, info);
+
+    // The callback is invoked from the tasklet so that it is never
+    // called from within the query start API.
+
+    mCacheTask.Post();
+    mCacheCounters.mHits++;
+    answered = true;
+
+exit:
+    return answered;
+}
+
+void Client::SaveToCache(const Query &aQuery, const Message &aResponseMessage)
+{
+    QueryInfo   info;
+    Name        queryName;
+    CacheEntry *entry;
+    Message    *response = nullptr;
+    QueryType   responseType;
+    uint32_t    ttl;
+
+    VerifyOrExit(mCacheEnabled);
+
+    info.ReadFrom(aQuery);
+    VerifyOrExit((info.mMainQuery == nullptr) && (info.mNextQuery == nullptr) && IsCacheable(info));
+
+    // An IPv6 address query may have been replaced by an IPv4 one
+    // (NAT64). The entry is keyed by the query type the caller
+    // requested, and the type of the query the cached response
+    // answers is remembered so that a later cache hit synthesizes
+    // the IPv6 addresses the same way.
+
+    responseType    = info.mQueryType;
+    info.mQueryType = info.mRequestedType;
+
+    SuccessOrExit(DetermineCacheTtl(aResponseMessage, ttl));
+    ttl = Min(ttl, kCacheMaxTtl);
+    VerifyOrExit(ttl > 0);
+
+    response = aResponseMessage.Clone<kNoReservedHeader>();
+    VerifyOrExit(response != nullptr);
+
+    queryName.SetFromMessage(aQuery, kNameOffsetInQuery);
+
+    entry = FindCacheEntry(info, queryName);
+
+    if (entry != nullptr)
+    {
+        RemoveCacheEntry(*entry);
+    }
+
+    entry = mCachePool.Allocate();
+
+    if (entry == nullptr)
+    {
+        // Evict the least recently used entry (the list tail).
+        RemoveCacheEntry(*mCacheList.GetTail());
+        entry = mCachePool.Allocate();
+        OT_ASSERT(entry != nullptr);
+    }
+
+    entry->mResponse       = response;
+    entry->mServerSockAddr = info.mConfig.GetServerSockAddr();
+    entry->mSaveTime       = TimerMilli::GetNow();
+    entry->mExpireTime     = entry->mSaveTime + Time::SecToMsec(ttl);
+    entry->mQueryType      = info.mQueryType;
+    entry->mResponseType   = responseType;
+    entry->mRecordType     = DetermineQuestionRecordType(info);
+    entry->mRecursionFlag  = info.mConfig.mRecursionFlag;
+    entry->mNat64Mode      = info.mConfig.mNat64Mode;
+
+    mCacheList.Push(*entry);
+    response = nullptr;
+
+    LogInfo("Cached response for %lu sec", ToUlong(ttl));
+
+exit:
+    FreeMessage(response);
+}
+
+Client::CacheEntry *Client::FindCacheEntry(const QueryInfo &aInfo, const Name &aQueryName)
+{
+    CacheEntry *matchedEntry = nullptr;
+    uint16_t    recordType   = DetermineQuestionRecordType(aInfo);
+
+    RemoveExpiredCacheEntries();
+
+    for (CacheEntry &entry : mCacheList)
+    {
+        if (entry.Matches(aInfo, recordType, aQueryName))
+        {
+            matchedEntry = &entry;
+            break;
+        }
+    }
+
+    return matchedEntry;
+}
+
+void Client::RemoveCacheEntry(CacheEntry &aEntry)
+{
+    IgnoreError(mCacheList.Remove(aEntry));
+    FreeMessage(aEntry.mResponse);
+    mCachePool.Free(aEntry);
+}
+
+void Client::RemoveExpiredCacheEntries(void)
+{
+    TimeMilli   now = TimerMilli::GetNow();
+    CacheEntry *next;
+
+    for (CacheEntry *entry = mCacheList.GetHead(); entry != nullptr; entry = next)
+    {
+        next = entry->GetNext();
+
+        if (entry->mExpireTime <= now)
+        {
+            RemoveCacheEntry(*entry);
+        }
+    }
+}
+
+void Client::HandleCacheTask(void)
+{
+    // Finalizes all queries answered from cache. The callbacks may
+    // start or stop other queries, so we search from the list head
+    // again after finalizing each query.
+
+    Query    *query;
+    QueryInfo info;
+
+    do
+    {
+        for (query = mMainQueries.GetHead(); query != nullptr; query = query->GetNext())
+        {
+            info.ReadFrom(*query);
+
+            if ((info.mSavedResponse != nullptr) && (info.mTransmissionCount == 0))
+            {
+                break;
+            }
+        }
+
+        if (query != nullptr)
+        {
+            Header header;
+            Error  responseError;
+
+            IgnoreError(info.mSavedResponse->Read(info.mSavedResponse->GetOffset(), header));
+            responseError = Header::ResponseCodeToError(header.GetResponseCode());
+
+            if (responseError != kErrorNone)
+            {
+                FinalizeQuery(*query, responseError);
+            }
+            else
+            {
+                PrepareResponseAndFinalize(*query, *info.mSavedResponse, nullptr);
+            }
+        }
+    } while (query != nullptr);
+}
+
+Error Client::DetermineCacheTtl(const Message &aResponseMessage, uint32_t &aTtl)
+{
+    // Determines how long `aResponseMessage` can be cached. For a
+    // positive response, this is the smallest TTL among all its
+    // records. For a negative response (NXDOMAIN or no answer) this
+    // is the smaller of TTL and MINIMUM field of the SOA record in
+    // authority section (RFC 2308). Returns `kErrorNotFound` if the
+    // response cannot be cached.
+
+    Error          error  = kErrorNone;
+    uint16_t       offset = aResponseMessage.GetOffset();
+    Header         header;
+    ResourceRecord record;
+    bool           isNegative;
+    bool           foundSoa = false;
+    uint16_t       authorityStart;
+    uint16_t       authorityEnd;
+    uint16_t       numRecords;
+
+    aTtl = NumericLimits<uint32_t>::kMax;
+
+    SuccessOrExit(error = aResponseMessage.Read(offset, header));
+    offset += sizeof(Header);
+
+    VerifyOrExit(header.GetQuestionCount() > 0, error = kErrorNotFound);
+
+    switch (header.GetResponseCode())
+    {
+    case Header::kResponseSuccess:
+        isNegative = (header.GetAnswerCount() == 0);
+        break;
+    case Header::kResponseNameError:
+        isNegative = true;
+        break;
+    default:
+        ExitNow(error = kErrorNotFound);
+    }
+
+    for (uint16_t num = 0; num < header.GetQuestionCount(); num++)
+    {
+        SuccessOrExit(error = Name::ParseName(aResponseMessage, offset));
+        offset += sizeof(Question);
+    }
+
+    authorityStart = header.GetAnswerCount();
+    authorityEnd   = authorityStart + header.GetAuthorityRecordCount();
+    numRecords     = authorityEnd + header.GetAdditionalRecordCount();
+
+    for (uint16_t index = 0; index < numRecords; index++)
+    {
+        SuccessOrExit(error = Name::ParseName(aResponseMessage, offset));
+        SuccessOrExit(error = aResponseMessage.Read(offset, record));
+
+        if (record.GetType() == ResourceRecord::kTypeOpt)
+        {
+            // OPT pseudo-record uses the TTL field for flags.
+        }
+        else if (!isNegative)
+        {
+            aTtl = Min(aTtl, record.GetTtl());
+        }
+        else if ((record.GetType() == ResourceRecord::kTypeSoa) && (index >= authorityStart) &&
+                 (index < authorityEnd) && (record.GetLength() >= sizeof(uint32_t)))
+        {
+            uint32_t minimum;
+
+            // MINIMUM is the last field in SOA record data.
+            SuccessOrExit(error = aResponseMessage.Read(offset + record.GetSize() - sizeof(uint32_t), minimum));
+            aTtl     = Min(aTtl, Min(record.GetTtl(), BigEndian::HostSwap32(minimum)));
+            foundSoa = true;
+        }
+
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+    VerifyOrExit(!isNegative || foundSoa, error = kErrorNotFound);
+
+exit:
+    return error;
+}
+
+void Client::AgeRecordTtls(Message &aResponseMessage, uint32_t aElapsedTime)
+{
+    // Reduces the TTL of all records in a cached response by
+    // `aElapsedTime` (in seconds). The cached response is already
+    // validated so parse errors are not expected here.
+
+    uint16_t       offset = aResponseMessage.GetOffset();
+    Header         header;
+    ResourceRecord record;
+    uint16_t       numRecords;
+
+    VerifyOrExit(aElapsedTime > 0);
+
+    SuccessOrExit(aResponseMessage.Read(offset, header));
+    offset += sizeof(Header);
+
+    for (uint16_t num = 0; num < header.GetQuestionCount(); num++)
+    {
+        SuccessOrExit(Name::ParseName(aResponseMessage, offset));
+        offset += sizeof(Question);
+    }
+
+    numRecords = header.GetAnswerCount() + header.GetAuthorityRecordCount() + header.GetAdditionalRecordCount();
+
+    for (uint16_t index = 0; index < numRecords; index++)
+    {
+        SuccessOrExit(Name::ParseName(aResponseMessage, offset));
+        SuccessOrExit(aResponseMessage.Read(offset, record));
+
+        if (record.GetType() != ResourceRecord::kTypeOpt)
+        {
+            record.SetTtl((record.GetTtl() > aElapsedTime) ? record.GetTtl() - aElapsedTime : 0);
+            aResponseMessage.Write(offset, record);
+        }
+
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    return;
+}
+
+bool Client::CacheEntry::Matches(const QueryInfo &aInfo, uint16_t aRecordType, const Name &aQueryName) const
+{
+    bool     matches = false;
+    uint16_t offset  = mResponse->GetOffset() + sizeof(Header);
+
+    VerifyOrExit(mQueryType == aInfo.mQueryType);
+    VerifyOrExit(mRecordType == aRecordType);
+    VerifyOrExit(mRecursionFlag == aInfo.mConfig.mRecursionFlag);
+    VerifyOrExit(mNat64Mode == aInfo.mConfig.mNat64Mode);
+    VerifyOrExit(mServerSockAddr == aInfo.mConfig.GetServerSockAddr());
+    SuccessOrExit(Name::CompareName(*mResponse, offset, aQueryName));
+    matches = true;
+
+exit:
+    return matches;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
 
 Error Client::ReplaceWithIp4Query(Query &aQuery, const Message &aResponseMessage)
@@ -37,8 +37,12 @@
 
 #include "common/as_core_type.hpp"
 #include "common/clearable.hpp"
+#include "common/linked_list.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/notifier.hpp"
+#include "common/pool.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
@@ -103,6 +107,8 @@ struct otDnsRecordResponse
 
 namespace ot {
 
+class UnitTester;
+
 namespace Srp {
 class Client;
 }
@@ -115,6 +121,10 @@ namespace Dns {
 class Client : public InstanceLocator, private NonCopyable
 {
     friend class ot::Srp::Client;
+    friend class ot::UnitTester;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    friend class ot::Notifier;
+#endif
 
     typedef Message Query; // `Message` is used to save `Query` related info.
 
@@ -270,6 +280,16 @@ public:
         void SetFrom(const QueryConfig *aConfig, const QueryConfig &aDefaultConfig);
     };
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    /**
+     * Represents the answer cache counters.
+     */
+    class CacheCounters : public otDnsClientCacheCounters, public Clearable<CacheCounters>
+    {
+        friend class Client;
+    };
+#endif
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
     /**
      * Provides info for a DNS service instance.
@@ -715,6 +735,42 @@ public:
      */
     void ResetDefaultConfig(void);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    /**
+     * Enables or disables the answer cache.
+     *
+     * Disabling the cache flushes all cached responses.
+     *
+     * @param[in] aEnabled   TRUE to enable the cache, FALSE to disable it.
+     */
+    void SetCacheEnabled(bool aEnabled);
+
+    /**
+     * Indicates whether the answer cache is enabled.
+     *
+     * @retval TRUE   The cache is enabled.
+     * @retval FALSE  The cache is disabled.
+     */
+    bool IsCacheEnabled(void) const { return mCacheEnabled; }
+
+    /**
+     * Removes all responses from the answer cache.
+     */
+    void FlushCache(void);
+
+    /**
+     * Gets the answer cache counters.
+     *
+     * @returns The cache counters.
+     */
+    const CacheCounters &GetCacheCounters(void) const { return mCacheCounters; }
+
+    /**
+     * Resets the answer cache counters.
+     */
+    void ResetCacheCounters(void) { mCacheCounters.Clear(); }
+#endif
+
     /**
      * Sends an address resolution DNS query for AAAA (IPv6) record for a given host name.
      *
@@ -923,6 +979,9 @@ private:
         bool        mShouldResolveHostAddr;
 #if OPENTHREAD_CONFIG_DNS_CLIENT_ARBITRARY_RECORD_QUERY_ENABLE
         uint16_t mRecordType; // Used only when `mQueryType == kRecordQuery`
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        QueryType mRequestedType; // Query type requested by the caller (before any NAT64 replacement).
 #endif
         Query   *mMainQuery;
         Query   *mNextQuery;
@@ -974,6 +1033,41 @@ private:
     void UpdateDefaultConfigAddress(void);
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    static constexpr uint16_t kCacheMaxEntries = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES;
+    static constexpr uint32_t kCacheMaxTtl     = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL; // In seconds.
+
+    struct CacheEntry : public LinkedListEntry<CacheEntry>
+    {
+        bool Matches(const QueryInfo &aInfo, uint16_t aRecordType, const Name &aQueryName) const;
+
+        CacheEntry   *mNext;
+        Message      *mResponse;
+        Ip6::SockAddr mServerSockAddr;
+        TimeMilli     mSaveTime;
+        TimeMilli     mExpireTime;
+        QueryType     mQueryType;
+        QueryType     mResponseType;
+        uint16_t      mRecordType;
+        uint8_t       mRecursionFlag;
+        uint8_t       mNat64Mode;
+    };
+
+    void        HandleNotifierEvents(Events aEvents);
+    bool        AnswerFromCache(Query &aQuery, const QueryInfo &aInfo);
+    void        SaveToCache(const Query &aQuery, const Message &aResponseMessage);
+    CacheEntry *FindCacheEntry(const QueryInfo &aInfo, const Name &aQueryName);
+    void        RemoveCacheEntry(CacheEntry &aEntry);
+    void        RemoveExpiredCacheEntries(void);
+    void        HandleCacheTask(void);
+
+    static bool  IsCacheable(const QueryInfo &aInfo);
+    static Error DetermineCacheTtl(const Message &aResponseMessage, uint32_t &aTtl);
+    static void  AgeRecordTtls(Message &aResponseMessage, uint32_t aElapsedTime);
+
+    using CacheTask = TaskletIn<Client, &Client::HandleCacheTask>;
+#endif
+
 #if OPENTHREAD_CONFIG_DNS_CLIENT_OVER_TCP_ENABLE
     static void HandleTcpEstablishedCallback(otTcpEndpoint *aEndpoint);
     static void HandleTcpSendDoneCallback(otTcpEndpoint *aEndpoint, otLinkedBuffer *aData);
@@ -1022,11 +1116,21 @@ private:
     bool mUserDidSetDefaultAddress;
 #endif
     Array<Ip6::Address, kLimitedQueryServersArraySize> mLimitedQueryServers;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    bool                               mCacheEnabled;
+    LinkedList<CacheEntry>             mCacheList;
+    Pool<CacheEntry, kCacheMaxEntries> mCachePool;
+    CacheTask                          mCacheTask;
+    CacheCounters                      mCacheCounters;
+#endif
 };
 
 } // namespace Dns
 
 DefineCoreType(otDnsQueryConfig, Dns::Client::QueryConfig);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+DefineCoreType(otDnsClientCacheCounters, Dns::Client::CacheCounters);
+#endif
 DefineCoreType(otDnsAddressResponse, Dns::Client::AddressResponse);
 #if OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 DefineCoreType(otDnsBrowseResponse, Dns::Client::BrowseResponse);
@@ -112,6 +112,11 @@ void Dso::Connection::SetState(State aState)
     mState          = aState;
     mStateDidChange = true;
 
+    if ((mState == kStateSessionEstablished) && IsClient())
+    {
+        Get<Dso>().mCounters.mSessionsEstablished++;
+    }
+
 exit:
     return;
 }
@@ -121,9 +126,13 @@ void Dso::Connection::SignalAnyStateChange(void)
     VerifyOrExit(mStateDidChange);
     mStateDidChange = false;
 
+    // The users are signaled before the owner since the owner may
+    // disconnect or free the connection from its callback.
+
     switch (mState)
     {
     case kStateDisconnected:
+        SignalUsersDisconnected();
         mCallbacks.mHandleDisconnected(*this);
         break;
 
@@ -132,6 +141,12 @@ void Dso::Connection::SignalAnyStateChange(void)
         break;
 
     case kStateSessionEstablished:
+        for (User *user = mUsers.GetHead(), *next; user != nullptr; user = next)
+        {
+            next = user->GetNext();
+            user->mCallbacks.mHandleSessionEstablished(*this);
+        }
+
         mCallbacks.mHandleSessionEstablished(*this);
         break;
 
@@ -156,6 +171,7 @@ void Dso::Connection::Connect(void)
 
     Init(/* aIsServer */ false);
     Get<Dso>().mClientConnections.Push(*this);
+    Get<Dso>().mCounters.mConnectAttempts++;
     MarkAsConnecting();
     otPlatDsoConnect(this, &mPeerSockAddr);
 }
@@ -196,6 +212,22 @@ void Dso::Connection::HandleConnected(void)
 
 void Dso::Connection::Disconnect(DisconnectMode aMode, DisconnectReason aReason)
 {
+    Close(aMode, aReason);
+
+    // The owner requested the disconnect, so it is not signaled and
+    // may free the connection once we return. The users are signaled
+    // now that the disconnect is fully processed.
+
+    SignalUsersDisconnected();
+}
+
+void Dso::Connection::Close(DisconnectMode aMode, DisconnectReason aReason)
+{
+    // Disconnects without signaling. Used when the DSO module itself
+    // closes the connection, in which case both the users and the
+    // owner are signaled from `SignalAnyStateChange()` once the
+    // current event is fully processed.
+
     VerifyOrExit(mState != kStateDisconnected);
 
     mDisconnectReason = aReason;
@@ -252,6 +284,14 @@ void Dso::Connection::MarkAsDisconnected(void)
     LogInfo("Disconnect reason: %s", DisconnectReasonToString(mDisconnectReason));
 }
 
+void Dso::Connection::SignalUsersDisconnected(void)
+{
+    while (!mUsers.IsEmpty())
+    {
+        mUsers.Pop()->mCallbacks.mHandleDisconnected(*this);
+    }
+}
+
 void Dso::Connection::MarkSessionEstablished(void)
 {
     switch (mState)
@@ -274,6 +314,39 @@ Error Dso::Connection::SendRequestMessage(Message &aMessage, MessageId &aMessage
     return SendMessage(aMessage, kRequestMessage, aMessageId, Dns::Header::kResponseSuccess, aResponseTimeout);
 }
 
+Error Dso::Connection::SendRequestMessage(Message   &aMessage,
+                                         MessageId &aMessageId,
+                                         User      &aUser,
+                                         uint32_t   aResponseTimeout)
+{
+    OT_ASSERT(mUsers.Contains(aUser));
+
+    return SendMessage(aMessage, kRequestMessage, aMessageId, Dns::Header::kResponseSuccess, aResponseTimeout, &aUser);
+}
+
+void Dso::Connection::AddUser(User &aUser)
+{
+    OT_ASSERT(IsClient() && (mState != kStateDisconnected));
+
+    VerifyOrExit(!mUsers.Contains(aUser));
+    mUsers.Push(aUser);
+    Get<Dso>().mCounters.mConnectionReuses++;
+
+    LogInfo("Sharing connection with %s", mPeerSockAddr.ToString().AsCString());
+
+exit:
+    return;
+}
+
+void Dso::Connection::RemoveUser(User &aUser)
+{
+    SuccessOrExit(mUsers.Remove(aUser));
+    mPendingRequests.DropResponsesFor(aUser);
+
+exit:
+    return;
+}
+
 Error Dso::Connection::SendUnidirectionalMessage(Message &aMessage)
 {
     MessageId messageId = 0;
@@ -455,7 +528,7 @@ Error Dso::Connection::SendKeepAliveMessage(MessageType aMessageType, MessageId
     else
     {
         keepAliveTlv.SetInactivityTimeout(mInactivity.GetRequestInterval());
-        keepAliveTlv.SetKeepAliveInterval(mKeepAlive.GetRequestInterval());
+        keepAliveTlv.SetKeepAliveInterval(DetermineKeepAliveRequestInterval());
     }
 
     SuccessOrExit(error = message->Append(keepAliveTlv));
@@ -471,7 +544,8 @@ Error Dso::Connection::SendMessage(Message              &aMessage,
                                    MessageType           aMessageType,
                                    MessageId            &aMessageId,
                                    Dns::Header::Response aResponseCode,
-                                   uint32_t              aResponseTimeout)
+                                   uint32_t              aResponseTimeout,
+                                   User                 *aUser)
 {
     Error       error          = kErrorNone;
     Tlv::Type   primaryTlvType = Tlv::kReservedType;
@@ -560,8 +634,8 @@ Error Dso::Connection::SendMessage(Message              &aMessage,
 
     if (aMessageType == kRequestMessage)
     {
-        SuccessOrExit(
-            error = mPendingRequests.Add(mNextMessageId, primaryTlvType, TimerMilli::GetNow() + aResponseTimeout));
+        SuccessOrExit(error = mPendingRequests.Add(mNextMessageId, primaryTlvType, aUser, aResponseTimeout));
+        Get<Dso>().mCounters.mRequestsSent++;
 
         if (++mNextMessageId == 0)
         {
@@ -739,7 +813,7 @@ exit:
     }
     else
     {
-        Disconnect(kForciblyAbort, kReasonPeerMisbehavior);
+        Close(kForciblyAbort, kReasonPeerMisbehavior);
     }
 
     // We signal any state change at the very end when the received
@@ -837,17 +911,27 @@ Error Dso::Connection::ProcessResponseMessage(const Dns::Header &aHeader,
                                               const Message     &aMessage,
                                               Tlv::Type          aPrimaryTlvType)
 {
-    Error     error = kErrorAbort;
-    Tlv::Type requestPrimaryTlvType;
+    Error                         error = kErrorAbort;
+    const PendingRequests::Entry *request;
+    Tlv::Type                     requestPrimaryTlvType;
+    Callbacks                    *callbacks = &mCallbacks;
+    bool                          dropResponse;
+    uint32_t                      responseTime;
+    Counters                     &counters = Get<Dso>().mCounters;
 
     // If a client or server receives a response where the message
     // ID is zero, or is any other value that does not match the
     // message ID of any of its outstanding operations, this is a
     // fatal error and the recipient MUST forcibly abort the
-    // connection immediately.
+    // connection immediately. The responses to pipelined requests
+    // can arrive in any order.
 
     VerifyOrExit(aHeader.GetMessageId() != 0);
-    VerifyOrExit(mPendingRequests.Contains(aHeader.GetMessageId(), requestPrimaryTlvType));
+
+    request = mPendingRequests.Find(aHeader.GetMessageId());
+    VerifyOrExit(request != nullptr);
+
+    requestPrimaryTlvType = request->mPrimaryTlvType;
 
     // If the response has no error and contains a primary TLV, it
     // MUST match the request primary TLV.
@@ -857,6 +941,18 @@ Error Dso::Connection::ProcessResponseMessage(const Dns::Header &aHeader,
         VerifyOrExit(aPrimaryTlvType == requestPrimaryTlvType);
     }
 
+    if (request->mUser != nullptr)
+    {
+        callbacks = &request->mUser->mCallbacks;
+    }
+
+    dropResponse = request->mDropResponse;
+    responseTime = TimerMilli::GetNow() - request->mSendTime;
+
+    counters.mResponsesReceived++;
+    counters.mTotalResponseTime += responseTime;
+    counters.mMaxResponseTime = Max(counters.mMaxResponseTime, responseTime);
+
     mPendingRequests.Remove(aHeader.GetMessageId());
 
     switch (requestPrimaryTlvType)
@@ -866,7 +962,14 @@ Error Dso::Connection::ProcessResponseMessage(const Dns::Header &aHeader,
         break;
 
     default:
-        SuccessOrExit(error = mCallbacks.mProcessResponseMessage(*this, aHeader, aMessage, aPrimaryTlvType,
+        if (dropResponse)
+        {
+            LogInfo("Dropping response with id %u, user was removed", aHeader.GetMessageId());
+            error = kErrorNone;
+            break;
+        }
+
+        SuccessOrExit(error = callbacks->mProcessResponseMessage(*this, aHeader, aMessage, aPrimaryTlvType,
                                                                  requestPrimaryTlvType));
         break;
     }
@@ -910,7 +1013,7 @@ Error Dso::Connection::ProcessKeepAliveMessage(const Dns::Header &aHeader, const
 
             if (mState == kStateEstablishingSession)
             {
-                Disconnect(kGracefullyClose, kReasonPeerDoesNotSupportDso);
+                Close(kGracefullyClose, kReasonPeerDoesNotSupportDso);
                 error = kErrorNone;
             }
 
@@ -1013,7 +1116,7 @@ Error Dso::Connection::ProcessRetryDelayMessage(const Dns::Header &aHeader, cons
     LogInfo("Received Retry Delay message from server %s", mPeerSockAddr.ToString().AsCString());
     LogInfo("   RetryDelay:%lu ms, ResponseCode:%d", ToUlong(mRetryDelay), mRetryDelayErrorCode);
 
-    Disconnect(kGracefullyClose, kReasonServerRetryDelayRequest);
+    Close(kGracefullyClose, kReasonServerRetryDelayRequest);
 
 exit:
     return error;
@@ -1040,6 +1143,24 @@ exit:
     FreeMessage(response);
 }
 
+uint32_t Dso::Connection::DetermineKeepAliveRequestInterval(void) const
+{
+    // On a sleepy device, every Keep Alive exchange wakes the device
+    // and its parent needs to hold the response until the next data
+    // poll, so a longer interval is requested. Any other message
+    // exchanged on the session also resets the Keep Alive timer, so
+    // a busy session does not need any Keep Alive messages.
+
+    uint32_t interval = mKeepAlive.GetRequestInterval();
+
+    if (!Get<Mle::Mle>().IsRxOnWhenIdle())
+    {
+        interval = Max(interval, kSleepyKeepAliveInterval);
+    }
+
+    return interval;
+}
+
 void Dso::Connection::AdjustInactivityTimeout(uint32_t aNewTimeout)
 {
     // This method sets the inactivity timeout interval to a new value
@@ -1234,7 +1355,7 @@ void Dso::Connection::HandleTimer(NextFireTime &aNextTime)
     case kStateConnecting:
         if (mKeepAlive.IsExpired(aNextTime.GetNow()))
         {
-            Disconnect(kGracefullyClose, kReasonFailedToConnect);
+            Close(kGracefullyClose, kReasonFailedToConnect);
         }
         break;
 
@@ -1246,7 +1367,7 @@ void Dso::Connection::HandleTimer(NextFireTime &aNextTime)
             // If server sends no response to a request, client
             // waits for 30 seconds (`kResponseTimeout`) after which
             // client MUST forcibly abort the connection.
-            Disconnect(kForciblyAbort, kReasonResponseTimeout);
+            Close(kForciblyAbort, kReasonResponseTimeout);
             ExitNow();
         }
 
@@ -1264,7 +1385,7 @@ void Dso::Connection::HandleTimer(NextFireTime &aNextTime)
             // whichever is grater) elapses server MUST consider the
             // client delinquent and MUST forcibly abort the connection.
 
-            Disconnect(IsClient() ? kGracefullyClose : kForciblyAbort, kReasonInactivityTimeout);
+            Close(IsClient() ? kGracefullyClose : kForciblyAbort, kReasonInactivityTimeout);
             ExitNow();
         }
 
@@ -1284,7 +1405,7 @@ void Dso::Connection::HandleTimer(NextFireTime &aNextTime)
             }
             else
             {
-                Disconnect(kForciblyAbort, kReasonKeepAliveTimeout);
+                Close(kForciblyAbort, kReasonKeepAliveTimeout);
                 ExitNow();
             }
         }
@@ -1344,33 +1465,60 @@ const char *Dso::Connection::DisconnectReasonToString(DisconnectReason aReason)
 //---------------------------------------------------------------------------------------------------------------------
 // Dso::Connection::PendingRequests
 
-bool Dso::Connection::PendingRequests::Contains(MessageId aMessageId, Tlv::Type &aPrimaryTlvType) const
+Error Dso::Connection::PendingRequests::Add(MessageId aMessageId,
+                                            Tlv::Type aPrimaryTlvType,
+                                            User     *aUser,
+                                            uint32_t  aResponseTimeout)
 {
-    bool         contains = true;
-    const Entry *entry    = mRequests.FindMatching(aMessageId);
+    Error  error = kErrorNone;
+    Entry *entry;
 
-    VerifyOrExit(entry != nullptr, contains = false);
-    aPrimaryTlvType = entry->mPrimaryTlvType;
+    VerifyOrExit(mRequests.GetLength() < kMaxPendingRequests, error = kErrorNoBufs);
+
+    entry = mRequests.PushBack();
+    VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
+
+    entry->mMessageId      = aMessageId;
+    entry->mPrimaryTlvType = aPrimaryTlvType;
+    entry->mDropResponse   = false;
+    entry->mUser           = aUser;
+    entry->mSendTime       = TimerMilli::GetNow();
+    entry->mTimeout        = entry->mSendTime + aResponseTimeout;
 
 exit:
-    return contains;
+    return error;
 }
 
-Error Dso::Connection::PendingRequests::Add(MessageId aMessageId, Tlv::Type aPrimaryTlvType, TimeMilli aResponseTimeout)
+void Dso::Connection::PendingRequests::Remove(MessageId aMessageId)
 {
-    Error  error = kErrorNone;
-    Entry *entry = mRequests.PushBack();
+    Entry *entry = mRequests.FindMatching(aMessageId);
 
-    VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
-    entry->mMessageId      = aMessageId;
-    entry->mPrimaryTlvType = aPrimaryTlvType;
-    entry->mTimeout        = aResponseTimeout;
+    VerifyOrExit(entry != nullptr);
+
+    // Move the last entry into the place of the removed one.
+
+    *entry = *mRequests.Back();
+    mRequests.PopBack();
 
 exit:
-    return error;
+    return;
 }
 
-void Dso::Connection::PendingRequests::Remove(MessageId aMessageId) { mRequests.RemoveMatching(aMessageId); }
+void Dso::Connection::PendingRequests::DropResponsesFor(const User &aUser)
+{
+    // The entries are kept so that the responses (when received)
+    // are still matched with a pending request and are not treated
+    // as a fatal error.
+
+    for (Entry &entry : mRequests)
+    {
+        if (entry.Matches(aUser))
+        {
+            entry.mDropResponse = true;
+            entry.mUser         = nullptr;
+        }
+    }
+}
 
 bool Dso::Connection::PendingRequests::HasAnyTimedOut(TimeMilli aNow) const
 {
@@ -1404,6 +1552,7 @@ Dso::Dso(Instance &aInstance)
     , mAcceptHandler(nullptr)
     , mTimer(aInstance)
 {
+    mCounters.Clear();
 }
 
 void Dso::StartListening(AcceptHandler aAcceptHandler)
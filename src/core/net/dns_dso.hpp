@@ -35,10 +35,11 @@
 
 #include <openthread/platform/dso_transport.h>
 
-#include "common/array.hpp"
 #include "common/as_core_type.hpp"
+#include "common/clearable.hpp"
 #include "common/const_cast.hpp"
 #include "common/encoding.hpp"
+#include "common/heap_array.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
@@ -115,6 +116,28 @@ public:
      */
     static constexpr uint32_t kMinServerInactivityWaitTime = TimeMilli::SecToMsec(5);
 
+    /**
+     * The minimum Keep Alive interval (in msec) requested by a client when device is sleepy (rx-off-when-idle).
+     */
+    static constexpr uint32_t kSleepyKeepAliveInterval = OPENTHREAD_CONFIG_DNS_DSO_SLEEPY_KEEP_ALIVE_INTERVAL;
+
+    /**
+     * Represents the DSO counters.
+     *
+     * The counters can be used to evaluate the benefit of sharing client connections, i.e., the number of connection
+     * attempts and session handshakes avoided and the response time of requests.
+     */
+    struct Counters : public Clearable<Counters>
+    {
+        uint32_t mConnectAttempts;     ///< Number of client connection attempts.
+        uint32_t mSessionsEstablished; ///< Number of client DSO sessions established.
+        uint32_t mConnectionReuses;    ///< Number of times a client connection was shared with another user.
+        uint32_t mRequestsSent;        ///< Number of request messages sent.
+        uint32_t mResponsesReceived;   ///< Number of response messages received for a pending request.
+        uint32_t mTotalResponseTime;   ///< Sum of the response times of all received responses (in msec).
+        uint32_t mMaxResponseTime;     ///< Maximum response time of a received response (in msec).
+    };
+
     /**
      * Represents a DSO TLV.
      */
@@ -372,6 +395,42 @@ public:
             ProcessResponseMessage       mProcessResponseMessage;
         };
 
+        /**
+         * Represents an additional user of a shared client `Connection`.
+         *
+         * Multiple modules talking to the same server (e.g., DNS client, SRP client, discovery proxy) can share one
+         * client `Connection` instead of each connecting and establishing its own DSO session. The module calling
+         * `Connect()` owns the connection. Other modules find it using `Dso::FindClientConnection()` and attach a
+         * `User` to it using `AddUser()`.
+         *
+         * The `Callbacks` of a `User` are invoked for session state changes (`HandleSessionEstablished` and
+         * `HandleDisconnected`) and for responses to the requests sent on behalf of the `User` (`SendRequestMessage()`
+         * with a `User`). The `HandleConnected` callback is not used, and the request and unidirectional messages
+         * received from the peer are always passed to the owner's `Callbacks`.
+         */
+        class User : public LinkedListEntry<User>, private NonCopyable
+        {
+            friend class Connection;
+            friend class LinkedList<User>;
+            friend class LinkedListEntry<User>;
+
+        public:
+            /**
+             * Initializes a `User` instance.
+             *
+             * @param[in] aCallbacks   A reference to the `Callbacks` instance used by the `User`.
+             */
+            explicit User(Callbacks &aCallbacks)
+                : mNext(nullptr)
+                , mCallbacks(aCallbacks)
+            {
+            }
+
+        private:
+            User      *mNext;
+            Callbacks &mCallbacks;
+        };
+
         /**
          * Initializes a `Connection` instance.
          *
@@ -454,7 +513,8 @@ public:
          * Requests the connection to be disconnected.
          *
          * Note that calling `Disconnect()` does not trigger the `Callbacks::HandleDisconnected()` to be invoked (as
-         * this callback is used when DSO module itself or the peer disconnects the connections).
+         * this callback is used when DSO module itself or the peer disconnects the connections). The callbacks of any
+         * `User` sharing the connection are invoked before `Disconnect()` returns.
          *
          * After the call to `Disconnect()` the caller can take back ownership of the `Connection` (e.g., can free the
          * `Connection` instance if it was heap allocated).
@@ -514,6 +574,62 @@ public:
                                  MessageId &aMessageId,
                                  uint32_t   aResponseTimeout = kResponseTimeout);
 
+        /**
+         * Sends a DSO request message on behalf of a `User` of a shared connection.
+         *
+         * Behaves the same as the `SendRequestMessage()` above, except that the response is passed to the
+         * `Callbacks::ProcessResponseMessage()` of @p aUser instead of the owner's `Callbacks`. Requests from the owner
+         * and from different users can be pipelined on the session and their responses can arrive in any order.
+         *
+         * @param[in]  aMessage          The DSO request message to send.
+         * @param[out] aMessageId        A reference to output the message ID used for the transmission.
+         * @param[in]  aUser             The `User` sending the request. MUST be added to the connection.
+         * @param[in]  aResponseTimeout  The response timeout in msec (default value is `kResponseTimeout`)
+         *
+         * @retval  kErrorNone      Successfully sent the DSO request message and updated @p aMessageId.
+         * @retval  kErrorNoBufs    Failed to allocate new buffer to prepare the message, or too many pending requests.
+         */
+        Error SendRequestMessage(Message   &aMessage,
+                                 MessageId &aMessageId,
+                                 User      &aUser,
+                                 uint32_t   aResponseTimeout = kResponseTimeout);
+
+        /**
+         * Adds a `User` to share this client connection.
+         *
+         * MUST be used on a client connection which is not in `kStateDisconnected` state (i.e., after `Connect()`).
+         *
+         * If the session is already established, no callback is invoked for @p aUser (the user can check the current
+         * state using `GetState()`). Otherwise, the `HandleSessionEstablished()` callback of @p aUser is invoked once
+         * the session is established.
+         *
+         * When the connection gets disconnected (by the owner calling `Disconnect()`, by the DSO module itself, or by
+         * the peer), the `HandleDisconnected()` callback of all users is invoked and all users are removed. The users
+         * are signaled on the same path as the owner once the event causing the disconnect is fully processed, and
+         * before the owner (which may free the connection from its callback). The same applies to
+         * `HandleSessionEstablished()`.
+         *
+         * @param[in] aUser   The `User` to add.
+         */
+        void AddUser(User &aUser);
+
+        /**
+         * Removes a previously added `User` from the connection.
+         *
+         * Responses to any pending requests sent on behalf of @p aUser are dropped when received.
+         *
+         * @param[in] aUser   The `User` to remove.
+         */
+        void RemoveUser(User &aUser);
+
+        /**
+         * Indicates whether or not the connection is shared with any `User`.
+         *
+         * @retval TRUE   The connection is shared.
+         * @retval FALSE  The connection is not shared.
+         */
+        bool IsShared(void) const { return !mUsers.IsEmpty(); }
+
         /**
          * Sends a DSO unidirectional message.
          *
@@ -664,31 +780,39 @@ public:
             kUnidirectionalMessage,
         };
 
-        // Info about pending request messages (message ID, primary TLV type, and response timeout).
+        // Info about pending request messages (message ID, primary TLV type, requesting user and timing). The
+        // entries are allocated from heap as requests are sent and freed when the connection is disconnected.
         class PendingRequests
         {
         public:
-            static constexpr uint8_t kMaxPendingRequests = OPENTHREAD_CONFIG_DNS_DSO_MAX_PENDING_REQUESTS;
+            static constexpr uint16_t kMaxPendingRequests = OPENTHREAD_CONFIG_DNS_DSO_MAX_PENDING_REQUESTS;
 
-            void  Clear(void) { mRequests.Clear(); }
-            bool  IsEmpty(void) const { return mRequests.IsEmpty(); }
-            bool  Contains(MessageId aMessageId, Tlv::Type &aPrimaryTlvType) const;
-            Error Add(MessageId aMessageId, Tlv::Type aPrimaryTlvType, TimeMilli aResponseTimeout);
-            void  Remove(MessageId aMessageId);
-            bool  HasAnyTimedOut(TimeMilli aNow) const;
-            void  UpdateNextFireTime(NextFireTime &aNextTime) const;
-
-        private:
             struct Entry
             {
                 bool Matches(MessageId aMessageId) const { return mMessageId == aMessageId; }
+                bool Matches(const User &aUser) const { return mUser == &aUser; }
 
                 MessageId mMessageId;
                 Tlv::Type mPrimaryTlvType;
+                bool      mDropResponse; // The user sending the request was removed.
+                User     *mUser;         // `nullptr` if request is from the owner.
+                TimeMilli mSendTime;
                 TimeMilli mTimeout; // Latest time by which a response is expected.
             };
 
-            Array<Entry, kMaxPendingRequests> mRequests;
+            void         Clear(void) { mRequests.Free(); }
+            bool         IsEmpty(void) const { return mRequests.GetLength() == 0; }
+            const Entry *Find(MessageId aMessageId) const { return mRequests.FindMatching(aMessageId); }
+            Error        Add(MessageId aMessageId, Tlv::Type aPrimaryTlvType, User *aUser, uint32_t aResponseTimeout);
+            void         Remove(MessageId aMessageId);
+            void         DropResponsesFor(const User &aUser);
+            bool         HasAnyTimedOut(TimeMilli aNow) const;
+            void         UpdateNextFireTime(NextFireTime &aNextTime) const;
+
+        private:
+            static constexpr uint16_t kCapacityIncrement = 4;
+
+            Heap::Array<Entry, kCapacityIncrement> mRequests;
         };
 
         // Inactivity or KeepAlive timeout
@@ -741,14 +865,17 @@ public:
         void MarkAsConnecting(void);
         void HandleConnected(void);
         void HandleDisconnected(DisconnectMode aMode);
+        void Close(DisconnectMode aMode, DisconnectReason aReason);
         void MarkAsDisconnected(void);
+        void SignalUsersDisconnected(void);
 
         Error SendKeepAliveMessage(MessageType aMessageType, MessageId aResponseId);
         Error SendMessage(Message              &aMessage,
                           MessageType           aMessageType,
                           MessageId            &aMessageId,
                           Dns::Header::Response aResponseCode    = Dns::Header::kResponseSuccess,
-                          uint32_t              aResponseTimeout = kResponseTimeout);
+                          uint32_t              aResponseTimeout = kResponseTimeout,
+                          User                 *aUser            = nullptr);
         void  HandleReceive(Message &aMessage);
         Error ReadPrimaryTlv(const Message &aMessage, Tlv::Type &aPrimaryTlvType) const;
         Error ProcessRequestOrUnidirectionalMessage(const Dns::Header &aHeader,
@@ -760,6 +887,7 @@ public:
         void  SendErrorResponse(const Dns::Header &aHeader, Dns::Header::Response aResponseCode);
         Error AppendPadding(Message &aMessage);
 
+        uint32_t DetermineKeepAliveRequestInterval(void) const;
         void     AdjustInactivityTimeout(uint32_t aNewTimeout);
         uint32_t CalculateServerInactivityWaitTime(void) const;
         void     ResetTimeouts(bool aIsKeepAliveMessage);
@@ -774,6 +902,7 @@ public:
 
         Connection           *mNext;
         Callbacks            &mCallbacks;
+        LinkedList<User>      mUsers;
         Ip6::SockAddr         mPeerSockAddr;
         State                 mState;
         MessageId             mNextMessageId;
@@ -846,6 +975,18 @@ public:
      */
     Connection *FindServerConnection(const Ip6::SockAddr &aPeerSockAddr);
 
+    /**
+     * Gets the DSO counters.
+     *
+     * @returns The DSO counters.
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the DSO counters.
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 private:
     OT_TOOL_PACKED_BEGIN
     class KeepAliveTlv : public Tlv
@@ -907,6 +1048,7 @@ private:
     LinkedList<Connection> mClientConnections;
     LinkedList<Connection> mServerConnections;
     DsoTimer               mTimer;
+    Counters               mCounters;
 };
 
 } // namespace Dns
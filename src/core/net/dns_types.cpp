@@ -1578,6 +1578,58 @@ exit:
     return error;
 }
 
+void RefreshWindowOption::Init(uint32_t aWindowInterval, uint32_t aNextWindowDelay)
+{
+    SetOptionCode(kRefreshWindow);
+    SetOptionLength(kLength);
+    mWindowInterval  = BigEndian::HostSwap32(aWindowInterval);
+    mNextWindowDelay = BigEndian::HostSwap32(aNextWindowDelay);
+}
+
+bool RefreshWindowOption::IsValid(void) const
+{
+    return (GetOptionLength() >= kLength) && (GetWindowInterval() != 0) &&
+           (GetNextWindowDelay() <= GetWindowInterval());
+}
+
+Error RefreshWindowOption::ReadFrom(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+{
+    Error    error = kErrorNone;
+    uint16_t endOffset;
+
+    VerifyOrExit(static_cast<uint32_t>(aOffset) + aLength <= aMessage.GetLength(), error = kErrorParse);
+
+    endOffset = aOffset + aLength;
+
+    while (aOffset < endOffset)
+    {
+        uint16_t size;
+
+        SuccessOrExit(error = aMessage.Read(aOffset, this, sizeof(Option)));
+
+        VerifyOrExit(aOffset + GetSize() <= endOffset, error = kErrorParse);
+
+        size = static_cast<uint16_t>(GetSize());
+
+        if (GetOptionCode() == kRefreshWindow)
+        {
+            VerifyOrExit(GetOptionLength() >= kLength, error = kErrorParse);
+
+            IgnoreError(aMessage.Read(aOffset, this, sizeof(RefreshWindowOption)));
+            VerifyOrExit(IsValid(), error = kErrorParse);
+
+            ExitNow();
+        }
+
+        aOffset += size;
+    }
+
+    error = kErrorNotFound;
+
+exit:
+    return error;
+}
+
 Error PtrRecord::ReadPtrName(const Message &aMessage,
                              uint16_t      &aOffset,
                              char          *aLabelBuffer,
@@ -2709,7 +2709,8 @@ OT_TOOL_PACKED_BEGIN
 class Option
 {
 public:
-    static constexpr uint16_t kUpdateLease = 2; ///< Update lease option code.
+    static constexpr uint16_t kUpdateLease   = 2;     ///< Update lease option code.
+    static constexpr uint16_t kRefreshWindow = 65001; ///< Refresh window option code (Local/Experimental Use).
 
     /**
      * Returns the option code value.
@@ -2847,6 +2848,67 @@ private:
     uint32_t mKeyLeaseInterval;
 } OT_TOOL_PACKED_END;
 
+/**
+ * Implements a Refresh Window Option body.
+ *
+ * The Refresh Window Option is included by an SRP server in its response (along with the Update Lease Option) as a
+ * hint for clients to align their lease refreshes to the server's refresh windows. It uses an option code from the
+ * Local/Experimental Use range (RFC 6891). Time is divided into consecutive windows of the given interval, and the
+ * option indicates the delay from when the response is sent to the start of the next window.
+ */
+OT_TOOL_PACKED_BEGIN
+class RefreshWindowOption : public Option
+{
+public:
+    /**
+     * Initializes the Refresh Window Option.
+     *
+     * @param[in] aWindowInterval  The refresh window interval in msec.
+     * @param[in] aNextWindowDelay The delay in msec from now to the start of next refresh window.
+     */
+    void Init(uint32_t aWindowInterval, uint32_t aNextWindowDelay);
+
+    /**
+     * Tells whether this is a valid Refresh Window Option.
+     *
+     * @returns  TRUE if this is a valid Refresh Window Option, FALSE otherwise.
+     */
+    bool IsValid(void) const;
+
+    /**
+     * Returns the refresh window interval.
+     *
+     * @returns The refresh window interval (in msec).
+     */
+    uint32_t GetWindowInterval(void) const { return BigEndian::HostSwap32(mWindowInterval); }
+
+    /**
+     * Returns the delay to the start of the next refresh window.
+     *
+     * @returns The delay (in msec) from when the option was sent to the start of the next refresh window.
+     */
+    uint32_t GetNextWindowDelay(void) const { return BigEndian::HostSwap32(mNextWindowDelay); }
+
+    /**
+     * Searches among the Options is a given message and reads and validates the Refresh Window Option if found.
+     *
+     * @param[in] aMessage   The message to read the Option from.
+     * @param[in] aOffset    Offset in @p aMessage to the start of Options (start of OPT Record data).
+     * @param[in] aLength    Length of Option data in OPT record.
+     *
+     * @retval kErrorNone      Successfully read and validated the Refresh Window Option from @p aMessage.
+     * @retval kErrorNotFound  Did not find any Refresh Window Option.
+     * @retval kErrorParse     Failed to parse the Options.
+     */
+    Error ReadFrom(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+
+private:
+    static constexpr uint16_t kLength = sizeof(uint32_t) + sizeof(uint32_t);
+
+    uint32_t mWindowInterval;
+    uint32_t mNextWindowDelay;
+} OT_TOOL_PACKED_END;
+
 /**
  * Implements body format of NSEC record (RFC 3845) for use with mDNS.
  */
@@ -390,6 +390,10 @@ Error Ip6::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, uint8_t aI
     uint8_t  dscp;
     uint16_t payloadLength = aMessage.GetLength();
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    Get<Utils::PacketLatencyTracker>().HandleIp6Start(aMessage);
+#endif
+
     if ((aIpProto == kProtoUdp) &&
         Get<Tmf::Agent>().IsTmfMessage(aMessageInfo.GetSockAddr(), aMessageInfo.GetPeerAddr(),
                                        aMessageInfo.GetPeerPort()))
@@ -1322,6 +1326,10 @@ Error Ip6::HandleDatagram(OwnedPtr<Message> aMessagePtr, bool aIsReassembled, ui
 
     VerifyOrExit(aRecursionDepth <= kMaxRecursionDepth, error = kErrorDrop);
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    Get<Utils::PacketLatencyTracker>().HandleIp6Start(*aMessagePtr);
+#endif
+
     SuccessOrExit(error = header.ParseFrom(*aMessagePtr));
 
     if (!aMessagePtr->IsOriginHostTrusted())
@@ -106,6 +106,7 @@ Core::Core(Instance &aInstance)
     , mVerboseLogging(kDefaultVerboseLog)
 #endif
 {
+    ClearAllBytes(mCounters);
 }
 
 void Core::AfterInstanceInit(void)
@@ -465,6 +466,8 @@ void Core::HandleMessage(Message &aMessage, bool aIsUnicast, const AddressInfo &
             ExitNow();
         }
 
+        rxMessagePtr->SuppressDuplicateQueries();
+
         switch (rxMessagePtr->ProcessQuery(/* aShouldProcessTruncated */ false))
         {
         case RxMessage::kProcessed:
@@ -840,6 +843,7 @@ void Core::RecordInfo::StartAnnouncing(void)
     {
         mAnnounceCounter = 0;
         mAnnounceTime    = TimerMilli::GetNow();
+        mAnnounceDelay   = 0;
     }
 }
 
@@ -903,10 +907,17 @@ bool Core::RecordInfo::ShouldAppendTo(EntryContext &aContext)
     {
     case TxMessage::kMulticastResponse:
 
-        if ((mAnnounceCounter < kNumberOfAnnounces) && (mAnnounceTime <= aContext.GetNow()))
+        if ((mAnnounceCounter < kNumberOfAnnounces) && (GetAnnounceTime() <= aContext.GetNow()))
         {
-            shouldAppend = true;
-            ExitNow();
+            // Check if we can delay the announcement so that it can be
+            // aggregated with other transmissions scheduled to go out
+            // a little later.
+
+            if (ExtendAnnounceDelay(aContext) != kErrorNone)
+            {
+                shouldAppend = true;
+                ExitNow();
+            }
         }
 
         if (mMulticastAnswerPending && (GetAnswerTime() <= aContext.GetNow()))
@@ -968,6 +979,35 @@ exit:
     return error;
 }
 
+Error Core::RecordInfo::ExtendAnnounceDelay(EntryContext &aContext)
+{
+    Error error = kErrorFailed;
+
+    // Extend the announcement delay for aggregation when possible.
+    //
+    // This method is called when an announcement is due. The first
+    // announcement is never delayed. A later announcement can be
+    // delayed to an upcoming `mNextAggrTxTime`, provided the overall
+    // delay from its scheduled time `mAnnounceTime` stays within
+    // `kResponseAggregationMaxDelay`. This allows entries registered
+    // close to each other (e.g., by SRP Advertising Proxy on a burst
+    // of SRP updates) to share the same response messages. Per RFC
+    // 6762 section 8.3, the interval between announcements must at
+    // least double, so delaying an announcement is always allowed.
+
+    VerifyOrExit(mAnnounceCounter > 0);
+
+    VerifyOrExit(aContext.mNextAggrTxTime != aContext.GetNow().GetDistantFuture());
+    VerifyOrExit(aContext.mNextAggrTxTime - mAnnounceTime < kResponseAggregationMaxDelay);
+
+    mAnnounceDelay = aContext.mNextAggrTxTime - mAnnounceTime;
+
+    error = kErrorNone;
+
+exit:
+    return error;
+}
+
 void Core::RecordInfo::UpdateStateAfterAnswer(const TxMessage &aResponse)
 {
     // Updates the state after a unicast or multicast response is
@@ -991,7 +1031,8 @@ void Core::RecordInfo::UpdateStateAfterAnswer(const TxMessage &aResponse)
             {
                 uint32_t delay = (1U << (mAnnounceCounter - 1)) * kAnnounceInterval;
 
-                mAnnounceTime = TimerMilli::GetNow() + delay;
+                mAnnounceTime  = TimerMilli::GetNow() + delay;
+                mAnnounceDelay = 0;
             }
             else if (mTtl == 0)
             {
@@ -1023,7 +1064,7 @@ void Core::RecordInfo::UpdateFireTimeOn(FireTime &aFireTime)
 
     if (mAnnounceCounter < kNumberOfAnnounces)
     {
-        aFireTime.SetFireTime(mAnnounceTime);
+        aFireTime.SetFireTime(GetAnnounceTime());
     }
 
     if (mMulticastAnswerPending)
@@ -1062,7 +1103,7 @@ void Core::RecordInfo::DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) co
 
     if (mAnnounceCounter < kNumberOfAnnounces)
     {
-        aNextAggrTxTime.UpdateIfEarlierAndInFuture(mAnnounceTime);
+        aNextAggrTxTime.UpdateIfEarlierAndInFuture(GetAnnounceTime());
     }
 
     if (mMulticastAnswerPending)
@@ -1082,15 +1123,7 @@ void Core::RecordInfo::MarkAsAppended(TxMessage &aTxMessage, Section aSection)
     {
     case TxMessage::kMulticastResponse:
     case TxMessage::kMulticastProbe:
-
         mAppendState = kAppendedInMulticastMsg;
-
-        if ((aSection == kAnswerSection) || (aSection == kAdditionalDataSection))
-        {
-            mLastMulticastTime    = TimerMilli::GetNow();
-            mIsLastMulticastValid = true;
-        }
-
         break;
 
     case TxMessage::kUnicastResponse:
@@ -1103,6 +1136,23 @@ void Core::RecordInfo::MarkAsAppended(TxMessage &aTxMessage, Section aSection)
     }
 }
 
+void Core::RecordInfo::UpdateLastMulticastTime(TimeMilli aTxTime)
+{
+    // Called when a multicast response message is sent. The
+    // `mLastMulticastTime` is only updated if the record is
+    // included in the Answer or Additional Data section of the
+    // sent message.
+
+    VerifyOrExit(mAppendState == kAppendedInMulticastMsg);
+    VerifyOrExit((mAppendSection == kAnswerSection) || (mAppendSection == kAdditionalDataSection));
+
+    mLastMulticastTime    = aTxTime;
+    mIsLastMulticastValid = true;
+
+exit:
+    return;
+}
+
 void Core::RecordInfo::MarkToAppendInAdditionalData(void)
 {
     if (mAppendState == kNotAppended)
@@ -1385,6 +1435,8 @@ void Core::Entry::ClearAppendState(void)
     mAppendedNsec = false;
 }
 
+void Core::Entry::UpdateLastMulticastTimes(TimeMilli aTxTime) { mKeyRecord.UpdateLastMulticastTime(aTxTime); }
+
 void Core::Entry::UpdateRecordsState(const TxMessage &aResponse)
 {
     mKeyRecord.UpdateStateAfterAnswer(aResponse);
@@ -1465,6 +1517,13 @@ void Core::Entry::AnswerNonProbe(const AnswerInfo &aInfo, RecordAndTypeArray &aR
         if (QuestionMatches(aInfo.mQuestionRrType, recordAndType.mType))
         {
             answerNsec = false;
+
+            if (aInfo.IsKnownAnswer(recordAndType.mType))
+            {
+                Get<Core>().mCounters.mKnownAnswerSuppressed++;
+                continue;
+            }
+
             record.ScheduleAnswer(aInfo);
         }
     }
@@ -2158,6 +2217,65 @@ exit:
     return;
 }
 
+void Core::HostEntry::DetermineKnownAnswers(const RxMessage &aQuery, const Name &aName, AnswerInfo &aInfo) const
+{
+    // An address record type is treated as known-answer only when
+    // all host addresses of that type are included in the known-answer
+    // section of `aQuery` (or its related multi-packet messages).
+
+    if (AreAllAddressesKnown(aQuery, aName, mIp6AddrRecord, /* aIp6 */ true))
+    {
+        aInfo.AddKnownAnswer(ResourceRecord::kTypeAaaa);
+    }
+
+    if ((mIp4AddrRecord != nullptr) && AreAllAddressesKnown(aQuery, aName, *mIp4AddrRecord, /* aIp6 */ false))
+    {
+        aInfo.AddKnownAnswer(ResourceRecord::kTypeA);
+    }
+}
+
+bool Core::HostEntry::AreAllAddressesKnown(const RxMessage  &aQuery,
+                                           const Name       &aName,
+                                           const AddrRecord &aAddrRecord,
+                                           bool              aIp6) const
+{
+    bool allKnown = false;
+
+    VerifyOrExit(aAddrRecord.CanAnswer() && !aAddrRecord.mAddresses.IsEmpty());
+
+    for (const Ip6::Address &address : aAddrRecord.mAddresses)
+    {
+        Ip4::Address ip4Address;
+        const void  *data   = &address;
+        uint16_t     length = sizeof(Ip6::Address);
+        bool         known  = false;
+
+        if (!aIp6)
+        {
+            SuccessOrExit(ip4Address.ExtractFromIp4MappedIp6Address(address));
+            data   = &ip4Address;
+            length = sizeof(Ip4::Address);
+        }
+
+        for (const RxMessage *rxMessage = &aQuery; rxMessage != nullptr; rxMessage = rxMessage->GetNext())
+        {
+            if (rxMessage->ContainsKnownAnswer(aName, aIp6 ? ResourceRecord::kTypeAaaa : ResourceRecord::kTypeA, data,
+                                               length, aAddrRecord.GetTtl()))
+            {
+                known = true;
+                break;
+            }
+        }
+
+        VerifyOrExit(known);
+    }
+
+    allKnown = true;
+
+exit:
+    return allKnown;
+}
+
 void Core::HostEntry::HandleTimer(EntryContext &aContext) { Entry::HandleTimer<HostEntry>(aContext); }
 
 void Core::HostEntry::ClearAppendState(void)
@@ -2177,6 +2295,18 @@ void Core::HostEntry::ClearAppendState(void)
     mNameOffset = kUnspecifiedOffset;
 }
 
+void Core::HostEntry::UpdateLastMulticastTimes(TimeMilli aTxTime)
+{
+    Entry::UpdateLastMulticastTimes(aTxTime);
+
+    mIp6AddrRecord.UpdateLastMulticastTime(aTxTime);
+
+    if (mIp4AddrRecord != nullptr)
+    {
+        mIp4AddrRecord->UpdateLastMulticastTime(aTxTime);
+    }
+}
+
 void Core::HostEntry::PrepareProbe(TxMessage &aProbe)
 {
     bool prepareAgain = false;
@@ -2801,6 +2931,40 @@ exit:
     return shouldSuppress;
 }
 
+void Core::ServiceEntry::DetermineKnownAnswers(const RxMessage &aQuery, const Name &aName, AnswerInfo &aInfo) const
+{
+    // Check for SRV and TXT known-answers in `aQuery` and all its
+    // related messages in case it is multi-packet query.
+
+    SrvRecord srv;
+
+    srv.Init();
+    srv.SetPriority(mPriority);
+    srv.SetWeight(mWeight);
+    srv.SetPort(mPort);
+    srv.SetTtl(mSrvRecord.GetTtl());
+
+    for (const RxMessage *rxMessage = &aQuery; rxMessage != nullptr; rxMessage = rxMessage->GetNext())
+    {
+        if (mSrvRecord.CanAnswer() && rxMessage->ContainsKnownSrvAnswer(aName, srv, mHostName.AsCString()))
+        {
+            aInfo.AddKnownAnswer(ResourceRecord::kTypeSrv);
+            break;
+        }
+    }
+
+    for (const RxMessage *rxMessage = &aQuery; rxMessage != nullptr; rxMessage = rxMessage->GetNext())
+    {
+        if (mTxtRecord.CanAnswer() && rxMessage->ContainsKnownAnswer(aName, ResourceRecord::kTypeTxt,
+                                                                     mTxtData.GetBytes(), mTxtData.GetLength(),
+                                                                     mTxtRecord.GetTtl()))
+        {
+            aInfo.AddKnownAnswer(ResourceRecord::kTypeTxt);
+            break;
+        }
+    }
+}
+
 void Core::ServiceEntry::HandleTimer(EntryContext &aContext) { Entry::HandleTimer<ServiceEntry>(aContext); }
 
 void Core::ServiceEntry::ClearAppendState(void)
@@ -2826,6 +2990,20 @@ void Core::ServiceEntry::ClearAppendState(void)
     }
 }
 
+void Core::ServiceEntry::UpdateLastMulticastTimes(TimeMilli aTxTime)
+{
+    Entry::UpdateLastMulticastTimes(aTxTime);
+
+    mPtrRecord.UpdateLastMulticastTime(aTxTime);
+    mSrvRecord.UpdateLastMulticastTime(aTxTime);
+    mTxtRecord.UpdateLastMulticastTime(aTxTime);
+
+    for (SubType &subType : mSubTypes)
+    {
+        subType.mPtrRecord.UpdateLastMulticastTime(aTxTime);
+    }
+}
+
 void Core::ServiceEntry::PrepareProbe(TxMessage &aProbe)
 {
     bool prepareAgain = false;
@@ -3497,6 +3675,8 @@ bool Core::ServiceType::Matches(const Heap::String &aServiceType) const
 
 void Core::ServiceType::ClearAppendState(void) { mServicesPtr.MarkAsNotAppended(); }
 
+void Core::ServiceType::UpdateLastMulticastTimes(TimeMilli aTxTime) { mServicesPtr.UpdateLastMulticastTime(aTxTime); }
+
 void Core::ServiceType::AnswerQuestion(const AnswerInfo &aInfo)
 {
     VerifyOrExit(mServicesPtr.CanAnswer());
@@ -3649,6 +3829,7 @@ void Core::TxMessage::Init(Type aType, uint16_t aMessageId)
     mTcpOffset           = kUnspecifiedOffset;
     mServicesDnssdOffset = kUnspecifiedOffset;
     mType                = aType;
+    mIsTruncated         = false;
 
     // Allocate messages. The main `mMsgPtr` is always allocated.
     // The Authority and Addition section messages are allocated
@@ -3971,6 +4152,12 @@ void Core::TxMessage::Send(void)
 
     SuccessOrAssert(mMsgPtr->Read(kHeaderOffset, header));
     mRecordCounts.WriteTo(header);
+
+    if (mIsTruncated)
+    {
+        header.SetTruncationFlag();
+    }
+
     mMsgPtr->Write(kHeaderOffset, header);
 
     if (!mExtraMsgPtr.IsNull())
@@ -3980,6 +4167,14 @@ void Core::TxMessage::Send(void)
 
     Get<Core>().mTxMessageHistory.Add(*mMsgPtr);
 
+    if (mType == kMulticastResponse)
+    {
+        UpdateLastMulticastTimes();
+    }
+
+    Get<Core>().mCounters.mTxMessages++;
+    Get<Core>().mCounters.mTxBytes += mMsgPtr->GetLength();
+
     LogVerbose("Sending %s message len:%u", TypeToString(mType), mMsgPtr->GetLength());
 
     if (!mUnicastDest.GetAddress().IsUnspecified())
@@ -4009,6 +4204,35 @@ exit:
     return;
 }
 
+void Core::TxMessage::UpdateLastMulticastTimes(void)
+{
+    // Updates the last multicast time of all records included in
+    // the multicast response being sent.
+
+    TimeMilli now = TimerMilli::GetNow();
+
+    for (HostEntry &entry : Get<Core>().mHostEntries)
+    {
+        entry.UpdateLastMulticastTimes(now);
+    }
+
+    for (ServiceEntry &entry : Get<Core>().mServiceEntries)
+    {
+        entry.UpdateLastMulticastTimes(now);
+    }
+
+    for (ServiceType &serviceType : Get<Core>().mServiceTypes)
+    {
+        serviceType.UpdateLastMulticastTimes(now);
+    }
+}
+
+void Core::TxMessage::SendAndReinit(void)
+{
+    Send();
+    Reinit();
+}
+
 void Core::TxMessage::Reinit(void)
 {
     Init(GetType());
@@ -4478,6 +4702,11 @@ void Core::RxMessage::AnswerQuestion(const Question &aQuestion, uint16_t aDelay)
 
     if (hostEntry != nullptr)
     {
+        if (!answerInfo.mIsProbe)
+        {
+            hostEntry->DetermineKnownAnswers(*this, Name(*mMessagePtr, aQuestion.mNameOffset), answerInfo);
+        }
+
         hostEntry->AnswerQuestion(answerInfo);
         ExitNow();
     }
@@ -4488,6 +4717,11 @@ void Core::RxMessage::AnswerQuestion(const Question &aQuestion, uint16_t aDelay)
 
     if (!aQuestion.mIsServiceType)
     {
+        if (!answerInfo.mIsProbe)
+        {
+            serviceEntry->DetermineKnownAnswers(*this, Name(*mMessagePtr, aQuestion.mNameOffset), answerInfo);
+        }
+
         serviceEntry->AnswerServiceNameQuestion(answerInfo);
     }
     else
@@ -4544,7 +4778,11 @@ void Core::RxMessage::AnswerServiceTypeQuestion(const Question   &aQuestion,
             }
         }
 
-        if (!shouldSuppress)
+        if (shouldSuppress)
+        {
+            Get<Core>().mCounters.mKnownAnswerSuppressed++;
+        }
+        else
         {
             serviceEntry->AnswerServiceTypeQuestion(aInfo, subLabel);
         }
@@ -4594,6 +4832,86 @@ exit:
     return shouldSuppress;
 }
 
+bool Core::RxMessage::ContainsKnownAnswer(const Name &aName,
+                                          uint16_t    aRrType,
+                                          const void *aData,
+                                          uint16_t    aLength,
+                                          uint32_t    aTtl) const
+{
+    // Checks whether the known-answer section of this `RxMessage`
+    // contains a record matching `aName`, `aRrType` and record data
+    // `aData` with a TTL at least half of `aTtl` (RFC 6762 - 7.1).
+
+    bool     contains   = false;
+    uint16_t offset     = mStartOffset[kAnswerSection];
+    uint16_t numRecords = mRecordCounts.GetFor(kAnswerSection);
+
+    while (ResourceRecord::FindRecord(*mMessagePtr, offset, numRecords, aName) == kErrorNone)
+    {
+        ResourceRecord record;
+
+        SuccessOrExit(mMessagePtr->Read(offset, record));
+
+        if ((record.GetType() == aRrType) && (record.GetLength() == aLength) && (record.GetTtl() > aTtl / 2) &&
+            mMessagePtr->CompareBytes(offset + sizeof(ResourceRecord), aData, aLength))
+        {
+            contains = true;
+            ExitNow();
+        }
+
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    return contains;
+}
+
+bool Core::RxMessage::ContainsKnownSrvAnswer(const Name      &aName,
+                                             const SrvRecord &aSrvRecord,
+                                             const char      *aHostName) const
+{
+    // Checks whether the known-answer section of this `RxMessage`
+    // contains an SRV record matching `aName` with the same
+    // priority, weight, port and target host as `aSrvRecord` and
+    // `aHostName` with a TTL at least half of `aSrvRecord` TTL.
+
+    bool     contains   = false;
+    uint16_t offset     = mStartOffset[kAnswerSection];
+    uint16_t numRecords = mRecordCounts.GetFor(kAnswerSection);
+
+    while (ResourceRecord::FindRecord(*mMessagePtr, offset, numRecords, aName) == kErrorNone)
+    {
+        Error     error;
+        SrvRecord srv;
+
+        error = ResourceRecord::ReadRecord(*mMessagePtr, offset, srv);
+
+        if (error == kErrorNotFound)
+        {
+            // `ReadRecord()` skips over the entire record if it
+            // is not an SRV record.
+            continue;
+        }
+
+        SuccessOrExit(error);
+
+        // `offset` is now pointing to SRV target host name.
+
+        if ((srv.GetPriority() == aSrvRecord.GetPriority()) && (srv.GetWeight() == aSrvRecord.GetWeight()) &&
+            (srv.GetPort() == aSrvRecord.GetPort()) && (srv.GetTtl() > aSrvRecord.GetTtl() / 2) &&
+            Name(*mMessagePtr, offset).Matches(/* aFirstLabel */ nullptr, aHostName, kLocalDomain))
+        {
+            contains = true;
+            ExitNow();
+        }
+
+        SuccessOrExit(Name::ParseName(*mMessagePtr, offset));
+    }
+
+exit:
+    return contains;
+}
+
 bool Core::RxMessage::ParseQuestionNameAsSubType(const Question    &aQuestion,
                                                  Name::LabelBuffer &aSubLabel,
                                                  Name              &aServiceType) const
@@ -4629,7 +4947,11 @@ void Core::RxMessage::AnswerAllServicesQuestion(const Question &aQuestion, const
             }
         }
 
-        if (!shouldSuppress)
+        if (shouldSuppress)
+        {
+            Get<Core>().mCounters.mKnownAnswerSuppressed++;
+        }
+        else
         {
             serviceType.AnswerQuestion(aInfo);
         }
@@ -4681,6 +5003,66 @@ exit:
     return shouldSuppress;
 }
 
+void Core::RxMessage::SuppressDuplicateQueries(void)
+{
+    // Duplicate question suppression (RFC 6762 section 7.3): If we
+    // see a query from another host containing the same "QM"
+    // question as a query we plan to send, and its known-answer
+    // section does not contain any records that we would not also
+    // include, we treat our own query as sent. We only apply this
+    // to queries with an empty known-answer section, which always
+    // satisfies the known-answer condition.
+
+    VerifyOrExit(!mIsSelfOriginating && !mIsLegacyUnicast && !mTruncated);
+    VerifyOrExit(mRecordCounts.GetFor(kAnswerSection) == 0);
+
+    for (const Question &question : mQuestions)
+    {
+        Name name(*mMessagePtr, question.mNameOffset);
+
+        if (question.mUnicastResponse || question.mIsProbe || !question.mIsRrClassInternet)
+        {
+            continue;
+        }
+
+        switch (question.mRrType)
+        {
+        case ResourceRecord::kTypePtr:
+            HandleDuplicateQuestion(Get<Core>().mBrowseCacheList, name);
+            break;
+        case ResourceRecord::kTypeSrv:
+            HandleDuplicateQuestion(Get<Core>().mSrvCacheList, name);
+            break;
+        case ResourceRecord::kTypeTxt:
+            HandleDuplicateQuestion(Get<Core>().mTxtCacheList, name);
+            break;
+        case ResourceRecord::kTypeAaaa:
+            HandleDuplicateQuestion(Get<Core>().mIp6AddrCacheList, name);
+            break;
+        case ResourceRecord::kTypeA:
+            HandleDuplicateQuestion(Get<Core>().mIp4AddrCacheList, name);
+            break;
+        default:
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+template <typename CacheType>
+void Core::RxMessage::HandleDuplicateQuestion(OwningList<CacheType> &aCacheList, const Name &aName)
+{
+    for (CacheType &cacheEntry : aCacheList)
+    {
+        if (cacheEntry.Matches(aName))
+        {
+            cacheEntry.HandleDuplicateQuestion(mRxTime);
+        }
+    }
+}
+
 void Core::RxMessage::SendUnicastResponse(void)
 {
     TxMessage::Type responseType = mIsLegacyUnicast ? TxMessage::kLegacyUnicastResponse : TxMessage::kUnicastResponse;
@@ -5313,41 +5695,288 @@ void Core::AddPassiveIp6AddrCache(const char *aHostName)
     }
 }
 
-void Core::HandleCacheTimer(void)
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+Error Core::SaveCacheSnapshot(uint8_t *aBuffer, uint16_t &aLength)
 {
-    CacheContext      context(GetInstance());
-    ExpirationChecker expirationChecker(context.GetNow());
+    // The snapshot is formatted as a DNS response message containing
+    // the cached records in its Answer section, each with its
+    // remaining TTL. Names are not compressed.
 
-    // First remove all expired entries.
+    Error             error = kErrorNone;
+    OwnedPtr<Message> messagePtr;
+    Header            header;
 
-    mBrowseCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mSrvCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mTxtCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mIp6AddrCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mIp4AddrCacheList.RemoveAndFreeAllMatching(expirationChecker);
-    mRecordCacheList.RemoveAndFreeAllMatching(expirationChecker);
+    VerifyOrExit(mIsEnabled, error = kErrorInvalidState);
 
-    // Process cache types in a specific order to optimize name
-    // compression when constructing query messages.
+    messagePtr.Reset(Get<MessagePool>().Allocate(Message::kTypeOther));
+    VerifyOrExit(!messagePtr.IsNull(), error = kErrorNoBufs);
 
-    for (SrvCache &srvCache : mSrvCacheList)
-    {
-        srvCache.HandleTimer(context);
-    }
+    header.Clear();
+    header.SetType(Header::kTypeResponse);
+    SuccessOrExit(error = messagePtr->Append(header));
 
-    for (TxtCache &txtCache : mTxtCacheList)
-    {
-        txtCache.HandleTimer(context);
-    }
+    VerifyOrExit(messagePtr->GetLength() <= aLength, error = kErrorNoBufs);
 
-    for (BrowseCache &browseCache : mBrowseCacheList)
     {
-        browseCache.HandleTimer(context);
-    }
+        CacheSnapshot snapshot(*messagePtr, aLength);
 
-    for (Ip6AddrCache &addrCache : mIp6AddrCacheList)
-    {
-        addrCache.HandleTimer(context);
+        for (const BrowseCache &browseCache : mBrowseCacheList)
+        {
+            browseCache.SaveRecordsTo(snapshot);
+        }
+
+        for (const SrvCache &srvCache : mSrvCacheList)
+        {
+            srvCache.SaveRecordTo(snapshot);
+        }
+
+        for (const TxtCache &txtCache : mTxtCacheList)
+        {
+            txtCache.SaveRecordTo(snapshot);
+        }
+
+        for (const Ip6AddrCache &ip6AddrCache : mIp6AddrCacheList)
+        {
+            ip6AddrCache.SaveRecordsTo(snapshot);
+        }
+
+        VerifyOrExit(snapshot.GetNumRecords() > 0, error = kErrorNotFound);
+
+        header.SetAnswerCount(snapshot.GetNumRecords());
+        messagePtr->Write(0, header);
+
+        LogInfo("Saved %u records in cache snapshot%s", snapshot.GetNumRecords(),
+                snapshot.IsFull() ? " (truncated)" : "");
+    }
+
+    aLength = messagePtr->GetLength();
+    messagePtr->ReadBytes(0, aBuffer, aLength);
+
+exit:
+    return error;
+}
+
+Error Core::RestoreCacheSnapshot(const uint8_t *aBuffer, uint16_t aLength, uint32_t aElapsedTime)
+{
+    Error             error       = kErrorNone;
+    uint16_t          numRestored = 0;
+    TimeMilli         now         = TimerMilli::GetNow();
+    OwnedPtr<Message> messagePtr;
+    Header            header;
+    uint16_t          offset;
+
+    VerifyOrExit(mIsEnabled, error = kErrorInvalidState);
+
+    messagePtr.Reset(Get<MessagePool>().Allocate(Message::kTypeOther));
+    VerifyOrExit(!messagePtr.IsNull(), error = kErrorNoBufs);
+    SuccessOrExit(error = messagePtr->AppendBytes(aBuffer, aLength));
+
+    offset = 0;
+    SuccessOrExit(error = messagePtr->Read(offset, header));
+    offset += sizeof(Header);
+
+    VerifyOrExit(header.GetType() == Header::kTypeResponse, error = kErrorParse);
+    VerifyOrExit(header.GetQuestionCount() == 0, error = kErrorParse);
+
+    for (uint16_t numRecords = header.GetAnswerCount(); numRecords > 0; numRecords--)
+    {
+        uint16_t       nameOffset = offset;
+        ResourceRecord record;
+
+        SuccessOrExit(error = Name::ParseName(*messagePtr, offset));
+        SuccessOrExit(error = messagePtr->Read(offset, record));
+        VerifyOrExit(offset + record.GetSize() <= messagePtr->GetLength(), error = kErrorParse);
+
+        // Records are restored with their TTL reduced by the elapsed
+        // time since the snapshot was saved, so that they expire at
+        // the same time as they would have originally.
+
+        if (record.GetTtl() > aElapsedTime)
+        {
+            record.SetTtl(record.GetTtl() - aElapsedTime);
+            messagePtr->Write(offset, record);
+
+            if (RestoreCacheRecord(*messagePtr, nameOffset, offset) == kErrorNone)
+            {
+                numRestored++;
+            }
+        }
+
+        offset += static_cast<uint16_t>(record.GetSize());
+    }
+
+exit:
+    // Since restoring is done synchronously, all records refreshed
+    // from the snapshot have `now` as their last rx time. They are
+    // marked as unverified so that they are revalidated.
+
+    for (Ip6AddrCache &ip6AddrCache : mIp6AddrCacheList)
+    {
+        ip6AddrCache.CommitNewResponseEntries();
+        ip6AddrCache.MarkRestoredRecords(now);
+    }
+
+    for (BrowseCache &browseCache : mBrowseCacheList)
+    {
+        browseCache.MarkRestoredRecords(now);
+    }
+
+    for (SrvCache &srvCache : mSrvCacheList)
+    {
+        srvCache.MarkRestoredRecords(now);
+    }
+
+    for (TxtCache &txtCache : mTxtCacheList)
+    {
+        txtCache.MarkRestoredRecords(now);
+    }
+
+    if (numRestored > 0)
+    {
+        LogInfo("Restored %u records from cache snapshot", numRestored);
+    }
+
+    return error;
+}
+
+Error Core::RestoreCacheRecord(const Message &aMessage, uint16_t aNameOffset, uint16_t aRecordOffset)
+{
+    Error             error = kErrorNone;
+    Name              name(aMessage, aNameOffset);
+    uint16_t          offset;
+    ResourceRecord    record;
+    Name::Buffer      fullName;
+    Name::Buffer      labels;
+    Name::LabelBuffer firstLabel;
+    uint8_t           labelLength;
+
+    offset = aNameOffset;
+    SuccessOrExit(error = Name::ReadName(aMessage, offset, fullName));
+    SuccessOrExit(error = aMessage.Read(aRecordOffset, record));
+
+    switch (record.GetType())
+    {
+    case ResourceRecord::kTypePtr:
+        AddPassiveBrowseCache(fullName);
+        VerifyOrExit(mBrowseCacheList.ContainsMatching(name), error = kErrorParse);
+        mBrowseCacheList.FindMatching(name)->ProcessResponseRecord(aMessage, aRecordOffset);
+        break;
+
+    case ResourceRecord::kTypeSrv:
+    case ResourceRecord::kTypeTxt:
+        offset      = aNameOffset;
+        labelLength = sizeof(firstLabel);
+        SuccessOrExit(error = Name::ReadLabel(aMessage, offset, firstLabel, labelLength));
+        SuccessOrExit(error = Name::ReadName(aMessage, offset, fullName));
+        SuccessOrExit(error = Name::ExtractLabels(fullName, kLocalDomain, labels));
+
+        AddPassiveSrvTxtCache(firstLabel, labels);
+
+        if (record.GetType() == ResourceRecord::kTypeSrv)
+        {
+            VerifyOrExit(mSrvCacheList.ContainsMatching(name), error = kErrorParse);
+            mSrvCacheList.FindMatching(name)->ProcessResponseRecord(aMessage, aRecordOffset);
+        }
+        else
+        {
+            VerifyOrExit(mTxtCacheList.ContainsMatching(name), error = kErrorParse);
+            mTxtCacheList.FindMatching(name)->ProcessResponseRecord(aMessage, aRecordOffset);
+        }
+
+        break;
+
+    case ResourceRecord::kTypeAaaa:
+        SuccessOrExit(error = Name::ExtractLabels(fullName, kLocalDomain, labels));
+
+        AddPassiveIp6AddrCache(labels);
+        VerifyOrExit(mIp6AddrCacheList.ContainsMatching(name), error = kErrorParse);
+        mIp6AddrCacheList.FindMatching(name)->ProcessResponseRecord(aMessage, aRecordOffset);
+        break;
+
+    default:
+        error = kErrorNotFound;
+        break;
+    }
+
+exit:
+    return error;
+}
+
+void Core::AddPassiveBrowseCache(const char *aFullServiceType)
+{
+    // Adds a passive `BrowseCache` for `aFullServiceType` which can
+    // be a service type (e.g., "_srv._udp.local.") or a sub-type
+    // (e.g., "_label._sub._srv._udp.local.").
+
+    static const char kSubLabels[] = "._sub.";
+
+    Name::Buffer serviceType;
+    char        *subLabels;
+    const char  *subTypeLabel = nullptr;
+    const char  *type;
+
+    SuccessOrExit(Name::ExtractLabels(aFullServiceType, kLocalDomain, serviceType));
+
+    type      = serviceType;
+    subLabels = AsNonConst(StringFind(serviceType, kSubLabels, kStringCaseInsensitiveMatch));
+
+    if (subLabels != nullptr)
+    {
+        *subLabels   = kNullChar;
+        subTypeLabel = serviceType;
+        type         = subLabels + sizeof(kSubLabels) - 1;
+    }
+
+    if (!mBrowseCacheList.ContainsMatching(type, subTypeLabel))
+    {
+        BrowseCache *browseCache = BrowseCache::AllocateAndInit(GetInstance(), type, subTypeLabel);
+
+        OT_ASSERT(browseCache != nullptr);
+        mBrowseCacheList.Push(*browseCache);
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+void Core::HandleCacheTimer(void)
+{
+    CacheContext      context(GetInstance());
+    ExpirationChecker expirationChecker(context.GetNow());
+
+    // First remove all expired entries.
+
+    mBrowseCacheList.RemoveAndFreeAllMatching(expirationChecker);
+    mSrvCacheList.RemoveAndFreeAllMatching(expirationChecker);
+    mTxtCacheList.RemoveAndFreeAllMatching(expirationChecker);
+    mIp6AddrCacheList.RemoveAndFreeAllMatching(expirationChecker);
+    mIp4AddrCacheList.RemoveAndFreeAllMatching(expirationChecker);
+    mRecordCacheList.RemoveAndFreeAllMatching(expirationChecker);
+
+    // Process cache types in a specific order to optimize name
+    // compression when constructing query messages.
+
+    for (SrvCache &srvCache : mSrvCacheList)
+    {
+        srvCache.HandleTimer(context);
+    }
+
+    for (TxtCache &txtCache : mTxtCacheList)
+    {
+        txtCache.HandleTimer(context);
+    }
+
+    for (BrowseCache &browseCache : mBrowseCacheList)
+    {
+        browseCache.HandleTimer(context);
+    }
+
+    for (Ip6AddrCache &addrCache : mIp6AddrCacheList)
+    {
+        addrCache.HandleTimer(context);
     }
 
     for (Ip4AddrCache &addrCache : mIp4AddrCacheList)
@@ -5485,12 +6114,62 @@ Core::CacheContext::CacheContext(Instance &aInstance)
 {
 }
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// Core::CacheSnapshot
+
+Core::CacheSnapshot::CacheSnapshot(Message &aMessage, uint16_t aMaxLength)
+    : mMessage(aMessage)
+    , mNow(TimerMilli::GetNow())
+    , mMaxLength(aMaxLength)
+    , mRecordStart(0)
+    , mNumRecords(0)
+    , mIsFull(false)
+{
+}
+
+void Core::CacheSnapshot::FinishRecord(Error aError)
+{
+    if ((aError != kErrorNone) || (mMessage.GetLength() > mMaxLength))
+    {
+        IgnoreError(mMessage.SetLength(mRecordStart));
+        mIsFull = true;
+    }
+    else
+    {
+        mNumRecords++;
+    }
+}
+
+Error Core::CacheSnapshot::AppendName(const char *aFirstLabel, const char *aLabels)
+{
+    // Appends the full name `[<aFirstLabel>.]<aLabels>.local.`
+    // without any name compression.
+
+    Error error = kErrorNone;
+
+    if (aFirstLabel != nullptr)
+    {
+        SuccessOrExit(error = Name::AppendLabel(aFirstLabel, mMessage));
+    }
+
+    SuccessOrExit(error = Name::AppendMultipleLabels(aLabels, mMessage));
+    error = Name::AppendName(kLocalDomain, mMessage);
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // Core::CacheRecordInfo
 
 Core::CacheRecordInfo::CacheRecordInfo(void)
     : mTtl(0)
     , mQueryCount(0)
+    , mIsUnverified(false)
 {
 }
 
@@ -5502,9 +6181,10 @@ bool Core::CacheRecordInfo::RefreshTtl(uint32_t aTtl)
 
     bool changed = (aTtl != mTtl);
 
-    mLastRxTime = TimerMilli::GetNow();
-    mTtl        = aTtl;
-    mQueryCount = 0;
+    mLastRxTime   = TimerMilli::GetNow();
+    mTtl          = aTtl;
+    mQueryCount   = 0;
+    mIsUnverified = false;
 
     return changed;
 }
@@ -5562,7 +6242,12 @@ exit:
 
 bool Core::CacheRecordInfo::LessThanHalfTtlRemains(TimeMilli aNow) const
 {
-    return IsPresent() && ((aNow - mLastRxTime) > TimeMilli::SecToMsec(GetClampedTtl()) / 2);
+    // An unverified record (restored from a cache snapshot) is
+    // treated as if less than half of its TTL remains. This ensures
+    // it is not included as a known-answer in queries and that
+    // initial queries are sent to revalidate it.
+
+    return IsPresent() && (mIsUnverified || ((aNow - mLastRxTime) > TimeMilli::SecToMsec(GetClampedTtl()) / 2));
 }
 
 uint32_t Core::CacheRecordInfo::GetRemainingTtl(TimeMilli aNow) const
@@ -5589,6 +6274,14 @@ uint32_t Core::CacheRecordInfo::GetClampedTtl(void) const
     return Min(mTtl, kMaxTtl);
 }
 
+void Core::CacheRecordInfo::MarkUnverifiedIfRefreshedAt(TimeMilli aTime)
+{
+    if (IsPresent() && (mLastRxTime == aTime))
+    {
+        mIsUnverified = true;
+    }
+}
+
 TimeMilli Core::CacheRecordInfo::GetExpireTime(void) const
 {
     return mLastRxTime + TimeMilli::SecToMsec(GetClampedTtl());
@@ -5994,8 +6687,36 @@ void Core::CacheEntry::PrepareQuery(CacheContext &aContext)
 
     } while (prepareAgain);
 
+    UpdateStateAfterQuery(aContext.GetNow());
+}
+
+void Core::CacheEntry::HandleDuplicateQuestion(TimeMilli aRxTime)
+{
+    // Called when a query from another host is received containing
+    // the same "QM" question as this cache entry would send. Per RFC
+    // 6762 section 7.3, if we have a pending query, we treat it as
+    // if it was sent. The responses to the other host's query will
+    // be multicast and also update our cache.
+
+    VerifyOrExit(mIsActive && mQueryPending);
+
+    mQueryPending = false;
+    UpdateStateAfterQuery(aRxTime);
+
+    Get<Core>().mCounters.mDuplicateQuerySuppressed++;
+
+    ClearFireTime();
+    DetermineNextFireTime();
+    ScheduleTimer();
+
+exit:
+    return;
+}
+
+void Core::CacheEntry::UpdateStateAfterQuery(TimeMilli aNow)
+{
     mLastQueryTimeValid = true;
-    mLastQueryTime      = aContext.GetNow();
+    mLastQueryTime      = aNow;
 
     UpdateQueryRetryInterval();
 
@@ -6005,18 +6726,18 @@ void Core::CacheEntry::PrepareQuery(CacheContext &aContext)
     switch (mType)
     {
     case kBrowseCache:
-        As<BrowseCache>().UpdateRecordStateAfterQuery(aContext.GetNow());
+        As<BrowseCache>().UpdateRecordStateAfterQuery(aNow);
         break;
     case kSrvCache:
     case kTxtCache:
-        As<ServiceCache>().UpdateRecordStateAfterQuery(aContext.GetNow());
+        As<ServiceCache>().UpdateRecordStateAfterQuery(aNow);
         break;
     case kIp6AddrCache:
     case kIp4AddrCache:
-        As<AddrCache>().UpdateRecordStateAfterQuery(aContext.GetNow());
+        As<AddrCache>().UpdateRecordStateAfterQuery(aNow);
         break;
     case kRecordCache:
-        As<RecordCache>().UpdateRecordStateAfterQuery(aContext.GetNow());
+        As<RecordCache>().UpdateRecordStateAfterQuery(aNow);
     }
 }
 
@@ -6174,6 +6895,8 @@ exit:
 void Core::BrowseCache::PreparePtrQuestion(TxMessage &aQuery, TimeMilli aNow)
 {
     Question question;
+    bool     canSplit;
+    bool     didSplit = false;
 
     DiscoverCompressOffsets();
 
@@ -6185,6 +6908,16 @@ void Core::BrowseCache::PreparePtrQuestion(TxMessage &aQuery, TimeMilli aNow)
 
     aQuery.IncrementRecordCount(kQuestionSection);
 
+    // If the question itself does not fit, we leave it to the caller
+    // (`CheckSizeLimitToPrepareAgain()`) to move it to a new message.
+    // Otherwise, we use a multi-packet known-answer query (RFC 6762
+    // section 7.2) when the known-answer records do not fit in the
+    // message: The message is sent with the TC flag set and the
+    // remaining known-answer records are sent in follow-up messages
+    // with no questions.
+
+    canSplit = !aQuery.IsOverSizeLimit();
+
     for (const PtrEntry &ptrEntry : mPtrEntries)
     {
         if (!ptrEntry.mRecord.IsPresent() || ptrEntry.mRecord.LessThanHalfTtlRemains(aNow))
@@ -6192,7 +6925,31 @@ void Core::BrowseCache::PreparePtrQuestion(TxMessage &aQuery, TimeMilli aNow)
             continue;
         }
 
+        if (canSplit)
+        {
+            aQuery.SaveCurrentState();
+        }
+
         AppendKnownAnswer(aQuery, ptrEntry, aNow);
+
+        if (canSplit && aQuery.IsOverSizeLimit())
+        {
+            aQuery.RestoreToSavedState();
+            aQuery.SetTruncated();
+            aQuery.SendAndReinit();
+
+            AppendKnownAnswer(aQuery, ptrEntry, aNow);
+            didSplit = true;
+        }
+    }
+
+    if (didSplit)
+    {
+        // Send the last known-answer message right away so that
+        // no other question is added to it.
+
+        aQuery.SendAndReinit();
+        Get<Core>().mCounters.mMultiPacketQueries++;
     }
 }
 
@@ -6339,6 +7096,68 @@ void Core::BrowseCache::CopyInfoTo(Browser &aBrowser, CacheInfo &aInfo) const
 
 #endif
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+void Core::BrowseCache::SaveRecordsTo(CacheSnapshot &aSnapshot) const
+{
+    for (const PtrEntry &ptrEntry : mPtrEntries)
+    {
+        uint32_t ttl = ptrEntry.mRecord.GetRemainingTtl(aSnapshot.GetNow());
+
+        if (aSnapshot.IsFull())
+        {
+            break;
+        }
+
+        if (ttl == 0)
+        {
+            continue;
+        }
+
+        aSnapshot.StartRecord();
+        aSnapshot.FinishRecord(AppendSnapshotRecord(aSnapshot, ptrEntry, ttl));
+    }
+}
+
+Error Core::BrowseCache::AppendSnapshotRecord(CacheSnapshot &aSnapshot, const PtrEntry &aPtrEntry, uint32_t aTtl) const
+{
+    Error     error   = kErrorNone;
+    Message  &message = aSnapshot.GetMessage();
+    PtrRecord ptr;
+    uint16_t  offset;
+
+    if (!mSubTypeLabel.IsNull())
+    {
+        SuccessOrExit(error = Name::AppendLabel(mSubTypeLabel.AsCString(), message));
+        SuccessOrExit(error = aSnapshot.AppendName(kSubServiceLabel, mServiceType.AsCString()));
+    }
+    else
+    {
+        SuccessOrExit(error = aSnapshot.AppendName(nullptr, mServiceType.AsCString()));
+    }
+
+    ptr.Init();
+    ptr.SetTtl(aTtl);
+
+    offset = message.GetLength();
+    SuccessOrExit(error = message.Append(ptr));
+    SuccessOrExit(error = aSnapshot.AppendName(aPtrEntry.mServiceInstance.AsCString(), mServiceType.AsCString()));
+    ResourceRecord::UpdateRecordLengthInMessage(message, offset);
+
+exit:
+    return error;
+}
+
+void Core::BrowseCache::MarkRestoredRecords(TimeMilli aRestoreTime)
+{
+    for (PtrEntry &ptrEntry : mPtrEntries)
+    {
+        ptrEntry.mRecord.MarkUnverifiedIfRefreshedAt(aRestoreTime);
+    }
+}
+
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // Core::BrowseCache::PtrEntry
 
@@ -6641,6 +7460,47 @@ void Core::SrvCache::CopyInfoTo(SrvResolver &aResolver, CacheInfo &aInfo) const
 
 #endif
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+void Core::SrvCache::SaveRecordTo(CacheSnapshot &aSnapshot) const
+{
+    uint32_t ttl = mRecord.GetRemainingTtl(aSnapshot.GetNow());
+
+    VerifyOrExit(!aSnapshot.IsFull() && (ttl > 0));
+
+    aSnapshot.StartRecord();
+    aSnapshot.FinishRecord(AppendSnapshotRecord(aSnapshot, ttl));
+
+exit:
+    return;
+}
+
+Error Core::SrvCache::AppendSnapshotRecord(CacheSnapshot &aSnapshot, uint32_t aTtl) const
+{
+    Error     error   = kErrorNone;
+    Message  &message = aSnapshot.GetMessage();
+    SrvRecord srv;
+    uint16_t  offset;
+
+    SuccessOrExit(error = aSnapshot.AppendName(mServiceInstance.AsCString(), mServiceType.AsCString()));
+
+    srv.Init();
+    srv.SetTtl(aTtl);
+    srv.SetPriority(mPriority);
+    srv.SetWeight(mWeight);
+    srv.SetPort(mPort);
+
+    offset = message.GetLength();
+    SuccessOrExit(error = message.Append(srv));
+    SuccessOrExit(error = aSnapshot.AppendName(nullptr, mHostName.AsCString()));
+    ResourceRecord::UpdateRecordLengthInMessage(message, offset);
+
+exit:
+    return error;
+}
+
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // Core::TxtCache
 
@@ -6826,6 +7686,42 @@ void Core::TxtCache::CopyInfoTo(TxtResolver &aResolver, CacheInfo &aInfo) const
 
 #endif
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+void Core::TxtCache::SaveRecordTo(CacheSnapshot &aSnapshot) const
+{
+    uint32_t ttl = mRecord.GetRemainingTtl(aSnapshot.GetNow());
+
+    VerifyOrExit(!aSnapshot.IsFull() && (ttl > 0));
+
+    aSnapshot.StartRecord();
+    aSnapshot.FinishRecord(AppendSnapshotRecord(aSnapshot, ttl));
+
+exit:
+    return;
+}
+
+Error Core::TxtCache::AppendSnapshotRecord(CacheSnapshot &aSnapshot, uint32_t aTtl) const
+{
+    Error     error   = kErrorNone;
+    Message  &message = aSnapshot.GetMessage();
+    TxtRecord txt;
+
+    SuccessOrExit(error = aSnapshot.AppendName(mServiceInstance.AsCString(), mServiceType.AsCString()));
+
+    txt.Init();
+    txt.SetTtl(aTtl);
+    txt.SetLength(mTxtData.GetLength());
+
+    SuccessOrExit(error = message.Append(txt));
+    SuccessOrExit(error = message.AppendBytes(mTxtData.GetBytes(), mTxtData.GetLength()));
+
+exit:
+    return error;
+}
+
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // Core::AddrCache
 
@@ -7165,6 +8061,18 @@ void Core::AddrCache::CopyInfoTo(AddressResolver &aResolver, CacheInfo &aInfo) c
 
 #endif
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+void Core::AddrCache::MarkRestoredRecords(TimeMilli aRestoreTime)
+{
+    for (AddrEntry &entry : mCommittedEntries)
+    {
+        entry.mRecord.MarkUnverifiedIfRefreshedAt(aRestoreTime);
+    }
+}
+
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // Core::AddrCache::AddrEntry
 
@@ -7219,6 +8127,50 @@ void Core::Ip6AddrCache::PrepareAaaaQuestion(TxMessage &aQuery)
     PrepareQueryQuestion(aQuery, ResourceRecord::kTypeAaaa);
 }
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+void Core::Ip6AddrCache::SaveRecordsTo(CacheSnapshot &aSnapshot) const
+{
+    for (const AddrEntry &entry : mCommittedEntries)
+    {
+        uint32_t ttl = entry.mRecord.GetRemainingTtl(aSnapshot.GetNow());
+
+        if (aSnapshot.IsFull())
+        {
+            break;
+        }
+
+        if (ttl == 0)
+        {
+            continue;
+        }
+
+        aSnapshot.StartRecord();
+        aSnapshot.FinishRecord(AppendSnapshotRecord(aSnapshot, entry.mAddress, ttl));
+    }
+}
+
+Error Core::Ip6AddrCache::AppendSnapshotRecord(CacheSnapshot      &aSnapshot,
+                                               const Ip6::Address &aAddress,
+                                               uint32_t            aTtl) const
+{
+    Error      error = kErrorNone;
+    AaaaRecord aaaaRecord;
+
+    SuccessOrExit(error = aSnapshot.AppendName(nullptr, mName.AsCString()));
+
+    aaaaRecord.Init();
+    aaaaRecord.SetTtl(aTtl);
+    aaaaRecord.SetAddress(aAddress);
+
+    error = aSnapshot.GetMessage().Append(aaaaRecord);
+
+exit:
+    return error;
+}
+
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // Core::Ip4AddrCache
 
@@ -143,6 +143,7 @@ public:
     typedef otMdnsRecordQuerier    RecordQuerier;    ///< Record querier.
     typedef otMdnsIterator         Iterator;         ///< An entry iterator.
     typedef otMdnsCacheInfo        CacheInfo;        ///< Cache information.
+    typedef otMdnsCounters         Counters;         ///< mDNS counters.
 
     /**
      * Represents a socket address info.
@@ -274,6 +275,51 @@ public:
      */
     bool IsQuestionUnicastAllowed(void) const { return mIsQuestionUnicastAllowed; }
 
+    /**
+     * Gets the mDNS counters.
+     *
+     * @returns The mDNS counters.
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the mDNS counters.
+     */
+    void ResetCounters(void) { ClearAllBytes(mCounters); }
+
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+    /**
+     * Saves a snapshot of the cached records (PTR, SRV, TXT, and AAAA) along with their remaining TTLs.
+     *
+     * If @p aBuffer is not large enough to contain all records, the snapshot is truncated.
+     *
+     * @param[out]    aBuffer   A pointer to a buffer to output the snapshot.
+     * @param[in,out] aLength   On input, the size of @p aBuffer. On output, the length of the snapshot.
+     *
+     * @retval kErrorNone          Successfully saved the snapshot.
+     * @retval kErrorInvalidState  mDNS module is not enabled.
+     * @retval kErrorNotFound      There is no cached record to save.
+     * @retval kErrorNoBufs        Could not allocate buffer to prepare the snapshot.
+     */
+    Error SaveCacheSnapshot(uint8_t *aBuffer, uint16_t &aLength);
+
+    /**
+     * Restores the cached records from a snapshot saved earlier by `SaveCacheSnapshot()`.
+     *
+     * The restored records are added as unverified records in passive cache entries.
+     *
+     * @param[in] aBuffer       A pointer to a buffer containing the snapshot.
+     * @param[in] aLength       The snapshot length.
+     * @param[in] aElapsedTime  The elapsed time (in seconds) since the snapshot was saved.
+     *
+     * @retval kErrorNone          Successfully restored the snapshot.
+     * @retval kErrorInvalidState  mDNS module is not enabled.
+     * @retval kErrorParse         The snapshot is not well-formed.
+     * @retval kErrorNoBufs        Could not allocate buffer to process the snapshot.
+     */
+    Error RestoreCacheSnapshot(const uint8_t *aBuffer, uint16_t aLength, uint32_t aElapsedTime);
+#endif
+
     /**
      * Sets the conflict callback.
      *
@@ -1020,14 +1066,19 @@ private:
 
     struct AnswerInfo
     {
-        TimeMilli GetAnswerTime(void) const { return (mQueryRxTime + mAnswerDelay); }
+        static constexpr uint8_t kMaxKnownAnswerTypes = 4; // SRV, TXT, AAAA, A.
 
-        uint16_t  mQuestionRrType;
-        uint32_t  mAnswerDelay;
-        TimeMilli mQueryRxTime;
-        bool      mIsProbe;
-        bool      mUnicastResponse;
-        bool      mLegacyUnicastResponse;
+        TimeMilli GetAnswerTime(void) const { return (mQueryRxTime + mAnswerDelay); }
+        bool      IsKnownAnswer(uint16_t aRrType) const { return mKnownAnswerTypes.Contains(aRrType); }
+        void      AddKnownAnswer(uint16_t aRrType) { IgnoreError(mKnownAnswerTypes.PushBack(aRrType)); }
+
+        uint16_t                              mQuestionRrType;
+        uint32_t                              mAnswerDelay;
+        TimeMilli                             mQueryRxTime;
+        bool                                  mIsProbe;
+        bool                                  mUnicastResponse;
+        bool                                  mLegacyUnicastResponse;
+        Array<uint16_t, kMaxKnownAnswerTypes> mKnownAnswerTypes; // Record types included by querier as known-answer.
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1087,6 +1138,7 @@ private:
         bool     CanAnswer(void) const;
         void     ScheduleAnswer(const AnswerInfo &aInfo);
         Error    ExtendAnswerDelay(EntryContext &aContext);
+        Error    ExtendAnnounceDelay(EntryContext &aContext);
         void     UpdateStateAfterAnswer(const TxMessage &aResponse);
         void     UpdateFireTimeOn(FireTime &aFireTime);
         void     DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) const;
@@ -1099,6 +1151,7 @@ private:
 
         void MarkAsNotAppended(void) { mAppendState = kNotAppended; }
         void MarkAsAppended(TxMessage &aTxMessage, Section aSection);
+        void UpdateLastMulticastTime(TimeMilli aTxTime);
         void MarkToAppendInAdditionalData(void);
         bool IsAppended(void) const;
         bool CanAppend(void) const;
@@ -1114,6 +1167,7 @@ private:
         };
 
         TimeMilli GetAnswerTime(void) const { return mQueryRxTime + mAnswerDelay; }
+        TimeMilli GetAnnounceTime(void) const { return mAnnounceTime + mAnnounceDelay; }
 
         static constexpr uint32_t kMinIntervalBetweenMulticast = 1000; // msec
         static constexpr uint32_t kLastMulticastTimeAge        = 10 * Time::kOneHourInMsec;
@@ -1129,6 +1183,7 @@ private:
         AppendState mAppendState;
         Section     mAppendSection;
         uint32_t    mAnswerDelay;
+        uint32_t    mAnnounceDelay;
         uint32_t    mTtl;
         TimeMilli   mAnnounceTime;
         TimeMilli   mQueryRxTime;
@@ -1158,6 +1213,7 @@ private:
         void  Unregister(const Key &aKey);
         void  InvokeCallbacks(void);
         void  ClearAppendState(void);
+        void  UpdateLastMulticastTimes(TimeMilli aTxTime);
         Error CopyKeyInfoTo(Key &aKey, EntryState &aState) const;
 
     protected:
@@ -1301,8 +1357,10 @@ private:
         void  Unregister(const Host &aHost);
         void  Unregister(const Key &aKey);
         void  AnswerQuestion(const AnswerInfo &aInfo);
+        void  DetermineKnownAnswers(const RxMessage &aQuery, const Name &aName, AnswerInfo &aInfo) const;
         void  HandleTimer(EntryContext &aContext);
         void  ClearAppendState(void);
+        void  UpdateLastMulticastTimes(TimeMilli aTxTime);
         void  PrepareResponse(EntryContext &aContext);
         void  HandleConflict(void);
         void  DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) const;
@@ -1332,6 +1390,10 @@ private:
         void  AppendIp6AddressRecordsTo(TxMessage &aTxMessage, Section aSection);
         void  AppendIp4AddressRecordsTo(TxMessage &aTxMessage, Section aSection);
         void  AppendAddressRecordsTo(TxMessage &aTxMessage, Section aSection, AddrRecord &aAddrRecord, bool aIp6);
+        bool  AreAllAddressesKnown(const RxMessage  &aQuery,
+                                   const Name       &aName,
+                                   const AddrRecord &aAddrRecord,
+                                   bool              aIp6) const;
         void  AppendKeyRecordTo(TxMessage &aTxMessage, Section aSection);
         void  AppendNsecRecordTo(TxMessage &aTxMessage, Section aSection);
         void  AppendNameTo(TxMessage &aTxMessage, Section aSection);
@@ -1373,8 +1435,10 @@ private:
         void  AnswerServiceNameQuestion(const AnswerInfo &aInfo);
         void  AnswerServiceTypeQuestion(const AnswerInfo &aInfo, const char *aSubLabel);
         bool  ShouldSuppressKnownAnswer(uint32_t aTtl, const char *aSubLabel) const;
+        void  DetermineKnownAnswers(const RxMessage &aQuery, const Name &aName, AnswerInfo &aInfo) const;
         void  HandleTimer(EntryContext &aContext);
         void  ClearAppendState(void);
+        void  UpdateLastMulticastTimes(TimeMilli aTxTime);
         void  PrepareResponse(EntryContext &aContext);
         void  HandleConflict(void);
         void  DetermineNextAggrTxTime(NextFireTime &aNextAggrTxTime) const;
@@ -1464,6 +1528,7 @@ private:
         void     DecrementNumEntries(void) { mNumEntries--; }
         uint16_t GetNumEntries(void) const { return mNumEntries; }
         void     ClearAppendState(void);
+        void     UpdateLastMulticastTimes(TimeMilli aTxTime);
         void     AnswerQuestion(const AnswerInfo &aInfo);
         bool     ShouldSuppressKnownAnswer(uint32_t aTtl) const;
         void     HandleTimer(EntryContext &aContext);
@@ -1506,21 +1571,24 @@ private:
         void          AddQuestionFrom(const Message &aMessage);
         void          IncrementRecordCount(Section aSection) { mRecordCounts.Increment(aSection); }
         void          CheckSizeLimitToPrepareAgain(bool &aPrepareAgain);
+        bool          IsOverSizeLimit(void) const;
         void          SaveCurrentState(void);
         void          RestoreToSavedState(void);
+        void          SetTruncated(void) { mIsTruncated = true; }
         void          Send(void);
+        void          SendAndReinit(void);
 
     private:
         static constexpr bool kIsSingleLabel = true;
 
         void          Init(Type aType, uint16_t aMessageId = 0);
         void          Reinit(void);
-        bool          IsOverSizeLimit(void) const;
         AppendOutcome AppendLabels(Section     aSection,
                                    const char *aLabels,
                                    bool        aIsSingleLabel,
                                    uint16_t   &aCompressOffset);
         bool          ShouldClearAppendStateOnReinit(const Entry &aEntry) const;
+        void          UpdateLastMulticastTimes(void);
 
         static void SaveOffset(uint16_t &aCompressOffset, const Message &aMessage, Section aSection);
 
@@ -1538,6 +1606,7 @@ private:
         uint16_t          mServicesDnssdOffset; // Offset to `_services._dns-sd`
         AddressInfo       mUnicastDest;
         Type              mType;
+        bool              mIsTruncated;
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1583,6 +1652,15 @@ private:
         void                ClearProcessState(void);
         ProcessOutcome      ProcessQuery(bool aShouldProcessTruncated);
         void                ProcessResponse(void);
+        void                SuppressDuplicateQueries(void);
+        bool                ContainsKnownAnswer(const Name &aName,
+                                                uint16_t    aRrType,
+                                                const void *aData,
+                                                uint16_t    aLength,
+                                                uint32_t    aTtl) const;
+        bool                ContainsKnownSrvAnswer(const Name      &aName,
+                                                   const SrvRecord &aSrvRecord,
+                                                   const char      *aHostName) const;
 
     private:
         typedef void (RxMessage::*RecordProcessor)(const Name           &aName,
@@ -1628,6 +1706,9 @@ private:
         void ProcessARecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
         void ProcessOtherRecord(const Name &aName, const ResourceRecord &aRecord, uint16_t aRecordOffset);
 
+        template <typename CacheType>
+        void HandleDuplicateQuestion(OwningList<CacheType> &aCacheList, const Name &aName);
+
         RxMessage            *mNext;
         TimeMilli             mRxTime;
         OwnedPtr<Message>     mMessagePtr;
@@ -1799,6 +1880,40 @@ private:
         TxMessage    mQueryMessage;
     };
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    class CacheSnapshot : private NonCopyable
+    {
+        // Tracks the state while appending cached records to a
+        // snapshot message. Every record is appended between calls
+        // to `StartRecord()` and `FinishRecord()`. If the record
+        // cannot be appended or it makes the message exceed the max
+        // length, it is removed and the snapshot is marked as full.
+
+    public:
+        CacheSnapshot(Message &aMessage, uint16_t aMaxLength);
+
+        Message  &GetMessage(void) { return mMessage; }
+        TimeMilli GetNow(void) const { return mNow; }
+        bool      IsFull(void) const { return mIsFull; }
+        uint16_t  GetNumRecords(void) const { return mNumRecords; }
+        void      StartRecord(void) { mRecordStart = mMessage.GetLength(); }
+        void      FinishRecord(Error aError);
+        Error     AppendName(const char *aFirstLabel, const char *aLabels);
+
+    private:
+        Message  &mMessage;
+        TimeMilli mNow;
+        uint16_t  mMaxLength;
+        uint16_t  mRecordStart;
+        uint16_t  mNumRecords;
+        bool      mIsFull;
+    };
+
+#endif
+
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
     class CacheRecordInfo
@@ -1814,6 +1929,7 @@ private:
         void     UpdateQueryAndFireTimeOn(CacheEntry &aCacheEntry);
         bool     LessThanHalfTtlRemains(TimeMilli aNow) const;
         uint32_t GetRemainingTtl(TimeMilli aNow) const;
+        void     MarkUnverifiedIfRefreshedAt(TimeMilli aTime);
 
     private:
         static constexpr uint32_t kMaxTtl            = (24 * 3600); // One day
@@ -1827,6 +1943,7 @@ private:
         uint32_t  mTtl;
         TimeMilli mLastRxTime;
         uint8_t   mQueryCount;
+        bool      mIsUnverified;
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1844,6 +1961,7 @@ private:
         void HandleTimer(CacheContext &aContext);
         void ClearEmptyCallbacks(void);
         void ScheduleQuery(TimeMilli aQueryTime);
+        void HandleDuplicateQuestion(TimeMilli aRxTime);
 
     protected:
         enum Type : uint8_t
@@ -1879,6 +1997,7 @@ private:
         uint32_t DetermineDeleteTimeout(void) const;
         bool     ShouldQuery(TimeMilli aNow);
         void     PrepareQuery(CacheContext &aContext);
+        void     UpdateStateAfterQuery(TimeMilli aNow);
         void     ProcessExpiredRecords(TimeMilli aNow);
         void     UpdateQueryRetryInterval(void);
 
@@ -1920,6 +2039,10 @@ private:
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
         void CopyInfoTo(Browser &aBrowser, CacheInfo &aInfo) const;
 #endif
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        void SaveRecordsTo(CacheSnapshot &aSnapshot) const;
+        void MarkRestoredRecords(TimeMilli aRestoreTime);
+#endif
 
     private:
         struct PtrEntry : public LinkedListEntry<PtrEntry>, public Heap::Allocatable<PtrEntry>
@@ -1946,6 +2069,9 @@ private:
         void  AppendServiceTypeOrSubTypeTo(TxMessage &aTxMessage, Section aSection);
         void  AppendKnownAnswer(TxMessage &aTxMessage, const PtrEntry &aPtrEntry, TimeMilli aNow);
         void  DiscoverCompressOffsets(void);
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        Error AppendSnapshotRecord(CacheSnapshot &aSnapshot, const PtrEntry &aPtrEntry, uint32_t aTtl) const;
+#endif
 
         BrowseCache         *mNext;
         Heap::String         mServiceType;
@@ -1982,6 +2108,9 @@ private:
 
     public:
         void ClearCompressOffsets(void);
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        void MarkRestoredRecords(TimeMilli aRestoreTime) { mRecord.MarkUnverifiedIfRefreshedAt(aRestoreTime); }
+#endif
 
     protected:
         ServiceCache(void) = default;
@@ -2023,6 +2152,9 @@ private:
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
         void CopyInfoTo(SrvResolver &aResolver, CacheInfo &aInfo) const;
 #endif
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        void SaveRecordTo(CacheSnapshot &aSnapshot) const;
+#endif
 
     private:
         Error Init(Instance &aInstance, const char *aServiceInstance, const char *aServiceType);
@@ -2033,6 +2165,9 @@ private:
         void  ProcessExpiredRecords(TimeMilli aNow);
         void  ReportResultTo(ResultCallback &aCallback) const;
         void  ConvertTo(SrvResult &aResult) const;
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        Error AppendSnapshotRecord(CacheSnapshot &aSnapshot, uint32_t aTtl) const;
+#endif
 
         SrvCache    *mNext;
         Heap::String mHostName;
@@ -2061,6 +2196,9 @@ private:
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
         void CopyInfoTo(TxtResolver &aResolver, CacheInfo &aInfo) const;
 #endif
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        void SaveRecordTo(CacheSnapshot &aSnapshot) const;
+#endif
 
     private:
         Error Init(Instance &aInstance, const char *aServiceInstance, const char *aServiceType);
@@ -2071,6 +2209,9 @@ private:
         void  ProcessExpiredRecords(TimeMilli aNow);
         void  ReportResultTo(ResultCallback &aCallback) const;
         void  ConvertTo(TxtResult &aResult) const;
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        Error AppendSnapshotRecord(CacheSnapshot &aSnapshot, uint32_t aTtl) const;
+#endif
 
         TxtCache  *mNext;
         Heap::Data mTxtData;
@@ -2096,6 +2237,9 @@ private:
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
         void CopyInfoTo(AddressResolver &aResolver, CacheInfo &aInfo) const;
 #endif
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        void MarkRestoredRecords(TimeMilli aRestoreTime);
+#endif
 
     protected:
         struct AddrEntry : public LinkedListEntry<AddrEntry>, public Heap::Allocatable<AddrEntry>
@@ -2142,11 +2286,17 @@ private:
 
     public:
         void ProcessResponseRecord(const Message &aMessage, uint16_t aRecordOffset);
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        void SaveRecordsTo(CacheSnapshot &aSnapshot) const;
+#endif
 
     private:
         Error Init(Instance &aInstance, const char *aHostName);
         Error Init(Instance &aInstance, const AddressResolver &aResolver);
         void  PrepareAaaaQuestion(TxMessage &aQuery);
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+        Error AppendSnapshotRecord(CacheSnapshot &aSnapshot, const Ip6::Address &aAddress, uint32_t aTtl) const;
+#endif
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -2355,6 +2505,10 @@ private:
     void      HandleMessage(Message &aMessage, bool aIsUnicast, const AddressInfo &aSenderAddress);
     void      AddPassiveSrvTxtCache(const char *aServiceInstance, const char *aServiceType);
     void      AddPassiveIp6AddrCache(const char *aHostName);
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+    Error     RestoreCacheRecord(const Message &aMessage, uint16_t aNameOffset, uint16_t aRecordOffset);
+    void      AddPassiveBrowseCache(const char *aFullServiceType);
+#endif
     TimeMilli RandomizeFirstProbeTxTime(void);
     TimeMilli RandomizeInitialQueryTxTime(void);
     void      RemoveEmptyEntries(void);
@@ -2406,6 +2560,7 @@ private:
     EntryTask                mEntryTask;
     TxMessageHistory         mTxMessageHistory;
     ConflictCallback         mConflictCallback;
+    Counters                 mCounters;
 
     OwningList<BrowseCache>  mBrowseCacheList;
     OwningList<SrvCache>     mSrvCacheList;
@@ -59,6 +59,7 @@ Translator::Translator(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mState(kStateDisabled)
     , mMappingPool(aInstance)
+    , mNumActiveMappings(0)
     , mMinHostId(0)
     , mMaxHostId(0)
     , mNextHostId(0)
@@ -68,6 +69,8 @@ Translator::Translator(Instance &aInstance)
 
     mNat64Prefix.Clear();
     mIp4Cidr.Clear();
+    ClearAllBytes(mIp6HashTable);
+    ClearAllBytes(mIp4HashTable);
     mTimer.Start(Min(kIdleTimeout, kIcmpTimeout));
 
     mCounters.Clear();
@@ -132,7 +135,7 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
         ExitNow(error = kErrorAbort);
     }
 
-    mapping = mActiveMappings.FindMatching(ip6Headers);
+    mapping = FindMapping(ip6Headers);
 
     if (mapping == nullptr)
     {
@@ -149,6 +152,15 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
 
     mapping->Touch(ip6Headers.GetIpProto());
 
+    if (mapping->mOffloaded)
+    {
+        // The datagram is translated by the external datapath the
+        // mapping was installed in, so it is passed on untranslated.
+        mCounters.Count6To4Packet(ip6Headers);
+        mapping->mCounters.Count6To4Packet(ip6Headers);
+        ExitNow(error = kErrorAbort);
+    }
+
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     srcPortOrId = mapping->mTranslatedPortOrId;
 #else
@@ -232,7 +244,7 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
         ExitNow(error = kErrorDrop);
     }
 
-    mapping = mActiveMappings.FindMatching(ip4Headers);
+    mapping = FindMapping(ip4Headers);
 
     if (mapping == nullptr)
     {
@@ -350,9 +362,25 @@ void Translator::Mapping::Free(void)
 {
     LogInfo("Mapping removed: %s", ToString().AsCString());
 
+    Get<Translator>().ReportMappingEvent(kMappingRemoved, *this);
+    Get<Translator>().UnregisterMapping(*this);
     Get<Translator>().mMappingPool.Free(*this);
 }
 
+bool Translator::ReportMappingEvent(MappingEvent aEvent, const Mapping &aMapping) const
+{
+    bool           installed = false;
+    AddressMapping mapping;
+
+    VerifyOrExit(mMappingCallback.IsSet());
+
+    aMapping.CopyTo(mapping, TimerMilli::GetNow());
+    installed = mMappingCallback.Invoke(aEvent, &mapping);
+
+exit:
+    return installed;
+}
+
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
 uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
 {
@@ -373,10 +401,10 @@ uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
 
         if (((aSrcPort ^ port) & 1) == 1)
         {
-            port++;
+            port ^= 1;
         }
 
-    } while (mActiveMappings.ContainsMatching(port));
+    } while (IsTranslatedPortInUse(port));
 
     return port;
 }
@@ -406,16 +434,16 @@ Error Translator::AllocateIp4Address(Ip4::Address &aIp4Address)
 
     numberOfHosts = mMaxHostId - mMinHostId + 1;
 
-    if (mActiveMappings.CountAllEntries() >= numberOfHosts)
+    if (mNumActiveMappings >= numberOfHosts)
     {
         EvictStaleMapping();
-        VerifyOrExit(mActiveMappings.CountAllEntries() < numberOfHosts, error = kErrorFailed);
+        VerifyOrExit(mNumActiveMappings < numberOfHosts, error = kErrorFailed);
     }
 
     do
     {
         GetNextIp4Address(aIp4Address);
-    } while (mActiveMappings.ContainsMatching(aIp4Address));
+    } while (IsIp4AddressInUse(aIp4Address));
 
 exit:
     return error;
@@ -458,12 +486,22 @@ Translator::Mapping *Translator::AllocateMapping(const Ip6::Headers &aIp6Headers
     mapping->mId         = ++mNextMappingId;
     mapping->mIp6Address = aIp6Headers.GetSourceAddress();
     mapping->mIp4Address = ip4Addr;
+    mapping->mOffloaded  = false;
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     mapping->mSrcPortOrId        = GetSourcePortOrIcmp6Id(aIp6Headers);
     mapping->mTranslatedPortOrId = AllocateSourcePort(mapping->mSrcPortOrId);
 #endif
+    mapping->Touch(aIp6Headers.GetIpProto());
+
+    RegisterMapping(*mapping);
 
     LogInfo("Mapping created: %s", mapping->ToString().AsCString());
+    mapping->mOffloaded = ReportMappingEvent(kMappingAdded, *mapping);
+
+    if (mapping->mOffloaded)
+    {
+        LogInfo("Mapping offloaded: %s", mapping->ToString().AsCString());
+    }
 
 exit:
     return mapping;
@@ -620,6 +658,159 @@ exit:
     return matches;
 }
 
+uint16_t Translator::Mapping::DetermineIp6HashIndex(void) const
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return CalculateHashIndex(mIp6Address, mSrcPortOrId);
+#else
+    return CalculateHashIndex(mIp6Address, 0);
+#endif
+}
+
+uint16_t Translator::Mapping::DetermineIp4HashIndex(void) const
+{
+    // With port translation, the translated port is unique among
+    // all mappings (which may share the same IPv4 address) and is
+    // used as the key for the IPv4 hash table.
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return CalculateHashIndex(mTranslatedPortOrId);
+#else
+    return CalculateHashIndex(mIp4Address);
+#endif
+}
+
+uint16_t Translator::CalculateHashIndex(const uint8_t *aBytes, uint8_t aLength, uint16_t aPortOrId)
+{
+    uint32_t hash = aPortOrId;
+
+    for (uint8_t i = 0; i < aLength; i++)
+    {
+        hash = (hash * 31) + aBytes[i];
+    }
+
+    hash ^= (hash >> 16);
+    hash ^= (hash >> 8);
+
+    return static_cast<uint16_t>(hash & (kHashTableSize - 1));
+}
+
+uint16_t Translator::CalculateHashIndex(const Ip6::Address &aIp6Address, uint16_t aPortOrId)
+{
+    return CalculateHashIndex(aIp6Address.GetBytes(), sizeof(Ip6::Address), aPortOrId);
+}
+
+uint16_t Translator::CalculateHashIndex(const Ip4::Address &aIp4Address)
+{
+    return CalculateHashIndex(aIp4Address.GetBytes(), sizeof(Ip4::Address), 0);
+}
+
+void Translator::RegisterMapping(Mapping &aMapping)
+{
+    // Adds a newly allocated mapping (already in `mActiveMappings`)
+    // to the IPv6 and IPv4 hash tables, so that the mapping for a
+    // translated datagram can be found without iterating over all
+    // active mappings.
+
+    uint16_t ip6Index = aMapping.DetermineIp6HashIndex();
+    uint16_t ip4Index = aMapping.DetermineIp4HashIndex();
+
+    aMapping.mNextInIp6Table = mIp6HashTable[ip6Index];
+    mIp6HashTable[ip6Index]  = &aMapping;
+
+    aMapping.mNextInIp4Table = mIp4HashTable[ip4Index];
+    mIp4HashTable[ip4Index]  = &aMapping;
+
+    mNumActiveMappings++;
+}
+
+void Translator::UnregisterMapping(Mapping &aMapping)
+{
+    for (Mapping **entry = &mIp6HashTable[aMapping.DetermineIp6HashIndex()]; *entry != nullptr;
+         entry           = &(*entry)->mNextInIp6Table)
+    {
+        if (*entry == &aMapping)
+        {
+            *entry = aMapping.mNextInIp6Table;
+            break;
+        }
+    }
+
+    for (Mapping **entry = &mIp4HashTable[aMapping.DetermineIp4HashIndex()]; *entry != nullptr;
+         entry           = &(*entry)->mNextInIp4Table)
+    {
+        if (*entry == &aMapping)
+        {
+            *entry = aMapping.mNextInIp4Table;
+            break;
+        }
+    }
+
+    mNumActiveMappings--;
+}
+
+Translator::Mapping *Translator::FindMapping(const Ip6::Headers &aIp6Headers)
+{
+    Mapping *mapping;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    mapping = mIp6HashTable[CalculateHashIndex(aIp6Headers.GetSourceAddress(), GetSourcePortOrIcmp6Id(aIp6Headers))];
+#else
+    mapping = mIp6HashTable[CalculateHashIndex(aIp6Headers.GetSourceAddress(), 0)];
+#endif
+
+    while ((mapping != nullptr) && !mapping->Matches(aIp6Headers))
+    {
+        mapping = mapping->mNextInIp6Table;
+    }
+
+    return mapping;
+}
+
+Translator::Mapping *Translator::FindMapping(const Ip4::Headers &aIp4Headers)
+{
+    Mapping *mapping;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    mapping = mIp4HashTable[CalculateHashIndex(GetDestinationPortOrIcmp4Id(aIp4Headers))];
+#else
+    mapping = mIp4HashTable[CalculateHashIndex(aIp4Headers.GetDestinationAddress())];
+#endif
+
+    while ((mapping != nullptr) && !mapping->Matches(aIp4Headers))
+    {
+        mapping = mapping->mNextInIp4Table;
+    }
+
+    return mapping;
+}
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+bool Translator::IsTranslatedPortInUse(uint16_t aPort) const
+{
+    const Mapping *mapping = mIp4HashTable[CalculateHashIndex(aPort)];
+
+    while ((mapping != nullptr) && (mapping->mTranslatedPortOrId != aPort))
+    {
+        mapping = mapping->mNextInIp4Table;
+    }
+
+    return (mapping != nullptr);
+}
+#else
+bool Translator::IsIp4AddressInUse(const Ip4::Address &aIp4Address) const
+{
+    const Mapping *mapping = mIp4HashTable[CalculateHashIndex(aIp4Address)];
+
+    while ((mapping != nullptr) && (mapping->mIp4Address != aIp4Address))
+    {
+        mapping = mapping->mNextInIp4Table;
+    }
+
+    return (mapping != nullptr);
+}
+#endif
+
 Error Translator::TranslateIcmp4(Message &aMessage, uint16_t aOriginalId)
 {
     Error            error = kErrorNone;
@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/callback.hpp"
 #include "common/locator.hpp"
 #include "common/owning_list.hpp"
 #include "common/pool.hpp"
@@ -73,9 +74,14 @@ class Translator : public InstanceLocator, private NonCopyable
     struct Mapping;
 
 public:
-    typedef otNat64AddressMapping AddressMapping; ///< Address mapping.
-    typedef otNat64DropReason     DropReason;     ///< Drop reason.
-    typedef otNat64ErrorCounters  ErrorCounters;  ///< Error counters.
+    typedef otNat64AddressMapping  AddressMapping;  ///< Address mapping.
+    typedef otNat64DropReason      DropReason;      ///< Drop reason.
+    typedef otNat64ErrorCounters   ErrorCounters;   ///< Error counters.
+    typedef otNat64MappingCallback MappingCallback; ///< Mapping callback.
+    typedef otNat64MappingEvent    MappingEvent;    ///< Mapping event.
+
+    static constexpr MappingEvent kMappingAdded   = OT_NAT64_MAPPING_EVENT_ADDED;   ///< Mapping was created.
+    static constexpr MappingEvent kMappingRemoved = OT_NAT64_MAPPING_EVENT_REMOVED; ///< Mapping was removed.
 
     /**
      * An iterator to iterate over `AddressMapping` entries.
@@ -196,7 +202,8 @@ public:
      * @retval kErrorNone    The message was successfully translated from IPv6 to IPv4.
      * @retval kErrorDrop    The message should be dropped, e.g., it is malformed or translation failed.
      * @retval kErrorAbort   No translation was performed or required (e.g., NAT64 is disabled, the message is not
-     *                       destined for a NAT64-mapped address). In this case, the message is not modified.
+     *                       destined for a NAT64-mapped address, or its mapping is offloaded to an external
+     *                       datapath). In this case, the message is not modified.
      */
     Error TranslateIp6ToIp4(Message &aMessage);
 
@@ -275,6 +282,17 @@ public:
      */
     const ErrorCounters &GetErrorCounters(void) const { return mErrorCounters; }
 
+    /**
+     * Sets the callback to notify when an address mapping is created or removed.
+     *
+     * A mapping is offloaded when the callback returns `true` for its `kMappingAdded` event, see
+     * `otNat64MappingCallback`.
+     *
+     * @param[in] aCallback  The callback function, or `nullptr` to clear the callback.
+     * @param[in] aContext   An arbitrary context used with @p aCallback.
+     */
+    void SetMappingCallback(MappingCallback aCallback, void *aContext) { mMappingCallback.Set(aCallback, aContext); }
+
 private:
     // Timeouts are in milliseconds
     static constexpr uint32_t kIdleTimeout = OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
@@ -287,9 +305,19 @@ private:
 
     static constexpr uint32_t kPoolSize = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
 
+    static constexpr uint16_t kHashTableSize = OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE;
+
+    static_assert((kHashTableSize & (kHashTableSize - 1)) == 0,
+                  "OPENTHREAD_CONFIG_NAT64_MAPPING_HASH_TABLE_SIZE must be a power of two");
+
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
-    static constexpr uint16_t kMinTranslationPort = 49152;
-    static constexpr uint16_t kMaxTranslationPort = 65535;
+    static constexpr uint16_t kMinTranslationPort  = 49152;
+    static constexpr uint16_t kMaxTranslationPort  = 65535;
+    static constexpr uint16_t kNumTranslationPorts = kMaxTranslationPort - kMinTranslationPort + 1;
+
+    // Translated ports preserve the parity of the original port, so
+    // at most half of the range is usable by mappings of one parity.
+    static_assert(kPoolSize < kNumTranslationPorts / 2, "OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS is too large");
 #endif
 
     static constexpr DropReason kReasonUnknown          = OT_NAT64_DROP_REASON_UNKNOWN;
@@ -323,21 +351,21 @@ private:
         bool          Matches(const Ip4::Headers &aIp4Headers) const;
         bool          Matches(const ExpirationChecker &aChecker) const { return aChecker.IsExpired(mExpirationTime); }
         bool          Matches(const Mapping &aMapping) const { return this == &aMapping; }
-#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
-        bool Matches(const uint16_t aPort) const { return mTranslatedPortOrId == aPort; }
-#else
-        bool Matches(const Ip4::Address &aIp4Address) const { return mIp4Address == aIp4Address; }
-#endif
+        uint16_t      DetermineIp6HashIndex(void) const;
+        uint16_t      DetermineIp4HashIndex(void) const;
 
         static bool IsCounterZero(const ProtocolCounters::Counters &aCounters);
 
         Mapping         *mNext;
+        Mapping         *mNextInIp6Table;
+        Mapping         *mNextInIp4Table;
         uint64_t         mId;
         TimeMilli        mLastUseTime;
         TimeMilli        mExpirationTime;
         Ip4::Address     mIp4Address;
         Ip6::Address     mIp6Address;
         ProtocolCounters mCounters;
+        bool             mOffloaded;
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
         uint16_t mSrcPortOrId;
         uint16_t mTranslatedPortOrId;
@@ -355,27 +383,43 @@ private:
     Mapping *AllocateMapping(const Ip6::Headers &aIp6Headers);
     void     EvictStaleMapping(void);
     void     HandleTimer(void);
+    Mapping *FindMapping(const Ip6::Headers &aIp6Headers);
+    Mapping *FindMapping(const Ip4::Headers &aIp4Headers);
+    void     RegisterMapping(Mapping &aMapping);
+    void     UnregisterMapping(Mapping &aMapping);
+    bool     ReportMappingEvent(MappingEvent aEvent, const Mapping &aMapping) const;
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     uint16_t AllocateSourcePort(uint16_t aSrcPort);
+    bool     IsTranslatedPortInUse(uint16_t aPort) const;
+#else
+    bool IsIp4AddressInUse(const Ip4::Address &aIp4Address) const;
 #endif
 
     static uint16_t GetSourcePortOrIcmp6Id(const Ip6::Headers &aIp6Headers);
     static uint16_t GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers);
+    static uint16_t CalculateHashIndex(const uint8_t *aBytes, uint8_t aLength, uint16_t aPortOrId);
+    static uint16_t CalculateHashIndex(const Ip6::Address &aIp6Address, uint16_t aPortOrId);
+    static uint16_t CalculateHashIndex(const Ip4::Address &aIp4Address);
+    static uint16_t CalculateHashIndex(uint16_t aPort) { return aPort & (kHashTableSize - 1); }
 
     using TranslatorTimer = TimerMilliIn<Translator, &Translator::HandleTimer>;
 
-    State                    mState;
-    uint64_t                 mNextMappingId;
-    Pool<Mapping, kPoolSize> mMappingPool;
-    OwningList<Mapping>      mActiveMappings;
-    Ip6::Prefix              mNat64Prefix;
-    Ip4::Cidr                mIp4Cidr;
-    uint32_t                 mMinHostId;
-    uint32_t                 mMaxHostId;
-    uint32_t                 mNextHostId;
-    TranslatorTimer          mTimer;
-    ProtocolCounters         mCounters;
-    ErrorCounters            mErrorCounters;
+    State                     mState;
+    uint64_t                  mNextMappingId;
+    Pool<Mapping, kPoolSize>  mMappingPool;
+    OwningList<Mapping>       mActiveMappings;
+    uint16_t                  mNumActiveMappings;
+    Mapping                  *mIp6HashTable[kHashTableSize];
+    Mapping                  *mIp4HashTable[kHashTableSize];
+    Ip6::Prefix               mNat64Prefix;
+    Ip4::Cidr                 mIp4Cidr;
+    uint32_t                  mMinHostId;
+    uint32_t                  mMaxHostId;
+    uint32_t                  mNextHostId;
+    TranslatorTimer           mTimer;
+    ProtocolCounters          mCounters;
+    ErrorCounters             mErrorCounters;
+    Callback<MappingCallback> mMappingCallback;
 };
 #endif // OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 
@@ -167,6 +167,13 @@ public:
      */
     void ResetCounters(void) { mCounters.Clear(); }
 
+    /**
+     * Counts the number of outstanding advertisements (not yet committed on SRP server).
+     *
+     * @returns The number of outstanding advertisements.
+     */
+    uint32_t CountOutstandingAdvs(void) const { return mAdvInfoList.CountAllEntries(); }
+
     /**
      * Gets the advertisement timeout (in msec).
      *
@@ -337,6 +337,7 @@ Client::Client(Instance &aInstance)
     , mState(kStateStopped)
     , mTxFailureRetryCount(0)
     , mShouldRemoveKeyLease(false)
+    , mHasPublicKey(false)
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     , mServiceKeyRecordEnabled(false)
     , mHostKeyRecordEnabled(true)
@@ -345,6 +346,7 @@ Client::Client(Instance &aInstance)
     , mCurMessageId(0)
     , mAutoHostAddressCount(0)
     , mRetryWaitInterval(kMinRetryWaitInterval)
+    , mRefreshWindow(0)
     , mTtl(0)
     , mLease(0)
     , mKeyLease(0)
@@ -1043,7 +1045,7 @@ void Client::SendUpdate(void)
         /* (7) kRemoved    -> */ kRemoved,
     };
 
-    static const ItemState kNewStateOnSingleServiceMode[]{
+    static const ItemState kNewStateOnPartialMode[]{
         /* (0) kToAdd      -> */ kToAdd,
         /* (1) kAdding     -> */ kToRefresh,
         /* (2) kToRefresh  -> */ kToRefresh,
@@ -1056,7 +1058,7 @@ void Client::SendUpdate(void)
 
     Error    error = kErrorNone;
     MsgInfo  info;
-    uint32_t length;
+    uint16_t length;
     bool     anyChanged;
 #if OPENTHREAD_CONFIG_SRP_CLIENT_COUNTERS_ENABLE
     uint16_t txPayloadLength;
@@ -1065,16 +1067,40 @@ void Client::SendUpdate(void)
     info.mMessage.Reset(mSocket.NewMessage());
     VerifyOrExit(info.mMessage != nullptr, error = kErrorNoBufs);
 
-    info.mSingleServiceMode = false;
+#if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    info.mKeyInfo.SetKeyRef(Get<Crypto::Storage::KeyRefManager>().KeyRefFor(Crypto::Storage::KeyRefManager::kEcdsa));
+#endif
+
+    SuccessOrExit(error = ReadOrGenerateKey(info.mKeyInfo));
+    SuccessOrExit(error = UpdatePublicKey(info.mKeyInfo));
+
+    info.mPartialMode    = false;
+    info.mReservedLength = 0;
     SuccessOrExit(error = PrepareUpdateMessage(info));
 
-    length = info.mMessage->GetLength() + sizeof(Ip6::UdpHeader) + sizeof(Ip6::Header);
+    length = info.mMessage->GetLength();
 
-    if (length >= Ip6::kMaxDatagramLength)
+    if (length >= kMaxUpdateMessageLength)
     {
-        LogInfo("Msg len %lu is larger than MTU, enabling single service mode", ToUlong(length));
+        LogInfo("Msg len %u is larger than MTU, enabling partial mode", length);
+
+        // In "partial mode", services are appended as long as the
+        // message fits within the MTU. The remaining services are
+        // sent in the next update message(s). The length reserved
+        // for the records appended after the services is determined
+        // from the current full message. If the host name is appended
+        // (uncompressed) in the service instructions, we reserve room
+        // for it since it may need to be appended in the host
+        // description instruction instead.
+
+        info.mPartialMode    = true;
+        info.mReservedLength = length - info.mServicesEndOffset;
+
+        if (info.mHostNameOffset < info.mServicesEndOffset)
+        {
+            info.mReservedLength += StringLength(mHostInfo.GetName(), Dns::Name::kMaxNameSize) + 1;
+        }
 
-        info.mSingleServiceMode = true;
         IgnoreError(info.mMessage->SetLength(0));
 
         // State changes:
@@ -1082,7 +1108,7 @@ void Client::SendUpdate(void)
         //   kRefreshing -> kToRefresh
         //   kRemoving   -> kToRemove
 
-        ChangeHostAndServiceStates(kNewStateOnSingleServiceMode, kForServicesAppendedInMessage);
+        ChangeHostAndServiceStates(kNewStateOnPartialMode, kForServicesAppendedInMessage);
 
         SuccessOrExit(error = PrepareUpdateMessage(info));
     }
@@ -1113,6 +1139,22 @@ void Client::SendUpdate(void)
 #if OPENTHREAD_CONFIG_SRP_CLIENT_COUNTERS_ENABLE
     mCounters.mTxUpdates++;
     mCounters.mTxTotalBytes += txPayloadLength;
+    mCounters.mTxEstimatedFrames +=
+        DivideAndRoundUp<uint32_t>(txPayloadLength + sizeof(Ip6::UdpHeader) + sizeof(Ip6::Header),
+                                   kEstimatedFramePayloadSize);
+
+    if (info.mPartialMode)
+    {
+        mCounters.mTxPartialUpdates++;
+    }
+
+    for (const Service &service : mServices)
+    {
+        if ((service.GetState() == kRegistered) && !service.IsAppendedInMessage())
+        {
+            mCounters.mTxSkippedServices++;
+        }
+    }
 #endif
 
     // Ownership of the message is transferred to the socket upon a
@@ -1187,15 +1229,10 @@ Error Client::PrepareUpdateMessage(MsgInfo &aInfo)
     Error             error = kErrorNone;
     Dns::UpdateHeader header;
 
-    aInfo.mDomainNameOffset = MsgInfo::kUnknownOffset;
-    aInfo.mHostNameOffset   = MsgInfo::kUnknownOffset;
-    aInfo.mRecordCount      = 0;
-
-#if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
-    aInfo.mKeyInfo.SetKeyRef(Get<Crypto::Storage::KeyRefManager>().KeyRefFor(Crypto::Storage::KeyRefManager::kEcdsa));
-#endif
-
-    SuccessOrExit(error = ReadOrGenerateKey(aInfo.mKeyInfo));
+    aInfo.mDomainNameOffset  = MsgInfo::kUnknownOffset;
+    aInfo.mHostNameOffset    = MsgInfo::kUnknownOffset;
+    aInfo.mServicesEndOffset = MsgInfo::kUnknownOffset;
+    aInfo.mRecordCount       = 0;
 
     header.SetMessageId(mCurMessageId);
 
@@ -1222,6 +1259,7 @@ Error Client::PrepareUpdateMessage(MsgInfo &aInfo)
     // Prepare Update section
 
     SuccessOrExit(error = AppendServiceInstructions(aInfo));
+    aInfo.mServicesEndOffset = aInfo.mMessage->GetLength();
     SuccessOrExit(error = AppendHostDescriptionInstruction(aInfo));
 
     header.SetUpdateRecordCount(aInfo.mRecordCount);
@@ -1263,20 +1301,36 @@ Error Client::ReadOrGenerateKey(KeyInfo &aKeyInfo)
     Crypto::Ecdsa::P256::KeyPair keyPair;
 
     VerifyOrExit(!Crypto::Storage::HasKey(aKeyInfo.GetKeyRef()));
+
     error = Get<Settings>().Read<Settings::SrpEcdsaKey>(keyPair);
 
     if (error == kErrorNone)
     {
-        if (aKeyInfo.ImportKeyPair(keyPair) != kErrorNone)
+        // The public key derived from the imported key pair is cached
+        // so it is not read back from the key storage. The cache is
+        // only invalidated when a new key is generated.
+
+        Crypto::Ecdsa::P256::PublicKey publicKey;
+
+        if ((keyPair.GetPublicKey(publicKey) == kErrorNone) && (aKeyInfo.ImportKeyPair(keyPair) == kErrorNone))
+        {
+            mPublicKey    = publicKey;
+            mHasPublicKey = true;
+        }
+        else
         {
+            mHasPublicKey = false;
             SuccessOrExit(error = aKeyInfo.Generate());
         }
+
         Get<Settings>().Delete<Settings::SrpEcdsaKey>();
     }
     else
     {
+        mHasPublicKey = false;
         SuccessOrExit(error = aKeyInfo.Generate());
     }
+
 exit:
     return error;
 }
@@ -1289,14 +1343,19 @@ Error Client::ReadOrGenerateKey(KeyInfo &aKeyInfo)
 
     if (error == kErrorNone)
     {
-        Crypto::Ecdsa::P256::PublicKey publicKey;
+        // The read key is validated by deriving its public key, unless
+        // it is already derived (and cached) from a previous read.
 
-        if (aKeyInfo.GetPublicKey(publicKey) == kErrorNone)
+        VerifyOrExit(!mHasPublicKey);
+
+        if (aKeyInfo.GetPublicKey(mPublicKey) == kErrorNone)
         {
+            mHasPublicKey = true;
             ExitNow();
         }
     }
 
+    mHasPublicKey = false;
     SuccessOrExit(error = aKeyInfo.Generate());
     Get<Settings>().Save<Settings::SrpEcdsaKey>(aKeyInfo);
 
@@ -1305,6 +1364,24 @@ exit:
 }
 #endif //  OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
 
+Error Client::UpdatePublicKey(const KeyInfo &aKeyInfo)
+{
+    // The public key is cached so that it is not derived again (which
+    // involves EC operations or reading it from platform key storage)
+    // every time an update message is prepared. The cache is cleared
+    // when `ReadOrGenerateKey()` generates a new key, and it is set
+    // directly when the key is imported or validated there.
+
+    Error error = kErrorNone;
+
+    VerifyOrExit(!mHasPublicKey);
+    SuccessOrExit(error = aKeyInfo.GetPublicKey(mPublicKey));
+    mHasPublicKey = true;
+
+exit:
+    return error;
+}
+
 Error Client::AppendServiceInstructions(MsgInfo &aInfo)
 {
     Error error = kErrorNone;
@@ -1377,18 +1454,31 @@ Error Client::AppendServiceInstructions(MsgInfo &aInfo)
 
         if ((service.GetState() != kRegistered) && CanAppendService(service))
         {
+            uint16_t prevLength         = aInfo.mMessage->GetLength();
+            uint16_t prevHostNameOffset = aInfo.mHostNameOffset;
+            uint16_t prevRecordCount    = aInfo.mRecordCount;
+
             SuccessOrExit(error = AppendServiceInstruction(service, aInfo));
 
-            if (aInfo.mSingleServiceMode)
+            // In "partial mode", we append services as long as the
+            // message fits within the MTU, and always include at least
+            // one service. A service that does not fit is removed from
+            // the message and remains in its current state to be sent
+            // in a later update.
+
+            if (aInfo.mPartialMode && (prevRecordCount != 0) &&
+                (aInfo.mMessage->GetLength() + aInfo.mReservedLength >= kMaxUpdateMessageLength))
             {
-                // In "single service mode", we allow only one service
-                // to be appended in the message.
+                IgnoreError(aInfo.mMessage->SetLength(prevLength));
+                aInfo.mHostNameOffset = prevHostNameOffset;
+                aInfo.mRecordCount    = prevRecordCount;
+                service.ClearAppendedInMessageFlag();
                 break;
             }
         }
     }
 
-    if (!aInfo.mSingleServiceMode)
+    if (!aInfo.mPartialMode)
     {
         for (Service &service : mServices)
         {
@@ -1674,9 +1764,8 @@ exit:
 
 Error Client::AppendKeyRecord(MsgInfo &aInfo) const
 {
-    Error                          error;
-    Dns::KeyRecord                 key;
-    Crypto::Ecdsa::P256::PublicKey publicKey;
+    Error          error;
+    Dns::KeyRecord key;
 
     key.Init();
     key.SetTtl(DetermineTtl());
@@ -1686,8 +1775,7 @@ Error Client::AppendKeyRecord(MsgInfo &aInfo) const
     key.SetAlgorithm(Dns::KeyRecord::kAlgorithmEcdsaP256Sha256);
     key.SetLength(sizeof(Dns::KeyRecord) - sizeof(Dns::ResourceRecord) + sizeof(Crypto::Ecdsa::P256::PublicKey));
     SuccessOrExit(error = aInfo.mMessage->Append(key));
-    SuccessOrExit(error = aInfo.mKeyInfo.GetPublicKey(publicKey));
-    SuccessOrExit(error = aInfo.mMessage->Append(publicKey));
+    SuccessOrExit(error = aInfo.mMessage->Append(mPublicKey));
     aInfo.mRecordCount++;
 
 exit:
@@ -1990,6 +2078,9 @@ void Client::ProcessResponse(Message &aMessage)
     // Check for Update Lease OPT RR. This determines the lease
     // interval accepted by server. If not present, then use the
     // transmitted lease interval from the update request message.
+    // The OPT RR may also include a Refresh Window Option.
+
+    mRefreshWindow = 0;
 
     recordCount =
         header.GetPrerequisiteRecordCount() + header.GetUpdateRecordCount() + header.GetAdditionalRecordCount();
@@ -2020,6 +2111,7 @@ void Client::ProcessResponse(Message &aMessage)
         uint32_t interval = Time::SecToMsec(mLease - kLeaseRenewGuardInterval);
 
         mLeaseRenewTime += Random::NonCrypto::AddJitter(interval, kLeaseRenewJitter);
+        AlignLeaseRenewTimeToRefreshWindow();
     }
     else
     {
@@ -2106,8 +2198,9 @@ Error Client::ProcessOptRecord(const Message &aMessage, uint16_t aOffset, const
     // Read and process all options (in an OPT RR) from a message.
     // The `aOffset` points to beginning of record in `aMessage`.
 
-    Error            error = kErrorNone;
-    Dns::LeaseOption leaseOption;
+    Error                    error = kErrorNone;
+    Dns::LeaseOption         leaseOption;
+    Dns::RefreshWindowOption refreshWindowOption;
 
     IgnoreError(Dns::Name::ParseName(aMessage, aOffset));
     aOffset += sizeof(Dns::OptRecord);
@@ -2129,6 +2222,15 @@ Error Client::ProcessOptRecord(const Message &aMessage, uint16_t aOffset, const
         ExitNow();
     }
 
+    // The Refresh Window Option is an optional hint from the server.
+    // A malformed one is ignored.
+
+    if (refreshWindowOption.ReadFrom(aMessage, aOffset, aOptRecord.GetLength()) == kErrorNone)
+    {
+        mRefreshWindow      = refreshWindowOption.GetWindowInterval();
+        mRefreshWindowStart = TimerMilli::GetNow() + refreshWindowOption.GetNextWindowDelay();
+    }
+
 exit:
     return error;
 }
@@ -2270,6 +2372,33 @@ uint32_t Client::DetermineTtl(void) const
     return (mTtl == kUnspecifiedInterval) ? lease : Min(mTtl, lease);
 }
 
+void Client::AlignLeaseRenewTimeToRefreshWindow(void)
+{
+    // If the server provided a refresh window hint, move the lease
+    // renew time earlier to the start of the refresh window it falls
+    // in (plus a small jitter within the window). This way the
+    // refreshes from all clients fall at the start of the server's
+    // windows, where the server processes lease expirations in a
+    // batch. The renew time is never moved later.
+
+    uint32_t sinceWindowStart;
+    uint32_t jitter;
+
+    VerifyOrExit(mRefreshWindow != 0);
+    VerifyOrExit(mLeaseRenewTime >= mRefreshWindowStart);
+
+    sinceWindowStart = (mLeaseRenewTime - mRefreshWindowStart) % mRefreshWindow;
+    jitter           = Min<uint32_t>(sinceWindowStart, kLeaseRenewJitter);
+
+    mLeaseRenewTime -= sinceWindowStart;
+    mLeaseRenewTime += Random::NonCrypto::GenerateInClosedRange<uint32_t>(0, jitter);
+
+    LogInfo("Aligned lease renew time to refresh window (interval:%lu msec)", ToUlong(mRefreshWindow));
+
+exit:
+    return;
+}
+
 bool Client::ShouldRenewEarly(const Service &aService) const
 {
     // Check if we reached the service renew time or close to it. The
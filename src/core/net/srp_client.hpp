@@ -796,6 +796,18 @@ private:
 
     static constexpr uint16_t kUdpPayloadSize = Ip6::kMaxDatagramLength - sizeof(Ip6::UdpHeader);
 
+    // An update message is considered too large (requiring it to be
+    // split) if its length reaches this value, i.e., the IPv6 datagram
+    // (including IPv6 and UDP headers) reaches the MTU.
+    static constexpr uint16_t kMaxUpdateMessageLength =
+        Ip6::kMaxDatagramLength - sizeof(Ip6::UdpHeader) - sizeof(Ip6::Header);
+
+#if OPENTHREAD_CONFIG_SRP_CLIENT_COUNTERS_ENABLE
+    // Estimated number of IPv6 datagram bytes carried in each 15.4
+    // frame (fragment), used for `mTxEstimatedFrames` counter.
+    static constexpr uint16_t kEstimatedFramePayloadSize = 80;
+#endif
+
     // -------------------------------
     // Lease related constants
 
@@ -1041,9 +1053,11 @@ private:
         static constexpr uint16_t kUnknownOffset = 0;
 
         OwnedPtr<Message> mMessage;
-        bool              mSingleServiceMode;
+        bool              mPartialMode;    // Append only as many services as fit in the message.
+        uint16_t          mReservedLength; // Length reserved after services (host instruction, OPT and SIG RRs).
         uint16_t          mDomainNameOffset;
         uint16_t          mHostNameOffset;
+        uint16_t          mServicesEndOffset;
         uint16_t          mRecordCount;
         uint16_t          mSigRecordOffset;
         KeyInfo           mKeyInfo;
@@ -1070,6 +1084,7 @@ private:
     Error        PrepareUpdateMessage(MsgInfo &aInfo);
     Error        UpdateIdAndSignatureInUpdateMessage(MsgInfo &aInfo);
     Error        ReadOrGenerateKey(KeyInfo &aKeyInfo);
+    Error        UpdatePublicKey(const KeyInfo &aKeyInfo);
     Error        AppendServiceInstructions(MsgInfo &aInfo);
     bool         CanAppendService(const Service &aService);
     Error        AppendServiceInstruction(Service &aService, MsgInfo &aInfo);
@@ -1093,6 +1108,7 @@ private:
     void         GrowRetryWaitInterval(void);
     uint32_t     DetermineLeaseInterval(uint32_t aInterval, uint32_t aDefaultInterval) const;
     uint32_t     DetermineTtl(void) const;
+    void         AlignLeaseRenewTimeToRefreshWindow(void);
     bool         ShouldRenewEarly(const Service &aService) const;
     void         HandleTimer(void);
 #if OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_API_ENABLE
@@ -1130,6 +1146,7 @@ private:
     State   mState;
     uint8_t mTxFailureRetryCount : 4;
     bool    mShouldRemoveKeyLease : 1;
+    bool    mHasPublicKey : 1;
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     bool mServiceKeyRecordEnabled : 1;
     bool mHostKeyRecordEnabled : 1;
@@ -1141,6 +1158,8 @@ private:
     uint32_t mRetryWaitInterval;
 
     TimeMilli mLeaseRenewTime;
+    TimeMilli mRefreshWindowStart; // Start of a server refresh window (when `mRefreshWindow` is non-zero).
+    uint32_t  mRefreshWindow;      // Server refresh window interval in msec (from response), zero if none.
     uint32_t  mTtl;
     uint32_t  mLease;
     uint32_t  mKeyLease;
@@ -1148,6 +1167,8 @@ private:
     uint32_t  mDefaultKeyLease;
     TxJitter  mTxJitter;
 
+    Crypto::Ecdsa::P256::PublicKey mPublicKey; // Cached public key of `KeyInfo` (when `mHasPublicKey`).
+
     ClientSocket mSocket;
 
     Callback<ClientCallback> mCallback;
@@ -55,6 +55,7 @@ static Dns::UpdateHeader::Response ErrorToDnsResponseCode(Error aError)
         responseCode = Dns::UpdateHeader::kResponseSuccess;
         break;
     case kErrorNoBufs:
+    case kErrorBusy:
         responseCode = Dns::UpdateHeader::kResponseServerFailure;
         break;
     case kErrorParse:
@@ -78,6 +79,8 @@ Server::Server(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mSocket(aInstance, *this)
     , mLeaseTimer(aInstance)
+    , mRefreshWindow(Time::SecToMsec(kDefaultRefreshWindow))
+    , mRefreshWindowEpoch(TimerMilli::GetNow())
     , mOutstandingUpdatesTimer(aInstance)
     , mCompletedUpdateTask(aInstance)
     , mServiceUpdateId(Random::NonCrypto::Generate<uint32_t>())
@@ -93,6 +96,7 @@ Server::Server(Instance &aInstance)
     , mFastStartMode(false)
 #endif
 {
+    ClearAllBytes(mUpdateStats);
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -412,6 +416,31 @@ exit:
     return error;
 }
 
+Error Server::SetRefreshWindow(uint32_t aWindow)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aWindow <= kMaxRefreshWindow, error = kErrorInvalidArgs);
+    VerifyOrExit(Time::SecToMsec(aWindow) != mRefreshWindow);
+
+    mRefreshWindow      = Time::SecToMsec(aWindow);
+    mRefreshWindowEpoch = TimerMilli::GetNow();
+
+    LogInfo("Refresh window: %lu sec", ToUlong(aWindow));
+
+    // The lease timer may be armed at the start of a window of the
+    // previous interval, so the leases are processed again to
+    // reschedule it on the new windows.
+
+    if (mLeaseTimer.IsRunning())
+    {
+        mLeaseTimer.Start(0);
+    }
+
+exit:
+    return error;
+}
+
 Error Server::SetDomain(const char *aDomain)
 {
     Error    error = kErrorNone;
@@ -605,6 +634,8 @@ void Server::CommitSrpUpdate(Error                    aError,
     uint32_t grantedKeyLease = 0;
     bool     useShortLease   = aHost.ShouldUseShortLeaseOption();
 
+    UpdateLatencyStats(aHost);
+
     if (aError != kErrorNone || (mState != kStateRunning))
     {
         aHost.Free();
@@ -721,7 +752,7 @@ void Server::CommitSrpUpdate(Error                    aError,
 
     if (!aHost.IsDeleted())
     {
-        mLeaseTimer.FireAtIfEarlier(Min(aHost.GetExpireTime(), aHost.GetKeyExpireTime()));
+        ScheduleLeaseTimer(Min(aHost.GetExpireTime(), aHost.GetKeyExpireTime()));
     }
 
 exit:
@@ -971,6 +1002,19 @@ void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
     // Per 2.3.2 of SRP draft 6, no prerequisites should be included in a SRP update.
     VerifyOrExit(aMetadata.mDnsHeader.GetPrerequisiteRecordCount() == 0, error = kErrorFailed);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES > 0
+    // Reject the update early (before parsing it and verifying its
+    // signature) if too many updates are already pending. The client
+    // will retry after a back-off interval.
+
+    if (CountPendingUpdates() >= OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES)
+    {
+        LogInfo("Too many pending SRP updates, reject update: MessageId=%u", aMetadata.mDnsHeader.GetMessageId());
+        mUpdateStats.mNumRejectedBusy++;
+        ExitNow(error = kErrorBusy);
+    }
+#endif
+
     host = Host::Allocate(GetInstance(), aMetadata.mRxTime);
     VerifyOrExit(host != nullptr, error = kErrorNoBufs);
     SuccessOrExit(error = ProcessUpdateSection(*host, aMessage, aMetadata));
@@ -1613,7 +1657,7 @@ void Server::InformUpdateHandlerOrCommit(Error aError, Host &aHost, const Messag
     CommitSrpUpdate(aError, aHost, aMetadata);
 
 exit:
-    return;
+    mUpdateStats.mMaxNumPending = Max(mUpdateStats.mMaxNumPending, CountPendingUpdates());
 }
 
 void Server::SendResponse(const Dns::UpdateHeader    &aHeader,
@@ -1659,12 +1703,13 @@ void Server::SendResponse(const Dns::UpdateHeader &aHeader,
                           bool                     mUseShortLeaseOption,
                           const Ip6::MessageInfo  &aMessageInfo)
 {
-    Error             error;
-    Message          *response = nullptr;
-    Dns::UpdateHeader header;
-    Dns::OptRecord    optRecord;
-    Dns::LeaseOption  leaseOption;
-    uint16_t          optionSize;
+    Error                    error;
+    Message                 *response = nullptr;
+    Dns::UpdateHeader        header;
+    Dns::OptRecord           optRecord;
+    Dns::LeaseOption         leaseOption;
+    Dns::RefreshWindowOption refreshWindowOption;
+    uint16_t                 optionSize;
 
     response = GetSocket().NewMessage();
     VerifyOrExit(response != nullptr, error = kErrorNoBufs);
@@ -1695,9 +1740,23 @@ void Server::SendResponse(const Dns::UpdateHeader &aHeader,
     optionSize = static_cast<uint16_t>(leaseOption.GetSize());
     optRecord.SetLength(optionSize);
 
+    if (mRefreshWindow != 0)
+    {
+        TimeMilli now = TimerMilli::GetNow();
+
+        UpdateRefreshWindowEpoch();
+        refreshWindowOption.Init(mRefreshWindow, GetNextRefreshWindowStart(now) - now);
+        optRecord.SetLength(optionSize + sizeof(Dns::RefreshWindowOption));
+    }
+
     SuccessOrExit(error = response->Append(optRecord));
     SuccessOrExit(error = response->AppendBytes(&leaseOption, optionSize));
 
+    if (mRefreshWindow != 0)
+    {
+        SuccessOrExit(error = response->Append(refreshWindowOption));
+    }
+
     SuccessOrExit(error = GetSocket().SendTo(*response, aMessageInfo));
 
     LogInfo("Send success response with granted lease: %lu and key lease: %lu", ToUlong(aLease), ToUlong(aKeyLease));
@@ -1754,6 +1813,10 @@ void Server::HandleLeaseTimer(void)
     NextFireTime nextExpireTime;
     Host        *nextHost;
 
+    mUpdateStats.mNumLeaseRuns++;
+
+    UpdateRefreshWindowEpoch();
+
     for (Host *host = mHosts.GetHead(); host != nullptr; host = nextHost)
     {
         nextHost = host->GetNext();
@@ -1846,7 +1909,71 @@ void Server::HandleLeaseTimer(void)
         }
     }
 
-    mLeaseTimer.FireAtIfEarlier(nextExpireTime);
+    if (nextExpireTime.IsSet())
+    {
+        ScheduleLeaseTimer(nextExpireTime.GetNextTime());
+    }
+}
+
+void Server::ScheduleLeaseTimer(TimeMilli aExpireTime)
+{
+    // When refresh windows are enabled, the lease timer is scheduled
+    // at the start of a window so that all leases expiring within
+    // the same window are processed together.
+
+    UpdateRefreshWindowEpoch();
+    mLeaseTimer.FireAtIfEarlier(GetNextRefreshWindowStart(aExpireTime));
+}
+
+void Server::UpdateRefreshWindowEpoch(void)
+{
+    // Moves `mRefreshWindowEpoch` forward to the start of the current
+    // window, which keeps the windows unchanged. The time values wrap
+    // every 2^32 msec, so the epoch is moved forward regularly (on
+    // every lease timer run and SRP update response) to keep the time
+    // elapsed since it well below the wrap. Otherwise the windows
+    // calculated by `GetNextRefreshWindowStart()` would shift.
+
+    TimeMilli now = TimerMilli::GetNow();
+
+    VerifyOrExit(mRefreshWindow != 0);
+    mRefreshWindowEpoch += ((now - mRefreshWindowEpoch) / mRefreshWindow) * mRefreshWindow;
+
+exit:
+    return;
+}
+
+TimeMilli Server::GetNextRefreshWindowStart(TimeMilli aTime) const
+{
+    // Returns the start time of the first refresh window at or after
+    // `aTime`. Windows start at `mRefreshWindowEpoch` plus a multiple
+    // of `mRefreshWindow`. If refresh windows are disabled, `aTime`
+    // itself is returned.
+    //
+    // A time before the epoch (e.g., an already expired lease) maps
+    // to the epoch itself, which is never after now. Otherwise the
+    // unsigned difference `aTime - mRefreshWindowEpoch` would wrap and
+    // yield an arbitrary window.
+
+    uint32_t remainder;
+
+    VerifyOrExit(mRefreshWindow != 0);
+
+    if (aTime < mRefreshWindowEpoch)
+    {
+        aTime = mRefreshWindowEpoch;
+        ExitNow();
+    }
+
+    remainder = (aTime - mRefreshWindowEpoch) % mRefreshWindow;
+
+    if (remainder != 0)
+    {
+        aTime += mRefreshWindow - remainder;
+    }
+
+exit:
+    return aTime;
 }
 
 void Server::HandleOutstandingUpdatesTimer(void)
@@ -1907,6 +2034,42 @@ void Server::UpdateResponseCounters(Dns::UpdateHeader::Response aResponseCode)
     }
 }
 
+void Server::UpdateLatencyStats(const Host &aHost)
+{
+    // The average latency is tracked as an exponentially weighted
+    // moving average with a weight of 1/8 for the new sample.
+
+    uint32_t latency = TimerMilli::GetNow() - aHost.GetUpdateTime();
+
+    mUpdateStats.mMaxLatency = Max(mUpdateStats.mMaxLatency, latency);
+
+    if (mUpdateStats.mAvgLatency == 0)
+    {
+        mUpdateStats.mAvgLatency = latency;
+    }
+    else
+    {
+        mUpdateStats.mAvgLatency = static_cast<uint32_t>((7ull * mUpdateStats.mAvgLatency + latency) / 8);
+    }
+}
+
+uint16_t Server::CountPendingUpdates(void) const
+{
+    uint32_t count = mOutstandingUpdates.CountAllEntries() + mCompletedUpdates.CountAllEntries();
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
+    count += Get<AdvertisingProxy>().CountOutstandingAdvs();
+#endif
+
+    return ClampToUint16(count);
+}
+
+void Server::GetUpdateStats(otSrpServerUpdateStats &aStats) const
+{
+    aStats             = mUpdateStats;
+    aStats.mNumPending = CountPendingUpdates();
+}
+
 #if OPENTHREAD_FTD
 void Server::UpdateAddrResolverCacheTable(const Ip6::MessageInfo &aMessageInfo, const Host &aHost)
 {
@@ -228,11 +228,12 @@ public:
     protected:
         LeaseTracker(void) = default;
 
-        void  Init(TimeMilli aUpdateTime);
-        void  SetTtl(uint32_t aTtl) { mTtl = aTtl; }
-        void  SetLease(uint32_t aLease) { mLease = aLease; }
-        void  SetKeyLease(uint32_t aKeyLease) { mKeyLease = aKeyLease; }
-        Error ProcessTtl(uint32_t aTtl);
+        void      Init(TimeMilli aUpdateTime);
+        TimeMilli GetUpdateTime(void) const { return mUpdateTime; }
+        void      SetTtl(uint32_t aTtl) { mTtl = aTtl; }
+        void      SetLease(uint32_t aLease) { mLease = aLease; }
+        void      SetKeyLease(uint32_t aKeyLease) { mKeyLease = aKeyLease; }
+        Error     ProcessTtl(uint32_t aTtl);
 
     private:
         uint32_t  mLease;
@@ -797,6 +798,27 @@ public:
      */
     Error SetLeaseConfig(const LeaseConfig &aLeaseConfig);
 
+    /**
+     * Gets the refresh window interval.
+     *
+     * @returns The refresh window interval in seconds. Zero indicates refresh windows are disabled.
+     */
+    uint32_t GetRefreshWindow(void) const { return Time::MsecToSec(mRefreshWindow); }
+
+    /**
+     * Sets the refresh window interval.
+     *
+     * When non-zero, lease expirations are processed in batches at the start of each window, and a Refresh Window
+     * Option is included in the SRP update responses. Changing the interval restarts the windows from the current
+     * time and reschedules the lease expiration processing. Setting the current interval again has no effect.
+     *
+     * @param[in] aWindow   The refresh window interval in seconds. Zero to disable.
+     *
+     * @retval kErrorNone         Successfully set the refresh window interval.
+     * @retval kErrorInvalidArgs  The @p aWindow is too long.
+     */
+    Error SetRefreshWindow(uint32_t aWindow);
+
     /**
      * Returns the `Host` linked list.
      *
@@ -820,6 +842,13 @@ public:
      */
     const otSrpServerResponseCounters *GetResponseCounters(void) const { return &mResponseCounters; }
 
+    /**
+     * Gets the SRP update processing statistics.
+     *
+     * @param[out] aStats  A reference to output the statistics.
+     */
+    void GetUpdateStats(otSrpServerUpdateStats &aStats) const;
+
     /**
      * Receives the service update result from service handler set by
      * SetServiceHandler.
@@ -841,6 +870,10 @@ private:
     static constexpr uint32_t kDefaultMinTtl               = kDefaultMinLease;
     static constexpr uint32_t kDefaultMaxTtl               = kDefaultMaxLease;
     static constexpr uint32_t kDefaultEventsHandlerTimeout = OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT;
+    static constexpr uint32_t kDefaultRefreshWindow = OPENTHREAD_CONFIG_SRP_SERVER_DEFAULT_REFRESH_WINDOW; // In sec.
+    static constexpr uint32_t kMaxRefreshWindow     = 3600;                                                // In sec.
+
+    static_assert(kDefaultRefreshWindow <= kMaxRefreshWindow, "SRP_SERVER_DEFAULT_REFRESH_WINDOW is too long");
 
     static constexpr AddressMode kDefaultAddressMode =
         static_cast<AddressMode>(OPENTHREAD_CONFIG_SRP_SERVER_DEFAULT_ADDRESS_MODE);
@@ -975,6 +1008,9 @@ private:
                              const Ip6::MessageInfo  &aMessageInfo);
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void        HandleLeaseTimer(void);
+    void        ScheduleLeaseTimer(TimeMilli aExpireTime);
+    void        UpdateRefreshWindowEpoch(void);
+    TimeMilli   GetNextRefreshWindowStart(TimeMilli aTime) const;
     static void HandleOutstandingUpdatesTimer(Timer &aTimer);
     void        HandleOutstandingUpdatesTimer(void);
     void        ProcessCompletedUpdates(void);
@@ -982,8 +1018,10 @@ private:
     const UpdateMetadata *FindOutstandingUpdate(const MessageMetadata &aMessageMetadata) const;
     static const char    *AddressModeToString(AddressMode aMode);
 
-    void UpdateResponseCounters(Dns::Header::Response aResponseCode);
-    void UpdateAddrResolverCacheTable(const Ip6::MessageInfo &aMessageInfo, const Host &aHost);
+    void     UpdateResponseCounters(Dns::Header::Response aResponseCode);
+    void     UpdateLatencyStats(const Host &aHost);
+    uint16_t CountPendingUpdates(void) const;
+    void     UpdateAddrResolverCacheTable(const Ip6::MessageInfo &aMessageInfo, const Host &aHost);
 
     using LeaseTimer           = TimerMilliIn<Server, &Server::HandleLeaseTimer>;
     using UpdateTimer          = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
@@ -1001,6 +1039,8 @@ private:
 
     LinkedList<Host> mHosts;
     LeaseTimer       mLeaseTimer;
+    uint32_t         mRefreshWindow; // In msec, zero if disabled.
+    TimeMilli        mRefreshWindowEpoch;
 
     UpdateTimer                mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
@@ -1023,6 +1063,7 @@ private:
 #endif
 
     otSrpServerResponseCounters mResponseCounters;
+    otSrpServerUpdateStats      mUpdateStats;
 };
 
 } // namespace Srp
@@ -82,7 +82,12 @@ Error Tcp::Endpoint::Initialize(Instance &aInstance, const otTcpEndpointInitiali
 
     ClearAllBytes(mTimers);
     ClearAllBytes(mSockAddr);
-    mPendingCallbacks = 0;
+    mDataSegmentsSent          = 0;
+    mDataSegmentsRetransmitted = 0;
+    mPendingCallbacks          = 0;
+    mQueuedSegments            = 0;
+    mPacingEnabled             = false;
+    mOutputPaced               = false;
 
     /*
      * Initialize buffers --- formerly in initialize_tcb.
@@ -99,6 +104,7 @@ Error Tcp::Endpoint::Initialize(Instance &aInstance, const otTcpEndpointInitiali
     }
 
     tp.accepted_from = nullptr;
+    tp.cc_algo       = &newreno_cc_algo;
     initialize_tcb(&tp);
 
     /* Note that we do not need to zero-initialize mReceiveLinks. */
@@ -306,6 +312,35 @@ exit:
     return error;
 }
 
+Error Tcp::Endpoint::SetCongestionControl(CongestionControl aCongestionControl)
+{
+    Error         error = kErrorNone;
+    struct tcpcb &tp    = GetTcb();
+
+    switch (aCongestionControl)
+    {
+    case kCongestionControlNewReno:
+        tp.cc_algo = &newreno_cc_algo;
+        break;
+    case kCongestionControlVegas:
+        tp.cc_algo = &vegas_cc_algo;
+        break;
+    default:
+        ExitNow(error = kErrorInvalidArgs);
+    }
+
+    // Start a new round of RTT measurement for the new algorithm.
+    tp.cc_rtt_mark = tp.snd_max;
+
+exit:
+    return error;
+}
+
+Tcp::Endpoint::CongestionControl Tcp::Endpoint::GetCongestionControl(void) const
+{
+    return (GetTcb().cc_algo == &vegas_cc_algo) ? kCongestionControlVegas : kCongestionControlNewReno;
+}
+
 bool Tcp::Endpoint::IsClosed(void) const { return GetTcb().t_state == TCP6S_CLOSED; }
 
 uint8_t Tcp::Endpoint::TimerFlagToIndex(uint8_t aTimerFlag)
@@ -474,19 +509,85 @@ void Tcp::Endpoint::PostCallbacksAfterSend(size_t aSent, size_t aBacklogBefore)
 
 bool Tcp::Endpoint::FirePendingCallbacks(void)
 {
-    bool calledUserCallback = false;
+    bool    calledUserCallback = false;
+    uint8_t pendingCallbacks   = mPendingCallbacks;
+
+    mPendingCallbacks = 0;
+
+    if ((pendingCallbacks & kPacedOutputFlag) != 0 && !IsClosed())
+    {
+        tcplp_output(&GetTcb());
+    }
 
-    if ((mPendingCallbacks & kForwardProgressCallbackFlag) != 0 && mForwardProgressCallback != nullptr)
+    if ((pendingCallbacks & kForwardProgressCallbackFlag) != 0 && mForwardProgressCallback != nullptr)
     {
         mForwardProgressCallback(this, GetSendBufferBytes(), GetBacklogBytes());
         calledUserCallback = true;
     }
 
-    mPendingCallbacks = 0;
-
     return calledUserCallback;
 }
 
+bool Tcp::Endpoint::ShouldPaceOutput(void)
+{
+    bool shouldPace = mPacingEnabled && (mQueuedSegments >= OPENTHREAD_CONFIG_TCP_PACING_MAX_QUEUED_SEGMENTS);
+
+    if (shouldPace)
+    {
+        // Output is resumed once a queued segment is sent.
+        mOutputPaced = true;
+    }
+
+    return shouldPace;
+}
+
+void Tcp::Endpoint::HandleDataSegment(Message &aMessage, bool aRetransmit)
+{
+    mDataSegmentsSent++;
+
+    if (aRetransmit)
+    {
+        mDataSegmentsRetransmitted++;
+    }
+
+    // The segments are tracked even if pacing is disabled, so that the
+    // count is accurate if it gets enabled later on.
+
+    if (mQueuedSegments < NumericLimits<uint8_t>::kMax)
+    {
+        mQueuedSegments++;
+        aMessage.RegisterTxCallback(HandleDataSegmentTxDone, this);
+    }
+}
+
+void Tcp::Endpoint::HandleDataSegmentTxDone(const otMessage *aMessage, otError aError, void *aContext)
+{
+    // The endpoint may have been deinitialized while the segment was
+    // queued, so it is looked up before being used.
+
+    Tcp      &tcp      = AsCoreType(aMessage).GetInstance().Get<Tcp>();
+    Endpoint &endpoint = *static_cast<Endpoint *>(aContext);
+
+    OT_UNUSED_VARIABLE(aError);
+
+    VerifyOrExit(tcp.IsInitialized(endpoint));
+
+    if (endpoint.mQueuedSegments > 0)
+    {
+        endpoint.mQueuedSegments--;
+    }
+
+    if (endpoint.mOutputPaced && endpoint.mQueuedSegments < OPENTHREAD_CONFIG_TCP_PACING_MAX_QUEUED_SEGMENTS)
+    {
+        endpoint.mOutputPaced = false;
+        endpoint.mPendingCallbacks |= kPacedOutputFlag;
+        tcp.mTasklet.Post();
+    }
+
+exit:
+    return;
+}
+
 size_t Tcp::Endpoint::GetSendBufferBytes(void) const
 {
     const struct tcpcb &tp = GetTcb();
@@ -980,6 +1081,18 @@ void tcplp_sys_send_message(otInstance *aInstance, otMessage *aMessage, otMessag
     IgnoreError(instance.Get<ot::Ip6::Ip6>().SendDatagram(message, info, kProtoTcp));
 }
 
+bool tcplp_sys_output_paced(struct tcpcb *aTcb)
+{
+    Tcp::Endpoint &endpoint = Tcp::Endpoint::FromTcb(*aTcb);
+    return endpoint.ShouldPaceOutput();
+}
+
+void tcplp_sys_output_data_segment(struct tcpcb *aTcb, otMessage *aMessage, bool aRetransmit)
+{
+    Tcp::Endpoint &endpoint = Tcp::Endpoint::FromTcb(*aTcb);
+    endpoint.HandleDataSegment(AsCoreType(aMessage), aRetransmit);
+}
+
 uint32_t tcplp_sys_get_ticks(void) { return TimerMilli::GetNow().GetValue(); }
 
 uint32_t tcplp_sys_get_millis(void) { return TimerMilli::GetNow().GetValue(); }
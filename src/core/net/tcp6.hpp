@@ -68,6 +68,9 @@ void tcplp_sys_set_timer(struct tcpcb *aTcb, uint8_t aTimerFlag, uint32_t aDelay
 
 // NOLINTNEXTLINE(readability-inconsistent-declaration-parameter-name)
 void tcplp_sys_stop_timer(struct tcpcb *aTcb, uint8_t aTimerFlag);
+
+bool tcplp_sys_output_paced(struct tcpcb *aTcb);
+void tcplp_sys_output_data_segment(struct tcpcb *aTcb, otMessage *aMessage, bool aRetransmit);
 }
 
 namespace ot {
@@ -97,6 +100,15 @@ public:
         friend class LinkedList<Endpoint>;
 
     public:
+        /**
+         * Represents a congestion control algorithm.
+         */
+        enum CongestionControl : uint8_t
+        {
+            kCongestionControlNewReno = OT_TCP_CONGESTION_CONTROL_NEW_RENO, ///< Loss-based New Reno.
+            kCongestionControlVegas   = OT_TCP_CONGESTION_CONTROL_VEGAS,    ///< Delay-based.
+        };
+
         /**
          * Initializes a TCP endpoint.
          *
@@ -337,6 +349,68 @@ public:
          */
         Error Deinitialize(void);
 
+        /**
+         * Sets the congestion control algorithm of this Endpoint.
+         *
+         * @sa otTcpSetCongestionControl
+         *
+         * @param[in]  aCongestionControl  The congestion control algorithm.
+         *
+         * @retval kErrorNone         Successfully set the congestion control algorithm.
+         * @retval kErrorInvalidArgs  @p aCongestionControl is not valid.
+         */
+        Error SetCongestionControl(CongestionControl aCongestionControl);
+
+        /**
+         * Gets the congestion control algorithm of this Endpoint.
+         *
+         * @sa otTcpGetCongestionControl
+         *
+         * @returns The congestion control algorithm.
+         */
+        CongestionControl GetCongestionControl(void) const;
+
+        /**
+         * Enables or disables pacing of the new data sent by this Endpoint.
+         *
+         * @sa otTcpSetPacingEnabled
+         *
+         * @param[in]  aEnable  TRUE to enable pacing, FALSE to disable it.
+         */
+        void SetPacingEnabled(bool aEnable) { mPacingEnabled = aEnable; }
+
+        /**
+         * Indicates whether pacing is enabled on this Endpoint.
+         *
+         * @sa otTcpIsPacingEnabled
+         *
+         * @retval TRUE   Pacing is enabled.
+         * @retval FALSE  Pacing is disabled.
+         */
+        bool IsPacingEnabled(void) const { return mPacingEnabled; }
+
+        /**
+         * Gets the number of data segments sent by this Endpoint since it was initialized, including
+         * retransmissions.
+         *
+         * @returns The number of data segments sent.
+         */
+        uint32_t GetDataSegmentsSent(void) const { return mDataSegmentsSent; }
+
+        /**
+         * Gets the number of data segments retransmitted by this Endpoint since it was initialized.
+         *
+         * @returns The number of data segments retransmitted.
+         */
+        uint32_t GetDataSegmentsRetransmitted(void) const { return mDataSegmentsRetransmitted; }
+
+        /**
+         * Gets the number of data segments sent by this Endpoint that are still waiting to be transmitted.
+         *
+         * @returns The number of queued data segments.
+         */
+        uint8_t GetQueuedSegments(void) const { return mQueuedSegments; }
+
         /**
          * Converts a reference to a struct tcpcb to a reference to its
          * enclosing Endpoint.
@@ -361,6 +435,8 @@ public:
     private:
         friend void ::tcplp_sys_set_timer(struct tcpcb *aTcb, uint8_t aTimerFlag, uint32_t aDelay);
         friend void ::tcplp_sys_stop_timer(struct tcpcb *aTcb, uint8_t aTimerFlag);
+        friend bool ::tcplp_sys_output_paced(struct tcpcb *aTcb);
+        friend void ::tcplp_sys_output_data_segment(struct tcpcb *aTcb, otMessage *aMessage, bool aRetransmit);
 
         static constexpr uint8_t kTimerDelack       = 0;
         static constexpr uint8_t kTimerRexmtPersist = 1;
@@ -378,6 +454,10 @@ public:
         void PostCallbacksAfterSend(size_t aSent, size_t aBacklogBefore);
         bool FirePendingCallbacks(void);
 
+        bool        ShouldPaceOutput(void);
+        void        HandleDataSegment(Message &aMessage, bool aRetransmit);
+        static void HandleDataSegmentTxDone(const otMessage *aMessage, otError aError, void *aContext);
+
         size_t GetSendBufferBytes(void) const;
         size_t GetInFlightBytes(void) const;
         size_t GetBacklogBytes(void) const;
@@ -561,6 +641,7 @@ private:
     static constexpr uint8_t kForwardProgressCallbackFlag  = (1 << 2);
     static constexpr uint8_t kReceiveAvailableCallbackFlag = (1 << 3);
     static constexpr uint8_t kDisconnectedCallbackFlag     = (1 << 4);
+    static constexpr uint8_t kPacedOutputFlag              = (1 << 5);
 
     typedef TcpHeader Header;
 
@@ -590,6 +671,7 @@ private:
 } // namespace Ip6
 
 DefineCoreType(otTcpEndpoint, Ip6::Tcp::Endpoint);
+DefineMapEnum(otTcpCongestionControl, Ip6::Tcp::Endpoint::CongestionControl);
 DefineCoreType(otTcpListener, Ip6::Tcp::Listener);
 
 } // namespace ot
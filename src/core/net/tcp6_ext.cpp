@@ -54,6 +54,45 @@ Error TcpCircularSendBuffer::Write(Tcp::Endpoint &aEndpoint,
                                    size_t         aLength,
                                    size_t        &aWritten,
                                    uint32_t       aFlags)
+{
+    const uint8_t *dataIndexable = static_cast<const uint8_t *>(aData);
+    size_t         usedBefore    = mCapacityUsed;
+    size_t         writeIndex    = GetWriteIndex();
+    size_t         bytesUntilWrap;
+    Error          error;
+
+    /*
+     * Handle the case where we don't have enough space to accommodate all of the
+     * provided data.
+     */
+    aLength        = Min(aLength, GetFreeSpace());
+    bytesUntilWrap = mCapacity - writeIndex;
+
+    if (aLength <= bytesUntilWrap)
+    {
+        memcpy(&mDataBuffer[writeIndex], dataIndexable, aLength);
+    }
+    else
+    {
+        memcpy(&mDataBuffer[writeIndex], &dataIndexable[0], bytesUntilWrap);
+        memcpy(&mDataBuffer[0], &dataIndexable[bytesUntilWrap], aLength - bytesUntilWrap);
+    }
+
+    error    = Commit(aEndpoint, aLength, aFlags);
+    aWritten = mCapacityUsed - usedBefore;
+
+    return error;
+}
+
+void TcpCircularSendBuffer::GetWritableSpan(uint8_t *&aData, size_t &aLength) const
+{
+    size_t writeIndex = GetWriteIndex();
+
+    aData   = &mDataBuffer[writeIndex];
+    aLength = Min(mCapacity - writeIndex, GetFreeSpace());
+}
+
+Error TcpCircularSendBuffer::Commit(Tcp::Endpoint &aEndpoint, size_t aLength, uint32_t aFlags)
 {
     Error    error     = kErrorNone;
     size_t   bytesFree = GetFreeSpace();
@@ -61,16 +100,18 @@ Error TcpCircularSendBuffer::Write(Tcp::Endpoint &aEndpoint,
     uint32_t flags = 0;
     size_t   bytesUntilWrap;
 
-    /*
-     * Handle the case where we don't have enough space to accommodate all of the
-     * provided data.
-     */
-    aLength = Min(aLength, bytesFree);
+    if (aLength > bytesFree)
+    {
+        aLength = 0;
+        ExitNow(error = kErrorInvalidArgs);
+    }
+
     VerifyOrExit(aLength != 0);
 
     /*
      * This is a "simplifying" if statement the removes an edge case from the logic
-     * below. It guarantees that a write to an empty buffer will never wrap.
+     * below. It guarantees that a write to an empty buffer will never wrap. It
+     * matches the index that `GetWriteIndex()` returns for an empty buffer.
      */
     if (mCapacityUsed == 0)
     {
@@ -87,7 +128,6 @@ Error TcpCircularSendBuffer::Write(Tcp::Endpoint &aEndpoint,
     bytesUntilWrap = mCapacity - writeIndex;
     if (aLength <= bytesUntilWrap)
     {
-        memcpy(&mDataBuffer[writeIndex], aData, aLength);
         if (writeIndex == 0)
         {
             /*
@@ -126,11 +166,7 @@ Error TcpCircularSendBuffer::Write(Tcp::Endpoint &aEndpoint,
     }
     else
     {
-        const uint8_t *dataIndexable = static_cast<const uint8_t *>(aData);
-        size_t         bytesWrapped  = aLength - bytesUntilWrap;
-
-        memcpy(&mDataBuffer[writeIndex], &dataIndexable[0], bytesUntilWrap);
-        memcpy(&mDataBuffer[0], &dataIndexable[bytesUntilWrap], bytesWrapped);
+        size_t bytesWrapped = aLength - bytesUntilWrap;
 
         /*
          * Because of the "simplifying" if statement at the top, we don't
@@ -155,7 +191,6 @@ Error TcpCircularSendBuffer::Write(Tcp::Endpoint &aEndpoint,
 
 exit:
     mCapacityUsed += aLength;
-    aWritten = aLength;
     return error;
 }
 
@@ -214,6 +249,12 @@ size_t TcpCircularSendBuffer::GetIndex(size_t aStart, size_t aOffsetFromStart) c
     return index;
 }
 
+size_t TcpCircularSendBuffer::GetWriteIndex(void) const
+{
+    // Data written to an empty buffer is placed at its start (see `Commit()`).
+    return (mCapacityUsed == 0) ? 0 : GetIndex(mStartIndex, mCapacityUsed);
+}
+
 } // namespace Ip6
 } // namespace ot
 
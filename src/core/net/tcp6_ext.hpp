@@ -87,6 +87,31 @@ public:
      */
     Error Write(Tcp::Endpoint &aEndpoint, const void *aData, size_t aLength, size_t &aWritten, uint32_t aFlags);
 
+    /**
+     * Gets the contiguous free space at the tail of this TCP circular send buffer.
+     *
+     * @sa otTcpCircularSendBufferGetWritableSpan
+     *
+     * @param[out]  aData    Populated with a pointer to the start of the free space.
+     * @param[out]  aLength  Populated with the length of the contiguous free space at @p aData.
+     */
+    void GetWritableSpan(uint8_t *&aData, size_t &aLength) const;
+
+    /**
+     * Sends out data which has been placed at the tail of this TCP circular send buffer.
+     *
+     * @sa otTcpCircularSendBufferCommit
+     *
+     * @param[in]  aEndpoint  The TCP endpoint on which to send out data.
+     * @param[in]  aLength    The length of the data to send out.
+     * @param[in]  aFlags     Flags specifying options for this operation.
+     *
+     * @retval kErrorNone         Successfully sent out the data.
+     * @retval kErrorInvalidArgs  @p aLength exceeds the free space in the send buffer.
+     * @retval kErrorFailed       Failed to send out the data on the TCP endpoint.
+     */
+    Error Commit(Tcp::Endpoint &aEndpoint, size_t aLength, uint32_t aFlags);
+
     /**
      * Performs circular-send-buffer-specific handling in the otTcpForwardProgress callback.
      *
@@ -124,6 +149,7 @@ public:
 
 private:
     size_t GetIndex(size_t aStart, size_t aOffsetFromStart) const;
+    size_t GetWriteIndex(void) const;
 };
 
 } // namespace Ip6
@@ -200,6 +200,7 @@ Udp::Udp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEphemeralPort(kDynamicPortMin)
 {
+    ClearAllBytes(mSocketBuckets);
 }
 
 Error Udp::AddReceiver(Receiver &aReceiver) { return mReceivers.Add(aReceiver); }
@@ -240,9 +241,27 @@ exit:
     return error;
 }
 
+bool Udp::IsOpen(const SocketHandle &aSocket) const
+{
+    uint8_t bucket = BucketIndexFor(aSocket.GetSockName().mPort);
+    bool    isOpen = false;
+
+    for (const SocketHandle *socket = mSocketBuckets[bucket]; IsInBucket(socket, bucket); socket = socket->GetNext())
+    {
+        if (socket == &aSocket)
+        {
+            isOpen = true;
+            break;
+        }
+    }
+
+    return isOpen;
+}
+
 Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
 {
     Error error = kErrorNone;
+    bool  isOpen;
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     SuccessOrExit(error = Plat::BindToNetif(aSocket));
@@ -252,6 +271,16 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
                      Get<ThreadNetif>().HasUnicastAddress(aSockAddr.GetAddress()),
                  error = kErrorInvalidArgs);
 
+    // The socket is indexed by its port, so it is removed while its
+    // socket name is updated and then added back.
+
+    isOpen = IsOpen(aSocket);
+
+    if (isOpen)
+    {
+        RemoveSocket(aSocket);
+    }
+
     aSocket.mSockName = aSockAddr;
 
     if (!aSocket.IsBound())
@@ -271,6 +300,11 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
     }
 #endif
 
+    if (isOpen)
+    {
+        AddSocket(aSocket);
+    }
+
 exit:
     return error;
 }
@@ -367,13 +401,60 @@ bool Udp::IsPortReserved(uint16_t aPort)
     return aPort == Tmf::kUdpPort || (kSrpServerPortMin <= aPort && aPort <= kSrpServerPortMax);
 }
 
-void Udp::AddSocket(SocketHandle &aSocket) { IgnoreError(mSockets.Add(aSocket)); }
+uint8_t Udp::BucketIndexFor(uint16_t aPort) { return static_cast<uint8_t>((aPort ^ (aPort >> 8)) % kNumSocketBuckets); }
+
+bool Udp::IsInBucket(const SocketHandle *aSocket, uint8_t aBucket)
+{
+    return (aSocket != nullptr) && (BucketIndexFor(aSocket->GetSockName().mPort) == aBucket);
+}
+
+// Open sockets are kept in the single `mSockets` list (which is also
+// exposed through `otUdpGetSockets()`), grouped by the hash bucket of
+// their port and ordered by bucket index. `mSocketBuckets[]` tracks
+// the first socket of each group so a received datagram only walks
+// the sockets sharing its destination port bucket. Within a group the
+// most recently added socket comes first and takes precedence.
+
+void Udp::AddSocket(SocketHandle &aSocket)
+{
+    uint8_t       bucket = BucketIndexFor(aSocket.GetSockName().mPort);
+    SocketHandle *prev   = FindEntryBeforeBucket(bucket);
+
+    if (prev == nullptr)
+    {
+        mSockets.Push(aSocket);
+    }
+    else
+    {
+        mSockets.PushAfter(aSocket, *prev);
+    }
+
+    mSocketBuckets[bucket] = &aSocket;
+}
 
 void Udp::RemoveSocket(SocketHandle &aSocket)
 {
-    SocketHandle *prev;
+    uint8_t       bucket = BucketIndexFor(aSocket.GetSockName().mPort);
+    SocketHandle *prev   = nullptr;
+    SocketHandle *next   = aSocket.GetNext();
+
+    if (mSocketBuckets[bucket] == &aSocket)
+    {
+        prev                   = FindEntryBeforeBucket(bucket);
+        mSocketBuckets[bucket] = IsInBucket(next, bucket) ? next : nullptr;
+    }
+    else
+    {
+        for (prev = mSocketBuckets[bucket]; IsInBucket(prev, bucket); prev = prev->GetNext())
+        {
+            if (prev->GetNext() == &aSocket)
+            {
+                break;
+            }
+        }
 
-    SuccessOrExit(mSockets.Find(aSocket, prev));
+        VerifyOrExit(IsInBucket(prev, bucket));
+    }
 
     mSockets.PopAfter(prev);
     aSocket.SetNext(nullptr);
@@ -382,8 +463,57 @@ exit:
     return;
 }
 
+Udp::SocketHandle *Udp::FindEntryBeforeBucket(uint8_t aBucket)
+{
+    // Returns the last socket of the closest non-empty bucket with a
+    // smaller index, or `nullptr` if `aBucket` group starts at the
+    // list head.
+
+    SocketHandle *entry = nullptr;
+
+    for (uint8_t bucket = aBucket; bucket > 0; bucket--)
+    {
+        entry = mSocketBuckets[bucket - 1];
+
+        if (entry != nullptr)
+        {
+            while (IsInBucket(entry->GetNext(), bucket - 1))
+            {
+                entry = entry->GetNext();
+            }
+
+            break;
+        }
+    }
+
+    return entry;
+}
+
+Udp::SocketHandle *Udp::FindSocket(const MessageInfo &aMessageInfo)
+{
+    uint8_t       bucket = BucketIndexFor(aMessageInfo.GetSockPort());
+    SocketHandle *socket;
+
+    for (socket = mSocketBuckets[bucket]; IsInBucket(socket, bucket); socket = socket->GetNext())
+    {
+        if (socket->Matches(aMessageInfo))
+        {
+            ExitNow();
+        }
+    }
+
+    socket = nullptr;
+
+exit:
+    return socket;
+}
+
 uint16_t Udp::GetEphemeralPort(void)
 {
+    // Ports are allocated sequentially from the dynamic range,
+    // skipping reserved ports and ports already bound by an open
+    // socket (a lookup in the port's bucket).
+
     do
     {
         if (mEphemeralPort < kDynamicPortMax)
@@ -394,7 +524,7 @@ uint16_t Udp::GetEphemeralPort(void)
         {
             mEphemeralPort = kDynamicPortMin;
         }
-    } while (IsPortReserved(mEphemeralPort));
+    } while (IsPortReserved(mEphemeralPort) || IsPortInUse(mEphemeralPort));
 
     return mEphemeralPort;
 }
@@ -459,7 +589,7 @@ void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
     SocketHandle *socket;
 
-    socket = mSockets.FindMatching(aMessageInfo);
+    socket = FindSocket(aMessageInfo);
     VerifyOrExit(socket != nullptr);
 
     aMessage.RemoveHeader(aMessage.GetOffset());
@@ -470,7 +600,22 @@ exit:
     return;
 }
 
-bool Udp::IsPortInUse(uint16_t aPort) const { return mSockets.ContainsMatching(aPort); }
+bool Udp::IsPortInUse(uint16_t aPort) const
+{
+    uint8_t bucket = BucketIndexFor(aPort);
+    bool    inUse  = false;
+
+    for (const SocketHandle *socket = mSocketBuckets[bucket]; IsInBucket(socket, bucket); socket = socket->GetNext())
+    {
+        if (socket->Matches(aPort))
+        {
+            inUse = true;
+            break;
+        }
+    }
+
+    return inUse;
+}
 
 } // namespace Ip6
 } // namespace ot
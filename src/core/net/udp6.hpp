@@ -49,6 +49,9 @@
 #include "net/ip6_headers.hpp"
 
 namespace ot {
+
+class UnitTester;
+
 namespace Ip6 {
 
 class Udp;
@@ -82,6 +85,8 @@ enum NetifIdentifier : uint8_t
  */
 class Udp : public InstanceLocator, public MessageAllocator<Udp, ReservedHeaderSize::kUdpMessage>, private NonCopyable
 {
+    friend class ot::UnitTester;
+
 public:
     typedef otUdpReceive ReceiveHandler; ///< Receive handler callback.
 
@@ -413,7 +418,7 @@ public:
      *
      * @returns If the UDP socket is open.
      */
-    bool IsOpen(const SocketHandle &aSocket) const { return mSockets.Contains(aSocket); }
+    bool IsOpen(const SocketHandle &aSocket) const;
 
     /**
      * Binds a UDP socket.
@@ -534,6 +539,9 @@ private:
     static constexpr uint16_t kSrpServerPortMin = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MIN;
     static constexpr uint16_t kSrpServerPortMax = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MAX;
 
+    // Number of port hash buckets used to index `mSockets`.
+    static constexpr uint8_t kNumSocketBuckets = 16;
+
     typedef UdpHeader Header;
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
@@ -550,14 +558,19 @@ private:
     };
 #endif
 
-    static bool IsPortReserved(uint16_t aPort);
+    static bool    IsPortReserved(uint16_t aPort);
+    static uint8_t BucketIndexFor(uint16_t aPort);
+    static bool    IsInBucket(const SocketHandle *aSocket, uint8_t aBucket);
 
-    void AddSocket(SocketHandle &aSocket);
-    void RemoveSocket(SocketHandle &aSocket);
+    void          AddSocket(SocketHandle &aSocket);
+    void          RemoveSocket(SocketHandle &aSocket);
+    SocketHandle *FindEntryBeforeBucket(uint8_t aBucket);
+    SocketHandle *FindSocket(const MessageInfo &aMessageInfo);
 
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
+    SocketHandle            *mSocketBuckets[kNumSocketBuckets];
 #if OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE
     Callback<otUdpForwarder> mUdpForwarder;
 #endif
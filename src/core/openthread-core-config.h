@@ -100,10 +100,12 @@
 #include "config/net_diag.h"
 #include "config/netdata_publisher.h"
 #include "config/p2p.h"
+#include "config/packet_latency_tracker.h"
 #include "config/parent_search.h"
 #include "config/ping_sender.h"
 #include "config/platform.h"
 #include "config/power_calibration.h"
+#include "config/profiler.h"
 #include "config/radio_link.h"
 #include "config/secure_transport.h"
 #include "config/sntp_client.h"
@@ -333,6 +333,10 @@ Error IndirectSender::PrepareFrameForChild(Mac::TxFrame &aFrame, FrameContext &a
 
     VerifyOrExit(mEnabled, error = kErrorAbort);
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    aContext.mPrepareStartTime = Utils::PacketLatencyTracker::GetNow();
+#endif
+
     aChild.GetMacAddress(macAddrs.mDestination);
 
     message = aChild.GetIndirectMessage();
@@ -367,6 +371,11 @@ Error IndirectSender::PrepareFrameForChild(Mac::TxFrame &aFrame, FrameContext &a
 
     message->SetOffset(directTxOffset);
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    aContext.mTxStartTime = Get<Utils::PacketLatencyTracker>().HandleFramePrepared(
+        *message, Utils::PacketLatencyTracker::kTxModeIndirect, aContext.mPrepareStartTime);
+#endif
+
     // Set `FramePending` if there are more queued messages (excluding
     // the current one being sent out) for the child (note `> 1` check).
     // The case where the current message itself requires fragmentation
@@ -410,6 +419,15 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
 
     VerifyOrExit(nextOffset != 0);
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    if ((message != nullptr) && (message->GetType() == Message::kTypeIp6))
+    {
+        Get<Utils::PacketLatencyTracker>().HandleFrameSent(*message, Utils::PacketLatencyTracker::kTxModeIndirect,
+                                                           (aChild.GetIndirectFragmentOffset() == 0),
+                                                           aContext.mPrepareStartTime, aContext.mTxStartTime);
+    }
+#endif
+
     switch (aError)
     {
     case kErrorNone:
@@ -500,6 +518,11 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
 
         message->InvokeTxCallback(txError);
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+        Get<Utils::PacketLatencyTracker>().HandleMessageSent(*message, Utils::PacketLatencyTracker::kTxModeIndirect,
+                                                             txError);
+#endif
+
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
         if (aFrame.IsEmpty())
         {
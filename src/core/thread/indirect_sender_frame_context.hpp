@@ -75,6 +75,10 @@ public:
 
     private:
         uint16_t mMessageNextOffset; ///< The next offset into the message associated with the prepared frame.
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+        uint32_t mPrepareStartTime; ///< The time the frame preparation started (latency tracker time).
+        uint32_t mTxStartTime;      ///< The time the prepared frame was handed to the MAC (latency tracker time).
+#endif
     };
 };
 
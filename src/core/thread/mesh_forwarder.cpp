@@ -70,6 +70,10 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mSendMessage(nullptr)
     , mMeshSource()
     , mMeshDest()
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    , mLatencyPrepareStartTime(0)
+    , mLatencyTxStartTime(0)
+#endif
     , mAddMeshHeader(false)
     , mEnabled(false)
     , mTxPaused(false)
@@ -654,6 +658,10 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     VerifyOrExit(mEnabled && (mSendMessage != nullptr));
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    mLatencyPrepareStartTime = Utils::PacketLatencyTracker::GetNow();
+#endif
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     frame = &Get<RadioSelector>().SelectRadio(*mSendMessage, mMacAddrs.mDestination, aTxFrames);
 
@@ -732,6 +740,11 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     frame->SetIsARetransmission(false);
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    mLatencyTxStartTime = Get<Utils::PacketLatencyTracker>().HandleFramePrepared(
+        *mSendMessage, Utils::PacketLatencyTracker::kTxModeDirect, mLatencyPrepareStartTime);
+#endif
+
 exit:
     return frame;
 }
@@ -875,6 +888,12 @@ void MeshForwarder::UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDes
 
     OT_ASSERT(mSendMessage->IsDirectTransmission());
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    Get<Utils::PacketLatencyTracker>().HandleFrameSent(*mSendMessage, Utils::PacketLatencyTracker::kTxModeDirect,
+                                                       (mSendMessage->GetOffset() == 0), mLatencyPrepareStartTime,
+                                                       mLatencyTxStartTime);
+#endif
+
     if (aFrameTxError != kErrorNone)
     {
         // If the transmission of any fragment frame fails,
@@ -924,6 +943,11 @@ void MeshForwarder::UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDes
     Get<HistoryTracker::Local>().RecordTxMessage(*mSendMessage, aMacDest, mSendMessage->GetTxSuccess());
 #endif
 
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    Get<Utils::PacketLatencyTracker>().HandleMessageSent(*mSendMessage, Utils::PacketLatencyTracker::kTxModeDirect,
+                                                         txError);
+#endif
+
     LogMessage(kMessageTransmit, *mSendMessage, txError, &aMacDest);
     FinalizeMessageDirectTx(*mSendMessage, txError);
     RemoveMessageIfNoPendingTx(*mSendMessage);
@@ -1005,23 +1029,22 @@ exit:
     return error;
 }
 
-void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
+void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame, const Mac::RxFrame::HeaderView &aHeaderView)
 {
     Error  error = kErrorNone;
     RxInfo rxInfo(GetInstance());
 
     VerifyOrExit(mEnabled, error = kErrorInvalidState);
 
-    SuccessOrExit(error = aFrame.GetPayload(rxInfo.mFrameData));
-
-    SuccessOrExit(error = aFrame.GetSrcAddr(rxInfo.mMacAddrs.mSource));
-    SuccessOrExit(error = aFrame.GetDstAddr(rxInfo.mMacAddrs.mDestination));
+    rxInfo.mFrameData             = aHeaderView.GetPayload();
+    rxInfo.mMacAddrs.mSource      = aHeaderView.GetSrcAddr();
+    rxInfo.mMacAddrs.mDestination = aHeaderView.GetDstAddr();
 
-    rxInfo.mLinkInfo.SetFrom(aFrame);
+    rxInfo.mLinkInfo.SetFrom(aFrame, aHeaderView);
 
     Get<SupervisionListener>().UpdateOnReceive(rxInfo.mMacAddrs.mSource, rxInfo.IsLinkSecurityEnabled());
 
-    switch (aFrame.GetType())
+    switch (aHeaderView.GetType())
     {
     case Mac::Frame::kTypeData:
         if (Lowpan::MeshHeader::IsMeshHeader(rxInfo.mFrameData))
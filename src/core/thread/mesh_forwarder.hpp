@@ -456,7 +456,7 @@ private:
     Error RemoveUnsecureReassemblyMessage(EvictReason aEvictReason);
     void  HandleDiscoverComplete(void);
 
-    void          HandleReceivedFrame(Mac::RxFrame &aFrame);
+    void          HandleReceivedFrame(Mac::RxFrame &aFrame, const Mac::RxFrame::HeaderView &aHeaderView);
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
     Neighbor     *UpdateNeighborOnSentFrame(Mac::TxFrame       &aFrame,
                                             Error               aError,
@@ -554,6 +554,10 @@ private:
     Mac::Addresses mMacAddrs;
     uint16_t       mMeshSource;
     uint16_t       mMeshDest;
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    uint32_t mLatencyPrepareStartTime;
+    uint32_t mLatencyTxStartTime;
+#endif
     bool           mAddMeshHeader : 1;
     bool           mEnabled : 1;
     bool           mTxPaused : 1;
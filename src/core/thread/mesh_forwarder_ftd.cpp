@@ -48,6 +48,9 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
     message.SetOffset(0);
     message.SetDatagramTag(0);
     message.SetTimestampToNow();
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    Get<Utils::PacketLatencyTracker>().HandleEnqueue(message);
+#endif
     mSendQueue.Enqueue(message);
 
     switch (message.GetType())
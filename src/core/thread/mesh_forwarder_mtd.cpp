@@ -35,6 +35,8 @@
 
 #if OPENTHREAD_MTD
 
+#include "instance/instance.hpp"
+
 namespace ot {
 
 void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
@@ -45,6 +47,9 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
     message.SetOffset(0);
     message.SetDatagramTag(0);
     message.SetTimestampToNow();
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    Get<Utils::PacketLatencyTracker>().HandleEnqueue(message);
+#endif
 
     mSendQueue.Enqueue(message);
     mScheduleTransmissionTask.Post();
@@ -35,19 +35,19 @@
 
 namespace ot {
 
-void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame)
+void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame, const Mac::RxFrame::HeaderView &aHeaderView)
 {
     Clear();
 
-    if (kErrorNone != aFrame.GetSrcPanId(mPanId))
+    if (kErrorNone != aHeaderView.GetSrcPanId(mPanId))
     {
-        IgnoreError(aFrame.GetDstPanId(mPanId));
+        IgnoreError(aHeaderView.GetDstPanId(mPanId));
     }
 
     {
         Mac::PanId dstPanId;
 
-        if (kErrorNone != aFrame.GetDstPanId(dstPanId))
+        if (kErrorNone != aHeaderView.GetDstPanId(dstPanId))
         {
             dstPanId = mPanId;
         }
@@ -55,7 +55,7 @@ void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame)
         mIsDstPanIdBroadcast = (dstPanId == Mac::kPanIdBroadcast);
     }
 
-    mLinkSecurity = aFrame.IsSecuredWith(Mac::RxFrame::kAllowKeyIdMode0 | Mac::RxFrame::kAllowKeyIdMode1);
+    mLinkSecurity = aHeaderView.IsSecuredWith(Mac::RxFrame::kAllowKeyIdMode0 | Mac::RxFrame::kAllowKeyIdMode1);
     mChannel      = aFrame.GetChannel();
     mRss          = aFrame.GetRssi();
     mLqi          = aFrame.GetLqi();
@@ -113,9 +113,10 @@ public:
     /**
      * Sets the `ThreadLinkInfo` from a given received frame.
      *
-     * @param[in] aFrame  A received frame.
+     * @param[in] aFrame       A received frame.
+     * @param[in] aHeaderView  The parsed MAC header of @p aFrame.
      */
-    void SetFrom(const Mac::RxFrame &aFrame);
+    void SetFrom(const Mac::RxFrame &aFrame, const Mac::RxFrame::HeaderView &aHeaderView);
 };
 
 DefineCoreType(otThreadLinkInfo, ThreadLinkInfo);
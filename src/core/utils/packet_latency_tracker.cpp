@@ -0,0 +1,202 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the packet latency tracker.
+ */
+
+#include "packet_latency_tracker.hpp"
+
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
+#include "common/timer.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+namespace Utils {
+
+//---------------------------------------------------------------------------------------------------------------------
+// PacketLatencyTracker
+
+PacketLatencyTracker::PacketLatencyTracker(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+    Reset();
+}
+
+uint32_t PacketLatencyTracker::GetNow(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    return TimerMicro::GetNow().GetValue();
+#else
+    return TimerMilli::GetNow().GetValue() * 1000u;
+#endif
+}
+
+void PacketLatencyTracker::Reset(void)
+{
+    for (auto &stageHistograms : mHistograms)
+    {
+        for (auto &priorityHistograms : stageHistograms)
+        {
+            for (Histogram &histogram : priorityHistograms)
+            {
+                histogram.Clear();
+            }
+        }
+    }
+}
+
+bool PacketLatencyTracker::ShouldTrack(const Message &aMessage)
+{
+    return (aMessage.GetType() == Message::kTypeIp6) || (aMessage.GetType() == Message::kType6lowpan);
+}
+
+void PacketLatencyTracker::HandleIp6Start(Message &aMessage)
+{
+    VerifyOrExit(ShouldTrack(aMessage));
+    aMessage.StartLatencyTrace(GetNow());
+
+exit:
+    return;
+}
+
+void PacketLatencyTracker::HandleEnqueue(Message &aMessage)
+{
+    uint32_t now = GetNow();
+
+    VerifyOrExit(ShouldTrack(aMessage));
+
+    aMessage.StartLatencyTrace(now);
+    aMessage.SetLatencyTraceQueueTime(now);
+
+exit:
+    return;
+}
+
+uint32_t PacketLatencyTracker::HandleFramePrepared(const Message &aMessage, TxMode aTxMode, uint32_t aPrepareStart)
+{
+    uint32_t now = GetNow();
+
+    VerifyOrExit(aMessage.IsLatencyTraceStarted());
+    Record(kStageLowpan, aMessage, aTxMode, aPrepareStart, now);
+
+exit:
+    return now;
+}
+
+void PacketLatencyTracker::HandleFrameSent(const Message &aMessage,
+                                           TxMode         aTxMode,
+                                           bool           aIsFirstFrame,
+                                           uint32_t       aPrepareStart,
+                                           uint32_t       aTxStart)
+{
+    VerifyOrExit(aMessage.IsLatencyTraceStarted());
+
+    // For an indirect message queued for multiple sleepy children,
+    // the IPv6 and queue stages are recorded for each child. The
+    // queue stage of an indirect message also includes the wait
+    // for the data polls of any earlier failed tx attempts.
+
+    if (aIsFirstFrame)
+    {
+        Record(kStageIp6, aMessage, aTxMode, aMessage.GetLatencyTraceStartTime(), aMessage.GetLatencyTraceQueueTime());
+        Record(kStageQueue, aMessage, aTxMode, aMessage.GetLatencyTraceQueueTime(), aPrepareStart);
+    }
+
+    Record(kStageMac, aMessage, aTxMode, aTxStart, GetNow());
+
+exit:
+    return;
+}
+
+void PacketLatencyTracker::HandleMessageSent(const Message &aMessage, TxMode aTxMode, Error aError)
+{
+    VerifyOrExit(aMessage.IsLatencyTraceStarted() && (aError == kErrorNone));
+    Record(kStageEndToEnd, aMessage, aTxMode, aMessage.GetLatencyTraceStartTime(), GetNow());
+
+exit:
+    return;
+}
+
+void PacketLatencyTracker::Record(Stage          aStage,
+                                  const Message &aMessage,
+                                  TxMode         aTxMode,
+                                  uint32_t       aStart,
+                                  uint32_t       aEnd)
+{
+    // The unsigned subtraction handles the wrap of the time values.
+    mHistograms[aStage][aMessage.GetPriority()][aTxMode].Record(aEnd - aStart);
+}
+
+Error PacketLatencyTracker::GetHistogram(Stage aStage, uint8_t aPriority, TxMode aTxMode, Histogram &aHistogram) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((aStage < kNumStages) && (aPriority < kNumPriorities) && (aTxMode < kNumTxModes),
+                 error = kErrorInvalidArgs);
+
+    aHistogram = mHistograms[aStage][aPriority][aTxMode];
+
+exit:
+    return error;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// PacketLatencyTracker::Histogram
+
+void PacketLatencyTracker::Histogram::Record(uint32_t aLatency)
+{
+    // Upper limits (exclusive) of the histogram buckets in usec. The
+    // last bucket tracks the latencies exceeding all the limits.
+    static const uint32_t kBucketLimits[] = {100, 1000, 5000, 10000, 50000, 100000, 1000000};
+
+    static_assert(GetArrayLength(kBucketLimits) + 1 == OT_PACKET_LATENCY_HISTOGRAM_SIZE,
+                  "kBucketLimits does not match OT_PACKET_LATENCY_HISTOGRAM_SIZE");
+
+    uint8_t bucket = 0;
+
+    while ((bucket < GetArrayLength(kBucketLimits)) && (aLatency >= kBucketLimits[bucket]))
+    {
+        bucket++;
+    }
+
+    mBuckets[bucket]++;
+    mCount++;
+    mTotalLatency += aLatency;
+    mMaxLatency = Max(mMaxLatency, aLatency);
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
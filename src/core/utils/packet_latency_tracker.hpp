@@ -0,0 +1,210 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the packet latency tracker.
+ */
+
+#ifndef OT_CORE_UTILS_PACKET_LATENCY_TRACKER_HPP_
+#define OT_CORE_UTILS_PACKET_LATENCY_TRACKER_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+
+#include <openthread/packet_latency.h>
+
+#include "common/as_core_type.hpp"
+#include "common/clearable.hpp"
+#include "common/error.hpp"
+#include "common/locator.hpp"
+#include "common/message.hpp"
+#include "common/non_copyable.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * Implements the packet latency tracker.
+ *
+ * A message is timestamped when it enters the IPv6 layer and when it is added to the mesh forwarder send queue. The
+ * mesh forwarder and the indirect sender then report when the frames of the message are prepared and sent. From
+ * these, the latency of each stage of the transmit pipeline and the end-to-end latency are recorded in histograms
+ * (kept per stage, message priority and tx mode).
+ *
+ * Only IPv6 and 6LoWPAN (mesh forwarded) messages are tracked.
+ */
+class PacketLatencyTracker : public InstanceLocator, private NonCopyable
+{
+public:
+    /**
+     * Represents a pipeline stage.
+     */
+    enum Stage : uint8_t
+    {
+        kStageIp6      = OT_PACKET_LATENCY_STAGE_IP6,        ///< IPv6 layer.
+        kStageQueue    = OT_PACKET_LATENCY_STAGE_QUEUE,      ///< Waiting in send queue.
+        kStageLowpan   = OT_PACKET_LATENCY_STAGE_LOWPAN,     ///< 6LoWPAN framing.
+        kStageMac      = OT_PACKET_LATENCY_STAGE_MAC,        ///< MAC transmission.
+        kStageEndToEnd = OT_PACKET_LATENCY_STAGE_END_TO_END, ///< End-to-end.
+    };
+
+    /**
+     * Represents a tx mode.
+     */
+    enum TxMode : uint8_t
+    {
+        kTxModeDirect   = OT_PACKET_LATENCY_TX_MODE_DIRECT,   ///< Direct tx.
+        kTxModeIndirect = OT_PACKET_LATENCY_TX_MODE_INDIRECT, ///< Indirect tx to a sleepy child.
+    };
+
+    static constexpr uint8_t kNumStages     = OT_PACKET_LATENCY_NUM_STAGES;     ///< Number of stages.
+    static constexpr uint8_t kNumPriorities = OT_PACKET_LATENCY_NUM_PRIORITIES; ///< Number of priorities.
+    static constexpr uint8_t kNumTxModes    = 2;                                ///< Number of tx modes.
+
+    /**
+     * Represents a latency histogram.
+     */
+    class Histogram : public otPacketLatencyHistogram, public Clearable<Histogram>
+    {
+        friend class PacketLatencyTracker;
+
+    private:
+        void Record(uint32_t aLatency);
+    };
+
+    /**
+     * Initializes the `PacketLatencyTracker`.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     */
+    explicit PacketLatencyTracker(Instance &aInstance);
+
+    /**
+     * Gets the current time used for the latency timestamps.
+     *
+     * @returns The current time (in usec).
+     */
+    static uint32_t GetNow(void);
+
+    /**
+     * Marks the entry of a message into the IPv6 layer for transmission or forwarding.
+     *
+     * @param[in] aMessage  The message.
+     */
+    void HandleIp6Start(Message &aMessage);
+
+    /**
+     * Marks the addition of a message to the mesh forwarder send queue.
+     *
+     * Starts the latency trace of the message if it is not started already (e.g., a mesh forwarded message).
+     *
+     * @param[in] aMessage  The message.
+     */
+    void HandleEnqueue(Message &aMessage);
+
+    /**
+     * Handles a frame of a message being prepared for transmission.
+     *
+     * May be called multiple times for the same frame, e.g., when an indirect frame is prepared again for a retx.
+     *
+     * @param[in] aMessage       The message.
+     * @param[in] aTxMode        The tx mode.
+     * @param[in] aPrepareStart  The time the frame preparation started (from `GetNow()`).
+     *
+     * @returns The time the frame is handed to the MAC.
+     */
+    uint32_t HandleFramePrepared(const Message &aMessage, TxMode aTxMode, uint32_t aPrepareStart);
+
+    /**
+     * Handles the transmission of a frame of a message being done.
+     *
+     * The IPv6 and queue stages are recorded along with the first frame of the message, since the tx mode is only
+     * known once the message is being sent.
+     *
+     * @param[in] aMessage       The message.
+     * @param[in] aTxMode        The tx mode.
+     * @param[in] aIsFirstFrame  Whether the frame is the first frame of the message.
+     * @param[in] aPrepareStart  The time the (last) preparation of the frame started.
+     * @param[in] aTxStart       The time returned from `HandleFramePrepared()` for the (last) preparation of the frame.
+     */
+    void HandleFrameSent(const Message &aMessage,
+                         TxMode         aTxMode,
+                         bool           aIsFirstFrame,
+                         uint32_t       aPrepareStart,
+                         uint32_t       aTxStart);
+
+    /**
+     * Handles the transmission of all frames of a message being done.
+     *
+     * The end-to-end latency is only recorded if the message was sent successfully.
+     *
+     * @param[in] aMessage  The message.
+     * @param[in] aTxMode   The tx mode.
+     * @param[in] aError    The tx error.
+     */
+    void HandleMessageSent(const Message &aMessage, TxMode aTxMode, Error aError);
+
+    /**
+     * Gets a latency histogram.
+     *
+     * @param[in]  aStage      The stage.
+     * @param[in]  aPriority   The message priority.
+     * @param[in]  aTxMode     The tx mode.
+     * @param[out] aHistogram  A reference to output the histogram.
+     *
+     * @retval kErrorNone         Successfully retrieved the histogram.
+     * @retval kErrorInvalidArgs  @p aStage, @p aPriority, or @p aTxMode is not valid.
+     */
+    Error GetHistogram(Stage aStage, uint8_t aPriority, TxMode aTxMode, Histogram &aHistogram) const;
+
+    /**
+     * Clears all the histograms.
+     */
+    void Reset(void);
+
+private:
+    static bool ShouldTrack(const Message &aMessage);
+
+    void Record(Stage aStage, const Message &aMessage, TxMode aTxMode, uint32_t aStart, uint32_t aEnd);
+
+    Histogram mHistograms[kNumStages][kNumPriorities][kNumTxModes];
+};
+
+} // namespace Utils
+
+DefineMapEnum(otPacketLatencyStage, Utils::PacketLatencyTracker::Stage);
+DefineMapEnum(otPacketLatencyTxMode, Utils::PacketLatencyTracker::TxMode);
+DefineCoreType(otPacketLatencyHistogram, Utils::PacketLatencyTracker::Histogram);
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+
+#endif // OT_CORE_UTILS_PACKET_LATENCY_TRACKER_HPP_
@@ -0,0 +1,197 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the main-loop profiler.
+ */
+
+#include "profiler.hpp"
+
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+
+#include <openthread/platform/time.h>
+
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+namespace Utils {
+
+//---------------------------------------------------------------------------------------------------------------------
+// Profiler
+
+Profiler::Profiler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mEnabled(OPENTHREAD_CONFIG_PROFILER_ENABLED_BY_DEFAULT)
+{
+    Reset();
+}
+
+void Profiler::Reset(void)
+{
+    mDroppedCount = 0;
+    mMainloopStats.Clear();
+
+    for (HandlerStats &entry : mHandlers)
+    {
+        entry.Clear();
+    }
+}
+
+uint64_t Profiler::GetNow(void) { return otPlatTimeGet(); }
+
+Error Profiler::GetNextHandlerStats(Iterator &aIterator, HandlerStats &aStats) const
+{
+    Error error = kErrorNotFound;
+
+    for (; aIterator < kMaxHandlers; aIterator++)
+    {
+        if (mHandlers[aIterator].IsInUse())
+        {
+            aStats = mHandlers[aIterator];
+            aIterator++;
+            error = kErrorNone;
+            break;
+        }
+    }
+
+    return error;
+}
+
+void Profiler::RecordPlatformHandler(const char *aName, uint32_t aDuration)
+{
+    VerifyOrExit(mEnabled && (aName != nullptr));
+    RecordHandler(kTypePlatform, reinterpret_cast<uintptr_t>(aName), aName, aDuration);
+
+exit:
+    return;
+}
+
+void Profiler::RecordMainloopIteration(uint32_t aDuration)
+{
+    VerifyOrExit(mEnabled);
+    mMainloopStats.Record(aDuration);
+
+exit:
+    return;
+}
+
+void Profiler::RecordHandler(HandlerType aType, uintptr_t aHandler, const char *aName, uint32_t aDuration)
+{
+    // Handlers are stored in an open-addressing hash table keyed by
+    // the handler address, using linear probing. Entries are never
+    // removed (other than by `Reset()`), so the first unused entry
+    // along the probe sequence ends the search.
+
+    uint16_t index = static_cast<uint16_t>(((aHandler >> 2) ^ (aHandler >> 12)) % kMaxHandlers);
+
+    for (uint16_t probes = 0; probes < kMaxHandlers; probes++)
+    {
+        HandlerStats &entry = mHandlers[index];
+
+        if (!entry.IsInUse())
+        {
+            entry.mType    = static_cast<otProfilerHandlerType>(aType);
+            entry.mHandler = aHandler;
+            entry.mName    = aName;
+        }
+
+        if (entry.Matches(aType, aHandler))
+        {
+            entry.Record(aDuration);
+            ExitNow();
+        }
+
+        index = (index + 1 < kMaxHandlers) ? index + 1 : 0;
+    }
+
+    mDroppedCount++;
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Profiler::HandlerSample
+
+Profiler::HandlerSample::~HandlerSample(void)
+{
+    VerifyOrExit(mStarted);
+    mProfiler.RecordHandler(mType, mHandler, nullptr, ClampToUint32(GetNow() - mStartTime));
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Profiler::HandlerStats
+
+bool Profiler::HandlerStats::Matches(HandlerType aType, uintptr_t aHandler) const
+{
+    return (mType == static_cast<otProfilerHandlerType>(aType)) && (mHandler == aHandler);
+}
+
+void Profiler::HandlerStats::Record(uint32_t aDuration)
+{
+    mInvokeCount++;
+    mTotalTime += aDuration;
+    mMaxTime = Max(mMaxTime, aDuration);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Profiler::MainloopStats
+
+void Profiler::MainloopStats::Record(uint32_t aDuration)
+{
+    // Upper limits (exclusive) of the histogram buckets in usec. The
+    // last bucket tracks the iterations exceeding all the limits.
+    static const uint32_t kBucketLimits[] = {100, 500, 1000, 5000, 10000, 50000, 100000};
+
+    static_assert(GetArrayLength(kBucketLimits) + 1 == OT_PROFILER_MAINLOOP_HISTOGRAM_SIZE,
+                  "kBucketLimits does not match OT_PROFILER_MAINLOOP_HISTOGRAM_SIZE");
+
+    uint8_t bucket = 0;
+
+    while ((bucket < GetArrayLength(kBucketLimits)) && (aDuration >= kBucketLimits[bucket]))
+    {
+        bucket++;
+    }
+
+    mHistogram[bucket]++;
+    mIterationCount++;
+    mTotalTime += aDuration;
+    mMaxTime = Max(mMaxTime, aDuration);
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PROFILER_ENABLE
@@ -0,0 +1,231 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the main-loop profiler.
+ */
+
+#ifndef OT_CORE_UTILS_PROFILER_HPP_
+#define OT_CORE_UTILS_PROFILER_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+
+#include <openthread/profiler.h>
+
+#include "common/as_core_type.hpp"
+#include "common/clearable.hpp"
+#include "common/error.hpp"
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * Implements the main-loop profiler.
+ *
+ * The profiler keeps per-handler invocation count along with the cumulative and maximum execution time of tasklet,
+ * timer and state-changed callback handlers. Handlers are keyed by their function address in a fixed-size hash table.
+ * It also tracks a histogram of the main-loop iteration latency, which is reported by the platform.
+ */
+class Profiler : public InstanceLocator, private NonCopyable
+{
+public:
+    /**
+     * Represents a handler type.
+     */
+    enum HandlerType : uint8_t
+    {
+        kTypeTasklet              = OT_PROFILER_HANDLER_TYPE_TASKLET,                ///< Tasklet handler.
+        kTypeTimer                = OT_PROFILER_HANDLER_TYPE_TIMER,                  ///< Timer handler.
+        kTypeStateChangedCallback = OT_PROFILER_HANDLER_TYPE_STATE_CHANGED_CALLBACK, ///< State-changed callback.
+        kTypePlatform             = OT_PROFILER_HANDLER_TYPE_PLATFORM,               ///< Platform handler.
+    };
+
+    typedef otProfilerIterator Iterator; ///< Iterator to go over the handler entries.
+
+    /**
+     * Represents the statistics of a handler.
+     */
+    class HandlerStats : public otProfilerHandlerStats, public Clearable<HandlerStats>
+    {
+        friend class Profiler;
+
+    private:
+        bool IsInUse(void) const { return (mInvokeCount != 0); }
+        bool Matches(HandlerType aType, uintptr_t aHandler) const;
+        void Record(uint32_t aDuration);
+    };
+
+    /**
+     * Represents the main-loop iteration latency statistics.
+     */
+    class MainloopStats : public otProfilerMainloopStats, public Clearable<MainloopStats>
+    {
+        friend class Profiler;
+
+    private:
+        void Record(uint32_t aDuration);
+    };
+
+    /**
+     * Measures the execution time of a handler invocation within a scope.
+     *
+     * The measurement starts when the object is constructed and is recorded when it goes out of scope. Nothing is
+     * recorded if the profiler is disabled when the object is constructed.
+     */
+    class HandlerSample : private NonCopyable
+    {
+    public:
+        /**
+         * Starts measuring a handler invocation.
+         *
+         * @tparam HandlerPtrType  The handler function pointer type.
+         *
+         * @param[in] aProfiler  The `Profiler` to record the sample in.
+         * @param[in] aType      The handler type.
+         * @param[in] aHandler   The handler function pointer.
+         */
+        template <typename HandlerPtrType>
+        HandlerSample(Profiler &aProfiler, HandlerType aType, HandlerPtrType aHandler)
+            : mProfiler(aProfiler)
+            , mType(aType)
+            , mHandler(reinterpret_cast<uintptr_t>(aHandler))
+            , mStarted(aProfiler.IsEnabled())
+            , mStartTime(mStarted ? GetNow() : 0)
+        {
+        }
+
+        /**
+         * Stops the measurement and records the handler invocation.
+         */
+        ~HandlerSample(void);
+
+    private:
+        Profiler   &mProfiler;
+        HandlerType mType;
+        uintptr_t   mHandler;
+        bool        mStarted;
+        uint64_t    mStartTime;
+    };
+
+    /**
+     * Initializes the `Profiler`.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     */
+    explicit Profiler(Instance &aInstance);
+
+    /**
+     * Enables or disables recording.
+     *
+     * @param[in] aEnable  TRUE to enable, FALSE to disable.
+     */
+    void SetEnabled(bool aEnable) { mEnabled = aEnable; }
+
+    /**
+     * Indicates whether or not recording is enabled.
+     *
+     * @retval TRUE   The profiler is enabled.
+     * @retval FALSE  The profiler is disabled.
+     */
+    bool IsEnabled(void) const { return mEnabled; }
+
+    /**
+     * Clears all the recorded statistics.
+     */
+    void Reset(void);
+
+    /**
+     * Gets the statistics of the next handler entry.
+     *
+     * @param[in,out] aIterator  The iterator. Set to zero to get the first entry.
+     * @param[out]    aStats     A reference to output the handler statistics.
+     *
+     * @retval kErrorNone      Successfully retrieved the next entry.
+     * @retval kErrorNotFound  No more entries.
+     */
+    Error GetNextHandlerStats(Iterator &aIterator, HandlerStats &aStats) const;
+
+    /**
+     * Gets the number of invocations which were not recorded since the handler table was full.
+     *
+     * @returns The number of dropped invocations.
+     */
+    uint32_t GetDroppedCount(void) const { return mDroppedCount; }
+
+    /**
+     * Gets the main-loop iteration latency statistics.
+     *
+     * @returns The main-loop statistics.
+     */
+    const MainloopStats &GetMainloopStats(void) const { return mMainloopStats; }
+
+    /**
+     * Records an invocation of a platform handler.
+     *
+     * @param[in] aName      The handler name (MUST have static storage duration).
+     * @param[in] aDuration  The execution time (in usec).
+     */
+    void RecordPlatformHandler(const char *aName, uint32_t aDuration);
+
+    /**
+     * Records the latency of a main-loop iteration.
+     *
+     * @param[in] aDuration  The iteration processing time (in usec).
+     */
+    void RecordMainloopIteration(uint32_t aDuration);
+
+private:
+    static constexpr uint16_t kMaxHandlers = OPENTHREAD_CONFIG_PROFILER_MAX_HANDLERS;
+
+    static_assert(kMaxHandlers > 0, "OPENTHREAD_CONFIG_PROFILER_MAX_HANDLERS must be non-zero");
+
+    static uint64_t GetNow(void);
+
+    void RecordHandler(HandlerType aType, uintptr_t aHandler, const char *aName, uint32_t aDuration);
+
+    bool          mEnabled;
+    uint32_t      mDroppedCount;
+    MainloopStats mMainloopStats;
+    HandlerStats  mHandlers[kMaxHandlers];
+};
+
+} // namespace Utils
+
+DefineCoreType(otProfilerHandlerStats, Utils::Profiler::HandlerStats);
+DefineCoreType(otProfilerMainloopStats, Utils::Profiler::MainloopStats);
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PROFILER_ENABLE
+
+#endif // OT_CORE_UTILS_PROFILER_HPP_
@@ -4541,6 +4541,14 @@ enum
     /** Format: `L` (Read-only) */
     SPINEL_PROP_CNTR_IP_RX_FAILURE = SPINEL_PROP_CNTR__BEGIN + 307,
 
+    /// Coalesced unsolicited property update counters
+    /** Format: `LL` (Read-only)
+     *
+     *  `L`: Number of sent coalesced `CMD_PROP_VALUES_ARE` frames.
+     *  `L`: Number of frames saved by coalescing unsolicited property updates.
+     */
+    SPINEL_PROP_CNTR_TX_SPINEL_COALESCED = SPINEL_PROP_CNTR__BEGIN + 308,
+
     /// The message buffer counter info
     /** Format: `SSSSSSSSSSSSSSSS` (Read-only)
      *      `S`, (TotalBuffers)           The number of buffers in the pool.
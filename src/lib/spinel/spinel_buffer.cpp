@@ -33,6 +33,7 @@
 #include "spinel_buffer.hpp"
 
 #include <assert.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 
@@ -700,25 +701,127 @@ bool Buffer::OutFrameHasEnded(void) { return (mReadState == kReadStateDone) || (
 
 uint8_t Buffer::OutFrameReadByte(void)
 {
-    otError error;
     uint8_t retval = kReadByteAfterFrameHasEnded;
 
+    if (!OutFrameHasEnded())
+    {
+        retval = *mReadPointer;
+        OutFrameAdvance(1);
+    }
+
+    return retval;
+}
+
+uint16_t Buffer::OutFrameGetChunk(const uint8_t *&aChunk) const
+{
+    uint16_t length = 0;
+
+    aChunk = mReadPointer;
+
     switch (mReadState)
     {
     case kReadStateNotActive:
         OT_FALL_THROUGH;
 
     case kReadStateDone:
+        aChunk = nullptr;
+        break;
 
-        retval = kReadByteAfterFrameHasEnded;
+    case kReadStateInSegment:
 
+        // Bytes of a frame written in backward direction are
+        // stored in reverse order, so only one byte is contiguous.
+        // In forward direction, the chunk ends at the segment tail
+        // or at the end of `mBuffer` if the segment wraps around.
+
+        if (mReadDirection == kBackward)
+        {
+            length = 1;
+        }
+        else if (mReadSegmentTail > mReadPointer)
+        {
+            length = static_cast<uint16_t>(mReadSegmentTail - mReadPointer);
+        }
+        else
+        {
+            length = static_cast<uint16_t>(mBufferEnd - mReadPointer);
+        }
+
+        break;
+
+    case kReadStateInMessage:
+#if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
+        length = static_cast<uint16_t>(mReadMessageTail - mReadPointer);
+#endif
+        break;
+    }
+
+    return length;
+}
+
+uint16_t Buffer::OutFrameSkip(uint16_t aLength)
+{
+    uint16_t       bytesSkipped = 0;
+    const uint8_t *chunk;
+    uint16_t       chunkLength;
+
+    while ((bytesSkipped < aLength) && !OutFrameHasEnded())
+    {
+        chunkLength = OutFrameGetChunk(chunk);
+
+        if (chunkLength > aLength - bytesSkipped)
+        {
+            chunkLength = aLength - bytesSkipped;
+        }
+
+        OutFrameAdvance(chunkLength);
+        bytesSkipped += chunkLength;
+    }
+
+    return bytesSkipped;
+}
+
+uint16_t Buffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
+{
+    uint16_t       bytesRead = 0;
+    const uint8_t *chunk;
+    uint16_t       chunkLength;
+
+    while ((bytesRead < aReadLength) && !OutFrameHasEnded())
+    {
+        chunkLength = OutFrameGetChunk(chunk);
+
+        if (chunkLength > aReadLength - bytesRead)
+        {
+            chunkLength = aReadLength - bytesRead;
+        }
+
+        memcpy(aDataBuffer + bytesRead, chunk, chunkLength);
+        OutFrameAdvance(chunkLength);
+        bytesRead += chunkLength;
+    }
+
+    return bytesRead;
+}
+
+// This method moves the read pointer forward by `aLength` bytes within the current contiguous chunk (`aLength` MUST
+// not be larger than the length returned from `OutFrameGetChunk()`) and prepares the next segment or message content
+// when the end of the current one is reached.
+void Buffer::OutFrameAdvance(uint16_t aLength)
+{
+    otError error;
+
+    switch (mReadState)
+    {
+    case kReadStateNotActive:
+        OT_FALL_THROUGH;
+
+    case kReadStateDone:
         break;
 
     case kReadStateInSegment:
 
-        // Read a byte from current read pointer and move the read pointer by 1 byte in the read direction.
-        retval       = *mReadPointer;
-        mReadPointer = GetUpdatedBufPtr(mReadPointer, 1, mReadDirection);
+        mReadPointer = GetUpdatedBufPtr(mReadPointer, aLength, mReadDirection);
 
         // Check if at end of current segment.
         if (mReadPointer == mReadSegmentTail)
@@ -741,9 +844,7 @@ uint8_t Buffer::OutFrameReadByte(void)
 
     case kReadStateInMessage:
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
-        // Read a byte from current read pointer and move the read pointer by 1 byte.
-        retval = *mReadPointer;
-        mReadPointer++;
+        mReadPointer += aLength;
 
         // Check if at the end of content in message buffer.
         if (mReadPointer == mReadMessageTail)
@@ -760,20 +861,6 @@ uint8_t Buffer::OutFrameReadByte(void)
 #endif
         break;
     }
-
-    return retval;
-}
-
-uint16_t Buffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
-{
-    uint16_t bytesRead = 0;
-
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
-    {
-        *aDataBuffer++ = OutFrameReadByte();
-    }
-
-    return bytesRead;
 }
 
 otError Buffer::OutFrameRemove(void)
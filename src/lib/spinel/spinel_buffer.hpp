@@ -371,6 +371,37 @@ public:
      */
     uint16_t OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer);
 
+    /**
+     * Gets the next contiguous chunk of bytes from the current output frame without copying them.
+     *
+     * The NCP buffer maintains a read offset for the current output frame being read. This method provides a pointer
+     * to the byte at the read offset along with the number of bytes which can be read contiguously from it. The read
+     * offset itself is not changed, `OutFrameSkip()` should be used to move it forward once the bytes are consumed.
+     *
+     * A chunk never spans more than one segment or appended message. High priority frames are stored in reverse
+     * order in the buffer, so for them a chunk from a segment contains a single byte.
+     *
+     * The returned pointer stays valid until the read offset is changed or the buffer content is modified.
+     *
+     * @param[out] aChunk   A reference to a pointer to output the start of the chunk (`nullptr` if frame has ended).
+     *
+     * @returns The number of bytes in the chunk, or zero if the current output frame has ended or there is no
+     *          prepared/active output frame.
+     */
+    uint16_t OutFrameGetChunk(const uint8_t *&aChunk) const;
+
+    /**
+     * Moves the read offset of the current output frame forward by a given number of bytes.
+     *
+     * If there are fewer bytes remaining in the current frame than the requested @p aLength, the read offset is moved
+     * to the end of the frame.
+     *
+     * @param[in] aLength   Number of bytes to skip.
+     *
+     * @returns The number of bytes skipped.
+     */
+    uint16_t OutFrameSkip(uint16_t aLength);
+
     /**
      * Removes the current or front output frame from the buffer.
      *
@@ -581,6 +612,7 @@ private:
     void    OutFrameSelectReadDirection(void);
     otError OutFramePrepareSegment(void);
     void    OutFrameMoveToNextSegment(void);
+    void    OutFrameAdvance(uint16_t aLength);
 
 #if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
     otError OutFramePrepareMessage(void);
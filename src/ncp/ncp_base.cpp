@@ -281,6 +281,12 @@ NcpBase::NcpBase(Instance *aInstance)
     , mDiscoveryScanPanId(0xffff)
     , mUpdateChangedPropsTask(*aInstance, NcpBase::UpdateChangedProps)
     , mThreadChangedFlags(0)
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+    , mChangedPropsTimer(*aInstance, NcpBase::HandleChangedPropsTimer)
+    , mChangedPropsWindowExpired(false)
+    , mCoalescedChangedPropsFrameCounter(0)
+    , mSavedChangedPropsFrameCounter(0)
+#endif
     , mHostPowerState(SPINEL_HOST_POWER_STATE_ONLINE)
     , mHostPowerReplyFrameTag(Spinel::Buffer::kInvalidTag)
     , mHostPowerStateHeader(0)
@@ -405,6 +411,11 @@ void NcpBase::ResetCounters(void)
     mRxSpinelOutOfOrderTidCounter = 0;
     mTxSpinelFrameCounter         = 0;
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+    mCoalescedChangedPropsFrameCounter = 0;
+    mSavedChangedPropsFrameCounter     = 0;
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     mInboundSecureIpFrameCounter    = 0;
     mInboundInsecureIpFrameCounter  = 0;
@@ -946,6 +957,38 @@ void NcpBase::UpdateChangedProps(void)
 
     VerifyOrExit(!mChangedPropsSet.IsEmpty());
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+    if (mDidInitialUpdates)
+    {
+        // Changes are collected until the coalescing window expires.
+        // They are then packed into as many coalesced frames as
+        // needed, each limited to the max spinel frame size. Any
+        // property which could not be included in a coalesced frame
+        // (e.g., not enough buffer space) is then sent in its own
+        // frame below.
+
+        if (!mChangedPropsWindowExpired)
+        {
+            if (!mChangedPropsTimer.IsRunning())
+            {
+                mChangedPropsTimer.Start(kChangedPropsCoalesceWindow);
+            }
+
+            ExitNow();
+        }
+
+        while (!mChangedPropsSet.IsEmpty())
+        {
+            if (WriteCoalescedChangedPropsFrame(kMaxCoalescedFrameLength) != OT_ERROR_NONE)
+            {
+                break;
+            }
+        }
+
+        VerifyOrExit(!mChangedPropsSet.IsEmpty());
+    }
+#endif
+
     entry = mChangedPropsSet.GetSupportedEntries(numEntries);
 
     for (uint8_t index = 0; index < numEntries; index++, entry++)
@@ -978,9 +1021,141 @@ void NcpBase::UpdateChangedProps(void)
     }
 
 exit:
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+    if (mChangedPropsSet.IsEmpty())
+    {
+        mChangedPropsWindowExpired = false;
+    }
+#endif
+
     mDidInitialUpdates = true;
 }
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+
+void NcpBase::HandleChangedPropsTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+    GetNcpInstance()->HandleChangedPropsTimer();
+}
+
+void NcpBase::HandleChangedPropsTimer(void)
+{
+    mChangedPropsWindowExpired = true;
+    UpdateChangedProps();
+}
+
+bool NcpBase::CanCoalesceChangedProp(uint8_t aIndex) const
+{
+    uint8_t                       numEntries;
+    const ChangedPropsSet::Entry *entries = mChangedPropsSet.GetSupportedEntries(numEntries);
+    spinel_prop_key_t             propKey = entries[aIndex].mPropKey;
+
+    return mChangedPropsSet.IsEntryChanged(aIndex) &&
+           ((propKey == SPINEL_PROP_LAST_STATUS) || (FindGetPropertyHandler(propKey) != nullptr));
+}
+
+otError NcpBase::WriteCoalescedChangedPropsFrame(uint16_t aMaxFrameLength)
+{
+    // Writes changed properties (which have a get handler) along
+    // with any `LAST_STATUS` into a single `PROP_VALUES_ARE` frame.
+    // Each property is encoded as a struct containing the property
+    // key followed by its value. Entries are appended in order until
+    // the next one would make the frame longer than `aMaxFrameLength`.
+    // The included entries are removed from `mChangedPropsSet` only
+    // if the whole frame is written. The remaining ones are left in
+    // the set to be sent later.
+
+    otError                       error    = OT_ERROR_NONE;
+    uint8_t                       numProps = 0;
+    uint8_t                       endIndex;
+    uint8_t                       numEntries;
+    const ChangedPropsSet::Entry *entries = mChangedPropsSet.GetSupportedEntries(numEntries);
+    Spinel::Buffer::WritePosition frameStart;
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        if (CanCoalesceChangedProp(index))
+        {
+            numProps++;
+        }
+    }
+
+    // A single changed property is sent in a regular `VALUE_IS` frame.
+    VerifyOrExit(numProps > 1, error = OT_ERROR_NOT_FOUND);
+
+    numProps = 0;
+    endIndex = numEntries;
+
+    SuccessOrExit(error = mEncoder.BeginFrame(Spinel::Buffer::kPriorityLow));
+    SuccessOrExit(error = mTxFrameBuffer.InFrameGetPosition(frameStart));
+    SuccessOrExit(error = mEncoder.WriteUint8(SPINEL_HEADER_FLAG | SPINEL_HEADER_TX_NOTIFICATION_IID));
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CMD_PROP_VALUES_ARE));
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        spinel_prop_key_t propKey = entries[index].mPropKey;
+
+        if (!CanCoalesceChangedProp(index))
+        {
+            continue;
+        }
+
+        SuccessOrExit(error = mEncoder.SavePosition());
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUintPacked(propKey));
+
+        if (propKey == SPINEL_PROP_LAST_STATUS)
+        {
+            spinel_status_t status = entries[index].mStatus;
+
+            if (status == SPINEL_STATUS_RESET_UNKNOWN)
+            {
+                status = ResetReasonToSpinelStatus(otPlatGetResetReason(mInstance));
+            }
+
+            SuccessOrExit(error = mEncoder.WriteUintPacked(status));
+        }
+        else
+        {
+            SuccessOrExit(error = (this->*FindGetPropertyHandler(propKey))());
+        }
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+
+        if (mTxFrameBuffer.InFrameGetDistance(frameStart) > aMaxFrameLength)
+        {
+            SuccessOrExit(error = mEncoder.ResetToSaved());
+            endIndex = index;
+            break;
+        }
+
+        numProps++;
+    }
+
+    // If even the first entry does not fit, the entries are sent in
+    // their own `VALUE_IS` frames instead.
+    VerifyOrExit(numProps > 0, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+    for (uint8_t index = 0; index < endIndex; index++)
+    {
+        if (CanCoalesceChangedProp(index))
+        {
+            mChangedPropsSet.RemoveEntry(index);
+        }
+    }
+
+    mCoalescedChangedPropsFrameCounter++;
+    mSavedChangedPropsFrameCounter += numProps - 1;
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+
 // ----------------------------------------------------------------------------
 // MARK: Inbound Command Handler
 // ----------------------------------------------------------------------------
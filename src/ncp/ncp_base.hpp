@@ -57,6 +57,7 @@
 
 #include "changed_props_set.hpp"
 #include "common/tasklet.hpp"
+#include "common/timer.hpp"
 #include "instance/instance.hpp"
 #include "lib/spinel/spinel.h"
 #include "lib/spinel/spinel_buffer.hpp"
@@ -471,6 +472,13 @@ protected:
     static void UpdateChangedProps(Tasklet &aTasklet);
     void        UpdateChangedProps(void);
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+    static void HandleChangedPropsTimer(Timer &aTimer);
+    void        HandleChangedPropsTimer(void);
+    bool        CanCoalesceChangedProp(uint8_t aIndex) const;
+    otError     WriteCoalescedChangedPropsFrame(uint16_t aMaxFrameLength);
+#endif
+
     static void HandleFrameRemovedFromNcpBuffer(void                    *aContext,
                                                 Spinel::Buffer::FrameTag aFrameTag,
                                                 Spinel::Buffer::Priority aPriority,
@@ -828,6 +836,16 @@ protected:
     uint32_t        mThreadChangedFlags;
     ChangedPropsSet mChangedPropsSet;
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+    static constexpr uint32_t kChangedPropsCoalesceWindow = OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW;
+    static constexpr uint16_t kMaxCoalescedFrameLength    = SPINEL_FRAME_MAX_SIZE;
+
+    TimerMilli mChangedPropsTimer;
+    bool       mChangedPropsWindowExpired;
+    uint32_t   mCoalescedChangedPropsFrameCounter; // Number of sent coalesced `PROP_VALUES_ARE` frames.
+    uint32_t   mSavedChangedPropsFrameCounter;     // Number of frames saved by coalescing property updates.
+#endif
+
     spinel_host_power_state_t mHostPowerState;
     Spinel::Buffer::FrameTag  mHostPowerReplyFrameTag;
     uint8_t                   mHostPowerStateHeader;
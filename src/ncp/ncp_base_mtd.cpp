@@ -2784,6 +2784,19 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_RX_FAILURE>(v
     return mEncoder.WriteUint32(otThreadGetIp6Counters(mInstance)->mRxFailure);
 }
 
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_SPINEL_COALESCED>(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mEncoder.WriteUint32(mCoalescedChangedPropsFrameCounter));
+    SuccessOrExit(error = mEncoder.WriteUint32(mSavedChangedPropsFrameCounter));
+
+exit:
+    return error;
+}
+#endif
+
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MSG_BUFFER_COUNTERS>(void)
 {
     otError      error = OT_ERROR_NONE;
@@ -147,6 +147,21 @@
 #define OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE 15
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+ *
+ * The coalescing window (in milliseconds) for unsolicited property change notifications.
+ *
+ * When non-zero, property changes happening within the window after a first change are collected and sent to the
+ * host together in a single `SPINEL_CMD_PROP_VALUES_ARE` frame (each property value is encoded as a struct
+ * containing the property key followed by its value). The host driver must support `SPINEL_CMD_PROP_VALUES_ARE`.
+ *
+ * When zero, coalescing is disabled and each changed property is sent in its own `SPINEL_CMD_PROP_VALUE_IS` frame.
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+#define OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
  *
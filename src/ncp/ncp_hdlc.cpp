@@ -109,7 +109,6 @@ NcpHdlc::NcpHdlc(Instance *aInstance, otNcpHdlcSendCallback aSendCallback)
     , mSendCallback(aSendCallback)
     , mFrameEncoder(mHdlcBuffer)
     , mState(kStartingFrame)
-    , mByte(0)
     , mHdlcSendImmediate(false)
     , mHdlcSendTask(*aInstance, EncodeAndSend)
 #if OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
@@ -127,7 +126,6 @@ NcpHdlc::NcpHdlc(Instance **aInstances, uint8_t aCount, otNcpHdlcSendCallback aS
     , mSendCallback(aSendCallback)
     , mFrameEncoder(mHdlcBuffer)
     , mState(kStartingFrame)
-    , mByte(0)
     , mHdlcSendImmediate(false)
     , mHdlcSendTask(*aInstances[0], EncodeAndSend)
 #if OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
@@ -197,15 +195,28 @@ void NcpHdlc::EncodeAndSend(void)
 
             mState = kEncodingFrame;
 
+            OT_FALL_THROUGH;
+
+        case kEncodingFrame:
+
+            // Encode directly from the contiguous chunks of the frame
+            // (segment or message content) and only move the read
+            // offset past the bytes which fit in `mHdlcBuffer`, so
+            // encoding can resume from the same offset later.
+
             while (!txFrameBuffer.OutFrameHasEnded())
             {
-                mByte = txFrameBuffer.OutFrameReadByte();
-
-                OT_FALL_THROUGH;
+                const uint8_t *chunk;
+                uint16_t       chunkLength   = txFrameBuffer.OutFrameGetChunk(chunk);
+                uint16_t       encodedLength = 0;
 
-            case kEncodingFrame:
+                while ((encodedLength < chunkLength) && (mFrameEncoder.Encode(chunk[encodedLength]) == OT_ERROR_NONE))
+                {
+                    encodedLength++;
+                }
 
-                SuccessOrExit(mFrameEncoder.Encode(mByte));
+                IgnoreReturnValue(txFrameBuffer.OutFrameSkip(encodedLength));
+                VerifyOrExit(encodedLength == chunkLength);
             }
 
             // track the change of mHostPowerStateInProgress by the
@@ -383,7 +394,20 @@ otError NcpHdlc::BufferEncrypterReader::OutFrameBegin(void)
 
 bool NcpHdlc::BufferEncrypterReader::OutFrameHasEnded(void) { return (mDataBufferReadIndex >= mOutputDataLength); }
 
-uint8_t NcpHdlc::BufferEncrypterReader::OutFrameReadByte(void) { return mDataBuffer[mDataBufferReadIndex++]; }
+uint16_t NcpHdlc::BufferEncrypterReader::OutFrameGetChunk(const uint8_t *&aChunk) const
+{
+    aChunk = &mDataBuffer[mDataBufferReadIndex];
+
+    return static_cast<uint16_t>(mOutputDataLength - mDataBufferReadIndex);
+}
+
+uint16_t NcpHdlc::BufferEncrypterReader::OutFrameSkip(uint16_t aLength)
+{
+    aLength = static_cast<uint16_t>(Min<size_t>(aLength, mOutputDataLength - mDataBufferReadIndex));
+    mDataBufferReadIndex += aLength;
+
+    return aLength;
+}
 
 otError NcpHdlc::BufferEncrypterReader::OutFrameRemove(void) { return mTxFrameBuffer.OutFrameRemove(); }
 
@@ -107,11 +107,12 @@ private:
          * Takes a reference to Spinel::Buffer in order to read spinel frames.
          */
         explicit BufferEncrypterReader(Spinel::Buffer &aTxFrameBuffer);
-        bool    IsEmpty(void) const;
-        otError OutFrameBegin(void);
-        bool    OutFrameHasEnded(void);
-        uint8_t OutFrameReadByte(void);
-        otError OutFrameRemove(void);
+        bool     IsEmpty(void) const;
+        otError  OutFrameBegin(void);
+        bool     OutFrameHasEnded(void);
+        uint16_t OutFrameGetChunk(const uint8_t *&aChunk) const;
+        uint16_t OutFrameSkip(uint16_t aLength);
+        otError  OutFrameRemove(void);
 
     private:
         void Reset(void);
@@ -141,7 +142,6 @@ private:
     Hdlc::Encoder                          mFrameEncoder;
     Hdlc::Decoder                          mFrameDecoder;
     HdlcTxState                            mState;
-    uint8_t                                mByte;
     Spinel::FrameBuffer<kRxBufferSize>     mRxBuffer;
     bool                                   mHdlcSendImmediate;
     Tasklet                                mHdlcSendTask;
@@ -263,6 +263,34 @@ typedef struct otSysInfraNetIfAddressCounters
  */
 void otSysCountInfraNetifAddresses(otSysInfraNetIfAddressCounters *aAddressCounters);
 
+/**
+ * Represents a multicast route (MFC entry) installed by the Backbone Router and its forwarding counters.
+ */
+typedef struct otSysMulticastRouteInfo
+{
+    otIp6Address mSourceAddress; ///< The source address.
+    otIp6Address mGroupAddress;  ///< The multicast group address.
+    bool         mInbound;       ///< TRUE if the route is from the backbone to Thread, FALSE if from Thread.
+    bool         mForwarding;    ///< TRUE if the route forwards the traffic, FALSE if it blocks the traffic.
+    uint64_t     mPackets;       ///< Number of packets received on the expected interface.
+    uint64_t     mBytes;         ///< Number of bytes received.
+} otSysMulticastRouteInfo;
+
+typedef uint16_t otSysMulticastRouteIterator; ///< Used to iterate through multicast routes.
+
+/**
+ * Gets the next multicast route installed by the Backbone Router along with its forwarding counters.
+ *
+ * Requires `OPENTHREAD_POSIX_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE`.
+ *
+ * @param[in,out] aIterator   A pointer to the iterator. Set to zero to start from the first route.
+ * @param[out]    aRouteInfo  A pointer to output the multicast route info.
+ *
+ * @retval OT_ERROR_NONE       Successfully found the next multicast route.
+ * @retval OT_ERROR_NOT_FOUND  No subsequent multicast route was found.
+ */
+otError otSysGetNextMulticastRoute(otSysMulticastRouteIterator *aIterator, otSysMulticastRouteInfo *aRouteInfo);
+
 /**
  * Sets the infrastructure network interface and the ICMPv6 socket.
  *
@@ -192,6 +192,15 @@ public:
     static Dhcp6PdSocket &GetDhcp6PdSocket(void) { return Get().mDhcp6PdSocket; }
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE
+    /**
+     * Gets the multicast routing manager.
+     *
+     * @returns The `MulticastRoutingManager`.
+     */
+    MulticastRoutingManager &GetMulticastRoutingManager(void) { return mMulticastRoutingManager; }
+#endif
+
     /**
      * Creates a socket for sending/receiving ICMPv6 messages.
      *
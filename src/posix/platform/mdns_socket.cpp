@@ -46,10 +46,14 @@
 #include <sys/ioctl.h>
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+#include <openthread/mdns.h>
+#endif
 #include <openthread/platform/time.h>
 
 #include "ip6_utils.hpp"
 #include "platform-posix.h"
+#include "radio.hpp"
 #include "utils.hpp"
 #include "common/code_utils.hpp"
 
@@ -123,6 +127,9 @@ void MdnsSocket::TearDown(void)
 
     if (mEnabled)
     {
+#if OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+        SaveCacheSnapshot();
+#endif
         ClearTxQueue();
         mEnabled = false;
     }
@@ -230,6 +237,10 @@ otError MdnsSocket::Enable(uint32_t aInfraIfIndex)
 
     StartAddressMonitoring();
 
+#if OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+    RestoreCacheSnapshot();
+#endif
+
     LogInfo("Enabled");
 
 exit:
@@ -258,6 +269,57 @@ void MdnsSocket::Disable(uint32_t aInfraIfIndex)
     LogInfo("Disabled");
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+
+void MdnsSocket::SaveCacheSnapshot(void)
+{
+    otError  error;
+    uint8_t *snapshot = static_cast<uint8_t *>(malloc(kMaxCacheSnapshotLength));
+    uint16_t length   = kMaxCacheSnapshotLength;
+
+    VerifyOrExit(snapshot != nullptr, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = otMdnsSaveCacheSnapshot(mInstance, snapshot, &length));
+
+    GetTmpStorage().SaveMdnsCacheSnapshot(snapshot, length);
+    LogInfo("Saved cache snapshot, len:%u", length);
+
+exit:
+    if ((error != OT_ERROR_NONE) && (error != OT_ERROR_NOT_FOUND))
+    {
+        LogWarn("Failed to save cache snapshot: %s", otThreadErrorToString(error));
+    }
+
+    free(snapshot);
+}
+
+void MdnsSocket::RestoreCacheSnapshot(void)
+{
+    // Restoring the snapshot is done after the socket is enabled.
+    // This is called from `otPlatMdnsSetListeningEnabled()` when the
+    // mDNS module is being enabled (it is already marked as enabled).
+
+    otError  error;
+    uint8_t *snapshot = static_cast<uint8_t *>(malloc(kMaxCacheSnapshotLength));
+    uint16_t length   = kMaxCacheSnapshotLength;
+    uint32_t elapsedTime;
+
+    VerifyOrExit(snapshot != nullptr, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = GetTmpStorage().RestoreMdnsCacheSnapshot(snapshot, length, elapsedTime));
+    SuccessOrExit(error = otMdnsRestoreCacheSnapshot(mInstance, snapshot, length, elapsedTime));
+
+    LogInfo("Restored cache snapshot, len:%u, elapsed:%lu sec", length, ToUlong(elapsedTime));
+
+exit:
+    if ((error != OT_ERROR_NONE) && (error != OT_ERROR_NOT_FOUND))
+    {
+        LogWarn("Failed to restore cache snapshot: %s", otThreadErrorToString(error));
+    }
+
+    free(snapshot);
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+
 void MdnsSocket::SendMulticast(otMessage *aMessage, uint32_t aInfraIfIndex)
 {
     Metadata metadata;
@@ -132,6 +132,9 @@ private:
     static constexpr uint16_t kMaxMessageLength  = 2000;
     static constexpr uint16_t kMdnsPort          = 5353;
     static constexpr uint64_t kAddrMonitorPeriod = OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR_PERIOD;
+#if OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+    static constexpr uint16_t kMaxCacheSnapshotLength = 16 * 1024;
+#endif
 
     enum MsgType : uint8_t
     {
@@ -157,6 +160,10 @@ private:
     void    StartAddressMonitoring(void);
     void    StopAddressMonitoring(void);
     void    ReportInfraIfAddresses(void);
+#if OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+    void SaveCacheSnapshot(void);
+    void RestoreCacheSnapshot(void);
+#endif
 #if (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_PERIODIC)
     void UpdateTimeout(Mainloop::Context &aContext);
     void ProcessTimeout(void);
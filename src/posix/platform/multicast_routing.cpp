@@ -30,11 +30,13 @@
 
 #if OPENTHREAD_POSIX_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE
 
+#include <arpa/inet.h>
 #include <assert.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/in.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -49,15 +51,25 @@
 #include <openthread/logging.h>
 #include <openthread/platform/time.h>
 
+#include "infra_if.hpp"
 #include "utils.hpp"
 #include "common/arg_macros.hpp"
 #include "core/common/debug.hpp"
 
+otError otSysGetNextMulticastRoute(otSysMulticastRouteIterator *aIterator, otSysMulticastRouteInfo *aRouteInfo)
+{
+    OT_ASSERT(aIterator != nullptr && aRouteInfo != nullptr);
+
+    return ot::Posix::InfraNetif::Get().GetMulticastRoutingManager().GetNextRoute(*aIterator, *aRouteInfo);
+}
+
 namespace ot {
 namespace Posix {
 
 const char MulticastRoutingManager::kLogModuleName[] = "McastRtMgr";
 
+const char MulticastRoutingManager::kMulticastForwardingCacheProcFile[] = "/proc/net/ip6_mr_cache";
+
 #define LogResult(aError, ...)                                                                                \
     do                                                                                                        \
     {                                                                                                         \
@@ -222,6 +234,14 @@ void MulticastRoutingManager::Update(Mainloop::Context &aContext)
 
     Mainloop::AddToReadFdSet(mMulticastRouterSock, aContext);
 
+    if (mNextExpireCheckTime != kNoExpireCheckTime)
+    {
+        uint64_t now   = otPlatTimeGet();
+        uint64_t delay = (mNextExpireCheckTime > now) ? (mNextExpireCheckTime - now) : 0;
+
+        Mainloop::SetTimeoutIfEarlier(delay, aContext);
+    }
+
 exit:
     return;
 }
@@ -270,10 +290,7 @@ otError MulticastRoutingManager::InitMulticastRouterSock(void)
     struct icmp6_filter filter;
     struct mif6ctl      mif6ctl;
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
-    {
-        mfc.Erase();
-    }
+    ResetMulticastForwardingCacheTable();
 
     // Create a Multicast Routing socket
     mMulticastRouterSock = SocketWithCloseExec(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6, kSocketBlock);
@@ -438,12 +455,16 @@ void MulticastRoutingManager::UnblockInboundMulticastForwardingCache(const Ip6::
     mf6cctl.mf6cc_parent = kMifIndexBackbone;
     IF_SET(kMifIndexThread, &mf6cctl.mf6cc_ifset);
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    uint16_t index = mMulticastForwardingCacheBuckets[GetBucketIndex(aGroupAddr)];
+
+    while (index != kInvalidMfcIndex)
     {
-        otError error;
+        MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[index];
+        otError                   error;
 
-        if (!mfc.IsValid() || mfc.mIif != kMifIndexBackbone || mfc.mOif == kMifIndexThread ||
-            mfc.mGroupAddr != aGroupAddr)
+        index = mfc.mNextIndex;
+
+        if (mfc.mIif != kMifIndexBackbone || mfc.mOif == kMifIndexThread || mfc.mGroupAddr != aGroupAddr)
         {
             continue;
         }
@@ -466,9 +487,16 @@ void MulticastRoutingManager::UnblockInboundMulticastForwardingCache(const Ip6::
 
 void MulticastRoutingManager::RemoveInboundMulticastForwardingCache(const Ip6::Address &aGroupAddr)
 {
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    uint16_t index = mMulticastForwardingCacheBuckets[GetBucketIndex(aGroupAddr)];
+
+    while (index != kInvalidMfcIndex)
     {
-        if (mfc.IsValid() && mfc.mIif == kMifIndexBackbone && mfc.mGroupAddr == aGroupAddr)
+        MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[index];
+
+        // Get the next index first since removing `mfc` unlinks it.
+        index = mfc.mNextIndex;
+
+        if (mfc.mIif == kMifIndexBackbone && mfc.mGroupAddr == aGroupAddr)
         {
             RemoveMulticastForwardingCache(mfc);
         }
@@ -477,38 +505,86 @@ void MulticastRoutingManager::RemoveInboundMulticastForwardingCache(const Ip6::A
 
 void MulticastRoutingManager::ExpireMulticastForwardingCache(void)
 {
-    struct sioc_sg_req6 sioc_sg_req6;
-    uint64_t            now = otPlatTimeGet();
-    struct mf6cctl      mf6cctl;
+    uint64_t now         = otPlatTimeGet();
+    uint16_t numExpiring = 0;
 
-    VerifyOrExit(now >= mLastExpireTime + kMulticastForwardingCacheExpiringInterval * OT_US_PER_S);
+    VerifyOrExit(now >= mNextExpireCheckTime);
 
-    mLastExpireTime = now;
-
-    memset(&mf6cctl, 0, sizeof(mf6cctl));
-    memset(&sioc_sg_req6, 0, sizeof(sioc_sg_req6));
+    // Only the entries which have not seen any new traffic within
+    // `kMulticastForwardingCacheExpireTimeout` need their kernel
+    // counters checked. An expiring entry is kept if its counters
+    // show new traffic.
 
     for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
     {
-        if (mfc.IsValid() && mfc.mLastUseTime + kMulticastForwardingCacheExpireTimeout * OT_US_PER_S < now)
+        mfc.mIsExpiring = mfc.IsValid() && (mfc.GetExpireTime() < now);
+
+        if (mfc.mIsExpiring)
+        {
+            numExpiring++;
+        }
+    }
+
+    // With many expiring entries, read the counters of all kernel MFC
+    // entries at once instead of issuing one ioctl per entry. Fall
+    // back to per-entry ioctls if the proc file cannot be read.
+
+    if ((numExpiring < kMinExpiringEntriesForBulkRead) || (ReadAllMulticastRouteCounters() != OT_ERROR_NONE))
+    {
+        for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
         {
-            if (!UpdateMulticastRouteInfo(mfc))
+            if (mfc.mIsExpiring && UpdateMulticastRouteInfo(mfc))
             {
-                // The multicast route is expired
-                RemoveMulticastForwardingCache(mfc);
+                mfc.mIsExpiring = false;
             }
         }
     }
 
+    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    {
+        if (mfc.mIsExpiring)
+        {
+            RemoveMulticastForwardingCache(mfc);
+        }
+    }
+
+    ScheduleExpireCheck(now);
+
     DumpMulticastForwardingCache();
 
 exit:
     return;
 }
 
+void MulticastRoutingManager::ScheduleExpireCheck(uint64_t aNow)
+{
+    // Schedule the next check at the earliest expire time, but no
+    // sooner than `kMulticastForwardingCacheExpiringInterval` so that
+    // entries expiring close together are checked in one pass.
+
+    uint64_t minCheckTime = aNow + kMulticastForwardingCacheExpiringInterval * OT_US_PER_S;
+
+    mNextExpireCheckTime = kNoExpireCheckTime;
+
+    for (const MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    {
+        if (mfc.IsValid())
+        {
+            mNextExpireCheckTime = OT_MIN(mNextExpireCheckTime, OT_MAX(mfc.GetExpireTime(), minCheckTime));
+        }
+    }
+}
+
 bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc) const
 {
-    bool                updated = false;
+    unsigned long validPktCnt = aMfc.GetValidPktCnt();
+
+    return (ReadMulticastRouteCounters(aMfc) == OT_ERROR_NONE) && (aMfc.GetValidPktCnt() != validPktCnt);
+}
+
+otError MulticastRoutingManager::ReadMulticastRouteCounters(MulticastForwardingCache &aMfc) const
+{
+    otError             error = OT_ERROR_NONE;
     struct sioc_sg_req6 sioc_sg_req6;
 
     memset(&sioc_sg_req6, 0, sizeof(sioc_sg_req6));
@@ -518,27 +594,114 @@ bool MulticastRoutingManager::UpdateMulticastRouteInfo(MulticastForwardingCache
 
     if (ioctl(mMulticastRouterSock, SIOCGETSGCNT_IN6, &sioc_sg_req6) != -1)
     {
-        unsigned long validPktCnt;
-
         LogDebg("%s: SIOCGETSGCNT_IN6 %s => %s: bytecnt=%lu, pktcnt=%lu, wrong_if=%lu", __FUNCTION__,
                 aMfc.mSrcAddr.ToString().AsCString(), aMfc.mGroupAddr.ToString().AsCString(), sioc_sg_req6.bytecnt,
                 sioc_sg_req6.pktcnt, sioc_sg_req6.wrong_if);
 
-        validPktCnt = sioc_sg_req6.pktcnt - sioc_sg_req6.wrong_if;
-        if (validPktCnt != aMfc.mValidPktCnt)
-        {
-            aMfc.SetValidPktCnt(validPktCnt);
-
-            updated = true;
-        }
+        aMfc.UpdateCounters(sioc_sg_req6.pktcnt, sioc_sg_req6.bytecnt, sioc_sg_req6.wrong_if);
     }
     else
     {
+        error = OT_ERROR_FAILED;
         LogDebg("%s: SIOCGETSGCNT_IN6 %s => %s failed: %s", __FUNCTION__, aMfc.mSrcAddr.ToString().AsCString(),
                 aMfc.mGroupAddr.ToString().AsCString(), strerror(errno));
     }
 
-    return updated;
+    return error;
+}
+
+otError MulticastRoutingManager::ReadAllMulticastRouteCounters(void)
+{
+    // Each line of the proc file lists one kernel MFC entry as
+    // "<group> <origin> <iif> <pkts> <bytes> <wrong-if> <oifs>".
+    // Expiring entries with new traffic are no longer expiring.
+    // Entries missing from the file are left expiring, same as when
+    // the per-entry ioctl fails.
+
+    otError error = OT_ERROR_NONE;
+    FILE   *file  = fopen(mMulticastForwardingCacheProcFile, "r");
+    char    line[256];
+
+    VerifyOrExit(file != nullptr, error = OT_ERROR_FAILED);
+
+    // Skip the header line.
+    VerifyOrExit(fgets(line, sizeof(line), file) != nullptr, error = OT_ERROR_PARSE);
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        char                      groupString[INET6_ADDRSTRLEN];
+        char                      srcString[INET6_ADDRSTRLEN];
+        int                       iif;
+        unsigned long             pktCnt;
+        unsigned long             byteCnt;
+        unsigned long             wrongIfCnt;
+        Ip6::Address              groupAddr;
+        Ip6::Address              srcAddr;
+        MulticastForwardingCache *mfc;
+
+        if (sscanf(line, "%45s %45s %d %lu %lu %lu", groupString, srcString, &iif, &pktCnt, &byteCnt, &wrongIfCnt) !=
+            6)
+        {
+            continue;
+        }
+
+        if (inet_pton(AF_INET6, groupString, groupAddr.mFields.m8) != 1 ||
+            inet_pton(AF_INET6, srcString, srcAddr.mFields.m8) != 1)
+        {
+            continue;
+        }
+
+        mfc = FindMulticastForwardingCache(srcAddr, groupAddr);
+
+        if (mfc != nullptr && mfc->UpdateCounters(pktCnt, byteCnt, wrongIfCnt))
+        {
+            mfc->mIsExpiring = false;
+        }
+    }
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+
+    LogResult(error, "%s", __FUNCTION__);
+    return error;
+}
+
+otError MulticastRoutingManager::GetNextRoute(otSysMulticastRouteIterator &aIterator,
+                                              otSysMulticastRouteInfo     &aRouteInfo)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    VerifyOrExit(IsEnabled());
+
+    for (; aIterator < kMulticastForwardingCacheTableSize; aIterator++)
+    {
+        MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[aIterator];
+
+        if (!mfc.IsValid())
+        {
+            continue;
+        }
+
+        IgnoreError(ReadMulticastRouteCounters(mfc));
+
+        memset(&aRouteInfo, 0, sizeof(aRouteInfo));
+        aRouteInfo.mSourceAddress = mfc.mSrcAddr;
+        aRouteInfo.mGroupAddress  = mfc.mGroupAddr;
+        aRouteInfo.mInbound       = (mfc.mIif == kMifIndexBackbone);
+        aRouteInfo.mForwarding    = (mfc.mOif != kMifIndexNone);
+        aRouteInfo.mPackets       = mfc.GetValidPktCnt();
+        aRouteInfo.mBytes         = mfc.mByteCnt;
+
+        aIterator++;
+        error = OT_ERROR_NONE;
+        break;
+    }
+
+exit:
+    return error;
 }
 
 const char *MulticastRoutingManager::MifIndexToString(MifIndex aMif)
@@ -603,7 +766,10 @@ void MulticastRoutingManager::MulticastForwardingCache::Set(MulticastRoutingMana
 {
     mIif         = aIif;
     mOif         = aOif;
-    mValidPktCnt = 0;
+    mPktCnt      = 0;
+    mByteCnt     = 0;
+    mWrongIfCnt  = 0;
+    mIsExpiring  = false;
     mLastUseTime = otPlatTimeGet();
 }
 
@@ -617,10 +783,27 @@ void MulticastRoutingManager::MulticastForwardingCache::Set(const Ip6::Address &
     Set(aIif, aOif);
 }
 
-void MulticastRoutingManager::MulticastForwardingCache::SetValidPktCnt(unsigned long aValidPktCnt)
+bool MulticastRoutingManager::MulticastForwardingCache::UpdateCounters(unsigned long aPktCnt,
+                                                                       unsigned long aByteCnt,
+                                                                       unsigned long aWrongIfCnt)
 {
-    mValidPktCnt = aValidPktCnt;
-    mLastUseTime = otPlatTimeGet();
+    bool hasNewTraffic = (aPktCnt - aWrongIfCnt) != GetValidPktCnt();
+
+    mPktCnt     = aPktCnt;
+    mByteCnt    = aByteCnt;
+    mWrongIfCnt = aWrongIfCnt;
+
+    if (hasNewTraffic)
+    {
+        mLastUseTime = otPlatTimeGet();
+    }
+
+    return hasNewTraffic;
+}
+
+uint64_t MulticastRoutingManager::MulticastForwardingCache::GetExpireTime(void) const
+{
+    return mLastUseTime + kMulticastForwardingCacheExpireTimeout * OT_US_PER_S;
 }
 
 void MulticastRoutingManager::SaveMulticastForwardingCache(const Ip6::Address               &aSrcAddr,
@@ -628,49 +811,121 @@ void MulticastRoutingManager::SaveMulticastForwardingCache(const Ip6::Address
                                                            MulticastRoutingManager::MifIndex aIif,
                                                            MulticastRoutingManager::MifIndex aOif)
 {
-    MulticastForwardingCache *invalid = nullptr;
-    MulticastForwardingCache *oldest  = nullptr;
+    MulticastForwardingCache *mfc = FindMulticastForwardingCache(aSrcAddr, aGroupAddr);
+    uint16_t                  bucketIndex;
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    if (mfc != nullptr)
     {
-        if (mfc.IsValid())
-        {
-            if (mfc.mSrcAddr == aSrcAddr && mfc.mGroupAddr == aGroupAddr)
-            {
-                mfc.Set(aIif, aOif);
-                ExitNow();
-            }
+        mfc->Set(aIif, aOif);
+        ExitNow();
+    }
+
+    mfc = AllocateMulticastForwardingCache();
 
-            if (oldest == nullptr || mfc.mLastUseTime < oldest->mLastUseTime)
+    mfc->Set(aSrcAddr, aGroupAddr, aIif, aOif);
+
+    bucketIndex                                   = GetBucketIndex(aGroupAddr);
+    mfc->mNextIndex                               = mMulticastForwardingCacheBuckets[bucketIndex];
+    mMulticastForwardingCacheBuckets[bucketIndex] = GetIndexOf(*mfc);
+
+    mNextExpireCheckTime = OT_MIN(mNextExpireCheckTime, mfc->GetExpireTime());
+
+exit:
+    return;
+}
+
+MulticastRoutingManager::MulticastForwardingCache *MulticastRoutingManager::AllocateMulticastForwardingCache(void)
+{
+    MulticastForwardingCache *mfc;
+
+    if (mFreeMfcIndex == kInvalidMfcIndex)
+    {
+        // The table is full, evict the least recently used entry.
+        MulticastForwardingCache *oldest = nullptr;
+
+        for (MulticastForwardingCache &entry : mMulticastForwardingCacheTable)
+        {
+            if (oldest == nullptr || entry.mLastUseTime < oldest->mLastUseTime)
             {
-                oldest = &mfc;
+                oldest = &entry;
             }
         }
-        else if (invalid == nullptr)
+
+        RemoveMulticastForwardingCache(*oldest);
+    }
+
+    mfc           = &mMulticastForwardingCacheTable[mFreeMfcIndex];
+    mFreeMfcIndex = mfc->mNextIndex;
+
+    return mfc;
+}
+
+MulticastRoutingManager::MulticastForwardingCache *MulticastRoutingManager::FindMulticastForwardingCache(
+    const Ip6::Address &aSrcAddr,
+    const Ip6::Address &aGroupAddr)
+{
+    MulticastForwardingCache *found = nullptr;
+    uint16_t                  index = mMulticastForwardingCacheBuckets[GetBucketIndex(aGroupAddr)];
+
+    while (index != kInvalidMfcIndex)
+    {
+        MulticastForwardingCache &mfc = mMulticastForwardingCacheTable[index];
+
+        if (mfc.mSrcAddr == aSrcAddr && mfc.mGroupAddr == aGroupAddr)
         {
-            invalid = &mfc;
+            found = &mfc;
+            break;
         }
+
+        index = mfc.mNextIndex;
     }
 
-    if (invalid != nullptr)
+    return found;
+}
+
+void MulticastRoutingManager::ResetMulticastForwardingCacheTable(void)
+{
+    for (uint16_t &bucket : mMulticastForwardingCacheBuckets)
     {
-        invalid->Set(aSrcAddr, aGroupAddr, aIif, aOif);
+        bucket = kInvalidMfcIndex;
     }
-    else
+
+    for (uint16_t index = 0; index < kMulticastForwardingCacheTableSize; index++)
     {
-        RemoveMulticastForwardingCache(*oldest);
-        oldest->Set(aSrcAddr, aGroupAddr, aIif, aOif);
+        mMulticastForwardingCacheTable[index].Erase();
+        mMulticastForwardingCacheTable[index].mNextIndex = index + 1;
     }
 
-exit:
-    return;
+    mMulticastForwardingCacheTable[kMulticastForwardingCacheTableSize - 1].mNextIndex = kInvalidMfcIndex;
+
+    mFreeMfcIndex        = 0;
+    mNextExpireCheckTime = kNoExpireCheckTime;
 }
 
-void MulticastRoutingManager::RemoveMulticastForwardingCache(
-    MulticastRoutingManager::MulticastForwardingCache &aMfc) const
+uint16_t MulticastRoutingManager::GetIndexOf(const MulticastForwardingCache &aMfc) const
+{
+    return static_cast<uint16_t>(&aMfc - mMulticastForwardingCacheTable);
+}
+
+uint16_t MulticastRoutingManager::GetBucketIndex(const Ip6::Address &aGroupAddr)
+{
+    // Groups usually differ in their last bytes, so folding the words
+    // of the address together is enough to spread them.
+
+    uint32_t hash = aGroupAddr.mFields.m32[0] ^ aGroupAddr.mFields.m32[1] ^ aGroupAddr.mFields.m32[2] ^
+                    aGroupAddr.mFields.m32[3];
+
+    hash ^= (hash >> 16);
+    hash ^= (hash >> 8);
+
+    return static_cast<uint16_t>(hash % kMulticastForwardingCacheNumBuckets);
+}
+
+void MulticastRoutingManager::RemoveMulticastForwardingCache(MulticastRoutingManager::MulticastForwardingCache &aMfc)
 {
     otError        error;
     struct mf6cctl mf6cctl;
+    uint16_t      *indexPtr = &mMulticastForwardingCacheBuckets[GetBucketIndex(aMfc.mGroupAddr)];
 
     memset(&mf6cctl, 0, sizeof(mf6cctl));
 
@@ -689,10 +944,371 @@ void MulticastRoutingManager::RemoveMulticastForwardingCache(
               aMfc.mSrcAddr.ToString().AsCString(), aMfc.mGroupAddr.ToString().AsCString(),
               MifIndexToString(aMfc.mOif));
 
+    // Unlink the entry from its bucket and add it to the free list.
+
+    while (*indexPtr != GetIndexOf(aMfc))
+    {
+        indexPtr = &mMulticastForwardingCacheTable[*indexPtr].mNextIndex;
+    }
+
+    *indexPtr       = aMfc.mNextIndex;
+    aMfc.mNextIndex = mFreeMfcIndex;
+    mFreeMfcIndex   = GetIndexOf(aMfc);
+
     aMfc.Erase();
 }
 
 } // namespace Posix
 } // namespace ot
 
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
+#if SELF_TEST
+
+namespace ot {
+namespace Posix {
+
+class UnitTester
+{
+public:
+    static void TestMulticastForwardingCacheIndex(void);
+    static void TestMulticastForwardingCacheEviction(void);
+
+private:
+    typedef MulticastRoutingManager::MulticastForwardingCache Mfc;
+
+    static Ip6::Address MakeAddress(const char *aString, uint16_t aSuffix);
+    static uint16_t     CountValidEntries(const MulticastRoutingManager &aManager);
+    static uint16_t     CountFreeEntries(const MulticastRoutingManager &aManager);
+    static uint16_t     CountBucketEntries(const MulticastRoutingManager &aManager, const Ip6::Address &aGroupAddr);
+    static void         AgeEntry(Mfc &aMfc);
+};
+
+Ip6::Address UnitTester::MakeAddress(const char *aString, uint16_t aSuffix)
+{
+    Ip6::Address address;
+
+    assert(address.FromString(aString) == kErrorNone);
+    address.mFields.m8[14] = static_cast<uint8_t>(aSuffix >> 8);
+    address.mFields.m8[15] = static_cast<uint8_t>(aSuffix & 0xff);
+
+    return address;
+}
+
+uint16_t UnitTester::CountValidEntries(const MulticastRoutingManager &aManager)
+{
+    uint16_t count = 0;
+
+    for (const Mfc &mfc : aManager.mMulticastForwardingCacheTable)
+    {
+        count += mfc.IsValid() ? 1 : 0;
+    }
+
+    return count;
+}
+
+uint16_t UnitTester::CountFreeEntries(const MulticastRoutingManager &aManager)
+{
+    uint16_t count = 0;
+
+    for (uint16_t index = aManager.mFreeMfcIndex; index != MulticastRoutingManager::kInvalidMfcIndex;
+         index          = aManager.mMulticastForwardingCacheTable[index].mNextIndex)
+    {
+        assert(!aManager.mMulticastForwardingCacheTable[index].IsValid());
+        count++;
+    }
+
+    return count;
+}
+
+uint16_t UnitTester::CountBucketEntries(const MulticastRoutingManager &aManager, const Ip6::Address &aGroupAddr)
+{
+    uint16_t count  = 0;
+    uint16_t bucket = MulticastRoutingManager::GetBucketIndex(aGroupAddr);
+
+    for (uint16_t index = aManager.mMulticastForwardingCacheBuckets[bucket];
+         index != MulticastRoutingManager::kInvalidMfcIndex;
+         index = aManager.mMulticastForwardingCacheTable[index].mNextIndex)
+    {
+        const Mfc &mfc = aManager.mMulticastForwardingCacheTable[index];
+
+        assert(mfc.IsValid());
+        assert(MulticastRoutingManager::GetBucketIndex(mfc.mGroupAddr) == bucket);
+        count++;
+    }
+
+    return count;
+}
+
+void UnitTester::AgeEntry(Mfc &aMfc)
+{
+    // Move the last use time back so that the entry is past its expire
+    // time. Unsigned wraparound keeps `GetExpireTime()` correct even
+    // when the monotonic clock is smaller than the timeout.
+
+    aMfc.mLastUseTime =
+        otPlatTimeGet() - (MulticastRoutingManager::kMulticastForwardingCacheExpireTimeout + 1) * OT_US_PER_S;
+}
+
+void UnitTester::TestMulticastForwardingCacheIndex(void)
+{
+    static MulticastRoutingManager manager;
+    static char                    procFile[] = "/tmp/ot-test-mfc-XXXXXX";
+
+    const uint16_t kTableSize = MulticastRoutingManager::kMulticastForwardingCacheTableSize;
+
+    Ip6::Address src1   = MakeAddress("fd00:1::", 1);
+    Ip6::Address src2   = MakeAddress("fd00:1::", 2);
+    Ip6::Address group1 = MakeAddress("ff05::", 1);
+    Ip6::Address group2;
+    Ip6::Address group3;
+    Mfc         *mfc;
+    FILE        *file;
+    int          fd;
+
+    // Pick `group2` in the same bucket as `group1` and `group3` in a
+    // different one.
+
+    for (uint16_t suffix = 2;; suffix++)
+    {
+        group2 = MakeAddress("ff05::", suffix);
+
+        if (MulticastRoutingManager::GetBucketIndex(group2) == MulticastRoutingManager::GetBucketIndex(group1))
+        {
+            break;
+        }
+    }
+
+    for (uint16_t suffix = 2;; suffix++)
+    {
+        group3 = MakeAddress("ff05::", suffix);
+
+        if (MulticastRoutingManager::GetBucketIndex(group3) != MulticastRoutingManager::GetBucketIndex(group1))
+        {
+            break;
+        }
+    }
+
+    // Verify the empty table.
+
+    assert(CountValidEntries(manager) == 0);
+    assert(CountFreeEntries(manager) == kTableSize);
+    assert(manager.FindMulticastForwardingCache(src1, group1) == nullptr);
+    assert(manager.mNextExpireCheckTime == MulticastRoutingManager::kNoExpireCheckTime);
+
+    // Add entries for multiple (S,G), two groups sharing a bucket.
+
+    manager.SaveMulticastForwardingCache(src1, group1, MulticastRoutingManager::kMifIndexBackbone,
+                                         MulticastRoutingManager::kMifIndexNone);
+    manager.SaveMulticastForwardingCache(src2, group1, MulticastRoutingManager::kMifIndexBackbone,
+                                         MulticastRoutingManager::kMifIndexThread);
+    manager.SaveMulticastForwardingCache(src1, group2, MulticastRoutingManager::kMifIndexThread,
+                                         MulticastRoutingManager::kMifIndexBackbone);
+    manager.SaveMulticastForwardingCache(src1, group3, MulticastRoutingManager::kMifIndexThread,
+                                         MulticastRoutingManager::kMifIndexBackbone);
+
+    assert(CountValidEntries(manager) == 4);
+    assert(CountFreeEntries(manager) == kTableSize - 4);
+    assert(CountBucketEntries(manager, group1) == 3);
+    assert(CountBucketEntries(manager, group3) == 1);
+    assert(manager.mNextExpireCheckTime != MulticastRoutingManager::kNoExpireCheckTime);
+
+    mfc = manager.FindMulticastForwardingCache(src1, group1);
+    assert(mfc != nullptr);
+    assert(mfc->mIif == MulticastRoutingManager::kMifIndexBackbone);
+    assert(mfc->mOif == MulticastRoutingManager::kMifIndexNone);
+
+    mfc = manager.FindMulticastForwardingCache(src2, group1);
+    assert(mfc != nullptr);
+    assert(mfc->mOif == MulticastRoutingManager::kMifIndexThread);
+
+    mfc = manager.FindMulticastForwardingCache(src1, group2);
+    assert(mfc != nullptr);
+    assert(mfc->mSrcAddr == src1 && mfc->mGroupAddr == group2);
+
+    mfc = manager.FindMulticastForwardingCache(src1, group3);
+    assert(mfc != nullptr);
+    assert(mfc->mGroupAddr == group3);
+
+    // Same bucket, but no entry for this (S,G).
+    assert(manager.FindMulticastForwardingCache(src2, group2) == nullptr);
+
+    // Saving an existing (S,G) updates the entry in place.
+
+    manager.SaveMulticastForwardingCache(src1, group1, MulticastRoutingManager::kMifIndexBackbone,
+                                         MulticastRoutingManager::kMifIndexThread);
+    assert(CountValidEntries(manager) == 4);
+    assert(manager.FindMulticastForwardingCache(src1, group1)->mOif == MulticastRoutingManager::kMifIndexThread);
+
+    // Removing the inbound entries of `group1` keeps `group2` in the
+    // shared bucket.
+
+    manager.RemoveInboundMulticastForwardingCache(group1);
+
+    assert(CountValidEntries(manager) == 2);
+    assert(CountFreeEntries(manager) == kTableSize - 2);
+    assert(CountBucketEntries(manager, group1) == 1);
+    assert(manager.FindMulticastForwardingCache(src1, group1) == nullptr);
+    assert(manager.FindMulticastForwardingCache(src2, group1) == nullptr);
+    assert(manager.FindMulticastForwardingCache(src1, group2) != nullptr);
+    assert(manager.FindMulticastForwardingCache(src1, group3) != nullptr);
+
+    // Re-add an entry, it reuses a freed slot.
+
+    manager.SaveMulticastForwardingCache(src2, group1, MulticastRoutingManager::kMifIndexBackbone,
+                                         MulticastRoutingManager::kMifIndexNone);
+    assert(CountValidEntries(manager) == 3);
+    assert(CountFreeEntries(manager) == kTableSize - 3);
+    assert(CountBucketEntries(manager, group1) == 2);
+
+    // Expire a single entry. There is no multicast router socket so
+    // counter reads fail and the aged entry is removed.
+
+    AgeEntry(*manager.FindMulticastForwardingCache(src1, group2));
+    manager.mNextExpireCheckTime = 0;
+    manager.ExpireMulticastForwardingCache();
+
+    assert(CountValidEntries(manager) == 2);
+    assert(CountFreeEntries(manager) == kTableSize - 2);
+    assert(CountBucketEntries(manager, group1) == 1);
+    assert(manager.FindMulticastForwardingCache(src1, group2) == nullptr);
+    assert(manager.FindMulticastForwardingCache(src2, group1) != nullptr);
+    assert(manager.FindMulticastForwardingCache(src1, group3) != nullptr);
+    assert(manager.mNextExpireCheckTime != MulticastRoutingManager::kNoExpireCheckTime);
+
+    // Entries not yet expired are kept even when the check runs.
+
+    manager.mNextExpireCheckTime = 0;
+    manager.ExpireMulticastForwardingCache();
+    assert(CountValidEntries(manager) == 2);
+
+    // Expire enough entries to take the bulk read path.
+
+    for (uint16_t i = 0; i < MulticastRoutingManager::kMinExpiringEntriesForBulkRead; i++)
+    {
+        Ip6::Address src = MakeAddress("fd00:2::", i + 1);
+
+        manager.SaveMulticastForwardingCache(src, group3, MulticastRoutingManager::kMifIndexThread,
+                                             MulticastRoutingManager::kMifIndexBackbone);
+        AgeEntry(*manager.FindMulticastForwardingCache(src, group3));
+    }
+
+    assert(CountBucketEntries(manager, group3) == MulticastRoutingManager::kMinExpiringEntriesForBulkRead + 1);
+
+    // The bulk read uses a fixture file instead of the proc file of the
+    // host. The first two entries show new traffic and are kept. The
+    // third one only has wrong-interface packets, so it expires along
+    // with the entries missing from the file. Lines for unknown entries
+    // and malformed lines are ignored.
+
+    fd = mkstemp(procFile);
+    assert(fd >= 0);
+    file = fdopen(fd, "w");
+    assert(file != nullptr);
+
+    fprintf(file, "Group Origin Iif Pkts Bytes Wrong Oifs\n");
+    fprintf(file, "%s %s 0 5 500 0  1:1\n", group3.ToString().AsCString(),
+            MakeAddress("fd00:2::", 1).ToString().AsCString());
+    fprintf(file, "%s %s 0 7 700 2  1:1\n", group3.ToString().AsCString(),
+            MakeAddress("fd00:2::", 2).ToString().AsCString());
+    fprintf(file, "%s %s 0 3 300 3  1:1\n", group3.ToString().AsCString(),
+            MakeAddress("fd00:2::", 3).ToString().AsCString());
+    fprintf(file, "%s %s 0 9 900 0  1:1\n", group1.ToString().AsCString(),
+            MakeAddress("fd00:9::", 1).ToString().AsCString());
+    fprintf(file, "malformed line\n");
+    fclose(file);
+
+    manager.mMulticastForwardingCacheProcFile = procFile;
+    manager.mNextExpireCheckTime              = 0;
+    manager.ExpireMulticastForwardingCache();
+
+    assert(CountValidEntries(manager) == 4);
+    assert(CountFreeEntries(manager) == kTableSize - 4);
+    assert(CountBucketEntries(manager, group3) == 3);
+    assert(manager.FindMulticastForwardingCache(src1, group3) != nullptr);
+    assert(manager.FindMulticastForwardingCache(src2, group1) != nullptr);
+    assert(manager.FindMulticastForwardingCache(MakeAddress("fd00:2::", 3), group3) == nullptr);
+    assert(manager.FindMulticastForwardingCache(MakeAddress("fd00:9::", 1), group1) == nullptr);
+
+    mfc = manager.FindMulticastForwardingCache(MakeAddress("fd00:2::", 1), group3);
+    assert(mfc != nullptr);
+    assert(mfc->GetValidPktCnt() == 5 && mfc->mByteCnt == 500);
+
+    mfc = manager.FindMulticastForwardingCache(MakeAddress("fd00:2::", 2), group3);
+    assert(mfc != nullptr);
+    assert(mfc->GetValidPktCnt() == 5 && mfc->mWrongIfCnt == 2);
+
+    // Expire the remaining entries. There are too few for the bulk
+    // read, and with the fixture file removed it could not be read
+    // anyway.
+
+    unlink(procFile);
+
+    AgeEntry(*manager.FindMulticastForwardingCache(src1, group3));
+    AgeEntry(*manager.FindMulticastForwardingCache(src2, group1));
+    AgeEntry(*manager.FindMulticastForwardingCache(MakeAddress("fd00:2::", 1), group3));
+    AgeEntry(*manager.FindMulticastForwardingCache(MakeAddress("fd00:2::", 2), group3));
+    manager.mNextExpireCheckTime = 0;
+    manager.ExpireMulticastForwardingCache();
+
+    assert(CountValidEntries(manager) == 0);
+    assert(CountFreeEntries(manager) == kTableSize);
+    assert(manager.mNextExpireCheckTime == MulticastRoutingManager::kNoExpireCheckTime);
+}
+
+void UnitTester::TestMulticastForwardingCacheEviction(void)
+{
+    static MulticastRoutingManager manager;
+
+    const uint16_t kTableSize = MulticastRoutingManager::kMulticastForwardingCacheTableSize;
+
+    Ip6::Address group = MakeAddress("ff05::", 1);
+    Ip6::Address src;
+
+    // Fill the table, then make the entry in the middle the least
+    // recently used one.
+
+    for (uint16_t i = 0; i < kTableSize; i++)
+    {
+        src = MakeAddress("fd00:3::", i + 1);
+        manager.SaveMulticastForwardingCache(src, group, MulticastRoutingManager::kMifIndexThread,
+                                             MulticastRoutingManager::kMifIndexBackbone);
+    }
+
+    assert(CountValidEntries(manager) == kTableSize);
+    assert(CountFreeEntries(manager) == 0);
+
+    manager.FindMulticastForwardingCache(MakeAddress("fd00:3::", kTableSize / 2), group)->mLastUseTime = 0;
+
+    // Adding one more (S,G) evicts the least recently used entry.
+
+    src = MakeAddress("fd00:4::", 1);
+    manager.SaveMulticastForwardingCache(src, group, MulticastRoutingManager::kMifIndexThread,
+                                         MulticastRoutingManager::kMifIndexBackbone);
+
+    assert(CountValidEntries(manager) == kTableSize);
+    assert(CountFreeEntries(manager) == 0);
+    assert(CountBucketEntries(manager, group) == kTableSize);
+    assert(manager.FindMulticastForwardingCache(src, group) != nullptr);
+    assert(manager.FindMulticastForwardingCache(MakeAddress("fd00:3::", kTableSize / 2), group) == nullptr);
+    assert(manager.FindMulticastForwardingCache(MakeAddress("fd00:3::", 1), group) != nullptr);
+    assert(manager.FindMulticastForwardingCache(MakeAddress("fd00:3::", kTableSize), group) != nullptr);
+}
+
+} // namespace Posix
+} // namespace ot
+
+int main()
+{
+    ot::Posix::UnitTester::TestMulticastForwardingCacheIndex();
+    ot::Posix::UnitTester::TestMulticastForwardingCacheEviction();
+
+    printf("All tests passed\n");
+    return 0;
+}
+
+#endif // SELF_TEST
+
 #endif // OPENTHREAD_POSIX_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE
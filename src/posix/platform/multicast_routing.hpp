@@ -49,19 +49,25 @@
 namespace ot {
 namespace Posix {
 
+class UnitTester;
+
 class MulticastRoutingManager : public Mainloop::Source, public Logger<MulticastRoutingManager>, private NonCopyable
 {
+    friend class UnitTester;
+
 public:
     static const char kLogModuleName[];
 
     explicit MulticastRoutingManager()
 
-        : mLastExpireTime(0)
+        : mNextExpireCheckTime(kNoExpireCheckTime)
+        , mMulticastForwardingCacheProcFile(kMulticastForwardingCacheProcFile)
         , mMulticastRouterSock(-1)
         , mState(kStateDisabled)
         , mRetryIntervalMs(kMinRetryIntervalMs)
         , mNextRetryTime(0)
     {
+        ResetMulticastForwardingCacheTable();
     }
 
     bool IsEnabled(void) const { return mState == kStateEnabled; }
@@ -71,6 +77,19 @@ public:
     void Process(const Mainloop::Context &aContext) override;
     void HandleStateChange(otInstance *aInstance, otChangedFlags aFlags);
 
+    /**
+     * Gets the next multicast route (MFC entry) and its forwarding counters.
+     *
+     * The counters are refreshed from the kernel when the route is retrieved.
+     *
+     * @param[in,out] aIterator   A reference to the iterator. Set to zero to start from the first route.
+     * @param[out]    aRouteInfo  A reference to output the multicast route info.
+     *
+     * @retval OT_ERROR_NONE       Successfully found the next multicast route.
+     * @retval OT_ERROR_NOT_FOUND  No subsequent multicast route was found.
+     */
+    otError GetNextRoute(otSysMulticastRouteIterator &aIterator, otSysMulticastRouteInfo &aRouteInfo);
+
 private:
     static constexpr uint32_t kMinRetryIntervalMs                       = 100;
     static constexpr uint32_t kMaxRetryIntervalMs                       = 5000;
@@ -78,6 +97,12 @@ private:
     static constexpr uint16_t kMulticastForwardingCacheExpiringInterval = 60;
     static constexpr uint16_t kMulticastForwardingCacheTableSize =
         OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE;
+    static constexpr uint16_t kMulticastForwardingCacheNumBuckets = (kMulticastForwardingCacheTableSize + 3) / 4;
+    static constexpr uint16_t kMinExpiringEntriesForBulkRead       = 8;
+    static constexpr uint16_t kInvalidMfcIndex                     = 0xffff;
+    static constexpr uint64_t kNoExpireCheckTime                   = UINT64_MAX;
+
+    static const char kMulticastForwardingCacheProcFile[];
 
     enum State : uint8_t
     {
@@ -93,28 +118,41 @@ private:
         kMifIndexBackbone = 1,
     };
 
+    // MFC entries are stored in a fixed table and never move. Valid
+    // entries are chained (through `mNextIndex`) in a hash bucket
+    // keyed by the group address, and invalid entries are chained in
+    // a free list.
+
     class MulticastForwardingCache
     {
         friend class MulticastRoutingManager;
+        friend class UnitTester;
 
     private:
         MulticastForwardingCache()
-            : mIif(kMifIndexNone)
+            : mNextIndex(kInvalidMfcIndex)
+            , mIif(kMifIndexNone)
         {
         }
 
-        bool IsValid() const { return mIif != kMifIndexNone; }
-        void Set(MifIndex aIif, MifIndex aOif);
-        void Set(const Ip6::Address &aSrcAddr, const Ip6::Address &aGroupAddr, MifIndex aIif, MifIndex aOif);
-        void Erase(void) { mIif = kMifIndexNone; }
-        void SetValidPktCnt(unsigned long aValidPktCnt);
+        bool          IsValid() const { return mIif != kMifIndexNone; }
+        void          Set(MifIndex aIif, MifIndex aOif);
+        void          Set(const Ip6::Address &aSrcAddr, const Ip6::Address &aGroupAddr, MifIndex aIif, MifIndex aOif);
+        void          Erase(void) { mIif = kMifIndexNone; }
+        bool          UpdateCounters(unsigned long aPktCnt, unsigned long aByteCnt, unsigned long aWrongIfCnt);
+        unsigned long GetValidPktCnt(void) const { return mPktCnt - mWrongIfCnt; }
+        uint64_t      GetExpireTime(void) const;
 
         Ip6::Address  mSrcAddr;
         Ip6::Address  mGroupAddr;
         uint64_t      mLastUseTime;
-        unsigned long mValidPktCnt;
+        unsigned long mPktCnt;
+        unsigned long mByteCnt;
+        unsigned long mWrongIfCnt;
+        uint16_t      mNextIndex;
         MifIndex      mIif;
         MifIndex      mOif;
+        bool          mIsExpiring;
     };
 
     void    Enable(void);
@@ -134,8 +172,17 @@ private:
     void    UnblockInboundMulticastForwardingCache(const Ip6::Address &aGroupAddr);
     void    RemoveInboundMulticastForwardingCache(const Ip6::Address &aGroupAddr);
     void    ExpireMulticastForwardingCache(void);
+    void    ScheduleExpireCheck(uint64_t aNow);
     bool    UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc) const;
-    void    RemoveMulticastForwardingCache(MulticastForwardingCache &aMfc) const;
+    otError ReadMulticastRouteCounters(MulticastForwardingCache &aMfc) const;
+    otError ReadAllMulticastRouteCounters(void);
+    void    RemoveMulticastForwardingCache(MulticastForwardingCache &aMfc);
+    void    ResetMulticastForwardingCacheTable(void);
+    MulticastForwardingCache *FindMulticastForwardingCache(const Ip6::Address &aSrcAddr,
+                                                           const Ip6::Address &aGroupAddr);
+    MulticastForwardingCache *AllocateMulticastForwardingCache(void);
+    uint16_t                  GetIndexOf(const MulticastForwardingCache &aMfc) const;
+    static uint16_t           GetBucketIndex(const Ip6::Address &aGroupAddr);
     static const char *MifIndexToString(MifIndex aMif);
     void               DumpMulticastForwardingCache(void) const;
     static void        HandleBackboneMulticastListenerEvent(void                                  *aContext,
@@ -145,7 +192,10 @@ private:
                                                             const Ip6::Address                    &aAddress);
 
     MulticastForwardingCache mMulticastForwardingCacheTable[kMulticastForwardingCacheTableSize];
-    uint64_t                 mLastExpireTime;
+    uint16_t                 mMulticastForwardingCacheBuckets[kMulticastForwardingCacheNumBuckets];
+    uint16_t                 mFreeMfcIndex;
+    uint64_t                 mNextExpireCheckTime;
+    const char              *mMulticastForwardingCacheProcFile;
     int                      mMulticastRouterSock;
     State                    mState;
     uint32_t                 mRetryIntervalMs;
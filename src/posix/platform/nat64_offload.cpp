@@ -0,0 +1,131 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the NAT64 kernel offload using a Jool SIIT instance.
+ */
+
+#include "nat64_offload.hpp"
+
+#include <string.h>
+
+#include <openthread/border_routing.h>
+#include <openthread/logging.h>
+#include <openthread/nat64.h>
+
+#include "common/code_utils.hpp"
+#include "posix/platform/utils.hpp"
+
+namespace ot {
+namespace Posix {
+
+#if defined(__linux__) && OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+
+#if !OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE || !OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
+#error Configurations 'OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE' and 'OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE' are required.
+#endif
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+#error 'OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE' is not supported, EAMT entries map addresses only.
+#endif
+
+static const char kJoolSiitCommand[] = OPENTHREAD_POSIX_CONFIG_JOOL_SIIT_BINARY;
+
+// The NAT64 prefix last configured as the pool6 of the Jool instance.
+static otIp6Prefix sPool6;
+
+static otError UpdatePool6(otInstance *aInstance)
+{
+    otError     error;
+    otIp6Prefix prefix;
+    char        prefixString[OT_IP6_PREFIX_STRING_SIZE];
+
+    SuccessOrExit(error = otBorderRoutingGetNat64Prefix(aInstance, &prefix));
+    VerifyOrExit(memcmp(&prefix, &sPool6, sizeof(prefix)) != 0);
+
+    otIp6PrefixToString(&prefix, prefixString, sizeof(prefixString));
+    SuccessOrExit(error = ExecuteCommand("%s global update pool6 %s", kJoolSiitCommand, prefixString));
+    sPool6 = prefix;
+
+exit:
+    return error;
+}
+
+static bool HandleMappingEvent(otNat64MappingEvent aEvent, const otNat64AddressMapping *aMapping, void *aContext)
+{
+    otInstance *instance = static_cast<otInstance *>(aContext);
+    otError     error    = OT_ERROR_NONE;
+    char        ip6String[OT_IP6_ADDRESS_STRING_SIZE];
+    char        ip4String[OT_IP4_ADDRESS_STRING_SIZE];
+
+    otIp6AddressToString(&aMapping->mIp6, ip6String, sizeof(ip6String));
+    otIp4AddressToString(&aMapping->mIp4, ip4String, sizeof(ip4String));
+
+    switch (aEvent)
+    {
+    case OT_NAT64_MAPPING_EVENT_ADDED:
+        SuccessOrExit(error = UpdatePool6(instance));
+        SuccessOrExit(error = ExecuteCommand("%s eamt add %s/128 %s/32", kJoolSiitCommand, ip6String, ip4String));
+        break;
+
+    case OT_NAT64_MAPPING_EVENT_REMOVED:
+        // A failure is only logged, the mapping is removed in any case.
+        error = ExecuteCommand("%s eamt remove %s/128 %s/32", kJoolSiitCommand, ip6String, ip4String);
+        break;
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("NAT64 offload - failed to update mapping %s -> %s: %s", ip6String, ip4String,
+                      otThreadErrorToString(error));
+    }
+
+    return (error == OT_ERROR_NONE);
+}
+
+void Nat64OffloadInit(otInstance *aInstance)
+{
+    otError error;
+
+    memset(&sPool6, 0, sizeof(sPool6));
+
+    if ((error = ExecuteCommand("%s eamt flush", kJoolSiitCommand)) != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("NAT64 offload - failed to flush EAMT: %s", otThreadErrorToString(error));
+    }
+
+    otNat64SetMappingCallback(aInstance, HandleMappingEvent, aInstance);
+}
+
+#endif // defined(__linux__) && OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+
+} // namespace Posix
+} // namespace ot
@@ -0,0 +1,60 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes definitions of the NAT64 kernel offload.
+ */
+
+#ifndef OT_POSIX_PLATFORM_NAT64_OFFLOAD_HPP_
+#define OT_POSIX_PLATFORM_NAT64_OFFLOAD_HPP_
+
+#include "posix/platform/openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+
+#include <openthread/instance.h>
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Starts offloading the NAT64 address mappings of the translator to the kernel.
+ *
+ * Removes the mappings installed by a previous run and registers the NAT64 mapping callback.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ */
+void Nat64OffloadInit(otInstance *aInstance);
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+#endif // OT_POSIX_PLATFORM_NAT64_OFFLOAD_HPP_
@@ -183,6 +183,9 @@ unsigned int otSysGetThreadNetifIndex(void) { return gNetifIndex; }
 #if OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
 #include "firewall.hpp"
 #endif
+#if OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+#include "nat64_offload.hpp"
+#endif
 
 using namespace ot::Posix::Ip6Utils;
 
@@ -2430,6 +2433,10 @@ void nat64Init(void)
     {
         LogInfo("No default NAT64 CIDR provided.");
     }
+
+#if defined(__linux__) && OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+    ot::Posix::Nat64OffloadInit(gInstance);
+#endif
 }
 #endif
 
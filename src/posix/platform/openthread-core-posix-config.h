@@ -118,6 +118,10 @@
 #define OPENTHREAD_CONFIG_IP6_MAX_EXT_MCAST_ADDRS 8
 #endif
 
+#ifndef OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS
+#define OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS 256
+#endif
+
 #ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE 1
 #endif
@@ -270,6 +270,30 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+ *
+ * Define as 1 to offload the NAT64 translation of established mappings to the Linux kernel.
+ *
+ * Each address mapping created by the NAT64 translator is installed as an EAMT entry of a Jool SIIT instance in
+ * netfilter mode, whose pool6 is kept equal to the NAT64 prefix. The datagrams of installed mappings are then
+ * translated by the kernel in both directions, while OpenThread keeps allocating and expiring the mappings.
+ *
+ * The Jool SIIT instance is expected to be created by the system, e.g.:
+ *
+ * modprobe jool_siit
+ * jool_siit instance add --netfilter
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE 0
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_NAT64_OFFLOAD_ENABLE
+#ifndef OPENTHREAD_POSIX_CONFIG_JOOL_SIIT_BINARY
+#define OPENTHREAD_POSIX_CONFIG_JOOL_SIIT_BINARY "jool_siit"
+#endif
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_THREAD_NETIF_DEFAULT_NAME
  *
@@ -495,6 +519,22 @@
 #define OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR_PERIOD (5000)
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+ *
+ * Define as 1 to save the mDNS cache snapshot to the temporary storage when the mDNS socket is torn down and to
+ * restore it when the mDNS socket is enabled again, so that a restarted process can reuse previously discovered
+ * records (warm start) while they are being revalidated.
+ *
+ * Requires `OPENTHREAD_POSIX_CONFIG_TMP_STORAGE_ENABLE`, `OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE`
+ * and `OPENTHREAD_CONFIG_MULTICAST_DNS_PUBLIC_API_ENABLE`.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MDNS_CACHE_SNAPSHOT_ENABLE                                                  \
+    (OPENTHREAD_POSIX_CONFIG_TMP_STORAGE_ENABLE && OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE && \
+     OPENTHREAD_CONFIG_MULTICAST_DNS_PUBLIC_API_ENABLE)
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // Removed or renamed POSIX specific configs.
 
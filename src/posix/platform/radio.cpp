@@ -262,6 +262,10 @@ ot::Spinel::RadioSpinel &GetRadioSpinel(void) { return sRadio.GetRadioSpinel();
 ot::Posix::RcpCapsDiag &GetRcpCapsDiag(void) { return sRadio.GetRcpCapsDiag(); }
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_TMP_STORAGE_ENABLE
+ot::Posix::TmpStorage &GetTmpStorage(void) { return sRadio.GetTmpStorage(); }
+#endif
+
 void platformRadioDeinit(void) { sRadio.Deinit(); }
 
 void platformRadioHandleStateChange(otInstance *aInstance, otChangedFlags aFlags)
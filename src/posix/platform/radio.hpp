@@ -97,6 +97,15 @@ public:
     RcpCapsDiag &GetRcpCapsDiag(void) { return mRcpCapsDiag; }
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_TMP_STORAGE_ENABLE
+    /**
+     * Acts as an accessor to the temporary storage instance used by the radio.
+     *
+     * @returns A reference to the temporary storage instance.
+     */
+    TmpStorage &GetTmpStorage(void) { return mTmpStorage; }
+#endif
+
 private:
     void ProcessRadioUrl(const RadioUrl &aRadioUrl);
     void ProcessMaxPowerTable(const RadioUrl &aRadioUrl);
@@ -158,4 +167,13 @@ private:
 } // namespace Posix
 } // namespace ot
 
+#if OPENTHREAD_POSIX_CONFIG_TMP_STORAGE_ENABLE
+/**
+ * Gets the temporary storage instance used by the radio.
+ *
+ * @returns A reference to the temporary storage instance.
+ */
+ot::Posix::TmpStorage &GetTmpStorage(void);
+#endif
+
 #endif // OT_POSIX_PLATFORM_RADIO_HPP_
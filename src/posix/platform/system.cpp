@@ -42,6 +42,7 @@
 #include <openthread/border_router.h>
 #include <openthread/cli.h>
 #include <openthread/heap.h>
+#include <openthread/profiler.h>
 #include <openthread/tasklet.h>
 #include <openthread/trel.h>
 #include <openthread/platform/alarm-milli.h>
@@ -49,6 +50,7 @@
 #include <openthread/platform/logging.h>
 #include <openthread/platform/otns.h>
 #include <openthread/platform/radio.h>
+#include <openthread/platform/time.h>
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
@@ -431,8 +433,76 @@ static int trySelect(otSysMainloopContext &aContext)
 }
 #endif // OPENTHREAD_POSIX_VIRTUAL_TIME
 
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+// The time (in usec) at which the mainloop last returned from `select()`,
+// or zero if it has not been recorded.
+static uint64_t sMainloopWakeTime = 0;
+
+/**
+ * Reports the execution time of consecutive platform handlers to the profiler.
+ *
+ * `Skip()` starts the next lap without recording the current one.
+ */
+class ProfilerLap
+{
+public:
+    explicit ProfilerLap(otInstance *aInstance)
+        : mInstance(aInstance)
+        , mEnabled(otProfilerIsEnabled(aInstance))
+        , mLastTime(mEnabled ? otPlatTimeGet() : 0)
+    {
+    }
+
+    void Record(const char *aName)
+    {
+        uint64_t now;
+
+        VerifyOrExit(mEnabled);
+        now = otPlatTimeGet();
+        otProfilerRecordPlatformHandler(mInstance, aName, static_cast<uint32_t>(now - mLastTime));
+        mLastTime = now;
+
+    exit:
+        return;
+    }
+
+    void Skip(void)
+    {
+        VerifyOrExit(mEnabled);
+        mLastTime = otPlatTimeGet();
+
+    exit:
+        return;
+    }
+
+private:
+    otInstance *mInstance;
+    bool        mEnabled;
+    uint64_t    mLastTime;
+};
+#else
+class ProfilerLap
+{
+public:
+    explicit ProfilerLap(otInstance *) {}
+    void Record(const char *) {}
+    void Skip(void) {}
+};
+#endif // OPENTHREAD_CONFIG_PROFILER_ENABLE
+
 void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop)
 {
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+    // An iteration spans from waking up in `otSysMainloopPoll()` to the
+    // next `otSysMainloopUpdate()`, which covers processing the platform
+    // events followed by the tasklets.
+    if (sMainloopWakeTime != 0)
+    {
+        otProfilerRecordMainloopIteration(aInstance, static_cast<uint32_t>(otPlatTimeGet() - sMainloopWakeTime));
+        sMainloopWakeTime = 0;
+    }
+#endif
+
     ot::Posix::Mainloop::Manager::Get().Update(*aMainloop);
 
     platformAlarmUpdateTimeout(&aMainloop->mTimeout);
@@ -499,28 +569,45 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
                       &aMainloop->mTimeout);
     }
 
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+    sMainloopWakeTime = otPlatTimeGet();
+#endif
+
     return rval;
 }
 
 void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMainloop)
 {
+    ProfilerLap lap(aInstance);
+
     ot::Posix::Mainloop::Manager::Get().Process(*aMainloop);
+    lap.Record("mainloop-sources");
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
     virtualTimeProcess(aInstance, aMainloop);
+    lap.Record("virtual-time");
 #else
     platformSpinelManagerProcess(aInstance, aMainloop);
+    lap.Record("spinel");
     platformRadioProcess(aInstance, aMainloop);
+    lap.Record("radio");
 #endif
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     platformTrelProcess(aInstance, aMainloop);
+    lap.Record("trel");
 #endif
     platformAlarmProcess(aInstance);
+    // The alarm processing time is spent almost entirely in the fired
+    // timer handlers, which the core already records individually, so
+    // it is not reported as a platform handler.
+    lap.Skip();
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
     platformNetifProcess(aMainloop);
+    lap.Record("netif");
 #endif
 #if OPENTHREAD_CONFIG_DNS_UPSTREAM_QUERY_ENABLE
     platformResolverProcess(aMainloop);
+    lap.Record("resolver");
 #endif
 }
 
@@ -93,6 +93,45 @@ otError TmpStorage::RestoreRadioSpinelMetrics(otRadioSpinelMetrics &aMetrics)
     return mStorageFile.Get(kKeyRadioSpinelMetrics, 0, reinterpret_cast<uint8_t *>(&aMetrics), &valueLength);
 }
 
+void TmpStorage::SaveMdnsCacheSnapshot(const uint8_t *aSnapshot, uint16_t aLength)
+{
+    time_t saveTime;
+
+    VerifyOrDie(time(&saveTime) != -1, OT_EXIT_ERROR_ERRNO);
+
+    mStorageFile.Set(kKeyMdnsCacheSnapshotTime, reinterpret_cast<const uint8_t *>(&saveTime),
+                     static_cast<uint16_t>(sizeof(saveTime)));
+    mStorageFile.Set(kKeyMdnsCacheSnapshot, aSnapshot, aLength);
+}
+
+otError TmpStorage::RestoreMdnsCacheSnapshot(uint8_t *aSnapshot, uint16_t &aLength, uint32_t &aElapsedTime)
+{
+    otError  error;
+    time_t   saveTime;
+    time_t   curTime;
+    uint16_t valueLength = sizeof(saveTime);
+
+    SuccessOrExit(error = mStorageFile.Get(kKeyMdnsCacheSnapshotTime, 0, reinterpret_cast<uint8_t *>(&saveTime),
+                                           &valueLength));
+    VerifyOrExit(valueLength == sizeof(saveTime), error = OT_ERROR_NOT_FOUND);
+
+    // The wall-clock time may have been adjusted backwards since
+    // the snapshot was saved. In such a case, the elapsed time
+    // cannot be determined and the snapshot is discarded.
+
+    VerifyOrDie(time(&curTime) != -1, OT_EXIT_ERROR_ERRNO);
+    VerifyOrExit(curTime >= saveTime, error = OT_ERROR_NOT_FOUND);
+
+    SuccessOrExit(error = mStorageFile.Get(kKeyMdnsCacheSnapshot, 0, aSnapshot, &aLength));
+
+    aElapsedTime = static_cast<uint32_t>(curTime - saveTime);
+
+exit:
+    IgnoreError(mStorageFile.Delete(kKeyMdnsCacheSnapshotTime, -1));
+    IgnoreError(mStorageFile.Delete(kKeyMdnsCacheSnapshot, -1));
+    return error;
+}
+
 otError TmpStorage::SettingsFileInit(void)
 {
     char        fileBaseName[SettingsFile::kMaxFileBaseNameSize];
@@ -73,11 +73,37 @@ public:
      */
     otError RestoreRadioSpinelMetrics(otRadioSpinelMetrics &aMetrics);
 
+    /**
+     * Saves the mDNS cache snapshot to the temporary storage along with the current time.
+     *
+     * @param[in]  aSnapshot   A pointer to the snapshot bytes.
+     * @param[in]  aLength     The snapshot length (number of bytes).
+     */
+    void SaveMdnsCacheSnapshot(const uint8_t *aSnapshot, uint16_t aLength);
+
+    /**
+     * Restores the mDNS cache snapshot from the temporary storage.
+     *
+     * A snapshot can be restored at most once. The snapshot is deleted from the temporary storage whether or not it is
+     * restored successfully, so a snapshot which cannot be used (e.g., since the wall-clock time was adjusted
+     * backwards) is discarded.
+     *
+     * @param[out]    aSnapshot     A pointer to a buffer to output the snapshot.
+     * @param[in,out] aLength       On input, the size of @p aSnapshot. On output, the snapshot length.
+     * @param[out]    aElapsedTime  The time (in seconds) elapsed since the snapshot was saved.
+     *
+     * @retval OT_ERROR_NONE        The snapshot was found and fetched successfully.
+     * @retval OT_ERROR_NOT_FOUND   No valid snapshot was found in the setting store.
+     */
+    otError RestoreMdnsCacheSnapshot(uint8_t *aSnapshot, uint16_t &aLength, uint32_t &aElapsedTime);
+
 private:
     enum
     {
-        kKeyBootTime           = 1,
-        kKeyRadioSpinelMetrics = 2,
+        kKeyBootTime              = 1,
+        kKeyRadioSpinelMetrics    = 2,
+        kKeyMdnsCacheSnapshotTime = 3,
+        kKeyMdnsCacheSnapshot     = 4,
     };
 
     otError SettingsFileInit(void);
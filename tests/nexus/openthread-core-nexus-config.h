@@ -132,6 +132,7 @@
 #define OPENTHREAD_CONFIG_NET_DIAG_VENDOR_OUI 0x020100
 #define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE 1
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 256
+#define OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE 1
 #define OPENTHREAD_CONFIG_PARENT_SEARCH_BACKOFF_INTERVAL (10 * 60)
 #define OPENTHREAD_CONFIG_PLATFORM_DNS_ENABLE 1
 #define OPENTHREAD_CONFIG_PLATFORM_DNSSD_ALLOW_RUN_TIME_SELECTION 0
@@ -146,6 +147,8 @@
 #define OPENTHREAD_CONFIG_RADIO_STATS_ENABLE 0
 #define OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE 1
 #define OPENTHREAD_CONFIG_SEEKER_ENABLE 1
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS 1000
+#define OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE 1
 #define OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_DEFAULT_MODE 0
 #define OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE 1
 #define OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE 1
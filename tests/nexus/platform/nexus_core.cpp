@@ -805,7 +805,8 @@ void Core::ProcessRadio(Node &aNode)
             int16_t localRssi = RadioModel::CalculateRssi(aNode, rxNode);
 
             // Completely intercept and drop packets that dip below target receiver sensitivity
-            if (RadioModel::ShouldDropPacket(localRssi))
+            // or that are lost based on the configured frame loss rate.
+            if (RadioModel::ShouldDropPacket(localRssi) || RadioModel::ShouldDropFrame())
             {
                 continue;
             }
@@ -901,7 +902,7 @@ void Core::ProcessRadio(Node &aNode)
 
             mPcap.WriteFrame(ackFrame, mNow);
 
-            if (RadioModel::ShouldDropPacket(ackRssi))
+            if (RadioModel::ShouldDropPacket(ackRssi) || RadioModel::ShouldDropFrame())
             {
                 otPlatRadioTxDone(&aNode.GetInstance(), &aNode.mRadio.mTxFrame, nullptr, kErrorNoAck);
             }
@@ -58,5 +58,33 @@ int16_t RadioModel::CalculateRssi(const Node &aTxNode, const Node &aRxNode)
 
 bool RadioModel::ShouldDropPacket(int16_t aRssi) { return aRssi < Radio::kRadioSensitivity; }
 
+uint8_t  RadioModel::sFrameLossPercent = 0;
+uint32_t RadioModel::sLossRandomState  = 0;
+
+void RadioModel::SetFrameLossRate(uint8_t aLossPercent)
+{
+    static constexpr uint32_t kLossRandomSeed = 0x2545f491;
+
+    sFrameLossPercent = Min<uint8_t>(aLossPercent, 100);
+    sLossRandomState  = kLossRandomSeed;
+}
+
+bool RadioModel::ShouldDropFrame(void)
+{
+    bool shouldDrop = false;
+
+    if (sFrameLossPercent > 0)
+    {
+        // xorshift32
+        sLossRandomState ^= sLossRandomState << 13;
+        sLossRandomState ^= sLossRandomState >> 17;
+        sLossRandomState ^= sLossRandomState << 5;
+
+        shouldDrop = (sLossRandomState % 100) < sFrameLossPercent;
+    }
+
+    return shouldDrop;
+}
+
 } // namespace Nexus
 } // namespace ot
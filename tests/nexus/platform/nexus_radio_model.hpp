@@ -67,6 +67,28 @@ public:
      * @retval false if the packet should not be dropped.
      */
     static bool ShouldDropPacket(int16_t aRssi);
+
+    /**
+     * This static method sets the frame loss rate applied to all links (in addition to drops based on RSSI).
+     *
+     * Each received frame (including ack frames) is independently dropped with the given probability. The losses
+     * follow a fixed pseudo-random sequence, which restarts whenever the rate is set, so that runs are repeatable.
+     *
+     * @param[in] aLossPercent  The frame loss rate in percent (0 disables the random losses).
+     */
+    static void SetFrameLossRate(uint8_t aLossPercent);
+
+    /**
+     * This static method determines if a received frame should be dropped based on the frame loss rate.
+     *
+     * @retval true if the frame should be dropped.
+     * @retval false if the frame should not be dropped.
+     */
+    static bool ShouldDropFrame(void);
+
+private:
+    static uint8_t  sFrameLossPercent;
+    static uint32_t sLossRandomState;
 };
 
 } // namespace Nexus
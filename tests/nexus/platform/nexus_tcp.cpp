@@ -0,0 +1,255 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "nexus_tcp.hpp"
+
+namespace ot {
+namespace Nexus {
+
+Node &FormRouterChain(Core &aNexus, Node &aLeader, Node *aRouters[], uint16_t aNumRouters)
+{
+    OT_ASSERT(aNumRouters > 0);
+
+    aLeader.Form();
+    aNexus.AdvanceTime(13 * 1000);
+    VerifyOrQuit(aLeader.Get<Mle::Mle>().IsLeader());
+
+    for (uint16_t i = 0; i < aNumRouters; i++)
+    {
+        Node &parent = (i == 0) ? aLeader : *aRouters[i - 1];
+
+        aRouters[i] = &aNexus.CreateNode();
+        aRouters[i]->SetName("ROUTER", i + 1);
+        AllowLinkBetween(*aRouters[i], parent);
+        aRouters[i]->Join(parent, Node::kAsFtd);
+        aNexus.AdvanceTime(200 * 1000);
+
+        VerifyOrQuit(aRouters[i]->Get<Mle::Mle>().IsRouter());
+    }
+
+    aNexus.AdvanceTime(60 * 1000);
+    aNexus.SendAndVerifyEchoRequest(*aRouters[aNumRouters - 1], aLeader.Get<Mle::Mle>().GetMeshLocalEid(), 0,
+                                    Ip6::kDefaultHopLimit, 5 * 1000);
+
+    return *aRouters[aNumRouters - 1];
+}
+
+TcpTransfer::TcpTransfer(Node    &aSender,
+                         Node    &aReceiver,
+                         uint16_t aPort,
+                         size_t   aSendBufferSize,
+                         size_t   aReceiveBufferSize)
+    : mIsEstablished(false)
+    , mShouldConsume(true)
+    , mMaxQueuedSegments(0)
+    , mTransferSize(0)
+    , mBytesCommitted(0)
+    , mBytesReceived(0)
+    , mSendBufferSize(aSendBufferSize)
+{
+    otTcpEndpointInitializeArgs endpointArgs;
+    otTcpListenerInitializeArgs listenerArgs;
+    Ip6::SockAddr               sockAddr;
+
+    OT_ASSERT(aSendBufferSize <= sizeof(mSendBufferBytes));
+    OT_ASSERT(aReceiveBufferSize <= sizeof(mReceiveBuffer));
+
+    ClearAllBytes(endpointArgs);
+    endpointArgs.mContext                 = this;
+    endpointArgs.mEstablishedCallback     = HandleEstablished;
+    endpointArgs.mForwardProgressCallback = HandleForwardProgress;
+    endpointArgs.mReceiveBuffer           = mSenderReceiveBuffer;
+    endpointArgs.mReceiveBufferSize       = sizeof(mSenderReceiveBuffer);
+    SuccessOrQuit(mSender.Initialize(aSender, endpointArgs));
+
+    ClearAllBytes(endpointArgs);
+    endpointArgs.mContext                  = this;
+    endpointArgs.mReceiveAvailableCallback = HandleReceiveAvailable;
+    endpointArgs.mReceiveBuffer            = mReceiveBuffer;
+    endpointArgs.mReceiveBufferSize        = aReceiveBufferSize;
+    SuccessOrQuit(mReceiver.Initialize(aReceiver, endpointArgs));
+
+    ClearAllBytes(listenerArgs);
+    listenerArgs.mContext             = this;
+    listenerArgs.mAcceptReadyCallback = HandleAcceptReady;
+    SuccessOrQuit(mListener.Initialize(aReceiver, listenerArgs));
+
+    sockAddr.SetPort(aPort);
+    SuccessOrQuit(mListener.Listen(sockAddr));
+
+    mSendBuffer.Initialize(mSendBufferBytes, aSendBufferSize);
+
+    mPeerSockAddr.SetAddress(aReceiver.Get<Mle::Mle>().GetMeshLocalEid());
+    mPeerSockAddr.SetPort(aPort);
+}
+
+TcpTransfer::~TcpTransfer(void)
+{
+    SuccessOrQuit(mSender.Abort());
+    SuccessOrQuit(mReceiver.Abort());
+    mSendBuffer.ForceDiscardAll();
+    SuccessOrQuit(mSendBuffer.Deinitialize());
+    SuccessOrQuit(mSender.Deinitialize());
+    SuccessOrQuit(mReceiver.Deinitialize());
+    SuccessOrQuit(mListener.Deinitialize());
+}
+
+void TcpTransfer::Connect(uint32_t aFlags) { SuccessOrQuit(mSender.Connect(mPeerSockAddr, aFlags)); }
+
+Error TcpTransfer::Commit(size_t aLength, uint32_t aFlags)
+{
+    Error error = mSendBuffer.Commit(mSender, aLength, aFlags);
+
+    if (error == kErrorNone)
+    {
+        mBytesCommitted += static_cast<uint32_t>(aLength);
+
+        // The segments are handed to the IPv6 layer (and queued) as
+        // part of the commit.
+        UpdateMaxQueuedSegments();
+    }
+
+    return error;
+}
+
+void TcpTransfer::Fill(size_t aIndex, size_t aLength, uint32_t aStreamOffset)
+{
+    for (size_t i = 0; i < aLength; i++)
+    {
+        mSendBufferBytes[(aIndex + i) % mSendBufferSize] = GetPatternByte(aStreamOffset + static_cast<uint32_t>(i));
+    }
+}
+
+void TcpTransfer::StartConsuming(void)
+{
+    mShouldConsume = true;
+    ConsumeReceiveBuffer();
+}
+
+TcpTransfer &TcpTransfer::From(otTcpEndpoint *aEndpoint)
+{
+    return *static_cast<TcpTransfer *>(AsCoreType(aEndpoint).GetContext());
+}
+
+void TcpTransfer::HandleEstablished(otTcpEndpoint *aEndpoint)
+{
+    From(aEndpoint).mIsEstablished = true;
+    From(aEndpoint).FillSendBuffer();
+}
+
+void TcpTransfer::HandleForwardProgress(otTcpEndpoint *aEndpoint, size_t aInSendBuffer, size_t aBacklog)
+{
+    OT_UNUSED_VARIABLE(aBacklog);
+
+    From(aEndpoint).UpdateMaxQueuedSegments();
+    From(aEndpoint).mSendBuffer.HandleForwardProgress(aInSendBuffer);
+    From(aEndpoint).FillSendBuffer();
+}
+
+void TcpTransfer::HandleReceiveAvailable(otTcpEndpoint *aEndpoint,
+                                         size_t         aBytesAvailable,
+                                         bool           aEndOfStream,
+                                         size_t         aBytesRemaining)
+{
+    OT_UNUSED_VARIABLE(aBytesAvailable);
+    OT_UNUSED_VARIABLE(aEndOfStream);
+    OT_UNUSED_VARIABLE(aBytesRemaining);
+
+    if (From(aEndpoint).mShouldConsume)
+    {
+        From(aEndpoint).ConsumeReceiveBuffer();
+    }
+}
+
+otTcpIncomingConnectionAction TcpTransfer::HandleAcceptReady(otTcpListener    *aListener,
+                                                             const otSockAddr *aPeer,
+                                                             otTcpEndpoint   **aAcceptInto)
+{
+    TcpTransfer &transfer = *static_cast<TcpTransfer *>(AsCoreType(aListener).GetContext());
+
+    OT_UNUSED_VARIABLE(aPeer);
+
+    *aAcceptInto = &transfer.mReceiver;
+
+    return OT_TCP_INCOMING_CONNECTION_ACTION_ACCEPT;
+}
+
+void TcpTransfer::FillSendBuffer(void)
+{
+    while (mBytesCommitted < mTransferSize)
+    {
+        uint8_t *data;
+        size_t   length;
+        uint32_t flags = 0;
+
+        mSendBuffer.GetWritableSpan(data, length);
+        length = Min<size_t>(length, mTransferSize - mBytesCommitted);
+
+        if (length == 0)
+        {
+            break;
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+            data[i] = GetPatternByte(mBytesCommitted + static_cast<uint32_t>(i));
+        }
+
+        if (mBytesCommitted + length < mTransferSize)
+        {
+            flags = OT_TCP_CIRCULAR_SEND_BUFFER_WRITE_MORE_TO_COME;
+        }
+
+        SuccessOrQuit(Commit(length, flags));
+    }
+}
+
+void TcpTransfer::ConsumeReceiveBuffer(void)
+{
+    const otLinkedBuffer *buffer;
+    size_t                length = 0;
+
+    SuccessOrQuit(mReceiver.ReceiveByReference(buffer));
+
+    for (; buffer != nullptr; buffer = buffer->mNext)
+    {
+        for (size_t i = 0; i < buffer->mLength; i++)
+        {
+            VerifyOrQuit(buffer->mData[i] == GetPatternByte(mBytesReceived + static_cast<uint32_t>(length + i)));
+        }
+
+        length += buffer->mLength;
+    }
+
+    VerifyOrQuit(mBytesReceived + length <= mBytesCommitted);
+    SuccessOrQuit(mReceiver.CommitReceive(length, 0));
+    mBytesReceived += static_cast<uint32_t>(length);
+}
+
+} // namespace Nexus
+} // namespace ot
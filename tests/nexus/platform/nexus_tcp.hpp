@@ -0,0 +1,186 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OT_NEXUS_PLATFORM_NEXUS_TCP_HPP_
+#define OT_NEXUS_PLATFORM_NEXUS_TCP_HPP_
+
+#include "openthread-core-config.h"
+
+#include "net/tcp6.hpp"
+#include "net/tcp6_ext.hpp"
+
+#include "nexus_core.hpp"
+#include "nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Forms a network with a leader and a chain of routers, where each router only has a link to the previous one
+ * (the first one to the leader), and verifies the connectivity from the last router to the leader.
+ *
+ * @param[in]  aNexus       The Nexus core.
+ * @param[in]  aLeader      The node to form the network as leader.
+ * @param[out] aRouters     An array to output the created routers (`aNumRouters` entries).
+ * @param[in]  aNumRouters  The number of routers in the chain.
+ *
+ * @returns The last router of the chain.
+ */
+Node &FormRouterChain(Core &aNexus, Node &aLeader, Node *aRouters[], uint16_t aNumRouters);
+
+/**
+ * This class implements a TCP transfer between two nodes, used by the TCP tests.
+ *
+ * The sender endpoint produces the data directly in a circular send buffer, while the receiver endpoint (accepted by a
+ * listener on the receiver node) consumes the data from its receive buffer by reference. The transferred data follows
+ * a fixed pattern which the receiver verifies.
+ *
+ * The data is either committed by the test (`Commit()`) or, when a transfer size is set, produced automatically as
+ * soon as the connection is established and as the send buffer frees up.
+ */
+class TcpTransfer
+{
+public:
+    static constexpr size_t kMaxBufferSize = OT_TCP_RECEIVE_BUFFER_SIZE_MANY_HOPS;
+
+    /**
+     * Initializes the endpoints and starts listening on the receiver node. The sender is not connected yet, so that
+     * it can be configured before calling `Connect()`.
+     *
+     * @param[in] aSender             The sender node.
+     * @param[in] aReceiver           The receiver node.
+     * @param[in] aPort               The port to listen on.
+     * @param[in] aSendBufferSize     The capacity of the circular send buffer (at most `kMaxBufferSize`).
+     * @param[in] aReceiveBufferSize  The size of the receive buffer of the receiver (at most `kMaxBufferSize`).
+     */
+    TcpTransfer(Node    &aSender,
+                Node    &aReceiver,
+                uint16_t aPort,
+                size_t   aSendBufferSize    = kMaxBufferSize,
+                size_t   aReceiveBufferSize = kMaxBufferSize);
+
+    ~TcpTransfer(void);
+
+    /**
+     * Connects the sender to the receiver.
+     *
+     * @param[in] aFlags  The `OT_TCP_CONNECT_*` flags.
+     */
+    void Connect(uint32_t aFlags);
+
+    /**
+     * Sets the number of bytes to produce automatically (zero disables it, which is the default).
+     *
+     * @param[in] aTransferSize  The transfer size in bytes.
+     */
+    void SetTransferSize(uint32_t aTransferSize) { mTransferSize = aTransferSize; }
+
+    /**
+     * Commits data written by the test into the circular send buffer.
+     *
+     * @param[in] aLength  The number of bytes to commit.
+     * @param[in] aFlags   The `OT_TCP_CIRCULAR_SEND_BUFFER_WRITE_*` flags.
+     *
+     * @returns The error returned by the circular send buffer.
+     */
+    Error Commit(size_t aLength, uint32_t aFlags);
+
+    /**
+     * Fills the send buffer with the pattern of the stream bytes starting at `aStreamOffset`, wrapping around the end
+     * of the buffer.
+     *
+     * @param[in] aIndex         The index in the send buffer to start from.
+     * @param[in] aLength        The number of bytes to fill.
+     * @param[in] aStreamOffset  The stream offset of the first byte.
+     */
+    void Fill(size_t aIndex, size_t aLength, uint32_t aStreamOffset);
+
+    /**
+     * Starts consuming the received data (the default), including any data already received.
+     */
+    void StartConsuming(void);
+
+    /**
+     * Stops consuming the received data, so that it is left in the receive buffer.
+     */
+    void StopConsuming(void) { mShouldConsume = false; }
+
+    /**
+     * Samples the number of data segments of the sender waiting in its send queue, keeping track of the maximum.
+     */
+    void UpdateMaxQueuedSegments(void) { mMaxQueuedSegments = Max(mMaxQueuedSegments, mSender.GetQueuedSegments()); }
+
+    bool     IsEstablished(void) const { return mIsEstablished; }
+    bool     IsComplete(void) const { return (mTransferSize > 0) && (mBytesReceived == mTransferSize); }
+    uint32_t GetBytesCommitted(void) const { return mBytesCommitted; }
+    uint32_t GetBytesReceived(void) const { return mBytesReceived; }
+    uint8_t  GetMaxQueuedSegments(void) const { return mMaxQueuedSegments; }
+
+    Ip6::Tcp::Endpoint               &GetSender(void) { return mSender; }
+    const Ip6::TcpCircularSendBuffer &GetSendBuffer(void) const { return mSendBuffer; }
+    const uint8_t                    *GetSendBufferBytes(void) const { return mSendBufferBytes; }
+
+    static uint8_t GetPatternByte(uint32_t aOffset) { return static_cast<uint8_t>(aOffset % 251); }
+
+private:
+    static TcpTransfer &From(otTcpEndpoint *aEndpoint);
+
+    static void HandleEstablished(otTcpEndpoint *aEndpoint);
+    static void HandleForwardProgress(otTcpEndpoint *aEndpoint, size_t aInSendBuffer, size_t aBacklog);
+    static void HandleReceiveAvailable(otTcpEndpoint *aEndpoint,
+                                       size_t         aBytesAvailable,
+                                       bool           aEndOfStream,
+                                       size_t         aBytesRemaining);
+    static otTcpIncomingConnectionAction HandleAcceptReady(otTcpListener    *aListener,
+                                                           const otSockAddr *aPeer,
+                                                           otTcpEndpoint   **aAcceptInto);
+
+    void FillSendBuffer(void);
+    void ConsumeReceiveBuffer(void);
+
+    Ip6::Tcp::Endpoint         mSender;
+    Ip6::Tcp::Endpoint         mReceiver;
+    Ip6::Tcp::Listener         mListener;
+    Ip6::TcpCircularSendBuffer mSendBuffer;
+    Ip6::SockAddr              mPeerSockAddr;
+    bool                       mIsEstablished;
+    bool                       mShouldConsume;
+    uint8_t                    mMaxQueuedSegments;
+    uint32_t                   mTransferSize;
+    uint32_t                   mBytesCommitted;
+    uint32_t                   mBytesReceived;
+    size_t                     mSendBufferSize;
+    uint8_t                    mSendBufferBytes[kMaxBufferSize];
+    uint8_t                    mSenderReceiveBuffer[OT_TCP_RECEIVE_BUFFER_SIZE_FEW_HOPS];
+    uint8_t                    mReceiveBuffer[kMaxBufferSize];
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // OT_NEXUS_PLATFORM_NEXUS_TCP_HPP_
@@ -127,6 +127,9 @@ void TestBorderAgent(void)
     VerifyOrQuit(sessionInfo.mIsConnected);
     VerifyOrQuit(!sessionInfo.mIsCommissioner);
     VerifyOrQuit(node1.Get<ThreadNetif>().HasUnicastAddress(AsCoreType(&sessionInfo.mPeerSockAddr.mAddress)));
+    VerifyOrQuit(sessionInfo.mHandshakeDuration <= sessionInfo.mLifetime);
+    VerifyOrQuit(sessionInfo.mRxBytes > 0);
+    VerifyOrQuit(sessionInfo.mTxBytes > 0);
     VerifyOrQuit(iter.GetNextSessionInfo(sessionInfo) == kErrorNotFound);
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -2786,6 +2789,89 @@ void TestBorderAgentSessionsLimit(void)
     Log("TestBorderAgentSessionsLimit passed successfully!");
 }
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+
+void TestBorderAgentSessionResumption(void)
+{
+    Core          nexus;
+    Node         &node0 = nexus.CreateNode();
+    Node         &node1 = nexus.CreateNode();
+    Ip6::SockAddr sockAddr;
+    Pskc          pskc;
+
+    Log("------------------------------------------------------------------------------------------------------");
+    Log("TestBorderAgentSessionResumption");
+
+    nexus.AdvanceTime(0);
+    SuccessOrQuit(node0.SetLogLevel(kLogLevelInfo));
+
+    node0.Form();
+    nexus.AdvanceTime(50 * Time::kOneSecondInMsec);
+    VerifyOrQuit(node0.Get<Mle::Mle>().IsLeader());
+
+    SuccessOrQuit(node1.Get<Mac::Mac>().SetPanChannel(node0.Get<Mac::Mac>().GetPanChannel()));
+    node1.Get<Mac::Mac>().SetPanId(node0.Get<Mac::Mac>().GetPanId());
+    node1.Get<ThreadNetif>().Up();
+
+    VerifyOrQuit(node0.Get<Manager>().IsRunning());
+    SuccessOrQuit(node0.Get<Ip6::Filter>().AddUnsecurePort(node0.Get<Manager>().GetUdpPort()));
+
+    sockAddr.SetAddress(node0.Get<Mle::Mle>().GetLinkLocalAddress());
+    sockAddr.SetPort(node0.Get<Manager>().GetUdpPort());
+    node0.Get<KeyManager>().GetPskc(pskc);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Establish a first session using a full EC-JPAKE handshake");
+
+    node1.Get<Tmf::SecureAgent>().SetSessionTicketsEnabled(true);
+    SuccessOrQuit(node1.Get<Tmf::SecureAgent>().SetPsk(pskc.m8, Pskc::kSize));
+    SuccessOrQuit(node1.Get<Tmf::SecureAgent>().Open(0));
+    SuccessOrQuit(node1.Get<Tmf::SecureAgent>().Connect(sockAddr));
+
+    nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+    VerifyOrQuit(node1.Get<Tmf::SecureAgent>().IsConnected());
+    VerifyOrQuit(node0.Get<Manager>().GetCounters().mPskcSecureSessionSuccesses == 1);
+    VerifyOrQuit(node0.Get<Manager>().GetResumedSessionCount() == 0);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Reconnect and check the session is resumed using the ticket (abbreviated handshake)");
+
+    node1.Get<Tmf::SecureAgent>().Disconnect();
+    nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+    VerifyOrQuit(!node1.Get<Tmf::SecureAgent>().IsConnected());
+
+    SuccessOrQuit(node1.Get<Tmf::SecureAgent>().Connect(sockAddr));
+
+    nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+    VerifyOrQuit(node1.Get<Tmf::SecureAgent>().IsConnected());
+    VerifyOrQuit(node0.Get<Manager>().GetCounters().mPskcSecureSessionSuccesses == 2);
+    VerifyOrQuit(node0.Get<Manager>().GetResumedSessionCount() == 1);
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    Log("Close the client transport and check the next session uses a full handshake again");
+
+    node1.Get<Tmf::SecureAgent>().Close();
+    nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+
+    SuccessOrQuit(node1.Get<Tmf::SecureAgent>().Open(0));
+    SuccessOrQuit(node1.Get<Tmf::SecureAgent>().Connect(sockAddr));
+
+    nexus.AdvanceTime(1 * Time::kOneSecondInMsec);
+
+    VerifyOrQuit(node1.Get<Tmf::SecureAgent>().IsConnected());
+    VerifyOrQuit(node0.Get<Manager>().GetCounters().mPskcSecureSessionSuccesses == 3);
+    VerifyOrQuit(node0.Get<Manager>().GetResumedSessionCount() == 1);
+
+    node1.Get<Tmf::SecureAgent>().Close();
+    nexus.AdvanceTime(3 * Time::kOneSecondInMsec);
+
+    Log("TestBorderAgentSessionResumption passed successfully!");
+}
+
+#endif // OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+
 } // namespace Nexus
 } // namespace ot
 
@@ -2799,6 +2885,9 @@ int main(void)
     ot::Nexus::TestBorderAgentServiceRegistration();
     ot::Nexus::TestBorderAgentServiceRegistrationRename();
     ot::Nexus::TestBorderAgentSessionsLimit();
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+    ot::Nexus::TestBorderAgentSessionResumption();
+#endif
     printf("All tests passed\n");
     return 0;
 }
@@ -206,6 +206,13 @@ void TestCoapsX509(void)
     nexus.AdvanceTime(5 * 1000);
     VerifyOrQuit(router.Get<Coap::ApplicationCoapSecure>().IsConnected());
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+    // The client side ECDHE-ECDSA handshake uses restartable ECC, so it
+    // must have been paused and resumed at least once before completing.
+    Log("Handshake resume count: %lu", ToUlong(router.Get<Coap::ApplicationCoapSecure>().GetHandshakeResumeCount()));
+    VerifyOrQuit(router.Get<Coap::ApplicationCoapSecure>().GetHandshakeResumeCount() > 0);
+#endif
+
     Log("Send GET request");
     Coap::Message *message = router.Get<Coap::ApplicationCoapSecure>().NewMessage();
     VerifyOrQuit(message != nullptr);
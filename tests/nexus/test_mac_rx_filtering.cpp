@@ -0,0 +1,216 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/platform/radio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint32_t kNumFramesPerType          = 100;
+static constexpr uint32_t kNumBenchmarkFramesPerType = 100000;
+static constexpr uint8_t  kNumFrameTypes             = 3;
+static constexpr uint8_t  kPayloadLength             = 16;
+static constexpr uint8_t  kFcsSize                   = 2; // FCS is not checked by the MAC layer.
+static constexpr uint16_t kSrcShortAddress           = 0x0401;
+
+// IEEE 802.15.4-2006 Data frame with PAN ID Compression and a short
+// source address. The destination is short or extended.
+static constexpr uint16_t kFcfDataShortDst = 0x9841;
+static constexpr uint16_t kFcfDataExtDst   = 0x9c41;
+
+struct TestFrame
+{
+    void InitShortDst(uint16_t aDstPanId, uint16_t aDstShort)
+    {
+        uint16_t length = 0;
+
+        length += Write16(length, kFcfDataShortDst);
+        mPsdu[length++] = 0x55; // Sequence number
+        length += Write16(length, aDstPanId);
+        length += Write16(length, aDstShort);
+        length += Write16(length, kSrcShortAddress);
+
+        Finish(length);
+    }
+
+    void InitExtDst(uint16_t aDstPanId, const Mac::ExtAddress &aDstExt)
+    {
+        uint16_t length = 0;
+
+        length += Write16(length, kFcfDataExtDst);
+        mPsdu[length++] = 0x55; // Sequence number
+        length += Write16(length, aDstPanId);
+        aDstExt.CopyTo(&mPsdu[length], Mac::ExtAddress::kReverseByteOrder);
+        length += sizeof(Mac::ExtAddress);
+        length += Write16(length, kSrcShortAddress);
+
+        Finish(length);
+    }
+
+    uint16_t Write16(uint16_t aOffset, uint16_t aValue)
+    {
+        LittleEndian::WriteUint16(aValue, &mPsdu[aOffset]);
+        return sizeof(uint16_t);
+    }
+
+    void Finish(uint16_t aLength)
+    {
+        memset(&mPsdu[aLength], 0xaa, kPayloadLength + kFcsSize);
+        aLength += kPayloadLength + kFcsSize;
+
+        ClearAllBytes(mFrame);
+        mFrame.mPsdu   = mPsdu;
+        mFrame.mLength = aLength;
+    }
+
+    Mac::RxFrame mFrame;
+    uint8_t      mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+};
+
+typedef TestFrame TestFrames[kNumFrameTypes];
+
+// Forms the network on `aNode` and prepares the frames to feed to
+// it. Three frame types are used:
+//  - A frame to a short address which does not match the node.
+//  - A broadcast frame to a different PAN ID.
+//  - A frame to an extended address which does not match the node.
+static void PrepareRxFiltering(Core &aNexus, Node &aNode, TestFrames &aFrames)
+{
+    Mac::ExtAddress   otherExtAddress;
+    Mac::PanId        panId;
+    Mac::ShortAddress otherShortAddress;
+
+    aNode.Form();
+    aNexus.AdvanceTime(13 * 1000);
+    VerifyOrQuit(aNode.Get<Mle::Mle>().IsLeader());
+
+    panId             = aNode.Get<Mac::Mac>().GetPanId();
+    otherShortAddress = aNode.Get<Mac::Mac>().GetShortAddress() ^ 0x1111;
+    otherExtAddress   = aNode.Get<Mac::Mac>().GetExtAddress();
+    otherExtAddress.m8[0] ^= 0xff;
+
+    aFrames[0].InitShortDst(panId, otherShortAddress);
+    aFrames[1].InitShortDst(panId ^ 0x1111, Mac::kShortAddrBroadcast);
+    aFrames[2].InitExtDst(panId, otherExtAddress);
+
+    aNode.Get<Mac::Mac>().ResetCounters();
+}
+
+// Feeds the frames directly to the node's simulated radio through
+// `otPlatRadioReceiveDone()` and verifies they are all filtered.
+static void ReceiveAndVerifyFiltered(Node &aNode, TestFrames &aFrames, uint32_t aNumFramesPerType)
+{
+    uint32_t      numFrames = aNumFramesPerType * kNumFrameTypes;
+    Mac::Counters counters;
+
+    for (uint32_t i = 0; i < aNumFramesPerType; i++)
+    {
+        for (TestFrame &frame : aFrames)
+        {
+            otPlatRadioReceiveDone(&aNode.GetInstance(), &frame.mFrame, kErrorNone);
+        }
+    }
+
+    counters = aNode.Get<Mac::Mac>().GetCounters();
+
+    VerifyOrQuit(counters.mRxTotal == numFrames);
+    VerifyOrQuit(counters.mRxDestAddrFiltered == numFrames);
+    VerifyOrQuit(counters.mRxData == 0);
+}
+
+/**
+ * This test verifies that received frames are filtered by the destination PAN ID and address checks in
+ * `Mac::HandleReceivedFrame()` and counted.
+ */
+void TestMacRxFiltering(void)
+{
+    Core       nexus;
+    Node      &node = nexus.CreateNode();
+    TestFrames frames;
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestMacRxFiltering");
+
+    PrepareRxFiltering(nexus, node, frames);
+    ReceiveAndVerifyFiltered(node, frames, kNumFramesPerType);
+}
+
+/**
+ * This benchmark measures the rate of received frames processed by `Mac::HandleReceivedFrame()` when they are
+ * filtered, and logs the number of frames processed per second of CPU time.
+ *
+ * It is not part of the default test run. It is run by passing the `benchmark` argument.
+ */
+void BenchmarkMacRxFiltering(void)
+{
+    Core       nexus;
+    Node      &node = nexus.CreateNode();
+    TestFrames frames;
+    clock_t    startClock;
+    uint32_t   cpuTime;
+    uint32_t   numFrames;
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("BenchmarkMacRxFiltering");
+
+    PrepareRxFiltering(nexus, node, frames);
+
+    startClock = clock();
+    ReceiveAndVerifyFiltered(node, frames, kNumBenchmarkFramesPerType);
+    cpuTime = static_cast<uint32_t>((clock() - startClock) * 1000 / CLOCKS_PER_SEC);
+
+    numFrames = kNumBenchmarkFramesPerType * kNumFrameTypes;
+
+    Log("Filtered %lu frames in %lu ms cpu time, %lu frames/sec", ToUlong(numFrames), ToUlong(cpuTime),
+        ToUlong((cpuTime == 0) ? 0 : static_cast<uint32_t>(numFrames * 1000ull / cpuTime)));
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(int argc, char *argv[])
+{
+    if ((argc > 1) && (strcmp(argv[1], "benchmark") == 0))
+    {
+        ot::Nexus::BenchmarkMacRxFiltering();
+    }
+    else
+    {
+        ot::Nexus::TestMacRxFiltering();
+    }
+
+    printf("All tests passed\n");
+    return 0;
+}
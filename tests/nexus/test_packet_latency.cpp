@@ -0,0 +1,250 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+using Tracker = Utils::PacketLatencyTracker;
+
+static constexpr uint16_t kNumPings       = 5;
+static constexpr uint16_t kLargePayload   = 400; // Requires 6LoWPAN fragmentation.
+static constexpr uint32_t kSedPollPeriod  = 500;
+static constexpr uint32_t kResponseWaitMs = 5 * 1000;
+
+static uint32_t GetCount(Node &aNode, Tracker::Stage aStage, Tracker::TxMode aTxMode)
+{
+    // Returns the count summed over all priorities.
+
+    uint32_t           count = 0;
+    Tracker::Histogram histogram;
+
+    for (uint8_t priority = 0; priority < Tracker::kNumPriorities; priority++)
+    {
+        SuccessOrQuit(aNode.Get<Tracker>().GetHistogram(aStage, priority, aTxMode, histogram));
+        count += histogram.mCount;
+    }
+
+    return count;
+}
+
+static uint32_t GetMaxLatency(Node &aNode, Tracker::Stage aStage, Tracker::TxMode aTxMode)
+{
+    uint32_t           maxLatency = 0;
+    Tracker::Histogram histogram;
+
+    for (uint8_t priority = 0; priority < Tracker::kNumPriorities; priority++)
+    {
+        SuccessOrQuit(aNode.Get<Tracker>().GetHistogram(aStage, priority, aTxMode, histogram));
+        maxLatency = Max(maxLatency, histogram.mMaxLatency);
+    }
+
+    return maxLatency;
+}
+
+static void VerifyHistograms(Node &aNode)
+{
+    // Verifies the invariants of all histograms of a node.
+
+    Tracker::Histogram histogram;
+
+    for (uint8_t stage = 0; stage < Tracker::kNumStages; stage++)
+    {
+        for (uint8_t priority = 0; priority < Tracker::kNumPriorities; priority++)
+        {
+            for (uint8_t mode = 0; mode < Tracker::kNumTxModes; mode++)
+            {
+                uint32_t bucketSum = 0;
+
+                SuccessOrQuit(aNode.Get<Tracker>().GetHistogram(static_cast<Tracker::Stage>(stage), priority,
+                                                                static_cast<Tracker::TxMode>(mode), histogram));
+
+                for (uint32_t bucket : histogram.mBuckets)
+                {
+                    bucketSum += bucket;
+                }
+
+                VerifyOrQuit(bucketSum == histogram.mCount);
+
+                if (histogram.mCount == 0)
+                {
+                    VerifyOrQuit(histogram.mTotalLatency == 0);
+                    VerifyOrQuit(histogram.mMaxLatency == 0);
+                }
+                else
+                {
+                    VerifyOrQuit(histogram.mMaxLatency <= histogram.mTotalLatency);
+                    VerifyOrQuit(histogram.mTotalLatency / histogram.mCount <= histogram.mMaxLatency);
+                }
+            }
+        }
+    }
+
+    for (uint8_t mode = 0; mode < Tracker::kNumTxModes; mode++)
+    {
+        Tracker::TxMode txMode = static_cast<Tracker::TxMode>(mode);
+
+        // The IPv6 and queue stages are recorded once per message (along
+        // with its first frame), the 6LoWPAN stage for every frame
+        // preparation and the MAC stage for every sent frame.
+
+        VerifyOrQuit(GetCount(aNode, Tracker::kStageIp6, txMode) == GetCount(aNode, Tracker::kStageQueue, txMode));
+        VerifyOrQuit(GetCount(aNode, Tracker::kStageLowpan, txMode) >= GetCount(aNode, Tracker::kStageQueue, txMode));
+        VerifyOrQuit(GetCount(aNode, Tracker::kStageMac, txMode) <= GetCount(aNode, Tracker::kStageLowpan, txMode));
+        VerifyOrQuit(GetCount(aNode, Tracker::kStageEndToEnd, txMode) <= GetCount(aNode, Tracker::kStageIp6, txMode));
+    }
+}
+
+void TestPacketLatency(void)
+{
+    /**
+     * Test packet latency tracker in a multi-hop topology.
+     *
+     * Topology:
+     *   ROUTER_2 ----- LEADER ---- ROUTER_1
+     *                                 |
+     *                                SED
+     *
+     * ROUTER_2 pings SED. The echo requests are forwarded by LEADER
+     * (mesh forwarded) and by ROUTER_1 (indirect tx to SED).
+     */
+
+    Core nexus;
+
+    Node &leader  = nexus.CreateNode();
+    Node &router1 = nexus.CreateNode();
+    Node &router2 = nexus.CreateNode();
+    Node &sed     = nexus.CreateNode();
+
+    leader.SetName("LEADER");
+    router1.SetName("ROUTER_1");
+    router2.SetName("ROUTER_2");
+    sed.SetName("SED");
+
+    AllowLinkBetween(leader, router1);
+    AllowLinkBetween(leader, router2);
+    AllowLinkBetween(router1, sed);
+
+    nexus.AdvanceTime(0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 1: Form network");
+
+    leader.Form();
+    nexus.AdvanceTime(13 * 1000); // kFormNetworkTime
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    router1.Join(leader);
+    router2.Join(leader);
+    nexus.AdvanceTime(200 * 1000); // kAttachToRouterTime
+    VerifyOrQuit(router1.Get<Mle::Mle>().IsRouter());
+    VerifyOrQuit(router2.Get<Mle::Mle>().IsRouter());
+
+    sed.Join(router1, Node::kAsSed);
+    SuccessOrQuit(sed.Get<DataPollSender>().SetExternalPollPeriod(kSedPollPeriod));
+    nexus.AdvanceTime(5 * 1000); // kAttachAsChildTime
+    VerifyOrQuit(sed.Get<Mle::Mle>().IsChild());
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 2: Reset histograms");
+
+    for (Node &node : nexus.GetNodes())
+    {
+        node.Get<Tracker>().Reset();
+        VerifyOrQuit(GetCount(node, Tracker::kStageIp6, Tracker::kTxModeDirect) == 0);
+        VerifyOrQuit(GetCount(node, Tracker::kStageIp6, Tracker::kTxModeIndirect) == 0);
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 3: Ping SED from ROUTER_2 (multi-hop)");
+
+    for (uint16_t i = 0; i < kNumPings; i++)
+    {
+        nexus.SendAndVerifyEchoRequest(router2, sed.Get<Mle::Mle>().GetMeshLocalEid(), kLargePayload,
+                                       Ip6::kDefaultHopLimit, kResponseWaitMs);
+    }
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 4: Verify histograms");
+
+    for (Node &node : nexus.GetNodes())
+    {
+        VerifyHistograms(node);
+    }
+
+    // ROUTER_2 sent the echo requests directly, each in multiple
+    // fragment frames.
+
+    VerifyOrQuit(GetCount(router2, Tracker::kStageEndToEnd, Tracker::kTxModeDirect) >= kNumPings);
+    VerifyOrQuit(GetCount(router2, Tracker::kStageMac, Tracker::kTxModeDirect) >= 2 * kNumPings);
+    VerifyOrQuit(GetMaxLatency(router2, Tracker::kStageMac, Tracker::kTxModeDirect) > 0);
+
+    // LEADER forwarded the echo requests and replies.
+
+    VerifyOrQuit(GetCount(leader, Tracker::kStageEndToEnd, Tracker::kTxModeDirect) >= 2 * kNumPings);
+
+    // ROUTER_1 forwarded the echo requests to SED using indirect tx,
+    // which waits for the data poll from SED.
+
+    VerifyOrQuit(GetCount(router1, Tracker::kStageEndToEnd, Tracker::kTxModeIndirect) >= kNumPings);
+    VerifyOrQuit(GetCount(router1, Tracker::kStageMac, Tracker::kTxModeIndirect) >= 2 * kNumPings);
+    VerifyOrQuit(GetMaxLatency(router1, Tracker::kStageQueue, Tracker::kTxModeIndirect) >
+                 GetMaxLatency(router1, Tracker::kStageQueue, Tracker::kTxModeDirect));
+
+    // SED sent the echo replies directly to its parent.
+
+    VerifyOrQuit(GetCount(sed, Tracker::kStageEndToEnd, Tracker::kTxModeDirect) >= kNumPings);
+    VerifyOrQuit(GetCount(sed, Tracker::kStageEndToEnd, Tracker::kTxModeIndirect) == 0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Step 5: Reset histograms");
+
+    router1.Get<Tracker>().Reset();
+
+    for (uint8_t stage = 0; stage < Tracker::kNumStages; stage++)
+    {
+        VerifyOrQuit(GetCount(router1, static_cast<Tracker::Stage>(stage), Tracker::kTxModeDirect) == 0);
+        VerifyOrQuit(GetCount(router1, static_cast<Tracker::Stage>(stage), Tracker::kTxModeIndirect) == 0);
+    }
+
+    nexus.SaveTestInfo("test_packet_latency.json");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestPacketLatency();
+    printf("All tests passed\n");
+    return 0;
+}
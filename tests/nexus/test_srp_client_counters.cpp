@@ -104,6 +104,9 @@ void TestSrpClientCounters(void)
         VerifyOrQuit(counters.mHostAndServicesRemoves == 0);
         VerifyOrQuit(counters.mHostAndServicesClears == 0);
         VerifyOrQuit(counters.mTxTotalBytes == 0);
+        VerifyOrQuit(counters.mTxPartialUpdates == 0);
+        VerifyOrQuit(counters.mTxSkippedServices == 0);
+        VerifyOrQuit(counters.mTxEstimatedFrames == 0);
         VerifyOrQuit(counters.mRegisteredTime == 0);
         VerifyOrQuit(counters.mAnycastAvailableTime == 0);
         VerifyOrQuit(counters.mUnicastAvailableTime == 0);
@@ -136,6 +139,8 @@ void TestSrpClientCounters(void)
         VerifyOrQuit(counters.mServiceAdds == 1);
         VerifyOrQuit(counters.mHostAddressChanges >= 1);
         VerifyOrQuit(counters.mTxTotalBytes > 0);
+        VerifyOrQuit(counters.mTxEstimatedFrames >= counters.mTxUpdates);
+        VerifyOrQuit(counters.mTxPartialUpdates == 0);
         VerifyOrQuit(counters.mTrackedTime > 0);
         VerifyOrQuit(counters.mRegisteredTime <= counters.mTrackedTime);
         VerifyOrQuit(counters.mUnicastAvailableTime > 0);
@@ -227,6 +232,9 @@ void TestSrpClientCounters(void)
         VerifyOrQuit(counters.mHostAndServicesRemoves == 0);
         VerifyOrQuit(counters.mHostAndServicesClears == 0);
         VerifyOrQuit(counters.mTxTotalBytes == 0);
+        VerifyOrQuit(counters.mTxPartialUpdates == 0);
+        VerifyOrQuit(counters.mTxSkippedServices == 0);
+        VerifyOrQuit(counters.mTxEstimatedFrames == 0);
         VerifyOrQuit(counters.mRegisteredTime == 0);
         VerifyOrQuit(counters.mAnycastAvailableTime == 0);
         VerifyOrQuit(counters.mUnicastAvailableTime == 0);
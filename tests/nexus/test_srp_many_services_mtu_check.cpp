@@ -146,6 +146,19 @@ void TestSrpManyServicesMtuCheck(void)
 
     Log("Registration worked for 15 long services on both client and server (MTU exceeded).");
 
+    {
+        // Services are split across multiple updates, each carrying
+        // as many services as fit within the MTU.
+
+        const otSrpClientCounters &counters = client.Get<Srp::Client>().GetCounters();
+
+        Log("Update attempts: %lu, partial updates: %lu, estimated frames: %lu", ToUlong(counters.mUpdateAttempts),
+            ToUlong(counters.mTxPartialUpdates), ToUlong(counters.mTxEstimatedFrames));
+
+        VerifyOrQuit(counters.mTxPartialUpdates >= 1);
+        VerifyOrQuit(counters.mUpdateAttempts < kNumServices);
+    }
+
     Log("---------------------------------------------------------------------------------------");
     Log("Step 4: Remove all 15 services.");
 
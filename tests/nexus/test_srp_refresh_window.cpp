@@ -0,0 +1,269 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+namespace {
+
+const uint16_t kNumSrpClients        = 100;
+const uint16_t kInstanceNumPerClient = 2;
+const uint16_t kServicePort          = 12345;
+const char    *kServiceName          = "_srpclient._udp";
+const uint32_t kLease                = 10 * 60; // in seconds
+const uint32_t kKeyLease             = 60 * 60; // in seconds
+const uint32_t kRefreshWindow        = 60;      // in seconds
+const uint32_t kOneHour              = 3600 * 1000;
+
+struct ClientInfo
+{
+    Srp::Client::Service mServices[kInstanceNumPerClient];
+    String<32>           mInstanceNames[kInstanceNumPerClient];
+};
+
+static ClientInfo sClientInfo[kNumSrpClients];
+
+void RegisterServices(Node &aNode, uint16_t aClientIndex)
+{
+    String<32> hostName;
+
+    hostName.Append("client%u", aClientIndex);
+
+    aNode.Get<Srp::Client>().SetLeaseInterval(kLease);
+    aNode.Get<Srp::Client>().SetKeyLeaseInterval(kKeyLease);
+    aNode.Get<Srp::Client>().EnableAutoStartMode(nullptr, nullptr);
+    SuccessOrQuit(aNode.Get<Srp::Client>().SetHostName(hostName.AsCString()));
+    SuccessOrQuit(aNode.Get<Srp::Client>().EnableAutoHostAddress());
+
+    for (uint16_t i = 0; i < kInstanceNumPerClient; i++)
+    {
+        String<32>           &instanceName = sClientInfo[aClientIndex].mInstanceNames[i];
+        Srp::Client::Service &service      = sClientInfo[aClientIndex].mServices[i];
+
+        instanceName.Clear().Append("client%u_%u", aClientIndex, i);
+
+        memset(&service, 0, sizeof(service));
+        service.mName         = kServiceName;
+        service.mInstanceName = instanceName.AsCString();
+        service.mPort         = kServicePort;
+
+        SuccessOrQuit(aNode.Get<Srp::Client>().AddService(service));
+    }
+}
+
+void VerifyClient(Node &aNode)
+{
+    VerifyOrQuit(aNode.Get<Srp::Client>().GetHostInfo().GetState() == Srp::Client::kRegistered);
+
+    for (const Srp::Client::Service &service : aNode.Get<Srp::Client>().GetServices())
+    {
+        VerifyOrQuit(service.GetState() == Srp::Client::kRegistered);
+    }
+}
+
+uint16_t CountRegisteredServices(Node &aServer)
+{
+    uint16_t                 count = 0;
+    const Srp::Server::Host *host  = nullptr;
+
+    while ((host = aServer.Get<Srp::Server>().GetNextHost(host)) != nullptr)
+    {
+        const Srp::Server::Service *service = nullptr;
+
+        while ((service = host->GetNextService(service)) != nullptr)
+        {
+            if (!service->IsDeleted())
+            {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+struct HourStats
+{
+    uint32_t mRefreshMessages; // Total SRP update transmissions from all clients.
+    uint32_t mLeaseRuns;       // Lease expiration processing runs on server.
+};
+
+void RunOneHour(Core &aNexus, Node &aServer, Node *aClients[], HourStats &aStats)
+{
+    otSrpServerUpdateStats serverStats;
+    uint32_t               leaseRunsBefore;
+
+    for (uint16_t i = 0; i < kNumSrpClients; i++)
+    {
+        aClients[i]->Get<Srp::Client>().ResetCounters();
+    }
+
+    aServer.Get<Srp::Server>().GetUpdateStats(serverStats);
+    leaseRunsBefore = serverStats.mNumLeaseRuns;
+
+    aNexus.AdvanceTime(kOneHour);
+
+    aStats.mRefreshMessages = 0;
+
+    for (uint16_t i = 0; i < kNumSrpClients; i++)
+    {
+        aStats.mRefreshMessages += aClients[i]->Get<Srp::Client>().GetCounters().mTxUpdates;
+        VerifyClient(*aClients[i]);
+    }
+
+    aServer.Get<Srp::Server>().GetUpdateStats(serverStats);
+    aStats.mLeaseRuns = serverStats.mNumLeaseRuns - leaseRunsBefore;
+
+    VerifyOrQuit(CountRegisteredServices(aServer) == kNumSrpClients * kInstanceNumPerClient);
+}
+
+} // namespace
+
+/**
+ * This test measures the lease refresh load of 100 SRP clients over an hour, with and without the server refresh
+ * window hint.
+ *
+ * Topology:
+ *          LEADER (SRP server)
+ *         /   |   \
+ *     FED1  FED2 ... FED100 (SRP clients)
+ *
+ * With the refresh window, clients align their lease refreshes to the start of the server windows, and the server
+ * processes lease expirations once per window instead of once per host lease.
+ */
+void TestSrpRefreshWindow(void)
+{
+    Core      nexus;
+    Node     &leader = nexus.CreateNode();
+    Node     *clients[kNumSrpClients];
+    HourStats withoutWindow;
+    HourStats withWindow;
+
+    Log("Test SRP refresh window with %u clients", kNumSrpClients);
+
+    leader.Form();
+    nexus.AdvanceTime(15 * 1000);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    SuccessOrQuit(leader.Get<Srp::Server>().SetRefreshWindow(0));
+    leader.Get<Srp::Server>().SetEnabled(true);
+    nexus.AdvanceTime(1000);
+
+    for (uint16_t i = 0; i < kNumSrpClients; i++)
+    {
+        clients[i] = &nexus.CreateNode();
+        clients[i]->SetName("fed", i + 1);
+        clients[i]->Join(leader, Node::kAsFed);
+
+        if ((i + 1) % 10 == 0)
+        {
+            nexus.AdvanceTime(10 * 1000);
+        }
+    }
+
+    nexus.AdvanceTime(20 * 1000);
+
+    for (uint16_t i = 0; i < kNumSrpClients; i++)
+    {
+        VerifyOrQuit(clients[i]->Get<Mle::Mle>().IsChild());
+    }
+
+    Log("Registering services from clients...");
+
+    for (uint16_t i = 0; i < kNumSrpClients; i++)
+    {
+        RegisterServices(*clients[i], i);
+
+        if ((i + 1) % 10 == 0)
+        {
+            nexus.AdvanceTime(5 * 1000);
+        }
+    }
+
+    nexus.AdvanceTime(60 * 1000);
+
+    for (uint16_t i = 0; i < kNumSrpClients; i++)
+    {
+        VerifyClient(*clients[i]);
+    }
+
+    VerifyOrQuit(CountRegisteredServices(leader) == kNumSrpClients * kInstanceNumPerClient);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Run one hour without refresh window");
+
+    RunOneHour(nexus, leader, clients, withoutWindow);
+
+    Log("Refresh messages per hour: %lu, server lease runs: %lu", ToUlong(withoutWindow.mRefreshMessages),
+        ToUlong(withoutWindow.mLeaseRuns));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Enable %lu sec refresh window, let clients learn it on their next refresh", ToUlong(kRefreshWindow));
+
+    SuccessOrQuit(leader.Get<Srp::Server>().SetRefreshWindow(kRefreshWindow));
+    VerifyOrQuit(leader.Get<Srp::Server>().GetRefreshWindow() == kRefreshWindow);
+
+    nexus.AdvanceTime(Time::SecToMsec(kLease));
+
+    Log("Run one hour with refresh window");
+
+    RunOneHour(nexus, leader, clients, withWindow);
+
+    Log("Refresh messages per hour: %lu, server lease runs: %lu", ToUlong(withWindow.mRefreshMessages),
+        ToUlong(withWindow.mLeaseRuns));
+
+    // The server processes lease expirations at most once per
+    // window (plus one for the initial schedule).
+
+    VerifyOrQuit(withWindow.mLeaseRuns <= kOneHour / Time::SecToMsec(kRefreshWindow) + 1);
+    VerifyOrQuit(withWindow.mLeaseRuns < withoutWindow.mLeaseRuns);
+
+    // Refreshes may move up to one window earlier, which bounds the
+    // increase in the number of refresh messages.
+
+    VerifyOrQuit(withWindow.mRefreshMessages * (kLease - kRefreshWindow) <= withoutWindow.mRefreshMessages * kLease +
+                                                                                 kNumSrpClients * kLease);
+
+    Log("Test passed!");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestSrpRefreshWindow();
+    printf("All tests passed\n");
+    return 0;
+}
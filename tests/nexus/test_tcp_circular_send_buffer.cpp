@@ -0,0 +1,225 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "platform/nexus_tcp.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kPort         = 31235;
+static constexpr size_t   kSendCapacity = 4000;
+
+// The receive buffer of the receiver is smaller than the data first
+// committed to the send buffer. As the receiving application does not
+// read the data until the end of the test, only part of the committed
+// data is acknowledged, which lets the test move the write index of
+// the send buffer around its end.
+static constexpr size_t kReceiveBufferSize = OT_TCP_RECEIVE_BUFFER_SIZE_FEW_HOPS;
+static constexpr size_t kFirstWriteSize    = 3000;
+
+static_assert(kReceiveBufferSize < kFirstWriteSize, "receive buffer must be smaller than kFirstWriteSize");
+static_assert(kFirstWriteSize < kSendCapacity, "kFirstWriteSize must be smaller than kSendCapacity");
+static_assert(kSendCapacity <= TcpTransfer::kMaxBufferSize, "kSendCapacity is too large");
+
+static void VerifyWritableSpan(const TcpTransfer &aTransfer, size_t aExpectedIndex, size_t aExpectedLength)
+{
+    uint8_t *data;
+    size_t   length;
+
+    aTransfer.GetSendBuffer().GetWritableSpan(data, length);
+
+    Log("  Writable span: index %lu, length %lu, free space %lu",
+        ToUlong(static_cast<uint32_t>(data - aTransfer.GetSendBufferBytes())), ToUlong(static_cast<uint32_t>(length)),
+        ToUlong(static_cast<uint32_t>(aTransfer.GetSendBuffer().GetFreeSpace())));
+
+    VerifyOrQuit(data == &aTransfer.GetSendBufferBytes()[aExpectedIndex]);
+    VerifyOrQuit(length == aExpectedLength);
+}
+
+void TestTcpCircularSendBufferSpan(void)
+{
+    /**
+     * Verifies the zero-copy write path of the TCP circular send buffer
+     * (`GetWritableSpan()` and `Commit()`), covering a partial commit of
+     * a span, a commit exceeding the free space, a commit exceeding the
+     * span which wraps around the end of the buffer, and spans after the
+     * wraparound. The receiver verifies the transferred data.
+     *
+     * Topology:
+     *   LEADER ---- ROUTER_1
+     */
+
+    static constexpr size_t kPartialSpanWrite = 1200;
+    static constexpr size_t kPartialCommit    = 1000;
+    static constexpr size_t kWrappedLength    = 500;
+    static constexpr size_t kLastCommit       = 100;
+
+    Core     nexus;
+    Node    &leader = nexus.CreateNode();
+    Node    *router;
+    size_t   freeSpace;
+    size_t   acked;
+    size_t   spanLength;
+    uint32_t waitTime;
+
+    leader.SetName("LEADER");
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestTcpCircularSendBufferSpan");
+
+    FormRouterChain(nexus, leader, &router, 1);
+
+    {
+        TcpTransfer transfer(*router, leader, kPort, kSendCapacity, kReceiveBufferSize);
+
+        transfer.StopConsuming();
+        transfer.Connect(0);
+
+        for (waitTime = 0; !transfer.IsEstablished(); waitTime += 10)
+        {
+            VerifyOrQuit(waitTime < 10 * 1000);
+            nexus.AdvanceTime(10);
+        }
+
+        Log("Connection established");
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Empty buffer: the span covers the whole buffer");
+
+        VerifyOrQuit(transfer.GetSendBuffer().GetFreeSpace() == kSendCapacity);
+        VerifyWritableSpan(transfer, 0, kSendCapacity);
+
+        // A commit larger than the free space is rejected and nothing
+        // is committed. A zero-length commit does nothing.
+
+        VerifyOrQuit(transfer.Commit(kSendCapacity + 1, 0) == kErrorInvalidArgs);
+        SuccessOrQuit(transfer.Commit(0, 0));
+        VerifyOrQuit(transfer.GetSendBuffer().GetFreeSpace() == kSendCapacity);
+        VerifyWritableSpan(transfer, 0, kSendCapacity);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Partial commit of the span");
+
+        // Write more bytes into the span than are committed. Only the
+        // committed bytes are sent and the next span starts right after
+        // them.
+
+        transfer.Fill(0, kPartialSpanWrite, 0);
+        SuccessOrQuit(transfer.Commit(kPartialCommit, 0));
+        VerifyOrQuit(transfer.GetSendBuffer().GetFreeSpace() == kSendCapacity - kPartialCommit);
+        VerifyWritableSpan(transfer, kPartialCommit, kSendCapacity - kPartialCommit);
+
+        transfer.Fill(kPartialCommit, kFirstWriteSize - kPartialCommit, kPartialCommit);
+        SuccessOrQuit(transfer.Commit(kFirstWriteSize - kPartialCommit, 0));
+        VerifyOrQuit(transfer.GetSendBuffer().GetFreeSpace() == kSendCapacity - kFirstWriteSize);
+        VerifyWritableSpan(transfer, kFirstWriteSize, kSendCapacity - kFirstWriteSize);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Wait for the receiver to acknowledge part of the data");
+
+        nexus.AdvanceTime(5 * 1000);
+
+        freeSpace = transfer.GetSendBuffer().GetFreeSpace();
+        acked     = freeSpace - (kSendCapacity - kFirstWriteSize);
+
+        Log("  Acknowledged %lu bytes", ToUlong(static_cast<uint32_t>(acked)));
+
+        // The receiving application does not read, so the data beyond
+        // the receive buffer is not acknowledged.
+
+        VerifyOrQuit(acked >= kWrappedLength + kLastCommit);
+        VerifyOrQuit(acked <= kReceiveBufferSize);
+        VerifyOrQuit(acked < kFirstWriteSize);
+
+        // The free space now extends past the end of the buffer, but the
+        // span ends at the end of the buffer.
+
+        spanLength = kSendCapacity - kFirstWriteSize;
+        VerifyOrQuit(spanLength < freeSpace);
+        VerifyWritableSpan(transfer, kFirstWriteSize, spanLength);
+
+        VerifyOrQuit(transfer.Commit(freeSpace + 1, 0) == kErrorInvalidArgs);
+        VerifyOrQuit(transfer.GetSendBuffer().GetFreeSpace() == freeSpace);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Commit larger than the span, wrapping around the buffer end");
+
+        transfer.Fill(kFirstWriteSize, spanLength + kWrappedLength, transfer.GetBytesCommitted());
+        SuccessOrQuit(transfer.Commit(spanLength + kWrappedLength, 0));
+        VerifyOrQuit(transfer.GetSendBuffer().GetFreeSpace() == freeSpace - spanLength - kWrappedLength);
+
+        // The next span continues after the wrapped data at the start of
+        // the buffer and covers all the remaining free space.
+
+        freeSpace = transfer.GetSendBuffer().GetFreeSpace();
+        VerifyWritableSpan(transfer, kWrappedLength, freeSpace);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Commit within the span after the wraparound");
+
+        transfer.Fill(kWrappedLength, kLastCommit, transfer.GetBytesCommitted());
+        SuccessOrQuit(transfer.Commit(kLastCommit, 0));
+        VerifyOrQuit(transfer.GetSendBuffer().GetFreeSpace() == freeSpace - kLastCommit);
+        VerifyWritableSpan(transfer, kWrappedLength + kLastCommit, freeSpace - kLastCommit);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        Log("Receive and verify all the committed data");
+
+        transfer.StartConsuming();
+
+        for (waitTime = 0; transfer.GetBytesReceived() != transfer.GetBytesCommitted(); waitTime += 100)
+        {
+            VerifyOrQuit(waitTime < 60 * 1000);
+            nexus.AdvanceTime(100);
+        }
+
+        nexus.AdvanceTime(5 * 1000);
+
+        // Once all data is acknowledged, the buffer is empty and the
+        // span starts again at the beginning of the buffer.
+
+        VerifyOrQuit(transfer.GetSendBuffer().GetFreeSpace() == kSendCapacity);
+        VerifyWritableSpan(transfer, 0, kSendCapacity);
+
+        Log("Transferred %lu bytes", ToUlong(transfer.GetBytesCommitted()));
+    }
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestTcpCircularSendBufferSpan();
+    printf("All tests passed\n");
+    return 0;
+}
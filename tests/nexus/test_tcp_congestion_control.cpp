@@ -0,0 +1,248 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "platform/nexus_radio_model.hpp"
+#include "platform/nexus_tcp.hpp"
+
+namespace ot {
+namespace Nexus {
+
+using CongestionControl = Ip6::Tcp::Endpoint::CongestionControl;
+
+static constexpr uint32_t kTransferSize      = 16 * 1024;
+static constexpr uint16_t kPort              = 31236;
+static constexpr uint16_t kNumHops           = 3;
+static constexpr uint32_t kStepTime          = 10;
+static constexpr uint32_t kMaxTransferTime   = 900 * 1000;
+static constexpr uint8_t  kMaxQueuedSegments = OPENTHREAD_CONFIG_TCP_PACING_MAX_QUEUED_SEGMENTS;
+
+struct Mode
+{
+    const char       *mName;
+    CongestionControl mCongestionControl;
+    bool              mPacing;
+};
+
+// The first mode (New Reno without pacing) is the baseline which the
+// other modes are compared against.
+static const Mode kModes[] = {
+    {"newreno", Ip6::Tcp::Endpoint::kCongestionControlNewReno, false},
+    {"newreno+pacing", Ip6::Tcp::Endpoint::kCongestionControlNewReno, true},
+    {"vegas", Ip6::Tcp::Endpoint::kCongestionControlVegas, false},
+    {"vegas+pacing", Ip6::Tcp::Endpoint::kCongestionControlVegas, true},
+};
+
+struct Result
+{
+    uint32_t mSegmentsSent;
+    uint32_t mSegmentsRetransmitted;
+    uint8_t  mMaxQueuedSegments;
+};
+
+void TestTcpCongestionControlConfig(void)
+{
+    // Verifies selecting the congestion control algorithm and pacing
+    // on an endpoint, through both the core and the public API.
+
+    Core                        nexus;
+    Node                       &node = nexus.CreateNode();
+    Ip6::Tcp::Endpoint          endpoint;
+    otTcpEndpointInitializeArgs endpointArgs;
+    uint8_t                     receiveBuffer[OT_TCP_RECEIVE_BUFFER_SIZE_FEW_HOPS];
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestTcpCongestionControlConfig");
+
+    ClearAllBytes(endpointArgs);
+    endpointArgs.mReceiveBuffer     = receiveBuffer;
+    endpointArgs.mReceiveBufferSize = sizeof(receiveBuffer);
+    SuccessOrQuit(endpoint.Initialize(node, endpointArgs));
+
+    // New Reno without pacing is the default.
+
+    VerifyOrQuit(endpoint.GetCongestionControl() == Ip6::Tcp::Endpoint::kCongestionControlNewReno);
+    VerifyOrQuit(otTcpGetCongestionControl(&endpoint) == OT_TCP_CONGESTION_CONTROL_NEW_RENO);
+    VerifyOrQuit(!endpoint.IsPacingEnabled());
+
+    SuccessOrQuit(endpoint.SetCongestionControl(Ip6::Tcp::Endpoint::kCongestionControlVegas));
+    VerifyOrQuit(endpoint.GetCongestionControl() == Ip6::Tcp::Endpoint::kCongestionControlVegas);
+    VerifyOrQuit(otTcpGetCongestionControl(&endpoint) == OT_TCP_CONGESTION_CONTROL_VEGAS);
+
+    // An invalid value is rejected and keeps the current algorithm.
+
+    VerifyOrQuit(endpoint.SetCongestionControl(static_cast<CongestionControl>(0xff)) == kErrorInvalidArgs);
+    VerifyOrQuit(endpoint.GetCongestionControl() == Ip6::Tcp::Endpoint::kCongestionControlVegas);
+
+    SuccessOrQuit(otTcpSetCongestionControl(&endpoint, OT_TCP_CONGESTION_CONTROL_NEW_RENO));
+    VerifyOrQuit(endpoint.GetCongestionControl() == Ip6::Tcp::Endpoint::kCongestionControlNewReno);
+
+    endpoint.SetPacingEnabled(true);
+    VerifyOrQuit(endpoint.IsPacingEnabled());
+    VerifyOrQuit(otTcpIsPacingEnabled(&endpoint));
+
+    otTcpSetPacingEnabled(&endpoint, false);
+    VerifyOrQuit(!endpoint.IsPacingEnabled());
+
+    // The selection is kept by the endpoint across a reset of the
+    // connection state.
+
+    SuccessOrQuit(endpoint.SetCongestionControl(Ip6::Tcp::Endpoint::kCongestionControlVegas));
+    SuccessOrQuit(endpoint.Abort());
+    VerifyOrQuit(endpoint.GetCongestionControl() == Ip6::Tcp::Endpoint::kCongestionControlVegas);
+
+    SuccessOrQuit(endpoint.Deinitialize());
+}
+
+void TestTcpCongestionControl(uint8_t aLossPercent)
+{
+    /**
+     * Compares the TCP congestion control modes over a lossy chain of routers.
+     *
+     * Topology:
+     *   LEADER ---- ROUTER_1 ---- ROUTER_2 ---- ROUTER_3
+     *
+     * Once the network is formed, each frame is dropped with a probability
+     * of `aLossPercent`, following the same loss sequence for every mode.
+     * ROUTER_3 then sends `kTransferSize` bytes to LEADER using each mode
+     * in turn. The goodput (based on the simulated time) and the number of
+     * retransmitted segments are reported for each mode.
+     *
+     * Every mode must complete the transfer. New Reno without pacing hands
+     * its whole congestion window to the IPv6 layer at once, so its send
+     * queue grows past the pacing limit. With pacing, new data is held back
+     * while the queue is full, so without loss the queue never exceeds the
+     * pacing limit and under loss (where retransmissions are not held back)
+     * it stays below the New Reno one. Vegas leaves slow start as soon as
+     * the path starts to queue, so its queue does not exceed the New Reno
+     * one either.
+     */
+
+    Core    nexus;
+    Node   &leader = nexus.CreateNode();
+    Node   *routers[kNumHops];
+    Node   *sender;
+    Result  results[GetArrayLength(kModes)];
+    uint8_t index = 0;
+
+    leader.SetName("LEADER");
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestTcpCongestionControl - %u%% frame loss", aLossPercent);
+
+    RadioModel::SetFrameLossRate(0);
+
+    sender = &FormRouterChain(nexus, leader, routers, kNumHops);
+
+    for (const Mode &mode : kModes)
+    {
+        TimeMilli startTime = nexus.GetNow();
+        Result   &result    = results[index++];
+        uint32_t  duration;
+
+        // Restart the loss sequence so that every mode sees the same
+        // frame losses.
+        RadioModel::SetFrameLossRate(aLossPercent);
+
+        {
+            TcpTransfer transfer(*sender, leader, kPort);
+
+            SuccessOrQuit(transfer.GetSender().SetCongestionControl(mode.mCongestionControl));
+            transfer.GetSender().SetPacingEnabled(mode.mPacing);
+            VerifyOrQuit(transfer.GetSender().GetCongestionControl() == mode.mCongestionControl);
+            VerifyOrQuit(transfer.GetSender().IsPacingEnabled() == mode.mPacing);
+
+            transfer.SetTransferSize(kTransferSize);
+            transfer.Connect(OT_TCP_CONNECT_NO_FAST_OPEN);
+
+            while (!transfer.IsComplete() && (nexus.GetNow() - startTime < kMaxTransferTime))
+            {
+                nexus.AdvanceTime(kStepTime);
+                transfer.UpdateMaxQueuedSegments();
+            }
+
+            if (!transfer.IsComplete())
+            {
+                Log("%u%% loss, %s: transfer did not complete", aLossPercent, mode.mName);
+            }
+
+            VerifyOrQuit(transfer.IsComplete());
+
+            result.mSegmentsSent          = transfer.GetSender().GetDataSegmentsSent();
+            result.mSegmentsRetransmitted = transfer.GetSender().GetDataSegmentsRetransmitted();
+            result.mMaxQueuedSegments     = transfer.GetMaxQueuedSegments();
+        }
+
+        duration = nexus.GetNow() - startTime;
+
+        Log("%u%% loss, %-14s: %lu bytes in %lu ms, goodput %lu bps, segments %lu, retransmitted %lu, max queued %u",
+            aLossPercent, mode.mName, ToUlong(kTransferSize), ToUlong(duration),
+            ToUlong(static_cast<uint32_t>(kTransferSize * 8ull * 1000 / duration)), ToUlong(result.mSegmentsSent),
+            ToUlong(result.mSegmentsRetransmitted), result.mMaxQueuedSegments);
+
+        // Let the queues along the path drain before the next mode.
+        RadioModel::SetFrameLossRate(0);
+        nexus.AdvanceTime(10 * 1000);
+    }
+
+    VerifyOrQuit(results[0].mMaxQueuedSegments > kMaxQueuedSegments);
+
+    for (uint8_t i = 1; i < GetArrayLength(kModes); i++)
+    {
+        VerifyOrQuit(results[i].mMaxQueuedSegments <= results[0].mMaxQueuedSegments);
+
+        if (!kModes[i].mPacing)
+        {
+            continue;
+        }
+
+        VerifyOrQuit(results[i].mMaxQueuedSegments < results[0].mMaxQueuedSegments);
+
+        if (aLossPercent == 0)
+        {
+            VerifyOrQuit(results[i].mSegmentsRetransmitted == 0);
+            VerifyOrQuit(results[i].mMaxQueuedSegments <= kMaxQueuedSegments);
+        }
+    }
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestTcpCongestionControlConfig();
+    ot::Nexus::TestTcpCongestionControl(0);
+    ot::Nexus::TestTcpCongestionControl(10);
+    ot::Nexus::TestTcpCongestionControl(20);
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "platform/nexus_tcp.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint32_t kTransferSize    = 32 * 1024;
+static constexpr uint16_t kPort            = 31234;
+static constexpr uint32_t kStepTime        = 10;
+static constexpr uint32_t kMaxTransferTime = 600 * 1000;
+
+void TestTcpThroughput(uint16_t aNumHops)
+{
+    /**
+     * Measures the TCP throughput over a chain of routers.
+     *
+     * Topology:
+     *   LEADER ---- ROUTER_1 ---- ... ---- ROUTER_<aNumHops>
+     *
+     * ROUTER_<aNumHops> sends `kTransferSize` bytes to LEADER. The
+     * sender produces the data directly in its circular send buffer
+     * and the receiver consumes it from the receive buffer by
+     * reference. The throughput is reported based on the simulated
+     * time, along with the host CPU time used to simulate the transfer
+     * (covering all the nodes).
+     */
+
+    Core      nexus;
+    Node     &leader = nexus.CreateNode();
+    Node     *routers[5];
+    Node     *sender;
+    TimeMilli startTime;
+    clock_t   startClock;
+    uint32_t  duration;
+    uint32_t  cpuTime;
+
+    OT_ASSERT(aNumHops <= GetArrayLength(routers));
+
+    leader.SetName("LEADER");
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("TestTcpThroughput - %u hop(s)", aNumHops);
+
+    sender = &FormRouterChain(nexus, leader, routers, aNumHops);
+
+    Log("Transfer %lu bytes", ToUlong(kTransferSize));
+
+    startTime  = nexus.GetNow();
+    startClock = clock();
+
+    {
+        TcpTransfer transfer(*sender, leader, kPort);
+
+        transfer.SetTransferSize(kTransferSize);
+        transfer.Connect(0);
+
+        while (!transfer.IsComplete())
+        {
+            VerifyOrQuit(nexus.GetNow() - startTime < kMaxTransferTime);
+            nexus.AdvanceTime(kStepTime);
+        }
+    }
+
+    duration = nexus.GetNow() - startTime;
+    cpuTime  = static_cast<uint32_t>((clock() - startClock) * 1000 / CLOCKS_PER_SEC);
+
+    Log("%u hop(s): %lu bytes in %lu ms, throughput %lu bps, cpu time %lu ms", aNumHops, ToUlong(kTransferSize),
+        ToUlong(duration), ToUlong(static_cast<uint32_t>(kTransferSize * 8ull * 1000 / duration)), ToUlong(cpuTime));
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestTcpThroughput(1);
+    ot::Nexus::TestTcpThroughput(3);
+    ot::Nexus::TestTcpThroughput(5);
+    printf("All tests passed\n");
+    return 0;
+}
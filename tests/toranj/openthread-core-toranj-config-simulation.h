@@ -59,6 +59,8 @@
 
 #define OPENTHREAD_CONFIG_DNS_CLIENT_BIND_UDP_TO_THREAD_NETIF 1
 
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 1
+
 #define OPENTHREAD_CONFIG_JOINER_MAX_CANDIDATES 8
 
 #define OPENTHREAD_CONFIG_JOINER_CANDIDATES_PER_NETWORK 3
@@ -73,6 +75,8 @@
 
 #define OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE 1
 
+#define OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE 1
+
 #define OPENTHREAD_CONFIG_MULTICAST_DNS_AUTO_ENABLE_ON_INFRA_IF 0
 
 #define OPENTHREAD_CONFIG_MULTICAST_DNS_VERBOSE_LOGGING_ENABLE 1
@@ -47,6 +47,10 @@
 
 #define OPENTHREAD_CONFIG_UPTIME_ENABLE 1
 
+#define OPENTHREAD_CONFIG_PROFILER_ENABLE 1
+
+#define OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE 1
+
 #define OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE 1
 
 #ifndef OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
@@ -151,6 +155,10 @@
 
 #define OPENTHREAD_CONFIG_LOG_LEVEL_OVERRIDE_ENABLE 1
 
+#define OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE 1
+
+#define OPENTHREAD_CONFIG_LOG_BINARY_ENABLE 1
+
 #define OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME 1
 
 #define OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL 1
@@ -0,0 +1,338 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/logging.h>
+
+#include "common/binary_log.hpp"
+#include "common/code_utils.hpp"
+#include "common/log.hpp"
+#include "common/num_utils.hpp"
+#include "common/string.hpp"
+#include "instance/instance.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+#if OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+static constexpr uint16_t kMaxLogSize = 200;
+
+static const char kTestModule[] = "TestModule";
+
+// Reads the next binary log string and verifies it matches the expected
+// log string (skipping the timestamp).
+static void VerifyNextLog(const char *aExpectedLog)
+{
+    char        log[kMaxLogSize];
+    const char *cur;
+
+    SuccessOrQuit(otLoggingReadBinaryLog(log, sizeof(log)));
+    printf("  %s\n", log);
+
+    cur = strchr(log, ' ');
+    VerifyOrQuit(cur != nullptr);
+    VerifyOrQuit(StringMatch(cur + 1, aExpectedLog));
+}
+
+static void VerifyNoLog(void)
+{
+    char log[kMaxLogSize];
+
+    VerifyOrQuit(otLoggingReadBinaryLog(log, sizeof(log)) == kErrorNotFound);
+}
+
+static void TestBinaryLogFormat(void)
+{
+    static const char kFormat[] = "int:%d neg:%i hex:0x%04x uns:%u %% long:%ld llong:%lld size:%zu";
+
+    Instance *instance;
+    char      longString[100];
+    char      expected[kMaxLogSize];
+    uint8_t   record[kMaxLogSize];
+    uint16_t  length;
+    uint64_t  value;
+
+    printf("\nTestBinaryLogFormat\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    VerifyOrQuit(!otLoggingIsBinaryModeEnabled());
+    otLoggingSetBinaryModeEnabled(true);
+    VerifyOrQuit(otLoggingIsBinaryModeEnabled());
+    otLoggingResetBinaryCounters();
+
+    VerifyNoLog();
+
+    Logger::LogInModule(kTestModule, kLogLevelCrit, kFormat, 12, -34, 0xab, 56u, -78L, 1234567890123LL,
+                        static_cast<size_t>(9));
+    VerifyNextLog("[C] TestModule----: int:12 neg:-34 hex:0x00ab uns:56 % long:-78 llong:1234567890123 size:9");
+    VerifyNoLog();
+
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "str:%s [%-6s] [%6s] [%.*s] [%.2s] char:%c", "hello", "ab", "cd",
+                        3, "abcdef", "xyz", 'Z');
+    VerifyNextLog("[C] TestModule----: str:hello [ab    ] [    cd] [abc] [xy] char:Z");
+
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "[%*d] [%-*u] [%05d]", 5, 42, 4, 7u, -12);
+    VerifyNextLog("[C] TestModule----: [   42] [7   ] [-0012]");
+
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "%hd %hu %hx %hhd %hhu %hhx", static_cast<short>(-2),
+                        static_cast<short>(-1), static_cast<short>(-1), static_cast<signed char>(-3),
+                        static_cast<signed char>(-1), static_cast<signed char>(-1));
+    VerifyNextLog("[C] TestModule----: -2 65535 ffff -3 255 ff");
+
+    Logger::LogOnError<kLogLevelCrit>(kTestModule, kErrorNoBufs, "send msg %u", 7u);
+    VerifyNextLog("[C] TestModule----: Failed to send msg 7 - NoBufs");
+
+    // Long strings are truncated.
+
+    memset(longString, 'a', sizeof(longString) - 1);
+    longString[sizeof(longString) - 1] = '\0';
+
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "%s!", longString);
+
+    {
+        StringWriter writer(expected, sizeof(expected));
+
+        writer.Append("[C] TestModule----: ");
+        writer.AppendCharMultipleTimes('a', OPENTHREAD_CONFIG_LOG_BINARY_MAX_STRING_ARG_LENGTH);
+        writer.Append("!");
+    }
+
+    VerifyNextLog(expected);
+
+    VerifyOrQuit(otLoggingGetBinaryCounters()->mRecorded == 6);
+    VerifyOrQuit(otLoggingGetBinaryCounters()->mDropped == 0);
+
+    // Read a raw record and check its header.
+
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "raw %u", 0x12345678u);
+
+    length = 4;
+    VerifyOrQuit(otLoggingReadBinaryRecord(record, &length) == kErrorNoBufs);
+    VerifyOrQuit(length == 2 + 1 + 1 + 4 + 2 * sizeof(uintptr_t) + sizeof(int));
+
+    length = sizeof(record);
+    SuccessOrQuit(otLoggingReadBinaryRecord(record, &length));
+    VerifyOrQuit(length == 2 + 1 + 1 + 4 + 2 * sizeof(uintptr_t) + sizeof(int));
+
+    VerifyOrQuit(record[0] == length);
+    VerifyOrQuit(record[1] == 0);
+    VerifyOrQuit(record[2] == kLogLevelCrit);
+    VerifyOrQuit(record[3] == kErrorNone);
+
+    value = 0;
+
+    for (uint8_t index = 0; index < sizeof(uintptr_t); index++)
+    {
+        value |= static_cast<uint64_t>(record[8 + sizeof(uintptr_t) + index]) << (8 * index);
+    }
+
+    VerifyOrQuit(StringMatch(reinterpret_cast<const char *>(static_cast<uintptr_t>(value)), "raw %u"));
+
+    VerifyOrQuit(record[length - 4] == 0x78);
+    VerifyOrQuit(record[length - 1] == 0x12);
+
+    VerifyNoLog();
+
+    // Disabling the binary mode keeps the saved records.
+
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "kept");
+    otLoggingSetBinaryModeEnabled(false);
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "not saved");
+    VerifyNextLog("[C] TestModule----: kept");
+    VerifyNoLog();
+
+    testFreeInstance(instance);
+}
+
+static void TestBinaryLogDrop(void)
+{
+    Instance *instance;
+    uint32_t  numRecorded;
+    uint32_t  numRead;
+    char      log[kMaxLogSize];
+
+    printf("\nTestBinaryLogDrop\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    otLoggingSetBinaryModeEnabled(true);
+    otLoggingResetBinaryCounters();
+
+    // Fill the buffer until logs start to get dropped.
+
+    for (uint32_t count = 0; otLoggingGetBinaryCounters()->mDropped == 0; count++)
+    {
+        VerifyOrQuit(count < OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE);
+        Logger::LogInModule(kTestModule, kLogLevelCrit, "log number %lu", ToUlong(count));
+    }
+
+    numRecorded = otLoggingGetBinaryCounters()->mRecorded;
+    printf("  recorded:%lu, dropped:%lu\n", ToUlong(numRecorded), ToUlong(otLoggingGetBinaryCounters()->mDropped));
+
+    // Read half of the records, and then log more so that the
+    // records wrap around the end of the ring buffer.
+
+    for (uint32_t count = 0; count < numRecorded / 2; count++)
+    {
+        char expected[kMaxLogSize];
+
+        snprintf(expected, sizeof(expected), "[C] TestModule----: log number %lu", ToUlong(count));
+        VerifyNextLog(expected);
+    }
+
+    for (uint32_t count = 0; count < numRecorded / 2; count++)
+    {
+        Logger::LogInModule(kTestModule, kLogLevelCrit, "log number %lu", ToUlong(numRecorded + 1 + count));
+    }
+
+    numRead = numRecorded / 2;
+
+    while (otLoggingReadBinaryLog(log, sizeof(log)) == kErrorNone)
+    {
+        char expected[kMaxLogSize];
+
+        if (numRead == numRecorded)
+        {
+            // Skip over the dropped record.
+            numRead++;
+        }
+
+        snprintf(expected, sizeof(expected), "[C] TestModule----: log number %lu", ToUlong(numRead));
+        VerifyOrQuit(StringMatch(strchr(log, ' ') + 1, expected));
+        numRead++;
+    }
+
+    VerifyOrQuit(numRead == numRecorded + numRecorded / 2 + 1);
+    VerifyOrQuit(otLoggingGetBinaryCounters()->mDropped == 1);
+
+    otLoggingResetBinaryCounters();
+    VerifyOrQuit(otLoggingGetBinaryCounters()->mRecorded == 0);
+    VerifyOrQuit(otLoggingGetBinaryCounters()->mDropped == 0);
+
+    otLoggingSetBinaryModeEnabled(false);
+
+    testFreeInstance(instance);
+}
+
+#endif // OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+
+#if OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE && OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+
+static void TestModuleLogLevel(void)
+{
+    Instance *instance;
+    char      moduleName[kMaxLogModuleNameLength + 2];
+
+    printf("\nTestModuleLogLevel\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    otLoggingSetBinaryModeEnabled(true);
+
+    VerifyOrQuit(otLoggingSetModuleLevel("", OT_LOG_LEVEL_NOTE) == kErrorInvalidArgs);
+    VerifyOrQuit(otLoggingSetModuleLevel("TooLongModuleName", OT_LOG_LEVEL_NOTE) == kErrorInvalidArgs);
+    VerifyOrQuit(otLoggingSetModuleLevel(kTestModule, static_cast<otLogLevel>(OT_LOG_LEVEL_DEBG + 1)) ==
+                 kErrorInvalidArgs);
+    VerifyOrQuit(otLoggingClearModuleLevel(kTestModule) == kErrorNotFound);
+
+    // Disable logs from `kTestModule` only.
+
+    SuccessOrQuit(otLoggingSetModuleLevel(kTestModule, OT_LOG_LEVEL_NONE));
+
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "filtered");
+    Logger::LogInModule("OtherModule", kLogLevelCrit, "not filtered");
+    Logger::LogInModule(kTestModule, kLogLevelNone, "always");
+
+    VerifyNextLog("[C] OtherModule---: not filtered");
+    VerifyNextLog("[-] TestModule----: always");
+    VerifyNoLog();
+
+    SuccessOrQuit(otLoggingSetModuleLevel(kTestModule, OT_LOG_LEVEL_CRIT));
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "updated");
+    VerifyNextLog("[C] TestModule----: updated");
+
+    SuccessOrQuit(otLoggingSetModuleLevel(kTestModule, OT_LOG_LEVEL_NONE));
+    SuccessOrQuit(otLoggingClearModuleLevel(kTestModule));
+    Logger::LogInModule(kTestModule, kLogLevelCrit, "cleared");
+    VerifyNextLog("[C] TestModule----: cleared");
+
+    // Fill the module level table.
+
+    for (uint8_t index = 0; index < OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_MAX_ENTRIES; index++)
+    {
+        snprintf(moduleName, sizeof(moduleName), "Module%u", index);
+        SuccessOrQuit(otLoggingSetModuleLevel(moduleName, OT_LOG_LEVEL_NONE));
+    }
+
+    VerifyOrQuit(otLoggingSetModuleLevel(kTestModule, OT_LOG_LEVEL_NONE) == kErrorNoBufs);
+
+    // Updating an existing entry is still allowed when the table is full.
+    SuccessOrQuit(otLoggingSetModuleLevel("Module0", OT_LOG_LEVEL_CRIT));
+
+    Logger::LogInModule("Module0", kLogLevelCrit, "module0");
+    Logger::LogInModule("Module1", kLogLevelCrit, "module1");
+    VerifyNextLog("[C] Module0-------: module0");
+    VerifyNoLog();
+
+    otLoggingClearAllModuleLevels();
+    SuccessOrQuit(otLoggingSetModuleLevel(kTestModule, OT_LOG_LEVEL_CRIT));
+    Logger::LogInModule("Module1", kLogLevelCrit, "module1");
+    VerifyNextLog("[C] Module1-------: module1");
+
+    otLoggingClearAllModuleLevels();
+    otLoggingSetBinaryModeEnabled(false);
+
+    testFreeInstance(instance);
+}
+
+#endif
+
+} // namespace ot
+
+int main(void)
+{
+#if OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE
+    ot::TestBinaryLogFormat();
+    ot::TestBinaryLogDrop();
+#endif
+#if OT_SHOULD_LOG && OPENTHREAD_CONFIG_LOG_BINARY_ENABLE && OPENTHREAD_CONFIG_LOG_MODULE_LEVEL_ENABLE
+    ot::TestModuleLogLevel();
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -222,6 +222,12 @@ void InitTest(void)
     AdvanceTime(10000);
 
     VerifyOrQuit(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    // Tests validate the server behavior, so the client answer
+    // cache is disabled (enabled only by `TestDnsClientCache()`).
+    sInstance->Get<Dns::Client>().SetCacheEnabled(false);
+#endif
 }
 
 void FinalizeTest(void)
@@ -2024,6 +2030,261 @@ void TestDnssdSoaNsResponse(void)
     Log("End of TestDnssdSoaNsResponse");
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+uint32_t GetServerTotalQueries(void)
+{
+    return sInstance->Get<Dns::ServiceDiscovery::Server>().GetCounters().GetTotalQueries();
+}
+
+void QueryNsRecord(const char *aLabel)
+{
+    sQueryRecordInfo.Reset();
+    Log("QueryRecord(%s.default.service.arpa.) for NS RR", aLabel);
+    SuccessOrQuit(sInstance->Get<Dns::Client>().QueryRecord(Dns::ResourceRecord::kTypeNs, aLabel,
+                                                            "default.service.arpa.", RecordCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sQueryRecordInfo.mCallbackCount == 1);
+    SuccessOrQuit(sQueryRecordInfo.mError);
+}
+
+void TestDnsClientCache(void)
+{
+    static const char *const kLabels[] = {"host0", "host1", "host2", "host3", "host4",
+                                          "host5", "host6", "host7", "host8"};
+
+    static_assert(GetArrayLength(kLabels) > OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES, "kLabels is too short");
+
+    Srp::Server          *srpServer;
+    Srp::Client          *srpClient;
+    Dns::Client          *dnsClient;
+    Srp::Client::Service  service1;
+    uint32_t              totalQueries;
+    uint32_t              ttl;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnsClientCache");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    dnsClient = &sInstance->Get<Dns::Client>();
+
+    PrepareService1(service1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client and register a service.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+    SuccessOrQuit(srpClient->AddService(service1));
+    AdvanceTime(2 * 1000);
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Enable the cache.
+
+    VerifyOrQuit(!dnsClient->IsCacheEnabled());
+    dnsClient->SetCacheEnabled(true);
+    VerifyOrQuit(dnsClient->IsCacheEnabled());
+    dnsClient->ResetCacheCounters();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Resolve the host address twice and validate that the second
+    // query is answered from the cache (without sending a query).
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Resolve address - miss then hit");
+
+    totalQueries = GetServerTotalQueries();
+
+    sAddressInfo.Reset();
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+    VerifyOrQuit(sAddressInfo.mNumHostAddresses > 0);
+
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mMisses == 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mHits == 0);
+
+    sAddressInfo.Reset();
+    SuccessOrQuit(dnsClient->ResolveAddress(kHostFullName, AddressCallback, sInstance));
+
+    // The callback must not be invoked from `ResolveAddress()`.
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 0);
+
+    AdvanceTime(1);
+    VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sAddressInfo.mError);
+    VerifyOrQuit(sAddressInfo.mNumHostAddresses > 0);
+    VerifyOrQuit(StringMatch(sAddressInfo.mHostName, kHostFullName, kStringCaseInsensitiveMatch));
+
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mMisses == 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mHits == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate that TTL of records in a cached response is aged.
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Query KEY record - TTL aging");
+
+    sQueryRecordInfo.Reset();
+    SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeKey, kHostName, "default.service.arpa.",
+                                         RecordCallback, sInstance));
+    AdvanceTime(100);
+    VerifyOrQuit(sQueryRecordInfo.mCallbackCount == 1);
+    SuccessOrQuit(sQueryRecordInfo.mError);
+    VerifyOrQuit(sQueryRecordInfo.mNumRecords == 1);
+    ttl = sQueryRecordInfo.mRecords[0].mTtl;
+    VerifyOrQuit(ttl > 5);
+
+    AdvanceTime(5 * 1000);
+
+    totalQueries = GetServerTotalQueries();
+
+    sQueryRecordInfo.Reset();
+    SuccessOrQuit(dnsClient->QueryRecord(Dns::ResourceRecord::kTypeKey, kHostName, "default.service.arpa.",
+                                         RecordCallback, sInstance));
+    AdvanceTime(1);
+    VerifyOrQuit(sQueryRecordInfo.mCallbackCount == 1);
+    SuccessOrQuit(sQueryRecordInfo.mError);
+    VerifyOrQuit(sQueryRecordInfo.mNumRecords == 1);
+    VerifyOrQuit(sQueryRecordInfo.mRecords[0].mTtl == ttl - 5);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate that an NXDOMAIN response without SOA record is not
+    // cached.
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Resolve non-existing name - not cached");
+
+    for (uint8_t iter = 0; iter < 2; iter++)
+    {
+        totalQueries = GetServerTotalQueries();
+
+        sAddressInfo.Reset();
+        SuccessOrQuit(dnsClient->ResolveAddress(kNonExistingName, AddressCallback, sInstance));
+        AdvanceTime(100);
+        VerifyOrQuit(sAddressInfo.mCallbackCount == 1);
+        VerifyOrQuit(sAddressInfo.mError == kErrorNotFound);
+        VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate negative caching using SOA record in Authority
+    // section. Server uses SOA MINIMUM of 10 seconds.
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Negative caching with SOA");
+
+    dnsClient->ResetCacheCounters();
+    totalQueries = GetServerTotalQueries();
+
+    QueryNsRecord("myhost");
+    VerifyOrQuit(sQueryRecordInfo.mNumRecords == 1);
+    VerifyOrQuit(sQueryRecordInfo.mRecords[0].mRecordType == Dns::ResourceRecord::kTypeSoa);
+    VerifyOrQuit(MapEnum(sQueryRecordInfo.mRecords[0].mSection) == Dns::Client::RecordInfo::kSectionAuthority);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+
+    AdvanceTime(8 * 1000);
+
+    QueryNsRecord("myhost");
+    VerifyOrQuit(sQueryRecordInfo.mNumRecords == 1);
+    VerifyOrQuit(sQueryRecordInfo.mRecords[0].mRecordType == Dns::ResourceRecord::kTypeSoa);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mHits == 1);
+
+    AdvanceTime(3 * 1000);
+
+    QueryNsRecord("myhost");
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 2);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mHits == 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mMisses == 2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate LRU eviction when cache is full.
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("LRU eviction");
+
+    dnsClient->FlushCache();
+
+    for (uint16_t index = 0; index < OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES; index++)
+    {
+        QueryNsRecord(kLabels[index]);
+    }
+
+    // Use `kLabels[0]` so that `kLabels[1]` becomes the least
+    // recently used entry, then add a new entry.
+
+    totalQueries = GetServerTotalQueries();
+    QueryNsRecord(kLabels[0]);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries);
+
+    QueryNsRecord(kLabels[OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES]);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+
+    QueryNsRecord(kLabels[0]);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+
+    QueryNsRecord(kLabels[2]);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+
+    QueryNsRecord(kLabels[1]);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate that cache is flushed on partition change and when
+    // cache is disabled.
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Flush cache");
+
+    totalQueries = GetServerTotalQueries();
+    QueryNsRecord(kLabels[1]);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries);
+
+    sInstance->Get<Notifier>().Signal(kEventThreadPartitionIdChanged);
+    AdvanceTime(1);
+
+    QueryNsRecord(kLabels[1]);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 1);
+
+    dnsClient->SetCacheEnabled(false);
+    dnsClient->SetCacheEnabled(true);
+
+    QueryNsRecord(kLabels[1]);
+    VerifyOrQuit(GetServerTotalQueries() == totalQueries + 2);
+
+    dnsClient->ResetCacheCounters();
+    VerifyOrQuit(dnsClient->GetCacheCounters().mHits == 0);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mMisses == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    Log("End of TestDnsClientCache");
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 #endif // ENABLE_DNS_TEST
 
 int main(void)
@@ -2032,6 +2293,9 @@ int main(void)
     TestDnsClient();
     TestDnssdServerProxyCallback();
     TestDnssdSoaNsResponse();
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    TestDnsClientCache();
+#endif
     printf("All tests passed\n");
 #else
     printf("DNS_CLIENT or DSNSSD_SERVER feature is not enabled\n");
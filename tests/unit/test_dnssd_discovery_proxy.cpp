@@ -229,6 +229,12 @@ void InitTest(void)
     AdvanceTime(10000);
 
     VerifyOrQuit(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    // Tests validate the proxy behavior, so the client answer cache
+    // is disabled.
+    sInstance->Get<Dns::Client>().SetCacheEnabled(false);
+#endif
 }
 
 void FinalizeTest(void)
@@ -3596,6 +3602,210 @@ void TestProxyInvokeCallbackFromStartApi(void)
     Log("End of TestProxyInvokeCallbackFromStartApi");
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+
+namespace ot {
+
+class UnitTester
+{
+public:
+    static void TestProxyNat64AddressCache(void);
+};
+
+void UnitTester::TestProxyNat64AddressCache(void)
+{
+    static constexpr uint32_t kTtl = 300;
+
+    Srp::Server                     *srpServer;
+    Srp::Client                     *srpClient;
+    Dns::Client                     *dnsClient;
+    Dns::Client::QueryConfig         config;
+    Dnssd::AddressResult             ip4AddrrResult;
+    Dnssd::AddressAndTtl             addressAndTtl;
+    NetworkData::ExternalRouteConfig routeConfig;
+    Ip6::Address                     address;
+    Dns::Client::QueryInfo           info;
+    const Dns::Client::CacheEntry   *entry;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestProxyNat64AddressCache");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    dnsClient = &sInstance->Get<Dns::Client>();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server and client.
+
+    SuccessOrQuit(otBorderRoutingInit(sInstance, /* aInfraIfIndex */ kInfraIfIndex, /* aInfraIfIsRunning */ true));
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(2000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Add a route prefix (with NAT64 flag) to network data");
+
+    routeConfig.Clear();
+    SuccessOrQuit(AsCoreType(&routeConfig.mPrefix.mPrefix).FromString("64:ff9b::"));
+    routeConfig.mPrefix.mLength = 96;
+    routeConfig.mPreference     = NetworkData::kRoutePreferenceMedium;
+    routeConfig.mNat64          = true;
+    routeConfig.mStable         = true;
+
+    SuccessOrQuit(otBorderRouterAddRoute(sInstance, &routeConfig));
+    SuccessOrQuit(otBorderRouterRegister(sInstance));
+    AdvanceTime(100);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("Allow NAT64, increase the response timeout and enable the cache on DNS client");
+
+    // The response timeout is longer than the proxy query timeout, so
+    // that the client does not retransmit the AAAA query.
+
+    config.Clear();
+    config.mResponseTimeout = 120 * 1000;
+    config.mNat64Mode       = OT_DNS_NAT64_ALLOW;
+    dnsClient->SetDefaultConfig(config);
+
+    dnsClient->SetCacheEnabled(true);
+    dnsClient->ResetCacheCounters();
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("ResolveAddress() for a host with only an IPv4 address");
+
+    ResetPlatDnssdApiInfo();
+    sResolveAddressInfo.Reset();
+
+    SuccessOrQuit(dnsClient->ResolveAddress("moon.default.service.arpa.", AddressCallback, sInstance));
+    AdvanceTime(10);
+
+    VerifyOrQuit(sStartIp6AddrResolverInfo.mCallCount == 1);
+    VerifyOrQuit(sStartIp6AddrResolverInfo.HostNameMatches("moon"));
+    VerifyOrQuit(sStartIp4AddrResolverInfo.mCallCount == 0);
+
+    // No IPv6 address is discovered. The proxy query times out and
+    // the server sends an empty response, so the client replaces the
+    // AAAA query with an A query.
+
+    AdvanceTime(10 * 1000);
+
+    VerifyOrQuit(sResolveAddressInfo.mCallbackCount == 0);
+    VerifyOrQuit(sStopIp6AddrResolverInfo.mCallCount == 1);
+    VerifyOrQuit(sStartIp4AddrResolverInfo.mCallCount == 1);
+    VerifyOrQuit(sStartIp4AddrResolverInfo.HostNameMatches("moon"));
+
+    // The outstanding query now asks for the IPv4 address while still
+    // remembering the IPv6 address type requested by the caller.
+
+    VerifyOrQuit(dnsClient->mMainQueries.GetHead() != nullptr);
+    info.ReadFrom(*dnsClient->mMainQueries.GetHead());
+    VerifyOrQuit(info.mQueryType == Dns::Client::kIp4AddressQuery);
+    VerifyOrQuit(info.mRequestedType == Dns::Client::kIp6AddressQuery);
+
+    SuccessOrQuit(AsCoreType(&addressAndTtl.mAddress).FromString("::ffff:1.2.3.4"));
+    addressAndTtl.mTtl              = kTtl;
+    ip4AddrrResult.mHostName        = "moon";
+    ip4AddrrResult.mInfraIfIndex    = kInfraIfIndex;
+    ip4AddrrResult.mAddresses       = &addressAndTtl;
+    ip4AddrrResult.mAddressesLength = 1;
+
+    InvokeIp4AddrResolverCallback(sStartIp4AddrResolverInfo.mCallback, ip4AddrrResult);
+    AdvanceTime(10);
+
+    // The 1.2.3.4 address with the NAT64 prefix
+    SuccessOrQuit(address.FromString("64:ff9b:0:0:0:0:102:304"));
+
+    VerifyOrQuit(sResolveAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sResolveAddressInfo.mError);
+    VerifyOrQuit(sResolveAddressInfo.mNumHostAddresses == 1);
+    VerifyOrQuit(sResolveAddressInfo.mHostAddresses[0] == address);
+
+    VerifyOrQuit(dnsClient->GetCacheCounters().mMisses == 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mHits == 0);
+
+    // The translated response is cached under the requested IPv6
+    // address query type, and remembers it answers an IPv4 query.
+
+    entry = dnsClient->mCacheList.GetHead();
+    VerifyOrQuit(entry != nullptr);
+    VerifyOrQuit(entry->GetNext() == nullptr);
+    VerifyOrQuit(entry->mQueryType == Dns::Client::kIp6AddressQuery);
+    VerifyOrQuit(entry->mResponseType == Dns::Client::kIp4AddressQuery);
+    VerifyOrQuit(entry->mRecordType == Dns::ResourceRecord::kTypeAaaa);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("ResolveAddress() again is answered from the cache");
+
+    ResetPlatDnssdApiInfo();
+    sResolveAddressInfo.Reset();
+
+    SuccessOrQuit(dnsClient->ResolveAddress("moon.default.service.arpa.", AddressCallback, sInstance));
+    AdvanceTime(10);
+
+    VerifyOrQuit(sStartIp6AddrResolverInfo.mCallCount == 0);
+    VerifyOrQuit(sStartIp4AddrResolverInfo.mCallCount == 0);
+
+    VerifyOrQuit(sResolveAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sResolveAddressInfo.mError);
+    VerifyOrQuit(sResolveAddressInfo.mNumHostAddresses == 1);
+    VerifyOrQuit(sResolveAddressInfo.mHostAddresses[0] == address);
+
+    VerifyOrQuit(dnsClient->GetCacheCounters().mMisses == 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mHits == 1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - ");
+    Log("ResolveIp4Address() is not answered from the translated entry");
+
+    ResetPlatDnssdApiInfo();
+    sResolveAddressInfo.Reset();
+
+    SuccessOrQuit(dnsClient->ResolveIp4Address("moon.default.service.arpa.", AddressCallback, sInstance));
+    AdvanceTime(10);
+
+    VerifyOrQuit(sResolveAddressInfo.mCallbackCount == 0);
+    VerifyOrQuit(sStartIp4AddrResolverInfo.mCallCount == 1);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mMisses == 2);
+    VerifyOrQuit(dnsClient->GetCacheCounters().mHits == 1);
+
+    InvokeIp4AddrResolverCallback(sStartIp4AddrResolverInfo.mCallback, ip4AddrrResult);
+    AdvanceTime(10);
+
+    VerifyOrQuit(sResolveAddressInfo.mCallbackCount == 1);
+    SuccessOrQuit(sResolveAddressInfo.mError);
+    VerifyOrQuit(sResolveAddressInfo.mNumHostAddresses == 1);
+    VerifyOrQuit(sResolveAddressInfo.mHostAddresses[0] == address);
+
+    // The IPv4 query gets its own entry, keyed and answered by the
+    // IPv4 address query type.
+
+    entry = dnsClient->mCacheList.GetHead();
+    VerifyOrQuit(entry != nullptr);
+    VerifyOrQuit(entry->mQueryType == Dns::Client::kIp4AddressQuery);
+    VerifyOrQuit(entry->mResponseType == Dns::Client::kIp4AddressQuery);
+    VerifyOrQuit(entry->GetNext() != nullptr);
+    VerifyOrQuit(entry->GetNext()->mQueryType == Dns::Client::kIp6AddressQuery);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    Log("End of TestProxyNat64AddressCache");
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+
 #endif // ENABLE_DISCOVERY_PROXY_TEST
 
 int main(void)
@@ -3608,6 +3818,9 @@ int main(void)
     TestProxyFilterInvalidAddresses();
     TestProxyStateChanges();
     TestProxyInvokeCallbackFromStartApi();
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    ot::UnitTester::TestProxyNat64AddressCache();
+#endif
 
     printf("All tests passed\n");
 #else
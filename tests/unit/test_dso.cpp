@@ -120,6 +120,9 @@ public:
         : Dso::Connection(aInstance, aPeerSockAddr, sCallbacks)
         , mName(aName)
         , mLocalSockAddr(aLocalSockAddr)
+        , mDeferResponses(false)
+        , mPipelinedTxTestTlvValues(0)
+        , mLastTxKeepAliveInterval(0)
     {
         ClearTestFlags();
     }
@@ -150,6 +153,7 @@ public:
 
     uint8_t               GetLastRxTestTlvValue(void) const { return mLastRxTestTlvValue; }
     Dns::Header::Response GetLastRxResponseCode(void) const { return mLastRxResponseCode; }
+    uint32_t              GetLastTxKeepAliveInterval(void) const { return mLastTxKeepAliveInterval; }
 
     void SendTestRequestMessage(uint8_t aValue = 0, uint32_t aResponseTimeout = Dso::kResponseTimeout)
     {
@@ -165,7 +169,47 @@ public:
         SuccessOrQuit(SendUnidirectionalMessage(PrepareTestMessage(aValue)));
     }
 
+    void SendPipelinedTestRequests(uint8_t aNumRequests)
+    {
+        // Sends multiple requests without waiting for the responses.
+        // The Test TLV value of each request is its index, which is
+        // tracked in `mPipelinedTxTestTlvValues` until its response
+        // is received.
+
+        OT_ASSERT(aNumRequests <= kMaxPipelinedRequests);
+
+        for (uint8_t value = 0; value < aNumRequests; value++)
+        {
+            MessageId messageId;
+
+            mPipelinedTxTestTlvValues |= (1u << value);
+            SuccessOrQuit(SendRequestMessage(PrepareTestMessage(value), messageId));
+        }
+    }
+
+    bool HasPendingPipelinedRequests(void) const { return mPipelinedTxTestTlvValues != 0; }
+
+    void SetDeferResponses(bool aDefer) { mDeferResponses = aDefer; }
+
+    void SendDeferredResponsesInReverseOrder(void)
+    {
+        DeferredResponse *response;
+
+        while ((response = mDeferredResponses.PopBack()) != nullptr)
+        {
+            SendTestResponseMessage(response->mMessageId, response->mValue);
+        }
+    }
+
 private:
+    static constexpr uint8_t kMaxPipelinedRequests = 32;
+
+    struct DeferredResponse
+    {
+        MessageId mMessageId;
+        uint8_t   mValue;
+    };
+
     Message &PrepareTestMessage(uint8_t aValue)
     {
         TestTlv  testTlv;
@@ -206,6 +250,27 @@ private:
         SuccessOrQuit(SendResponseMessage(PrepareTestMessage(aValue), aResponseId));
     }
 
+    void ParseTxMessage(const Message &aMessage)
+    {
+        // Tracks the Keep Alive interval in a sent Keep Alive TLV,
+        // which follows the DNS header as the primary TLV with the
+        // Inactivity Timeout before the Keep Alive interval.
+
+        uint16_t offset = sizeof(Dns::Header);
+        Dso::Tlv tlv;
+        uint32_t interval;
+
+        SuccessOrExit(aMessage.Read(offset, tlv));
+        VerifyOrExit(tlv.GetType() == Dso::Tlv::kKeepAliveType);
+        offset += sizeof(Dso::Tlv) + sizeof(uint32_t);
+
+        SuccessOrQuit(aMessage.Read(offset, interval));
+        mLastTxKeepAliveInterval = BigEndian::HostSwap32(interval);
+
+    exit:
+        return;
+    }
+
     //---------------------------------------------------------------------
     // Callback methods
 
@@ -222,6 +287,17 @@ private:
 
         VerifyOrExit(aPrimaryTlvType == TestTlv::kType, error = kErrorNotFound);
         ParseTestMessage(aMessage);
+
+        if (mDeferResponses)
+        {
+            DeferredResponse *response = mDeferredResponses.PushBack();
+
+            VerifyOrQuit(response != nullptr);
+            response->mMessageId = aMessageId;
+            response->mValue     = mLastRxTestTlvValue;
+            ExitNow();
+        }
+
         SendTestResponseMessage(aMessageId, mLastRxTestTlvValue);
 
     exit:
@@ -261,7 +337,16 @@ private:
         VerifyOrQuit(aResponseTlvType == TestTlv::kType);
         VerifyOrQuit(aRequestTlvType == TestTlv::kType);
         ParseTestMessage(aMessage);
-        VerifyOrQuit(mLastRxTestTlvValue == mLastTxTestTlvValue);
+
+        if (mPipelinedTxTestTlvValues != 0)
+        {
+            VerifyOrQuit(mPipelinedTxTestTlvValues & (1u << mLastRxTestTlvValue));
+            mPipelinedTxTestTlvValues &= ~(1u << mLastRxTestTlvValue);
+        }
+        else
+        {
+            VerifyOrQuit(mLastRxTestTlvValue == mLastTxTestTlvValue);
+        }
 
     exit:
         return error;
@@ -320,6 +405,11 @@ private:
     uint8_t               mLastTxTestTlvValue;
     uint8_t               mLastRxTestTlvValue;
     Dns::Header::Response mLastRxResponseCode;
+    bool                  mDeferResponses;
+    uint32_t              mPipelinedTxTestTlvValues;
+    uint32_t              mLastTxKeepAliveInterval;
+
+    Array<DeferredResponse, kMaxPipelinedRequests> mDeferredResponses;
 
     static Callbacks sCallbacks;
 };
@@ -331,6 +421,118 @@ Dso::Connection::Callbacks Connection::sCallbacks(Connection::HandleConnected,
                                                   Connection::ProcessUnidirectionalMessage,
                                                   Connection::ProcessResponseMessage);
 
+// A user sharing a client connection. The callbacks of a user are
+// only passed the `Connection`, so the test uses a single `User`.
+
+class TestUser : public Dso::Connection::User
+{
+public:
+    TestUser(void)
+        : User(sCallbacks)
+    {
+        ClearTestFlags();
+    }
+
+    void ClearTestFlags(void)
+    {
+        mDidGetSessionEstablishedSignal = false;
+        mDidGetDisconnectSignal         = false;
+        mDidProcessResponse             = false;
+    }
+
+    bool    DidGetSessionEstablishedSignal(void) const { return mDidGetSessionEstablishedSignal; }
+    bool    DidGetDisconnectSignal(void) const { return mDidGetDisconnectSignal; }
+    bool    DidProcessResponse(void) const { return mDidProcessResponse; }
+    uint8_t GetLastRxTestTlvValue(void) const { return mLastRxTestTlvValue; }
+
+    void SendTestRequestMessage(Dso::Connection &aConnection, uint8_t aValue)
+    {
+        TestTlv                    testTlv;
+        Message                   *message = aConnection.NewMessage();
+        Dso::Connection::MessageId messageId;
+
+        VerifyOrQuit(message != nullptr);
+        testTlv.Init(aValue);
+        SuccessOrQuit(message->Append(testTlv));
+        SuccessOrQuit(aConnection.SendRequestMessage(*message, messageId, *this));
+    }
+
+    static TestUser *sUser;
+
+private:
+    static void HandleConnected(Dso::Connection &) { VerifyOrQuit(false); }
+    // The users are signaled before the owner.
+
+    static void HandleSessionEstablished(Dso::Connection &aConnection)
+    {
+        VerifyOrQuit(aConnection.GetState() == Connection::kStateSessionEstablished);
+        VerifyOrQuit(!static_cast<Connection &>(aConnection).DidGetSessionEstablishedSignal());
+        sUser->mDidGetSessionEstablishedSignal = true;
+    }
+
+    static void HandleDisconnected(Dso::Connection &aConnection)
+    {
+        VerifyOrQuit(aConnection.GetState() == Connection::kStateDisconnected);
+        VerifyOrQuit(!static_cast<Connection &>(aConnection).DidGetDisconnectSignal());
+        sUser->mDidGetDisconnectSignal = true;
+    }
+
+    static Error ProcessRequestMessage(Dso::Connection &,
+                                       Dso::Connection::MessageId,
+                                       const Message &,
+                                       Dso::Tlv::Type)
+    {
+        VerifyOrQuit(false);
+        return kErrorNone;
+    }
+
+    static Error ProcessUnidirectionalMessage(Dso::Connection &, const Message &, Dso::Tlv::Type)
+    {
+        VerifyOrQuit(false);
+        return kErrorNone;
+    }
+
+    static Error ProcessResponseMessage(Dso::Connection   &aConnection,
+                                        const Dns::Header &aHeader,
+                                        const Message     &aMessage,
+                                        Dso::Tlv::Type     aResponseTlvType,
+                                        Dso::Tlv::Type     aRequestTlvType)
+    {
+        TestTlv testTlv;
+
+        OT_UNUSED_VARIABLE(aConnection);
+
+        Log(" TestUser::ProcessResponseMessage(responseTlv:0x%04x)", aResponseTlvType);
+
+        VerifyOrQuit(aHeader.GetResponseCode() == Dns::Header::kResponseSuccess);
+        VerifyOrQuit(aResponseTlvType == TestTlv::kType);
+        VerifyOrQuit(aRequestTlvType == TestTlv::kType);
+        SuccessOrQuit(aMessage.Read(aMessage.GetOffset(), testTlv));
+        VerifyOrQuit(testTlv.IsValid());
+
+        sUser->mDidProcessResponse = true;
+        sUser->mLastRxTestTlvValue = testTlv.GetValue();
+
+        return kErrorNone;
+    }
+
+    bool    mDidGetSessionEstablishedSignal;
+    bool    mDidGetDisconnectSignal;
+    bool    mDidProcessResponse;
+    uint8_t mLastRxTestTlvValue;
+
+    static Dso::Connection::Callbacks sCallbacks;
+};
+
+TestUser *TestUser::sUser = nullptr;
+
+Dso::Connection::Callbacks TestUser::sCallbacks(TestUser::HandleConnected,
+                                                TestUser::HandleSessionEstablished,
+                                                TestUser::HandleDisconnected,
+                                                TestUser::ProcessRequestMessage,
+                                                TestUser::ProcessUnidirectionalMessage,
+                                                TestUser::ProcessResponseMessage);
+
 static constexpr uint16_t kMaxConnections = 5;
 
 static Array<Connection *, kMaxConnections> sConnections;
@@ -421,6 +623,7 @@ void otPlatDsoSend(otPlatDsoConnection *aConnection, otMessage *aMessage)
     VerifyOrQuit(conn.GetState() != Connection::kStateDisconnected);
     VerifyOrQuit(conn.GetState() != Connection::kStateConnecting);
     conn.mDidSendMessage = true;
+    conn.ParseTxMessage(AsCoreType(aMessage));
 
     if (sTestDsoForwardMessageToPeer)
     {
@@ -540,6 +743,9 @@ void TestDso(void)
     static constexpr uint32_t kRetryDelayInterval  = TimeMilli::SecToMsec(3600);
     static constexpr uint32_t kLongResponseTimeout = Dso::kResponseTimeout + TimeMilli::SecToMsec(17);
 
+    static constexpr uint8_t  kNumPipelinedRequests = 10;
+    static constexpr uint32_t kResponseDelay        = 500;
+
     Instance             &instance = *static_cast<Instance *>(testInitInstance());
     Ip6::SockAddr         serverSockAddr(kPortA);
     Ip6::SockAddr         clientSockAddr(kPortB);
@@ -1213,6 +1419,164 @@ void TestDso(void)
     VerifyOrQuit(clientConn.GetRetryDelay() == kRetryDelayInterval);
     VerifyOrQuit(clientConn.GetRetryDelayErrorCode() == Dns::Header::kResponseServerFailure);
 
+    Log("-------------------------------------------------------------------------------------------");
+    Log("Pipelined requests with out of order responses");
+
+    clientConn.ClearTestFlags();
+    serverConn.ClearTestFlags();
+    instance.Get<Dso>().ResetCounters();
+
+    clientConn.Connect();
+    SuccessOrQuit(clientConn.SendKeepAliveMessage());
+    VerifyOrQuit(clientConn.GetState() == Connection::kStateSessionEstablished);
+    VerifyOrQuit(serverConn.GetState() == Connection::kStateSessionEstablished);
+
+    VerifyOrQuit(instance.Get<Dso>().GetCounters().mConnectAttempts == 1);
+    VerifyOrQuit(instance.Get<Dso>().GetCounters().mSessionsEstablished == 1);
+
+    serverConn.SetDeferResponses(true);
+    clientConn.SendPipelinedTestRequests(kNumPipelinedRequests);
+    VerifyOrQuit(serverConn.DidProcessRequest());
+    VerifyOrQuit(!clientConn.DidProcessResponse());
+    VerifyOrQuit(clientConn.HasPendingPipelinedRequests());
+
+    AdvanceTime(kResponseDelay);
+    serverConn.SendDeferredResponsesInReverseOrder();
+
+    VerifyOrQuit(clientConn.DidProcessResponse());
+    VerifyOrQuit(!clientConn.HasPendingPipelinedRequests());
+    VerifyOrQuit(clientConn.GetState() == Connection::kStateSessionEstablished);
+    VerifyOrQuit(serverConn.GetState() == Connection::kStateSessionEstablished);
+
+    // The Keep Alive request and the pipelined requests
+
+    VerifyOrQuit(instance.Get<Dso>().GetCounters().mRequestsSent == kNumPipelinedRequests + 1);
+    VerifyOrQuit(instance.Get<Dso>().GetCounters().mResponsesReceived == kNumPipelinedRequests + 1);
+    VerifyOrQuit(instance.Get<Dso>().GetCounters().mTotalResponseTime == kNumPipelinedRequests * kResponseDelay);
+    VerifyOrQuit(instance.Get<Dso>().GetCounters().mMaxResponseTime == kResponseDelay);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Share client connection with a user");
+
+    {
+        TestUser         user;
+        Dso::Connection *sharedConn;
+
+        TestUser::sUser = &user;
+
+        serverConn.SetDeferResponses(false);
+        clientConn.ClearTestFlags();
+
+        sharedConn = instance.Get<Dso>().FindClientConnection(serverSockAddr);
+        VerifyOrQuit(sharedConn == &clientConn);
+        VerifyOrQuit(!sharedConn->IsShared());
+
+        sharedConn->AddUser(user);
+        VerifyOrQuit(sharedConn->IsShared());
+        VerifyOrQuit(instance.Get<Dso>().GetCounters().mConnectionReuses == 1);
+        VerifyOrQuit(instance.Get<Dso>().GetCounters().mConnectAttempts == 1);
+
+        user.SendTestRequestMessage(*sharedConn, 0x77);
+        VerifyOrQuit(user.DidProcessResponse());
+        VerifyOrQuit(user.GetLastRxTestTlvValue() == 0x77);
+        VerifyOrQuit(!clientConn.DidProcessResponse());
+
+        Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+        Log("Remove user while its request is pending");
+
+        user.ClearTestFlags();
+        serverConn.SetDeferResponses(true);
+
+        user.SendTestRequestMessage(*sharedConn, 0x78);
+        sharedConn->RemoveUser(user);
+        VerifyOrQuit(!sharedConn->IsShared());
+
+        serverConn.SendDeferredResponsesInReverseOrder();
+        VerifyOrQuit(!user.DidProcessResponse());
+        VerifyOrQuit(!clientConn.DidProcessResponse());
+        VerifyOrQuit(clientConn.GetState() == Connection::kStateSessionEstablished);
+
+        Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+        Log("Disconnect shared connection");
+
+        serverConn.SetDeferResponses(false);
+        sharedConn->AddUser(user);
+        VerifyOrQuit(instance.Get<Dso>().GetCounters().mConnectionReuses == 2);
+
+        clientConn.Disconnect(Connection::kGracefullyClose, Connection::kReasonInactivityTimeout);
+        VerifyOrQuit(clientConn.GetState() == Connection::kStateDisconnected);
+        VerifyOrQuit(user.DidGetDisconnectSignal());
+        VerifyOrQuit(!clientConn.DidGetDisconnectSignal());
+        VerifyOrQuit(!clientConn.IsShared());
+
+        Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+        Log("Shared connection establishing session and closed by peer");
+
+        clientConn.ClearTestFlags();
+        serverConn.ClearTestFlags();
+        user.ClearTestFlags();
+
+        clientConn.Connect();
+        VerifyOrQuit(clientConn.GetState() == Connection::kStateConnectedButSessionless);
+        clientConn.AddUser(user);
+        VerifyOrQuit(instance.Get<Dso>().GetCounters().mConnectionReuses == 3);
+
+        // The user and owner `HandleSessionEstablished()` and
+        // `HandleDisconnected()` callbacks check that the user is
+        // signaled first.
+
+        SuccessOrQuit(clientConn.SendKeepAliveMessage());
+        VerifyOrQuit(clientConn.GetState() == Connection::kStateSessionEstablished);
+        VerifyOrQuit(user.DidGetSessionEstablishedSignal());
+        VerifyOrQuit(clientConn.DidGetSessionEstablishedSignal());
+
+        serverConn.Disconnect(Connection::kGracefullyClose, Connection::kReasonInactivityTimeout);
+        VerifyOrQuit(clientConn.GetState() == Connection::kStateDisconnected);
+        VerifyOrQuit(clientConn.GetDisconnectReason() == Connection::kReasonPeerClosed);
+        VerifyOrQuit(user.DidGetDisconnectSignal());
+        VerifyOrQuit(clientConn.DidGetDisconnectSignal());
+        VerifyOrQuit(!clientConn.IsShared());
+
+        TestUser::sUser = nullptr;
+    }
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("Sleepy client requesting Keep Alive interval");
+
+    {
+        Mle::DeviceMode mode = instance.Get<Mle::Mle>().GetDeviceMode();
+
+        clientConn.ClearTestFlags();
+        serverConn.ClearTestFlags();
+
+        SuccessOrQuit(clientConn.SetTimeouts(Dso::kInfiniteTimeout, Dso::kMinKeepAliveInterval));
+
+        clientConn.Connect();
+        SuccessOrQuit(clientConn.SendKeepAliveMessage());
+        VerifyOrQuit(clientConn.GetState() == Connection::kStateSessionEstablished);
+        VerifyOrQuit(clientConn.GetLastTxKeepAliveInterval() == Dso::kMinKeepAliveInterval);
+
+        // When sleepy, at least `kSleepyKeepAliveInterval` is requested.
+
+        SuccessOrQuit(instance.Get<Mle::Mle>().SetDeviceMode(Mle::DeviceMode(0)));
+        VerifyOrQuit(!instance.Get<Mle::Mle>().IsRxOnWhenIdle());
+
+        SuccessOrQuit(clientConn.SetTimeouts(Dso::kInfiniteTimeout, Dso::kMinKeepAliveInterval));
+        VerifyOrQuit(clientConn.GetLastTxKeepAliveInterval() == Dso::kSleepyKeepAliveInterval);
+
+        SuccessOrQuit(clientConn.SetTimeouts(Dso::kInfiniteTimeout, 2 * Dso::kSleepyKeepAliveInterval));
+        VerifyOrQuit(clientConn.GetLastTxKeepAliveInterval() == 2 * Dso::kSleepyKeepAliveInterval);
+
+        SuccessOrQuit(instance.Get<Mle::Mle>().SetDeviceMode(mode));
+        VerifyOrQuit(instance.Get<Mle::Mle>().IsRxOnWhenIdle());
+
+        SuccessOrQuit(clientConn.SetTimeouts(Dso::kInfiniteTimeout, Dso::kMinKeepAliveInterval));
+        VerifyOrQuit(clientConn.GetLastTxKeepAliveInterval() == Dso::kMinKeepAliveInterval);
+
+        clientConn.Disconnect(Connection::kGracefullyClose, Connection::kReasonInactivityTimeout);
+        VerifyOrQuit(clientConn.GetState() == Connection::kStateDisconnected);
+    }
+
     Log("End of test");
 
     testFreeInstance(&instance);
@@ -954,6 +954,139 @@ void TestMacFrameValidation(void)
     SuccessOrQuit(frame.ValidatePsdu());
 }
 
+void VerifyHeaderViewMatchesFrame(const Mac::RxFrame &aFrame)
+{
+    Mac::RxFrame::HeaderView headerView;
+    Mac::PanId               panId;
+    Mac::PanId               viewPanId;
+    Mac::Address             address;
+    FrameData                payload;
+    uint8_t                  commandId;
+    uint8_t                  viewCommandId;
+    uint8_t                  keyIndex;
+    uint8_t                  viewKeyIndex;
+    uint32_t                 frameCounter;
+    uint32_t                 viewFrameCounter;
+    Mac::Frame::KeyIdMode    keyIdMode;
+    Mac::Frame::KeyIdMode    viewKeyIdMode;
+
+    SuccessOrQuit(aFrame.ParseHeader(headerView));
+
+    VerifyOrQuit(headerView.GetType() == aFrame.GetType());
+    VerifyOrQuit(headerView.GetVersion() == aFrame.GetVersion());
+    VerifyOrQuit(headerView.GetSecurityEnabled() == aFrame.GetSecurityEnabled());
+    VerifyOrQuit(headerView.GetFramePending() == aFrame.GetFramePending());
+
+    VerifyOrQuit(headerView.GetDstPanId(viewPanId) == aFrame.GetDstPanId(panId));
+    VerifyOrQuit((aFrame.GetDstPanId(panId) != kErrorNone) || (viewPanId == panId));
+    VerifyOrQuit(headerView.GetSrcPanId(viewPanId) == aFrame.GetSrcPanId(panId));
+    VerifyOrQuit((aFrame.GetSrcPanId(panId) != kErrorNone) || (viewPanId == panId));
+
+    SuccessOrQuit(aFrame.GetDstAddr(address));
+    VerifyOrQuit(headerView.GetDstAddr() == address);
+    SuccessOrQuit(aFrame.GetSrcAddr(address));
+    VerifyOrQuit(headerView.GetSrcAddr() == address);
+
+    if (aFrame.GetSecurityEnabled())
+    {
+        SuccessOrQuit(aFrame.GetFrameCounter(frameCounter));
+        SuccessOrQuit(headerView.GetFrameCounter(viewFrameCounter));
+        VerifyOrQuit(viewFrameCounter == frameCounter);
+
+        SuccessOrQuit(aFrame.GetKeyIdMode(keyIdMode));
+        SuccessOrQuit(headerView.GetKeyIdMode(viewKeyIdMode));
+        VerifyOrQuit(viewKeyIdMode == keyIdMode);
+        VerifyOrQuit(headerView.HasKeyIdMode(keyIdMode));
+
+        VerifyOrQuit(headerView.GetKeyIndex(viewKeyIndex) == aFrame.GetKeyIndex(keyIndex));
+        VerifyOrQuit((aFrame.GetKeyIndex(keyIndex) != kErrorNone) || (viewKeyIndex == keyIndex));
+    }
+    else
+    {
+        VerifyOrQuit(headerView.GetFrameCounter(viewFrameCounter) == kErrorNotFound);
+        VerifyOrQuit(headerView.GetKeyIdMode(viewKeyIdMode) == kErrorNotFound);
+    }
+
+    VerifyOrQuit(headerView.IsSecuredWith(Mac::RxFrame::kAllowKeyIdMode0 | Mac::RxFrame::kAllowKeyIdMode1) ==
+                 aFrame.IsSecuredWith(Mac::RxFrame::kAllowKeyIdMode0 | Mac::RxFrame::kAllowKeyIdMode1));
+
+    VerifyOrQuit(headerView.GetCommandId(viewCommandId) == aFrame.GetCommandId(commandId));
+    VerifyOrQuit((aFrame.GetCommandId(commandId) != kErrorNone) || (viewCommandId == commandId));
+    VerifyOrQuit(headerView.IsDataRequestCommand() == aFrame.IsDataRequestCommand());
+
+    SuccessOrQuit(aFrame.GetPayload(payload));
+    VerifyOrQuit(headerView.GetPayload().GetBytes() == payload.GetBytes());
+    VerifyOrQuit(headerView.GetPayload().GetLength() == payload.GetLength());
+}
+
+void TestMacFrameHeaderView(void)
+{
+    // IEEE 802.15.4-2006 Data, unsecured, extended source and destination
+    uint8_t data_psdu1[] = {0x61, 0xdc, 0xbd, 0xce, 0xfa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6e,
+                            0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6e, 0x16, 0x7f, 0x33, 0xf0};
+
+    // IEEE 802.15.4-2006 Mac Command (Data Request), secured with Key ID Mode 1
+    uint8_t mac_cmd_psdu1[] = {0x6b, 0xdc, 0x85, 0xce, 0xfa, 0x47, 0x36, 0x07, 0xd9, 0x74, 0x45, 0x8d,
+                               0xb2, 0x6e, 0x81, 0x25, 0xc9, 0xdb, 0xac, 0x2b, 0x0a, 0x0d, 0x00, 0x00,
+                               0x00, 0x00, 0x01, 0x04, 0xaf, 0x14, 0xce, 0xaa, 0x5a, 0xe5};
+
+#if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
+    // IEEE 802.15.4-2015 Data, secured with Key ID Mode 1, short source and destination
+    uint8_t data_psdu2[] = {0x69, 0xa8, 0x8e, 0xce, 0xfa, 0x02, 0x24, 0x00, 0x24, 0x0d, 0x02,
+                            0x00, 0x00, 0x00, 0x01, 0x6b, 0x64, 0x60, 0x08, 0x55, 0xb8, 0x10,
+                            0x18, 0xc7, 0x40, 0x2e, 0xfb, 0xf3, 0xda, 0xf9, 0x4e, 0x58, 0x70};
+
+    // IEEE 802.15.4-2015 Mac Command (Data Request) with CSL IE
+    uint8_t mac_cmd_psdu2[] = {0x6b, 0xaa, 0x8d, 0xce, 0xfa, 0x00, 0x68, 0x01, 0x68, 0x0d,
+                               0x08, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0d, 0xed, 0x0b, 0x35,
+                               0x0c, 0x80, 0x3f, 0x04, 0x4b, 0x88, 0x89, 0xd6, 0x59, 0xe1};
+#endif
+
+    uint8_t                  invalid_psdu[] = {0x05, 0x00, 0x01, 0x00, 0x00};
+    Mac::RxFrame             frame;
+    Mac::RxFrame::HeaderView headerView;
+    uint8_t                  commandId;
+
+    frame.mPsdu   = data_psdu1;
+    frame.mLength = sizeof(data_psdu1);
+    VerifyHeaderViewMatchesFrame(frame);
+
+    frame.mPsdu   = mac_cmd_psdu1;
+    frame.mLength = sizeof(mac_cmd_psdu1);
+    VerifyHeaderViewMatchesFrame(frame);
+
+#if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
+    frame.mPsdu   = data_psdu2;
+    frame.mLength = sizeof(data_psdu2);
+    VerifyHeaderViewMatchesFrame(frame);
+
+    frame.mPsdu   = mac_cmd_psdu2;
+    frame.mLength = sizeof(mac_cmd_psdu2);
+    VerifyHeaderViewMatchesFrame(frame);
+
+    // For a 2015 MAC command, the Command ID is part of the payload
+    // which may be decrypted in place after the header is parsed.
+    // Verify that the view reflects the updated payload.
+
+    SuccessOrQuit(frame.ParseHeader(headerView));
+    SuccessOrQuit(headerView.GetCommandId(commandId));
+    VerifyOrQuit(commandId == Mac::Frame::kMacCmdDataRequest);
+
+    AsNonConst(headerView.GetPayload().GetBytes())[0] = Mac::Frame::kMacCmdBeaconRequest;
+    SuccessOrQuit(headerView.GetCommandId(commandId));
+    VerifyOrQuit(commandId == Mac::Frame::kMacCmdBeaconRequest);
+    VerifyOrQuit(!headerView.IsDataRequestCommand());
+#endif
+
+    // Verify that an invalid frame fails to parse (Multipurpose frame type).
+
+    frame.mPsdu   = invalid_psdu;
+    frame.mLength = sizeof(invalid_psdu);
+    VerifyOrQuit(frame.ParseHeader(headerView) == kErrorParse);
+
+    OT_UNUSED_VARIABLE(commandId);
+}
+
 } // namespace ot
 
 int main(void)
@@ -965,6 +1098,7 @@ int main(void)
     ot::TestMacFrameApi();
     ot::TestMacFrameAckGeneration();
     ot::TestMacFrameValidation();
+    ot::TestMacFrameHeaderView();
     printf("All tests passed\n");
     return 0;
 }
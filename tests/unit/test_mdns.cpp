@@ -1719,6 +1719,52 @@ static void SendEmtryPtrQueryWithKnownAnswers(const char *aName, const KnownAnsw
     otPlatMdnsHandleReceive(sInstance, message, /* aIsUnicast */ false, &senderAddrInfo);
 }
 
+static void SendQueryWithKnownAnswerRecords(const char       *aName,
+                                            uint16_t          aRecordType,
+                                            uint16_t          aNumRecords,
+                                            const RecordData *aRecords)
+{
+    Message          *message;
+    Header            header;
+    ResourceRecord    rr;
+    Core::AddressInfo senderAddrInfo;
+    uint16_t          nameOffset;
+
+    message = sInstance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrQuit(message != nullptr);
+
+    header.Clear();
+    header.SetType(Header::kTypeQuery);
+    header.SetQuestionCount(1);
+    header.SetAnswerCount(aNumRecords);
+
+    SuccessOrQuit(message->Append(header));
+    nameOffset = message->GetLength();
+    SuccessOrQuit(Name::AppendName(aName, *message));
+    SuccessOrQuit(message->Append(Question(aRecordType, ResourceRecord::kClassInternet)));
+
+    for (uint16_t index = 0; index < aNumRecords; index++)
+    {
+        const RecordData &record = aRecords[index];
+
+        rr.Init(record.mType);
+        rr.SetTtl(record.mTtl);
+        rr.SetLength(record.mLength);
+
+        SuccessOrQuit(Name::AppendPointerLabel(nameOffset, *message));
+        SuccessOrQuit(message->Append(rr));
+        SuccessOrQuit(message->AppendBytes(record.mData, record.mLength));
+    }
+
+    SuccessOrQuit(AsCoreType(&senderAddrInfo.mAddress).FromString(kDeviceIp6Address));
+    senderAddrInfo.mPort         = kMdnsPort;
+    senderAddrInfo.mInfraIfIndex = 0;
+
+    Log("Sending query for %s %s with %u known-answers", aName, RecordTypeToString(aRecordType), aNumRecords);
+
+    otPlatMdnsHandleReceive(sInstance, message, /* aIsUnicast */ false, &senderAddrInfo);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // `otPlatLog`
 
@@ -4138,6 +4184,7 @@ void TestQuery(void)
     DnsNameString     service2FullName;
     DnsNameString     service3FullName;
     KnownAnswer       knownAnswers[2];
+    RecordData        knownRecords[2];
 
     Log("-------------------------------------------------------------------------------------------");
     Log("TestQuery");
@@ -4580,6 +4627,64 @@ void TestQuery(void)
     dnsMsg->Validate(service3, kInAdditionalSection, kCheckSrv | kCheckTxt);
     dnsMsg->Validate(host2, kInAdditionalSection);
 
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send a TXT query for `srv3` with matching TXT known-answer, validate no response is emitted");
+
+    knownRecords[0].mType   = ResourceRecord::kTypeTxt;
+    knownRecords[0].mData   = kTxtData2;
+    knownRecords[0].mLength = sizeof(kTxtData2);
+    knownRecords[0].mTtl    = 1500;
+
+    mdns->ResetCounters();
+
+    AdvanceTime(1000);
+
+    sDnsMessages.Clear();
+    SendQueryWithKnownAnswerRecords(service3FullName.AsCString(), ResourceRecord::kTypeTxt, 1, knownRecords);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(sDnsMessages.IsEmpty());
+    VerifyOrQuit(mdns->GetCounters().mKnownAnswerSuppressed == 1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send an AAAA query for `host2` with one of its two addresses as known-answer, validate response");
+
+    knownRecords[0].mType   = ResourceRecord::kTypeAaaa;
+    knownRecords[0].mData   = reinterpret_cast<const uint8_t *>(&host2Addresses[0]);
+    knownRecords[0].mLength = sizeof(Ip6::Address);
+    knownRecords[0].mTtl    = 1500;
+
+    AdvanceTime(1000);
+
+    sDnsMessages.Clear();
+    SendQueryWithKnownAnswerRecords(host2FullName.AsCString(), ResourceRecord::kTypeAaaa, 1, knownRecords);
+
+    AdvanceTime(1000);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+    VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() == 2);
+    dnsMsg->Validate(host2, kInAnswerSection);
+    VerifyOrQuit(mdns->GetCounters().mKnownAnswerSuppressed == 1);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send an AAAA query for `host2` with both addresses as known-answer, validate no response is emitted");
+
+    knownRecords[1].mType   = ResourceRecord::kTypeAaaa;
+    knownRecords[1].mData   = reinterpret_cast<const uint8_t *>(&host2Addresses[1]);
+    knownRecords[1].mLength = sizeof(Ip6::Address);
+    knownRecords[1].mTtl    = 1500;
+
+    AdvanceTime(1000);
+
+    sDnsMessages.Clear();
+    SendQueryWithKnownAnswerRecords(host2FullName.AsCString(), ResourceRecord::kTypeAaaa, 2, knownRecords);
+
+    AdvanceTime(2000);
+    VerifyOrQuit(sDnsMessages.IsEmpty());
+    VerifyOrQuit(mdns->GetCounters().mKnownAnswerSuppressed == 2);
+
     //--- --- --- --- --- --- --- --- --- --- --- --- --- --- --- --- --- --- --- --- --- --- --- ---
     // Query during Goodbye announcements
 
@@ -5035,6 +5140,60 @@ void TestResponseAggregation(void)
     dnsMsg->Validate(udpService, kInAdditionalSection, kCheckSrv | kCheckTxt);
     VerifyOrQuit(dnsMsg->GetNext() == nullptr);
 
+    Log("-------------------------------------------------------------------------------------------");
+    Log("Re-register both services shortly apart and validate later announcements are aggregated");
+
+    SuccessOrQuit(mdns->UnregisterService(tcpService));
+    SuccessOrQuit(mdns->UnregisterService(udpService));
+
+    AdvanceTime(5000);
+
+    tcpService.mServiceInstance = "srv3";
+    udpService.mServiceInstance = "srv4";
+
+    sDnsMessages.Clear();
+
+    sRegCallbacks[0].Reset();
+    sRegCallbacks[1].Reset();
+    SuccessOrQuit(mdns->RegisterService(tcpService, 0, HandleSuccessCallback));
+
+    // Wait for the first probe of `tcpService` to be sent before
+    // registering `udpService` so that the two entries are probed
+    // separately and their announcements are not initially aligned.
+
+    while (sDnsMessages.IsEmpty())
+    {
+        AdvanceTime(1);
+    }
+
+    AdvanceTime(1);
+    SuccessOrQuit(mdns->RegisterService(udpService, 1, HandleSuccessCallback));
+
+    // By now, both entries have finished probing and sent their
+    // first announcement.
+
+    AdvanceTime(1100);
+    VerifyOrQuit(sRegCallbacks[0].mWasCalled);
+    VerifyOrQuit(sRegCallbacks[1].mWasCalled);
+
+    sDnsMessages.Clear();
+    AdvanceTime(1000);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    dnsMsg->Validate(tcpService, kInAnswerSection, kCheckSrv | kCheckTxt | kCheckPtr);
+    dnsMsg->Validate(udpService, kInAnswerSection, kCheckSrv | kCheckTxt | kCheckPtr);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
+    sDnsMessages.Clear();
+    AdvanceTime(2000);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    dnsMsg->Validate(tcpService, kInAnswerSection, kCheckSrv | kCheckTxt | kCheckPtr);
+    dnsMsg->Validate(udpService, kInAnswerSection, kCheckSrv | kCheckTxt | kCheckPtr);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
     SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
     VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
 
@@ -6270,6 +6429,217 @@ void TestBrowser(void)
     testFreeInstance(sInstance);
 }
 
+void TestDuplicateQuestionSuppression(void)
+{
+    Core             *mdns = InitTest();
+    Core::Browser     browser;
+    const DnsMessage *dnsMsg;
+    uint16_t          heapAllocations;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestDuplicateQuestionSuppression");
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Start a browser. Validate first two queries.");
+
+    ClearAllBytes(browser);
+
+    browser.mServiceType  = "_srv._udp";
+    browser.mSubTypeLabel = nullptr;
+    browser.mInfraIfIndex = kInfraIfIndex;
+    browser.mCallback     = HandleBrowseResult;
+
+    mdns->ResetCounters();
+
+    sDnsMessages.Clear();
+    SuccessOrQuit(mdns->StartBrowser(browser));
+
+    for (uint8_t queryCount = 0; queryCount < 2; queryCount++)
+    {
+        sDnsMessages.Clear();
+
+        AdvanceTime(DetermineQueryWaitTime(queryCount));
+
+        VerifyOrQuit(!sDnsMessages.IsEmpty());
+        dnsMsg = sDnsMessages.GetHead();
+        dnsMsg->ValidateHeader(kMulticastQuery, /* Q */ 1, /* Ans */ 0, /* Auth */ 0, /* Addnl */ 0);
+        dnsMsg->ValidateAsQueryFor(browser);
+        VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+    }
+
+    VerifyOrQuit(mdns->GetCounters().mTxMessages == 2);
+    VerifyOrQuit(mdns->GetCounters().mDuplicateQuerySuppressed == 0);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Receive the same QM question from another host before our next query. Validate it is suppressed.");
+
+    // The received query also asks about another service type so that
+    // it is not mistaken for our own (looped back) query.
+
+    sDnsMessages.Clear();
+    AdvanceTime(1000);
+
+    SendQueryForTwo("_srv._udp.local.", ResourceRecord::kTypePtr, "_other._udp.local.", ResourceRecord::kTypePtr);
+
+    AdvanceTime(DetermineQueryWaitTime(2) - 1000);
+    VerifyOrQuit(sDnsMessages.IsEmpty());
+
+    VerifyOrQuit(mdns->GetCounters().mDuplicateQuerySuppressed == 1);
+    VerifyOrQuit(mdns->GetCounters().mTxMessages == 2);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Validate the next query is sent using the doubled interval from the received query.");
+
+    AdvanceTime(DetermineQueryWaitTime(3));
+
+    VerifyOrQuit(!sDnsMessages.IsEmpty());
+    dnsMsg = sDnsMessages.GetHead();
+    dnsMsg->ValidateHeader(kMulticastQuery, /* Q */ 1, /* Ans */ 0, /* Auth */ 0, /* Addnl */ 0);
+    dnsMsg->ValidateAsQueryFor(browser);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
+    VerifyOrQuit(mdns->GetCounters().mTxMessages == 3);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Receive a QU question from another host. Validate it is not treated as a duplicate.");
+
+    sDnsMessages.Clear();
+    AdvanceTime(1000);
+
+    SendQuery("_srv._udp.local.", ResourceRecord::kTypePtr, ResourceRecord::kClassInternet | kClassQueryUnicastFlag);
+
+    AdvanceTime(DetermineQueryWaitTime(4));
+
+    VerifyOrQuit(!sDnsMessages.IsEmpty());
+    VerifyOrQuit(mdns->GetCounters().mDuplicateQuerySuppressed == 1);
+
+    mdns->ResetCounters();
+    VerifyOrQuit(mdns->GetCounters().mTxMessages == 0);
+
+    SuccessOrQuit(mdns->StopBrowser(browser));
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
+void TestMultiPacketKnownAnswerQuery(void)
+{
+    static constexpr uint16_t kNumServices = 20;
+
+    Core             *mdns = InitTest();
+    Core::Browser     browser;
+    const DnsMessage *dnsMsg;
+    uint16_t          heapAllocations;
+    uint16_t          numKnownAnswers;
+    uint16_t          numMessages;
+    DnsNameString     serviceType;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestMultiPacketKnownAnswerQuery");
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    mdns->SetMaxMessageSize(200);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Start a browser. Validate first query.");
+
+    ClearAllBytes(browser);
+
+    browser.mServiceType  = "_srv._udp";
+    browser.mSubTypeLabel = nullptr;
+    browser.mInfraIfIndex = kInfraIfIndex;
+    browser.mCallback     = HandleBrowseResult;
+    serviceType.Append("%s.local.", browser.mServiceType);
+
+    mdns->ResetCounters();
+
+    sDnsMessages.Clear();
+    SuccessOrQuit(mdns->StartBrowser(browser));
+
+    AdvanceTime(DetermineQueryWaitTime(0));
+
+    VerifyOrQuit(!sDnsMessages.IsEmpty());
+    dnsMsg = sDnsMessages.GetHead();
+    dnsMsg->ValidateHeader(kMulticastQuery, /* Q */ 1, /* Ans */ 0, /* Auth */ 0, /* Addnl */ 0);
+    dnsMsg->ValidateAsQueryFor(browser);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send responses for %u services so that known-answers do not fit in a single query", kNumServices);
+
+    for (uint16_t index = 0; index < kNumServices; index++)
+    {
+        DnsNameString instanceName;
+
+        instanceName.Append("instance%02u._srv._udp.local.", index);
+        SendPtrResponse("_srv._udp.local.", instanceName.AsCString(), 4500, kInAnswerSection);
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Validate next query is sent as a multi-packet known-answer query");
+
+    sDnsMessages.Clear();
+
+    AdvanceTime(DetermineQueryWaitTime(1));
+
+    VerifyOrQuit(!sDnsMessages.IsEmpty());
+    dnsMsg = sDnsMessages.GetHead();
+
+    // First message contains the question and is marked as truncated.
+
+    VerifyOrQuit(dnsMsg->mType == kMulticastQuery);
+    VerifyOrQuit(dnsMsg->mHeader.IsTruncationFlagSet());
+    VerifyOrQuit(dnsMsg->mHeader.GetQuestionCount() == 1);
+    VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() > 0);
+    VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() < kNumServices);
+    VerifyOrQuit(dnsMsg->mQuestions.Contains(ResourceRecord::kTypePtr, serviceType));
+
+    numKnownAnswers = dnsMsg->mHeader.GetAnswerCount();
+    numMessages     = 1;
+
+    // Follow-up messages contain no question and carry the remaining
+    // known-answers. All but the last one are marked as truncated.
+
+    for (dnsMsg = dnsMsg->GetNext(); dnsMsg != nullptr; dnsMsg = dnsMsg->GetNext())
+    {
+        VerifyOrQuit(dnsMsg->mType == kMulticastQuery);
+        VerifyOrQuit(dnsMsg->mHeader.GetQuestionCount() == 0);
+        VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() > 0);
+        VerifyOrQuit(dnsMsg->mHeader.IsTruncationFlagSet() == (dnsMsg->GetNext() != nullptr));
+
+        numKnownAnswers += dnsMsg->mHeader.GetAnswerCount();
+        numMessages++;
+    }
+
+    VerifyOrQuit(numMessages > 1);
+    VerifyOrQuit(numKnownAnswers == kNumServices);
+
+    VerifyOrQuit(mdns->GetCounters().mMultiPacketQueries == 1);
+    VerifyOrQuit(mdns->GetCounters().mTxMessages == 1 + numMessages);
+
+    SuccessOrQuit(mdns->StopBrowser(browser));
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
 void TestBrowserMalformedPtrName(void)
 {
     Core             *mdns = InitTest();
@@ -8833,6 +9203,218 @@ void TestPassiveCache(void)
     testFreeInstance(sInstance);
 }
 
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
+void TestCacheSnapshot(void)
+{
+    // Records are saved 10 seconds after they are received with TTL
+    // of 120 seconds, and then restored 20 seconds later.
+
+    static constexpr uint32_t kRestoredTtl = 120 - 10 - 20;
+
+    Core                 *mdns = InitTest();
+    Core::Browser         browser;
+    Core::SrvResolver     srvResolver;
+    Core::TxtResolver     txtResolver;
+    Core::AddressResolver addrResolver;
+    AddrAndTtl            addrTtls[2];
+    uint8_t               buffer[1000];
+    uint16_t              length;
+    const DnsMessage     *dnsMsg;
+    BrowseCallback       *browseCallback;
+    SrvCallback          *srvCallback;
+    TxtCallback          *txtCallback;
+    AddrCallback         *addrCallback;
+    uint16_t              heapAllocations;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestCacheSnapshot");
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    length = sizeof(buffer);
+    VerifyOrQuit(mdns->SaveCacheSnapshot(buffer, length) == kErrorInvalidState);
+
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    length = sizeof(buffer);
+    VerifyOrQuit(mdns->SaveCacheSnapshot(buffer, length) == kErrorNotFound);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Start browser and resolvers, and populate the caches from responses");
+
+    ClearAllBytes(browser);
+    ClearAllBytes(srvResolver);
+    ClearAllBytes(txtResolver);
+    ClearAllBytes(addrResolver);
+
+    browser.mServiceType  = "_srv._udp";
+    browser.mSubTypeLabel = nullptr;
+    browser.mInfraIfIndex = kInfraIfIndex;
+    browser.mCallback     = HandleBrowseResult;
+
+    srvResolver.mServiceInstance = "mysrv";
+    srvResolver.mServiceType     = "_srv._udp";
+    srvResolver.mInfraIfIndex    = kInfraIfIndex;
+    srvResolver.mCallback        = HandleSrvResult;
+
+    txtResolver.mServiceInstance = "mysrv";
+    txtResolver.mServiceType     = "_srv._udp";
+    txtResolver.mInfraIfIndex    = kInfraIfIndex;
+    txtResolver.mCallback        = HandleTxtResult;
+
+    addrResolver.mHostName     = "myhost";
+    addrResolver.mInfraIfIndex = kInfraIfIndex;
+    addrResolver.mCallback     = HandleAddrResult;
+
+    SuccessOrQuit(mdns->StartBrowser(browser));
+    SuccessOrQuit(mdns->StartSrvResolver(srvResolver));
+    SuccessOrQuit(mdns->StartTxtResolver(txtResolver));
+    SuccessOrQuit(mdns->StartIp6AddressResolver(addrResolver));
+
+    AdvanceTime(5 * 1000);
+
+    SuccessOrQuit(addrTtls[0].mAddress.FromString("fd00::1"));
+    SuccessOrQuit(addrTtls[1].mAddress.FromString("fd00::2"));
+    addrTtls[0].mTtl = 120;
+    addrTtls[1].mTtl = 120;
+
+    SendPtrResponse("_srv._udp.local.", "mysrv._srv._udp.local.", 120, kInAnswerSection);
+    SendSrvResponse("mysrv._srv._udp.local.", "myhost.local.", 1234, 0, 1, 120, kInAnswerSection);
+    SendTxtResponse("mysrv._srv._udp.local.", kTxtData1, sizeof(kTxtData1), 120, kInAnswerSection);
+    SendHostAddrResponse("myhost.local.", addrTtls, 2, /* aCacheFlush */ true, kInAnswerSection);
+
+    AdvanceTime(10 * 1000);
+
+    SuccessOrQuit(mdns->StopBrowser(browser));
+    SuccessOrQuit(mdns->StopSrvResolver(srvResolver));
+    SuccessOrQuit(mdns->StopTxtResolver(txtResolver));
+    SuccessOrQuit(mdns->StopIp6AddressResolver(addrResolver));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Save a snapshot. Validate it is truncated when buffer is too small.");
+
+    length = 80;
+    SuccessOrQuit(mdns->SaveCacheSnapshot(buffer, length));
+    VerifyOrQuit(length <= 80);
+
+    length = sizeof(buffer);
+    SuccessOrQuit(mdns->SaveCacheSnapshot(buffer, length));
+    Log("Snapshot length: %u", length);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Disable and re-enable mDNS, validate malformed snapshot is rejected.");
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(mdns->RestoreCacheSnapshot(buffer, length, 0) == kErrorInvalidState);
+
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+    VerifyOrQuit(mdns->RestoreCacheSnapshot(buffer, length - 1, 0) == kErrorParse);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Restore the snapshot after 20 seconds.");
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    AdvanceTime(20 * 1000);
+
+    SuccessOrQuit(mdns->RestoreCacheSnapshot(buffer, length, 20));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Start a browser, validate restored result is reported and query includes no known-answer.");
+
+    sBrowseCallbacks.Clear();
+    sDnsMessages.Clear();
+
+    SuccessOrQuit(mdns->StartBrowser(browser));
+
+    AdvanceTime(DetermineQueryWaitTime(0));
+
+    browseCallback = sBrowseCallbacks.GetHead();
+    VerifyOrQuit(browseCallback != nullptr);
+    VerifyOrQuit(browseCallback->mServiceType.Matches("_srv._udp"));
+    VerifyOrQuit(!browseCallback->mIsSubType);
+    VerifyOrQuit(browseCallback->mServiceInstance.Matches("mysrv"));
+    VerifyOrQuit(browseCallback->mTtl == kRestoredTtl);
+    VerifyOrQuit(browseCallback->GetNext() == nullptr);
+
+    VerifyOrQuit(!sDnsMessages.IsEmpty());
+    dnsMsg = sDnsMessages.GetHead();
+    dnsMsg->ValidateHeader(kMulticastQuery, /* Q */ 1, /* Ans */ 0, /* Auth */ 0, /* Addnl */ 0);
+    dnsMsg->ValidateAsQueryFor(browser);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Start resolvers, validate restored results are reported and initial queries are sent.");
+
+    sSrvCallbacks.Clear();
+    sTxtCallbacks.Clear();
+    sAddrCallbacks.Clear();
+    sDnsMessages.Clear();
+
+    SuccessOrQuit(mdns->StartSrvResolver(srvResolver));
+    SuccessOrQuit(mdns->StartTxtResolver(txtResolver));
+    SuccessOrQuit(mdns->StartIp6AddressResolver(addrResolver));
+
+    AdvanceTime(1);
+
+    srvCallback = sSrvCallbacks.GetHead();
+    VerifyOrQuit(srvCallback != nullptr);
+    VerifyOrQuit(srvCallback->mServiceInstance.Matches("mysrv"));
+    VerifyOrQuit(srvCallback->mHostName.Matches("myhost"));
+    VerifyOrQuit(srvCallback->mPort == 1234);
+    VerifyOrQuit(srvCallback->mPriority == 0);
+    VerifyOrQuit(srvCallback->mWeight == 1);
+    VerifyOrQuit(srvCallback->mTtl == kRestoredTtl);
+    VerifyOrQuit(srvCallback->GetNext() == nullptr);
+
+    txtCallback = sTxtCallbacks.GetHead();
+    VerifyOrQuit(txtCallback != nullptr);
+    VerifyOrQuit(txtCallback->mServiceInstance.Matches("mysrv"));
+    VerifyOrQuit(txtCallback->Matches(kTxtData1));
+    VerifyOrQuit(txtCallback->mTtl == kRestoredTtl);
+    VerifyOrQuit(txtCallback->GetNext() == nullptr);
+
+    addrTtls[0].mTtl = kRestoredTtl;
+    addrTtls[1].mTtl = kRestoredTtl;
+
+    addrCallback = sAddrCallbacks.GetHead();
+    VerifyOrQuit(addrCallback != nullptr);
+    VerifyOrQuit(addrCallback->mHostName.Matches("myhost"));
+    VerifyOrQuit(addrCallback->Matches(addrTtls, 2));
+    VerifyOrQuit(addrCallback->GetNext() == nullptr);
+
+    AdvanceTime(DetermineQueryWaitTime(0));
+    VerifyOrQuit(!sDnsMessages.IsEmpty());
+
+    SuccessOrQuit(mdns->StopBrowser(browser));
+    SuccessOrQuit(mdns->StopSrvResolver(srvResolver));
+    SuccessOrQuit(mdns->StopTxtResolver(txtResolver));
+    SuccessOrQuit(mdns->StopIp6AddressResolver(addrResolver));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Restore the snapshot with an elapsed time past the TTL, validate no record is restored.");
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    SuccessOrQuit(mdns->RestoreCacheSnapshot(buffer, length, 120));
+
+    length = sizeof(buffer);
+    VerifyOrQuit(mdns->SaveCacheSnapshot(buffer, length) == kErrorNotFound);
+
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
+#endif // OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+
 void TestLegacyUnicastResponse(void)
 {
     Core             *mdns = InitTest();
@@ -9033,6 +9615,8 @@ int main(void)
     ot::Dns::Multicast::TestServiceConflict();
 
     ot::Dns::Multicast::TestBrowser();
+    ot::Dns::Multicast::TestDuplicateQuestionSuppression();
+    ot::Dns::Multicast::TestMultiPacketKnownAnswerQuery();
     ot::Dns::Multicast::TestBrowserMalformedPtrName();
     ot::Dns::Multicast::TestSrvResolver();
     ot::Dns::Multicast::TestTxtResolver();
@@ -9040,6 +9624,9 @@ int main(void)
     ot::Dns::Multicast::TestRecordQuerier();
     ot::Dns::Multicast::TestRecordQuerierForAny();
     ot::Dns::Multicast::TestPassiveCache();
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_CACHE_SNAPSHOT_ENABLE
+    ot::Dns::Multicast::TestCacheSnapshot();
+#endif
     ot::Dns::Multicast::TestLegacyUnicastResponse();
 
     printf("All tests passed\n");
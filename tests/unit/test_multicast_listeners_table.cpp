@@ -44,6 +44,39 @@ namespace ot {
 
 using namespace ot::BackboneRouter;
 
+static Instance *sInstance;
+static uint32_t  sNow = 0;
+static uint32_t  sAlarmTime;
+static bool      sAlarmOn = false;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        sNow     = sAlarmTime;
+        sAlarmOn = false;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    sNow = time;
+}
+
 void TestMulticastListenersTable(void)
 {
     static constexpr uint16_t kMaxSize = OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS;
@@ -61,7 +94,8 @@ void TestMulticastListenersTable(void)
     SuccessOrQuit(kMa401.FromString("ff04::01"));
     SuccessOrQuit(kMa501.FromString("ff05::01"));
 
-    instance = testInitInstance();
+    instance  = testInitInstance();
+    sInstance = instance;
     VerifyOrQuit(instance != nullptr);
 
     table = &instance->Get<MulticastListenersTable>();
@@ -122,11 +156,141 @@ void TestMulticastListenersTable(void)
     }
 }
 
+static constexpr uint32_t kExpireStep          = 10;
+static constexpr uint32_t kRefreshedExpireTime = 1000 + 64 * kExpireStep;
+
+static uint16_t  sNumRemoved;
+static TimeMilli sLastRemovedExpireTime;
+
+static TimeMilli DetermineExpireTime(uint16_t aIndex)
+{
+    // Spread the expire times so that they are not in the order the
+    // listeners are added. Entries with an odd index share the same
+    // expire time with the entry before them.
+
+    return TimeMilli(1000 + ((aIndex / 2) * 37 % 64) * kExpireStep);
+}
+
+static TimeMilli DetermineRefreshedExpireTime(uint16_t aIndex)
+{
+    // The listener at index zero is refreshed to expire last.
+
+    return (aIndex == 0) ? TimeMilli(kRefreshedExpireTime) : DetermineExpireTime(aIndex);
+}
+
+static void HandleListenerEvent(void                                  *aContext,
+                                otBackboneRouterMulticastListenerEvent aEvent,
+                                const otIp6Address                    *aAddress)
+{
+    TimeMilli expireTime = DetermineRefreshedExpireTime(BigEndian::HostSwap16(AsCoreType(aAddress).mFields.m16[7]));
+
+    VerifyOrQuit(aContext == &sNumRemoved);
+
+    if (aEvent != OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED)
+    {
+        ExitNow();
+    }
+
+    // Listeners must expire in the order of their expire times and
+    // never before their expire time.
+
+    VerifyOrQuit(expireTime <= TimerMilli::GetNow());
+    VerifyOrQuit(sNumRemoved == 0 || sLastRemovedExpireTime <= expireTime);
+
+    sLastRemovedExpireTime = expireTime;
+    sNumRemoved++;
+
+exit:
+    return;
+}
+
+void TestMulticastListenersTableExpiry(void)
+{
+    static constexpr uint16_t kMaxSize = OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS;
+
+    MulticastListenersTable                   &table = sInstance->Get<MulticastListenersTable>();
+    Ip6::Address                               address;
+    Ip6::Address                               refreshedAddress;
+    MulticastListenersTable::ListenerIterator iterator = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
+    MulticastListenersTable::ListenerInfo     info;
+    uint16_t                                   count;
+
+    SuccessOrQuit(address.FromString("ff04::"));
+
+    table.Clear();
+    VerifyOrQuit(table.Count() == 0);
+
+    sNow        = 0;
+    sNumRemoved = 0;
+    table.SetCallback(HandleListenerEvent, &sNumRemoved);
+
+    for (uint16_t i = 0; i < kMaxSize; i++)
+    {
+        address.mFields.m16[7] = BigEndian::HostSwap16(i);
+        SuccessOrQuit(table.Add(address, DetermineExpireTime(i)));
+    }
+
+    VerifyOrQuit(table.Count() == kMaxSize);
+
+    // Refresh the listener with the earliest expire time so that it
+    // expires last.
+
+    refreshedAddress                = address;
+    refreshedAddress.mFields.m16[7] = BigEndian::HostSwap16(0);
+    SuccessOrQuit(table.Add(refreshedAddress, DetermineRefreshedExpireTime(0)));
+    VerifyOrQuit(table.Count() == kMaxSize);
+
+    // Iterate over all entries.
+
+    count = 0;
+
+    while (table.GetNext(iterator, info) == kErrorNone)
+    {
+        VerifyOrQuit(table.Has(AsCoreType(&info.mAddress)));
+        count++;
+    }
+
+    VerifyOrQuit(count == kMaxSize);
+
+    // Advance the time in steps and check that the number of
+    // remaining listeners matches the expected expire times.
+
+    while (table.Count() > 0)
+    {
+        uint16_t numExpected = 0;
+
+        AdvanceTime(kExpireStep * 3);
+
+        for (uint16_t i = 0; i < kMaxSize; i++)
+        {
+            address.mFields.m16[7] = BigEndian::HostSwap16(i);
+
+            if (DetermineRefreshedExpireTime(i) > TimerMilli::GetNow())
+            {
+                VerifyOrQuit(table.Has(address));
+                numExpected++;
+            }
+            else
+            {
+                VerifyOrQuit(!table.Has(address));
+            }
+        }
+
+        VerifyOrQuit(table.Count() == numExpected);
+    }
+
+    VerifyOrQuit(sNumRemoved == kMaxSize);
+    VerifyOrQuit(!table.Has(refreshedAddress));
+
+    table.SetCallback(nullptr, nullptr);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMulticastListenersTable();
+    ot::TestMulticastListenersTableExpiry();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -27,6 +27,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -435,6 +436,255 @@ void TestNat64Counters(void)
     Log("End of TestNat64Counters");
 }
 
+void TestNat64ManyMappings(void)
+{
+    static constexpr uint16_t kNumMappings = 200;
+
+    // Offset of the last two bytes of the IPv6 source address and of
+    // the IPv4 destination address in the test packets.
+    static constexpr uint16_t kIp6SrcAddrSuffixOffset = 22;
+    static constexpr uint16_t kIp4DstAddrOffset       = 16;
+
+    // fd02::1               fd01::ac10:f3c5       UDP      52     43981 → 4660 Len=4
+    const uint8_t kIp6Packet[] = {
+        0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x11, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x31, 0x61, 0x62, 0x63, 0x64,
+    };
+    // 172.16.243.197        192.168.123.1         UDP      32     43981 → 4660 Len=4
+    const uint8_t kIp4Packet[] = {0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x11, 0xa0,
+                                  0x4d, 172,  16,   243,  197,  192,  168,  123,  1,    0xab, 0xcd,
+                                  0x12, 0x34, 0x00, 0x0c, 0xa1, 0x8d, 0x61, 0x62, 0x63, 0x64};
+
+    Ip6::Prefix                        prefix;
+    Ip4::Cidr                          cidr;
+    Ip4::Address                       ip4Addresses[kNumMappings];
+    Translator::AddressMappingIterator iter;
+    Translator::AddressMapping         mapping;
+    uint16_t                           numMappings;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64ManyMappings");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    SuccessOrQuit(prefix.FromString("fd01::/96"));
+    SuccessOrQuit(cidr.FromString("192.168.0.0/24"));
+
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Translator>().SetNat64Prefix(prefix);
+    sInstance->Get<Translator>().SetEnabled(true);
+
+    // Translate datagrams from many different IPv6 sources, twice.
+    // The first round creates the mappings, the second round should
+    // find the existing ones and use the same IPv4 addresses.
+
+    for (uint8_t round = 0; round < 2; round++)
+    {
+        for (uint16_t i = 0; i < kNumMappings; i++)
+        {
+            Message     *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+            Ip4::Headers ip4Headers;
+
+            VerifyOrQuit(message != nullptr);
+            SuccessOrQuit(message->AppendBytes(kIp6Packet, sizeof(kIp6Packet)));
+            message->Write(kIp6SrcAddrSuffixOffset, BigEndian::HostSwap16(i + 1));
+
+            SuccessOrQuit(sInstance->Get<Translator>().TranslateIp6ToIp4(*message));
+            SuccessOrQuit(ip4Headers.ParseFrom(*message));
+
+            if (round == 0)
+            {
+                VerifyOrQuit(memcmp(ip4Headers.GetSourceAddress().GetBytes(), cidr.GetBytes(), 3) == 0);
+
+                for (uint16_t j = 0; j < i; j++)
+                {
+                    VerifyOrQuit(ip4Addresses[j] != ip4Headers.GetSourceAddress());
+                }
+
+                ip4Addresses[i] = ip4Headers.GetSourceAddress();
+            }
+            else
+            {
+                VerifyOrQuit(ip4Addresses[i] == ip4Headers.GetSourceAddress());
+            }
+
+            message->Free();
+        }
+    }
+
+    numMappings = 0;
+    iter.Init(*sInstance);
+
+    while (iter.GetNext(mapping) == kErrorNone)
+    {
+        numMappings++;
+    }
+
+    VerifyOrQuit(numMappings == kNumMappings);
+
+    // Translate datagrams towards each mapped IPv4 address and
+    // verify they are translated to the matching IPv6 destination.
+
+    for (uint16_t i = 0; i < kNumMappings; i++)
+    {
+        Message     *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+        Ip6::Headers ip6Headers;
+        Ip6::Address expectedAddress;
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(kIp4Packet, sizeof(kIp4Packet)));
+        message->Write(kIp4DstAddrOffset, ip4Addresses[i]);
+
+        SuccessOrQuit(sInstance->Get<Translator>().TranslateIp4ToIp6(*message));
+        SuccessOrQuit(ip6Headers.ParseFrom(*message));
+
+        SuccessOrQuit(expectedAddress.FromString("fd02::1"));
+        expectedAddress.mFields.m16[7] = BigEndian::HostSwap16(i + 1);
+        VerifyOrQuit(ip6Headers.GetDestinationAddress() == expectedAddress);
+
+        message->Free();
+    }
+
+    Log("End of TestNat64ManyMappings");
+}
+
+struct MappingEventInfo
+{
+    uint16_t                   mNumAdded;
+    uint16_t                   mNumRemoved;
+    bool                       mInstall;
+    Translator::MappingEvent   mLastEvent;
+    Translator::AddressMapping mLastMapping;
+};
+
+static MappingEventInfo sMappingEventInfo;
+
+bool HandleMappingEvent(otNat64MappingEvent aEvent, const otNat64AddressMapping *aMapping, void *aContext)
+{
+    VerifyOrQuit(aContext == &sMappingEventInfo);
+    VerifyOrQuit(aMapping != nullptr);
+
+    Log("  MappingEvent: %s, id:%lu", (aEvent == Translator::kMappingAdded) ? "added" : "removed",
+        ToUlong(static_cast<uint32_t>(aMapping->mId)));
+
+    if (aEvent == Translator::kMappingAdded)
+    {
+        sMappingEventInfo.mNumAdded++;
+    }
+    else
+    {
+        sMappingEventInfo.mNumRemoved++;
+    }
+
+    sMappingEventInfo.mLastEvent   = aEvent;
+    sMappingEventInfo.mLastMapping = *aMapping;
+
+    return sMappingEventInfo.mInstall;
+}
+
+void TestNat64MappingCallback(void)
+{
+    // fd02::1               fd01::ac10:f3c5       UDP      52     43981 → 4660 Len=4
+    const uint8_t kIp6Packet[] = {
+        0x60, 0x08, 0x6e, 0x38, 0x00, 0x0c, 0x11, 0x40, 0xfd, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        172,  16,   243,  197,  0xab, 0xcd, 0x12, 0x34, 0x00, 0x0c, 0xe3, 0x31, 0x61, 0x62, 0x63, 0x64,
+    };
+
+    Ip6::Prefix  prefix;
+    Ip4::Cidr    cidr;
+    Ip6::Address ip6Address;
+    Ip4::Headers ip4Headers;
+    uint64_t     mappingId;
+    uint64_t     numPackets;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64MappingCallback");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    SuccessOrQuit(prefix.FromString("fd01::/96"));
+    SuccessOrQuit(cidr.FromString("192.168.123.1/32"));
+    SuccessOrQuit(ip6Address.FromString("fd02::1"));
+
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Translator>().SetNat64Prefix(prefix);
+    sInstance->Get<Translator>().SetEnabled(true);
+
+    ClearAllBytes(sMappingEventInfo);
+    otNat64SetMappingCallback(sInstance, HandleMappingEvent, &sMappingEventInfo);
+
+    // The first datagram creates a mapping, the following one reuses it.
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        Message *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(kIp6Packet, sizeof(kIp6Packet)));
+        SuccessOrQuit(sInstance->Get<Translator>().TranslateIp6ToIp4(*message));
+        SuccessOrQuit(ip4Headers.ParseFrom(*message));
+        message->Free();
+
+        VerifyOrQuit(sMappingEventInfo.mNumAdded == 1);
+        VerifyOrQuit(sMappingEventInfo.mNumRemoved == 0);
+    }
+
+    VerifyOrQuit(sMappingEventInfo.mLastEvent == Translator::kMappingAdded);
+    VerifyOrQuit(AsCoreType(&sMappingEventInfo.mLastMapping.mIp6) == ip6Address);
+    VerifyOrQuit(AsCoreType(&sMappingEventInfo.mLastMapping.mIp4) == ip4Headers.GetSourceAddress());
+    VerifyOrQuit(sMappingEventInfo.mLastMapping.mRemainingTimeMs > 0);
+
+    mappingId = sMappingEventInfo.mLastMapping.mId;
+
+    // Clearing the CIDR removes all the mappings.
+
+    sInstance->Get<Translator>().ClearIp4Cidr();
+
+    VerifyOrQuit(sMappingEventInfo.mNumAdded == 1);
+    VerifyOrQuit(sMappingEventInfo.mNumRemoved == 1);
+    VerifyOrQuit(sMappingEventInfo.mLastEvent == Translator::kMappingRemoved);
+    VerifyOrQuit(sMappingEventInfo.mLastMapping.mId == mappingId);
+    VerifyOrQuit(AsCoreType(&sMappingEventInfo.mLastMapping.mIp6) == ip6Address);
+
+    // A mapping installed by the callback is offloaded: its datagrams
+    // are counted but passed on untranslated.
+
+    sMappingEventInfo.mInstall = true;
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+
+    numPackets = sInstance->Get<Translator>().GetCounters().mTotal.m6To4Packets;
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        Message *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(kIp6Packet, sizeof(kIp6Packet)));
+        VerifyOrQuit(sInstance->Get<Translator>().TranslateIp6ToIp4(*message) == kErrorAbort);
+        VerifyOrQuit(message->GetLength() == sizeof(kIp6Packet));
+        VerifyOrQuit(message->CompareBytes(0, kIp6Packet, sizeof(kIp6Packet)));
+        message->Free();
+
+        VerifyOrQuit(sMappingEventInfo.mNumAdded == 2);
+        VerifyOrQuit(sMappingEventInfo.mNumRemoved == 1);
+    }
+
+    VerifyOrQuit(sMappingEventInfo.mLastEvent == Translator::kMappingAdded);
+    VerifyOrQuit(AsCoreType(&sMappingEventInfo.mLastMapping.mIp6) == ip6Address);
+    VerifyOrQuit(sInstance->Get<Translator>().GetCounters().mTotal.m6To4Packets == numPackets + 2);
+
+    sInstance->Get<Translator>().ClearIp4Cidr();
+    VerifyOrQuit(sMappingEventInfo.mNumRemoved == 2);
+
+    otNat64SetMappingCallback(sInstance, nullptr, nullptr);
+
+    Log("End of TestNat64MappingCallback");
+}
+
 } // namespace Nat64
 } // namespace ot
 
@@ -445,6 +695,8 @@ int main(void)
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     ot::Nat64::TestNat64Translation();
     ot::Nat64::TestNat64Counters();
+    ot::Nat64::TestNat64ManyMappings();
+    ot::Nat64::TestNat64MappingCallback();
     printf("All tests passed\n");
 #else
     printf("NAT64 is not enabled\n");
@@ -0,0 +1,394 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "test_platform.h"
+#include "test_util.h"
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "lib/spinel/spinel_buffer.hpp"
+#include "lib/spinel/spinel_decoder.hpp"
+#include "ncp/ncp_base.hpp"
+
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+
+namespace ot {
+
+constexpr uint16_t kMaxSpinelBufferSize = 2048;
+constexpr uint16_t kSegmentHeaderSize   = sizeof(uint16_t);
+constexpr uint8_t  kMaxPropsInFrame     = 8;
+
+static const spinel_prop_key_t kChangedProps[] = {
+    SPINEL_PROP_NET_ROLE,
+    SPINEL_PROP_PHY_CHAN,
+    SPINEL_PROP_MAC_15_4_PANID,
+    SPINEL_PROP_NET_NETWORK_NAME,
+};
+
+struct ParsedFrame
+{
+    bool ContainsProp(spinel_prop_key_t aPropKey) const
+    {
+        bool contains = false;
+
+        for (uint8_t i = 0; i < mNumProps; i++)
+        {
+            if (mProps[i] == aPropKey)
+            {
+                contains = true;
+                break;
+            }
+        }
+
+        return contains;
+    }
+
+    uint16_t          mLength;
+    unsigned int      mCommand;
+    uint8_t           mNumProps;
+    spinel_prop_key_t mProps[kMaxPropsInFrame];
+    uint16_t          mPropEndOffsets[kMaxPropsInFrame]; // Frame length up to and including each property.
+};
+
+class TestNcp : public Ncp::NcpBase
+{
+public:
+    explicit TestNcp(Instance *aInstance)
+        : NcpBase(aInstance)
+    {
+        // Perform the initial updates (e.g., reset status) and drop
+        // them, so that the TX buffer only contains the frames written
+        // by the test.
+
+        UpdateChangedProps();
+        mTxFrameBuffer.Clear();
+    }
+
+    void AddChangedProps(void)
+    {
+        for (spinel_prop_key_t propKey : kChangedProps)
+        {
+            mChangedPropsSet.AddProperty(propKey);
+        }
+    }
+
+    bool HasChangedProps(void) const { return !mChangedPropsSet.IsEmpty(); }
+
+    otError WriteCoalescedFrame(uint16_t aMaxFrameLength) { return WriteCoalescedChangedPropsFrame(aMaxFrameLength); }
+
+    void ExpireWindowAndUpdate(void)
+    {
+        mChangedPropsWindowExpired = true;
+        UpdateChangedProps();
+    }
+
+    uint32_t GetCoalescedFrameCounter(void) const { return mCoalescedChangedPropsFrameCounter; }
+    uint32_t GetSavedFrameCounter(void) const { return mSavedChangedPropsFrameCounter; }
+
+    bool ReadFrame(ParsedFrame &aFrame)
+    {
+        bool            found = false;
+        uint8_t         buf[kMaxSpinelBufferSize];
+        uint8_t         header;
+        unsigned int    propKey;
+        Spinel::Decoder decoder;
+
+        VerifyOrExit(mTxFrameBuffer.OutFrameBegin() == OT_ERROR_NONE);
+
+        aFrame.mLength = mTxFrameBuffer.OutFrameGetLength();
+        VerifyOrQuit(aFrame.mLength <= sizeof(buf));
+        VerifyOrQuit(mTxFrameBuffer.OutFrameRead(aFrame.mLength, buf) == aFrame.mLength);
+        SuccessOrQuit(mTxFrameBuffer.OutFrameRemove());
+
+        aFrame.mCommand  = SPINEL_CMD_NOOP;
+        aFrame.mNumProps = 0;
+
+        decoder.Init(buf, aFrame.mLength);
+        SuccessOrQuit(decoder.ReadUint8(header));
+
+        if (header != (SPINEL_HEADER_FLAG | SPINEL_HEADER_TX_NOTIFICATION_IID))
+        {
+            // Not a property update frame (e.g. a filler frame).
+            ExitNow(found = true);
+        }
+
+        SuccessOrQuit(decoder.ReadUintPacked(aFrame.mCommand));
+
+        switch (aFrame.mCommand)
+        {
+        case SPINEL_CMD_PROP_VALUE_IS:
+            SuccessOrQuit(decoder.ReadUintPacked(propKey));
+            aFrame.mProps[aFrame.mNumProps]          = static_cast<spinel_prop_key_t>(propKey);
+            aFrame.mPropEndOffsets[aFrame.mNumProps] = aFrame.mLength;
+            aFrame.mNumProps++;
+            break;
+
+        case SPINEL_CMD_PROP_VALUES_ARE:
+            while (!decoder.IsAllRead())
+            {
+                VerifyOrQuit(aFrame.mNumProps < kMaxPropsInFrame);
+                SuccessOrQuit(decoder.OpenStruct());
+                SuccessOrQuit(decoder.ReadUintPacked(propKey));
+                SuccessOrQuit(decoder.CloseStruct());
+                aFrame.mProps[aFrame.mNumProps]          = static_cast<spinel_prop_key_t>(propKey);
+                aFrame.mPropEndOffsets[aFrame.mNumProps] = decoder.GetReadLength();
+                aFrame.mNumProps++;
+            }
+            break;
+
+        default:
+            VerifyOrQuit(false, "Unexpected spinel command");
+            break;
+        }
+
+        found = true;
+
+    exit:
+        return found;
+    }
+
+    void LeaveTxSpaceForFrame(uint16_t aFrameLength)
+    {
+        // Probe the longest frame which still fits in the TX buffer,
+        // then add a filler frame so that afterwards only a frame of
+        // up to `aFrameLength` bytes fits.
+
+        uint16_t maxLength = 0;
+
+        mTxFrameBuffer.InFrameBegin(Spinel::Buffer::kPriorityLow);
+
+        while (mTxFrameBuffer.InFrameFeedByte(0) == OT_ERROR_NONE)
+        {
+            maxLength++;
+        }
+
+        VerifyOrQuit(maxLength > aFrameLength + kSegmentHeaderSize);
+
+        // Beginning a new frame discards the unfinished probe frame.
+        mTxFrameBuffer.InFrameBegin(Spinel::Buffer::kPriorityLow);
+
+        for (uint16_t i = 0; i < maxLength - aFrameLength - kSegmentHeaderSize; i++)
+        {
+            SuccessOrQuit(mTxFrameBuffer.InFrameFeedByte(0));
+        }
+
+        SuccessOrQuit(mTxFrameBuffer.InFrameEnd());
+    }
+};
+
+void TestNcpChangedPropsCoalescing(void)
+{
+    Instance   *instance = static_cast<Instance *>(testInitInstance());
+    TestNcp     ncp(instance);
+    ParsedFrame frame;
+
+    printf("TestNcpChangedPropsCoalescing\n");
+
+    ncp.AddChangedProps();
+    ncp.ExpireWindowAndUpdate();
+
+    VerifyOrQuit(!ncp.HasChangedProps());
+    VerifyOrQuit(ncp.GetCoalescedFrameCounter() == 1);
+    VerifyOrQuit(ncp.GetSavedFrameCounter() == GetArrayLength(kChangedProps) - 1);
+
+    VerifyOrQuit(ncp.ReadFrame(frame));
+    VerifyOrQuit(frame.mCommand == SPINEL_CMD_PROP_VALUES_ARE);
+    VerifyOrQuit(frame.mLength <= SPINEL_FRAME_MAX_SIZE);
+    VerifyOrQuit(frame.mNumProps == GetArrayLength(kChangedProps));
+
+    for (spinel_prop_key_t propKey : kChangedProps)
+    {
+        VerifyOrQuit(frame.ContainsProp(propKey));
+    }
+
+    VerifyOrQuit(!ncp.ReadFrame(frame));
+}
+
+void TestNcpChangedPropsCoalescingSizeCap(void)
+{
+    Instance   *instance = static_cast<Instance *>(testInitInstance());
+    TestNcp     ncp(instance);
+    ParsedFrame fullFrame;
+    ParsedFrame frame;
+    uint16_t    maxFrameLength;
+
+    printf("TestNcpChangedPropsCoalescingSizeCap\n");
+
+    // Write all changed properties without a tight limit to learn
+    // where each entry ends in the coalesced frame.
+
+    ncp.AddChangedProps();
+    SuccessOrQuit(ncp.WriteCoalescedFrame(SPINEL_FRAME_MAX_SIZE));
+    VerifyOrQuit(ncp.ReadFrame(fullFrame));
+    VerifyOrQuit(fullFrame.mNumProps == GetArrayLength(kChangedProps));
+
+    // Limit the frame so that only the first two entries fit. The
+    // third entry must not be included and the remaining entries must
+    // stay in the changed set.
+
+    maxFrameLength = fullFrame.mPropEndOffsets[2] - 1;
+
+    ncp.AddChangedProps();
+    SuccessOrQuit(ncp.WriteCoalescedFrame(maxFrameLength));
+    VerifyOrQuit(ncp.HasChangedProps());
+
+    VerifyOrQuit(ncp.ReadFrame(frame));
+    VerifyOrQuit(frame.mCommand == SPINEL_CMD_PROP_VALUES_ARE);
+    VerifyOrQuit(frame.mLength <= maxFrameLength);
+    VerifyOrQuit(frame.mNumProps == 2);
+    VerifyOrQuit(frame.mProps[0] == fullFrame.mProps[0]);
+    VerifyOrQuit(frame.mProps[1] == fullFrame.mProps[1]);
+    VerifyOrQuit(!ncp.ReadFrame(frame));
+
+    // The remaining entries go in a next frame.
+
+    SuccessOrQuit(ncp.WriteCoalescedFrame(SPINEL_FRAME_MAX_SIZE));
+    VerifyOrQuit(!ncp.HasChangedProps());
+
+    VerifyOrQuit(ncp.ReadFrame(frame));
+    VerifyOrQuit(frame.mCommand == SPINEL_CMD_PROP_VALUES_ARE);
+    VerifyOrQuit(frame.mNumProps == fullFrame.mNumProps - 2);
+
+    for (uint8_t i = 2; i < fullFrame.mNumProps; i++)
+    {
+        VerifyOrQuit(frame.ContainsProp(fullFrame.mProps[i]));
+    }
+
+    // When even the first entry does not fit, no frame is written and
+    // all entries are kept.
+
+    ncp.AddChangedProps();
+    VerifyOrQuit(ncp.WriteCoalescedFrame(fullFrame.mPropEndOffsets[0] - 1) == OT_ERROR_NO_BUFS);
+    VerifyOrQuit(ncp.HasChangedProps());
+    VerifyOrQuit(!ncp.ReadFrame(frame));
+}
+
+void TestNcpChangedPropsFallbackToValueIs(void)
+{
+    Instance   *instance = static_cast<Instance *>(testInitInstance());
+    TestNcp     ncp(instance);
+    ParsedFrame frame;
+    uint16_t    coalescedLength;
+    uint8_t     numValueIsFrames = 0;
+    bool        seenProps[GetArrayLength(kChangedProps)];
+
+    printf("TestNcpChangedPropsFallbackToValueIs\n");
+
+    // Learn the length of the coalesced frame.
+
+    ncp.AddChangedProps();
+    SuccessOrQuit(ncp.WriteCoalescedFrame(SPINEL_FRAME_MAX_SIZE));
+    VerifyOrQuit(ncp.ReadFrame(frame));
+    coalescedLength = frame.mLength;
+
+    // Fill the TX buffer so that the coalesced frame no longer fits but
+    // a single `VALUE_IS` frame does. Writing the coalesced frame fails
+    // and the properties are sent in their own frames instead.
+
+    for (bool &seen : seenProps)
+    {
+        seen = false;
+    }
+
+    ncp.AddChangedProps();
+    ncp.LeaveTxSpaceForFrame(coalescedLength - 1);
+    ncp.ExpireWindowAndUpdate();
+
+    VerifyOrQuit(ncp.GetCoalescedFrameCounter() == 1);
+
+    while (ncp.ReadFrame(frame))
+    {
+        if (frame.mCommand == SPINEL_CMD_NOOP)
+        {
+            // Filler frame
+            continue;
+        }
+
+        VerifyOrQuit(frame.mCommand == SPINEL_CMD_PROP_VALUE_IS);
+        VerifyOrQuit(frame.mNumProps == 1);
+
+        for (uint8_t i = 0; i < GetArrayLength(kChangedProps); i++)
+        {
+            if (frame.mProps[0] == kChangedProps[i])
+            {
+                VerifyOrQuit(!seenProps[i]);
+                seenProps[i] = true;
+            }
+        }
+
+        numValueIsFrames++;
+    }
+
+    VerifyOrQuit(numValueIsFrames > 0);
+
+    // With the TX buffer drained, the entries which did not fit are
+    // sent on the next update.
+
+    if (ncp.HasChangedProps())
+    {
+        ncp.ExpireWindowAndUpdate();
+
+        while (ncp.ReadFrame(frame))
+        {
+            for (uint8_t i = 0; i < frame.mNumProps; i++)
+            {
+                for (uint8_t j = 0; j < GetArrayLength(kChangedProps); j++)
+                {
+                    if (frame.mProps[i] == kChangedProps[j])
+                    {
+                        VerifyOrQuit(!seenProps[j]);
+                        seenProps[j] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    VerifyOrQuit(!ncp.HasChangedProps());
+
+    for (bool seen : seenProps)
+    {
+        VerifyOrQuit(seen);
+    }
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_NCP_CHANGED_PROPS_COALESCE_WINDOW
+    ot::TestNcpChangedPropsCoalescing();
+    ot::TestNcpChangedPropsCoalescingSizeCap();
+    ot::TestNcpChangedPropsFallbackToValueIs();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,475 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "common/code_utils.hpp"
+#include "common/message.hpp"
+#include "instance/instance.hpp"
+#include "utils/packet_latency_tracker.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+
+typedef Utils::PacketLatencyTracker PacketLatencyTracker;
+
+// The current time in usec. The latencies used by the tests are
+// multiples of one msec so that the results are the same whether the
+// tracker uses the microsecond or the millisecond timer.
+static uint32_t sNow = 1000000;
+
+extern "C" {
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow / 1000; }
+uint32_t otPlatAlarmMicroGetNow(void) { return sNow; }
+}
+
+static void AdvanceTime(uint32_t aDuration) { sNow += aDuration; }
+
+static void VerifyHistogram(const PacketLatencyTracker  &aTracker,
+                            PacketLatencyTracker::Stage  aStage,
+                            uint8_t                      aPriority,
+                            PacketLatencyTracker::TxMode aTxMode,
+                            uint32_t                     aCount,
+                            uint64_t                     aTotalLatency,
+                            uint32_t                     aMaxLatency)
+{
+    PacketLatencyTracker::Histogram histogram;
+    uint32_t                        bucketSum = 0;
+
+    SuccessOrQuit(aTracker.GetHistogram(aStage, aPriority, aTxMode, histogram));
+
+    VerifyOrQuit(histogram.mCount == aCount);
+    VerifyOrQuit(histogram.mTotalLatency == aTotalLatency);
+    VerifyOrQuit(histogram.mMaxLatency == aMaxLatency);
+
+    for (uint32_t bucket : histogram.mBuckets)
+    {
+        bucketSum += bucket;
+    }
+
+    VerifyOrQuit(bucketSum == aCount);
+}
+
+static uint32_t GetBucket(const PacketLatencyTracker   &aTracker,
+                          PacketLatencyTracker::Stage  aStage,
+                          uint8_t                      aPriority,
+                          PacketLatencyTracker::TxMode aTxMode,
+                          uint8_t                      aBucket)
+{
+    PacketLatencyTracker::Histogram histogram;
+
+    SuccessOrQuit(aTracker.GetHistogram(aStage, aPriority, aTxMode, histogram));
+
+    return histogram.mBuckets[aBucket];
+}
+
+static void VerifyAllEmpty(const PacketLatencyTracker &aTracker)
+{
+    for (uint8_t stage = 0; stage < PacketLatencyTracker::kNumStages; stage++)
+    {
+        for (uint8_t priority = 0; priority < PacketLatencyTracker::kNumPriorities; priority++)
+        {
+            for (uint8_t txMode = 0; txMode < PacketLatencyTracker::kNumTxModes; txMode++)
+            {
+                VerifyHistogram(aTracker, static_cast<PacketLatencyTracker::Stage>(stage), priority,
+                                static_cast<PacketLatencyTracker::TxMode>(txMode), 0, 0, 0);
+            }
+        }
+    }
+}
+
+static void TestPacketLatencyDirectTx(void)
+{
+    static constexpr uint32_t kIp6Latency     = 2000;   // Bucket 2 [1ms, 5ms)
+    static constexpr uint32_t kQueueLatency   = 7000;   // Bucket 3 [5ms, 10ms)
+    static constexpr uint32_t kLowpanLatency1 = 20000;  // Bucket 4 [10ms, 50ms)
+    static constexpr uint32_t kMacLatency1    = 60000;  // Bucket 5 [50ms, 100ms)
+    static constexpr uint32_t kLowpanLatency2 = 0;      // Bucket 0 [0, 100us)
+    static constexpr uint32_t kMacLatency2    = 200000; // Bucket 6 [100ms, 1s)
+
+    static constexpr uint8_t kPriority = Message::kPriorityNormal;
+
+    Instance             *instance;
+    PacketLatencyTracker *tracker;
+    Message              *message;
+    uint32_t              prepareStart;
+    uint32_t              txStart;
+    uint32_t              endToEnd;
+
+    printf("TestPacketLatencyDirectTx\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    tracker = &instance->Get<PacketLatencyTracker>();
+    tracker->Reset();
+    VerifyAllEmpty(*tracker);
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetPriority(static_cast<Message::Priority>(kPriority)));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Stamp the message as it enters the IPv6 layer and the send queue.
+
+    VerifyOrQuit(!message->IsLatencyTraceStarted());
+
+    tracker->HandleIp6Start(*message);
+    VerifyOrQuit(message->IsLatencyTraceStarted());
+    VerifyOrQuit(message->GetLatencyTraceStartTime() == sNow);
+
+    // Starting the trace again (e.g., on a re-entry to the IPv6 layer)
+    // keeps the original start time.
+
+    AdvanceTime(kIp6Latency);
+    tracker->HandleIp6Start(*message);
+    VerifyOrQuit(message->GetLatencyTraceStartTime() == sNow - kIp6Latency);
+
+    tracker->HandleEnqueue(*message);
+    VerifyOrQuit(message->GetLatencyTraceStartTime() == sNow - kIp6Latency);
+    VerifyOrQuit(message->GetLatencyTraceQueueTime() == sNow);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // First frame: prepared and sent.
+
+    AdvanceTime(kQueueLatency);
+    prepareStart = PacketLatencyTracker::GetNow();
+    AdvanceTime(kLowpanLatency1);
+    txStart = tracker->HandleFramePrepared(*message, PacketLatencyTracker::kTxModeDirect, prepareStart);
+    VerifyOrQuit(txStart == sNow);
+
+    AdvanceTime(kMacLatency1);
+    tracker->HandleFrameSent(*message, PacketLatencyTracker::kTxModeDirect, /* aIsFirstFrame */ true, prepareStart,
+                             txStart);
+
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageIp6, kPriority, PacketLatencyTracker::kTxModeDirect, 1,
+                    kIp6Latency, kIp6Latency);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageQueue, kPriority, PacketLatencyTracker::kTxModeDirect, 1,
+                    kQueueLatency, kQueueLatency);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageLowpan, kPriority, PacketLatencyTracker::kTxModeDirect, 1,
+                    kLowpanLatency1, kLowpanLatency1);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageMac, kPriority, PacketLatencyTracker::kTxModeDirect, 1,
+                    kMacLatency1, kMacLatency1);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageEndToEnd, kPriority, PacketLatencyTracker::kTxModeDirect, 0,
+                    0, 0);
+
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageIp6, kPriority, PacketLatencyTracker::kTxModeDirect,
+                           2) == 1);
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageQueue, kPriority, PacketLatencyTracker::kTxModeDirect,
+                           3) == 1);
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageLowpan, kPriority,
+                           PacketLatencyTracker::kTxModeDirect, 4) == 1);
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageMac, kPriority, PacketLatencyTracker::kTxModeDirect,
+                           5) == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Second frame: only the 6LoWPAN and MAC stages are recorded.
+
+    prepareStart = PacketLatencyTracker::GetNow();
+    AdvanceTime(kLowpanLatency2);
+    txStart = tracker->HandleFramePrepared(*message, PacketLatencyTracker::kTxModeDirect, prepareStart);
+
+    AdvanceTime(kMacLatency2);
+    tracker->HandleFrameSent(*message, PacketLatencyTracker::kTxModeDirect, /* aIsFirstFrame */ false, prepareStart,
+                             txStart);
+
+    tracker->HandleMessageSent(*message, PacketLatencyTracker::kTxModeDirect, kErrorNone);
+
+    endToEnd = kIp6Latency + kQueueLatency + kLowpanLatency1 + kMacLatency1 + kLowpanLatency2 + kMacLatency2;
+
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageIp6, kPriority, PacketLatencyTracker::kTxModeDirect, 1,
+                    kIp6Latency, kIp6Latency);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageQueue, kPriority, PacketLatencyTracker::kTxModeDirect, 1,
+                    kQueueLatency, kQueueLatency);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageLowpan, kPriority, PacketLatencyTracker::kTxModeDirect, 2,
+                    kLowpanLatency1 + kLowpanLatency2, kLowpanLatency1);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageMac, kPriority, PacketLatencyTracker::kTxModeDirect, 2,
+                    kMacLatency1 + kMacLatency2, kMacLatency2);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageEndToEnd, kPriority, PacketLatencyTracker::kTxModeDirect, 1,
+                    endToEnd, endToEnd);
+
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageLowpan, kPriority,
+                           PacketLatencyTracker::kTxModeDirect, 0) == 1);
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageMac, kPriority, PacketLatencyTracker::kTxModeDirect,
+                           6) == 1);
+
+    // Nothing is recorded for other priorities or for indirect tx.
+
+    for (uint8_t priority = 0; priority < PacketLatencyTracker::kNumPriorities; priority++)
+    {
+        for (uint8_t stage = 0; stage < PacketLatencyTracker::kNumStages; stage++)
+        {
+            VerifyHistogram(*tracker, static_cast<PacketLatencyTracker::Stage>(stage), priority,
+                            PacketLatencyTracker::kTxModeIndirect, 0, 0, 0);
+
+            if (priority != kPriority)
+            {
+                VerifyHistogram(*tracker, static_cast<PacketLatencyTracker::Stage>(stage), priority,
+                                PacketLatencyTracker::kTxModeDirect, 0, 0, 0);
+            }
+        }
+    }
+
+    // `Reset()` clears all the histograms.
+
+    tracker->Reset();
+    VerifyAllEmpty(*tracker);
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+static void TestPacketLatencyIndirectTx(void)
+{
+    static constexpr uint32_t kQueueLatency  = 3000000; // Bucket 7 [1s, ...) (waiting for data poll)
+    static constexpr uint32_t kLowpanLatency = 1000;    // Bucket 2 [1ms, 5ms)
+    static constexpr uint32_t kMacLatency    = 4000;    // Bucket 2 [1ms, 5ms)
+    static constexpr uint32_t kRetxLatency   = 500000;  // Bucket 6 [100ms, 1s)
+
+    static constexpr uint8_t kPriority = Message::kPriorityNet;
+
+    Instance             *instance;
+    PacketLatencyTracker *tracker;
+    Message              *message;
+    uint32_t              prepareStart;
+    uint32_t              txStart;
+    uint32_t              endToEnd;
+
+    printf("TestPacketLatencyIndirectTx\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    tracker = &instance->Get<PacketLatencyTracker>();
+    tracker->Reset();
+
+    // A mesh forwarded 6LoWPAN message starts its trace when it is
+    // added to the send queue, so its IPv6 stage latency is zero.
+
+    message = instance->Get<MessagePool>().Allocate(Message::kType6lowpan);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetPriority(static_cast<Message::Priority>(kPriority)));
+
+    tracker->HandleEnqueue(*message);
+    VerifyOrQuit(message->IsLatencyTraceStarted());
+    VerifyOrQuit(message->GetLatencyTraceStartTime() == sNow);
+    VerifyOrQuit(message->GetLatencyTraceQueueTime() == sNow);
+
+    AdvanceTime(kQueueLatency);
+
+    // The frame is prepared twice (retx after a failed tx attempt to
+    // the sleepy child). Each preparation is recorded in the 6LoWPAN
+    // stage, while the IPv6, queue and MAC stages use the last one.
+
+    prepareStart = PacketLatencyTracker::GetNow();
+    AdvanceTime(kLowpanLatency);
+    IgnoreReturnValue(tracker->HandleFramePrepared(*message, PacketLatencyTracker::kTxModeIndirect, prepareStart));
+
+    AdvanceTime(kRetxLatency);
+
+    prepareStart = PacketLatencyTracker::GetNow();
+    AdvanceTime(kLowpanLatency);
+    txStart = tracker->HandleFramePrepared(*message, PacketLatencyTracker::kTxModeIndirect, prepareStart);
+
+    AdvanceTime(kMacLatency);
+    tracker->HandleFrameSent(*message, PacketLatencyTracker::kTxModeIndirect, /* aIsFirstFrame */ true, prepareStart,
+                             txStart);
+    tracker->HandleMessageSent(*message, PacketLatencyTracker::kTxModeIndirect, kErrorNone);
+
+    endToEnd = kQueueLatency + kLowpanLatency + kRetxLatency + kLowpanLatency + kMacLatency;
+
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageIp6, kPriority, PacketLatencyTracker::kTxModeIndirect, 1, 0,
+                    0);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageQueue, kPriority, PacketLatencyTracker::kTxModeIndirect, 1,
+                    kQueueLatency + kLowpanLatency + kRetxLatency, kQueueLatency + kLowpanLatency + kRetxLatency);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageLowpan, kPriority, PacketLatencyTracker::kTxModeIndirect, 2,
+                    2 * kLowpanLatency, kLowpanLatency);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageMac, kPriority, PacketLatencyTracker::kTxModeIndirect, 1,
+                    kMacLatency, kMacLatency);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageEndToEnd, kPriority, PacketLatencyTracker::kTxModeIndirect,
+                    1, endToEnd, endToEnd);
+
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageIp6, kPriority, PacketLatencyTracker::kTxModeIndirect,
+                           0) == 1);
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageQueue, kPriority,
+                           PacketLatencyTracker::kTxModeIndirect, OT_PACKET_LATENCY_HISTOGRAM_SIZE - 1) == 1);
+    VerifyOrQuit(GetBucket(*tracker, PacketLatencyTracker::kStageLowpan, kPriority,
+                           PacketLatencyTracker::kTxModeIndirect, 2) == 2);
+
+    for (uint8_t stage = 0; stage < PacketLatencyTracker::kNumStages; stage++)
+    {
+        VerifyHistogram(*tracker, static_cast<PacketLatencyTracker::Stage>(stage), kPriority,
+                        PacketLatencyTracker::kTxModeDirect, 0, 0, 0);
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+static void TestPacketLatencyNotRecorded(void)
+{
+    Instance                       *instance;
+    PacketLatencyTracker           *tracker;
+    Message                        *message;
+    uint32_t                        prepareStart;
+    uint32_t                        txStart;
+    PacketLatencyTracker::Histogram histogram;
+
+    printf("TestPacketLatencyNotRecorded\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    tracker = &instance->Get<PacketLatencyTracker>();
+    tracker->Reset();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Messages other than IPv6 and 6LoWPAN are not tracked.
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeSupervision);
+    VerifyOrQuit(message != nullptr);
+
+    tracker->HandleIp6Start(*message);
+    tracker->HandleEnqueue(*message);
+    VerifyOrQuit(!message->IsLatencyTraceStarted());
+
+    prepareStart = PacketLatencyTracker::GetNow();
+    AdvanceTime(1000);
+    txStart = tracker->HandleFramePrepared(*message, PacketLatencyTracker::kTxModeDirect, prepareStart);
+    VerifyOrQuit(txStart == sNow);
+    AdvanceTime(1000);
+    tracker->HandleFrameSent(*message, PacketLatencyTracker::kTxModeDirect, true, prepareStart, txStart);
+    tracker->HandleMessageSent(*message, PacketLatencyTracker::kTxModeDirect, kErrorNone);
+
+    VerifyAllEmpty(*tracker);
+    message->Free();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // The end-to-end latency is not recorded for a failed tx.
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    tracker->HandleIp6Start(*message);
+    tracker->HandleEnqueue(*message);
+
+    prepareStart = PacketLatencyTracker::GetNow();
+    txStart      = tracker->HandleFramePrepared(*message, PacketLatencyTracker::kTxModeDirect, prepareStart);
+    AdvanceTime(1000);
+    tracker->HandleFrameSent(*message, PacketLatencyTracker::kTxModeDirect, true, prepareStart, txStart);
+    tracker->HandleMessageSent(*message, PacketLatencyTracker::kTxModeDirect, kErrorNoAck);
+
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageMac, message->GetPriority(),
+                    PacketLatencyTracker::kTxModeDirect, 1, 1000, 1000);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageEndToEnd, message->GetPriority(),
+                    PacketLatencyTracker::kTxModeDirect, 0, 0, 0);
+
+    message->Free();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Invalid arguments to `GetHistogram()`.
+
+    VerifyOrQuit(tracker->GetHistogram(static_cast<PacketLatencyTracker::Stage>(PacketLatencyTracker::kNumStages), 0,
+                                       PacketLatencyTracker::kTxModeDirect, histogram) == kErrorInvalidArgs);
+    VerifyOrQuit(tracker->GetHistogram(PacketLatencyTracker::kStageMac, PacketLatencyTracker::kNumPriorities,
+                                       PacketLatencyTracker::kTxModeDirect, histogram) == kErrorInvalidArgs);
+    VerifyOrQuit(tracker->GetHistogram(PacketLatencyTracker::kStageMac, 0,
+                                       static_cast<PacketLatencyTracker::TxMode>(PacketLatencyTracker::kNumTxModes),
+                                       histogram) == kErrorInvalidArgs);
+
+    testFreeInstance(instance);
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+static void TestPacketLatencyTimeWrap(void)
+{
+    static constexpr uint32_t kLatency = 8000;
+
+    Instance             *instance;
+    PacketLatencyTracker *tracker;
+    Message              *message;
+    uint32_t              prepareStart;
+    uint32_t              txStart;
+
+    printf("TestPacketLatencyTimeWrap\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    tracker = &instance->Get<PacketLatencyTracker>();
+    tracker->Reset();
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    // Latencies spanning the wrap of the 32-bit usec time are recorded
+    // correctly.
+
+    sNow = 0xffffffff - kLatency / 2;
+
+    tracker->HandleIp6Start(*message);
+    tracker->HandleEnqueue(*message);
+
+    prepareStart = PacketLatencyTracker::GetNow();
+    txStart      = tracker->HandleFramePrepared(*message, PacketLatencyTracker::kTxModeDirect, prepareStart);
+    AdvanceTime(kLatency);
+    tracker->HandleFrameSent(*message, PacketLatencyTracker::kTxModeDirect, true, prepareStart, txStart);
+    tracker->HandleMessageSent(*message, PacketLatencyTracker::kTxModeDirect, kErrorNone);
+
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageMac, message->GetPriority(),
+                    PacketLatencyTracker::kTxModeDirect, 1, kLatency, kLatency);
+    VerifyHistogram(*tracker, PacketLatencyTracker::kStageEndToEnd, message->GetPriority(),
+                    PacketLatencyTracker::kTxModeDirect, 1, kLatency, kLatency);
+
+    message->Free();
+    testFreeInstance(instance);
+}
+#endif
+
+#endif // OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_PACKET_LATENCY_TRACKER_ENABLE
+    ot::TestPacketLatencyDirectTx();
+    ot::TestPacketLatencyIndirectTx();
+    ot::TestPacketLatencyNotRecorded();
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    ot::TestPacketLatencyTimeWrap();
+#endif
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,308 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/profiler.h>
+
+#include "common/code_utils.hpp"
+#include "common/tasklet.hpp"
+#include "instance/instance.hpp"
+#include "utils/profiler.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+
+static uint64_t sNow = 1;
+
+extern "C" uint64_t otPlatTimeGet(void) { return sNow; }
+
+static constexpr uint32_t kTaskletDuration = 250;
+
+static uint16_t sTaskletRunCount = 0;
+
+static void HandleTasklet(Tasklet &aTasklet)
+{
+    OT_UNUSED_VARIABLE(aTasklet);
+
+    sTaskletRunCount++;
+    sNow += kTaskletDuration * sTaskletRunCount;
+}
+
+static bool FindHandlerStats(Instance               &aInstance,
+                             otProfilerHandlerType   aType,
+                             uintptr_t               aHandler,
+                             otProfilerHandlerStats &aStats)
+{
+    bool               found    = false;
+    otProfilerIterator iterator = OT_PROFILER_ITERATOR_INIT;
+
+    while (otProfilerGetNextHandlerStats(&aInstance, &iterator, &aStats) == kErrorNone)
+    {
+        if ((aStats.mType == aType) && (aStats.mHandler == aHandler))
+        {
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+static uint16_t GetNumHandlers(Instance &aInstance)
+{
+    uint16_t               count    = 0;
+    otProfilerIterator     iterator = OT_PROFILER_ITERATOR_INIT;
+    otProfilerHandlerStats stats;
+
+    while (otProfilerGetNextHandlerStats(&aInstance, &iterator, &stats) == kErrorNone)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+static void TestProfilerHandlers(void)
+{
+    static const char kRadio[] = "radio";
+    static const char kNetif[] = "netif";
+
+    Instance              *instance;
+    Tasklet               *tasklet;
+    Tasklet               *otherTasklet;
+    otProfilerHandlerStats stats;
+
+    printf("TestProfilerHandlers\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    tasklet      = new Tasklet(*instance, HandleTasklet);
+    otherTasklet = new Tasklet(*instance, HandleTasklet);
+
+    otProfilerReset(instance);
+    VerifyOrQuit(!otProfilerIsEnabled(instance));
+
+    // Nothing is recorded while the profiler is disabled.
+
+    otProfilerRecordPlatformHandler(instance, kRadio, 100);
+    tasklet->Post();
+    otTaskletsProcess(instance);
+    VerifyOrQuit(sTaskletRunCount == 1);
+    VerifyOrQuit(!FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_PLATFORM, reinterpret_cast<uintptr_t>(kRadio),
+                                   stats));
+    VerifyOrQuit(!FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_TASKLET,
+                                   reinterpret_cast<uintptr_t>(&HandleTasklet), stats));
+
+    otProfilerSetEnabled(instance, true);
+    VerifyOrQuit(otProfilerIsEnabled(instance));
+
+    // Tasklet handler
+
+    tasklet->Post();
+    otTaskletsProcess(instance);
+    tasklet->Post();
+    otTaskletsProcess(instance);
+    VerifyOrQuit(sTaskletRunCount == 3);
+
+    VerifyOrQuit(FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_TASKLET,
+                                  reinterpret_cast<uintptr_t>(&HandleTasklet), stats));
+    VerifyOrQuit(stats.mName == nullptr);
+    VerifyOrQuit(stats.mInvokeCount == 2);
+    VerifyOrQuit(stats.mMaxTime == 3 * kTaskletDuration);
+    VerifyOrQuit(stats.mTotalTime == 5 * kTaskletDuration);
+
+    // Tasklets using the same handler function share one entry.
+
+    otherTasklet->Post();
+    otTaskletsProcess(instance);
+    VerifyOrQuit(sTaskletRunCount == 4);
+
+    VerifyOrQuit(FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_TASKLET,
+                                  reinterpret_cast<uintptr_t>(&HandleTasklet), stats));
+    VerifyOrQuit(stats.mInvokeCount == 3);
+    VerifyOrQuit(stats.mMaxTime == 4 * kTaskletDuration);
+    VerifyOrQuit(stats.mTotalTime == 9 * kTaskletDuration);
+
+    // Platform handlers
+
+    otProfilerRecordPlatformHandler(instance, kRadio, 100);
+    otProfilerRecordPlatformHandler(instance, kRadio, 300);
+    otProfilerRecordPlatformHandler(instance, kNetif, 50);
+
+    VerifyOrQuit(FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_PLATFORM, reinterpret_cast<uintptr_t>(kRadio),
+                                  stats));
+    VerifyOrQuit(strcmp(stats.mName, kRadio) == 0);
+    VerifyOrQuit(stats.mInvokeCount == 2);
+    VerifyOrQuit(stats.mMaxTime == 300);
+    VerifyOrQuit(stats.mTotalTime == 400);
+
+    VerifyOrQuit(FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_PLATFORM, reinterpret_cast<uintptr_t>(kNetif),
+                                  stats));
+    VerifyOrQuit(stats.mInvokeCount == 1);
+    VerifyOrQuit(stats.mMaxTime == 50);
+    VerifyOrQuit(stats.mTotalTime == 50);
+
+    // Disabling keeps the recorded stats, `Reset()` clears them.
+
+    otProfilerSetEnabled(instance, false);
+    VerifyOrQuit(FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_PLATFORM, reinterpret_cast<uintptr_t>(kNetif),
+                                  stats));
+
+    otProfilerReset(instance);
+    VerifyOrQuit(GetNumHandlers(*instance) == 0);
+
+    delete otherTasklet;
+    delete tasklet;
+    testFreeInstance(instance);
+}
+
+static void TestProfilerHandlerTableFull(void)
+{
+    static constexpr uint16_t kMaxHandlers = OPENTHREAD_CONFIG_PROFILER_MAX_HANDLERS;
+    static constexpr uint16_t kNumExtra    = 5;
+
+    // Platform handlers are keyed by the name pointer, so each char in
+    // `kNames` is used as a distinct handler.
+    static const char kNames[kMaxHandlers + kNumExtra + 1] = {};
+
+    Instance              *instance;
+    otProfilerHandlerStats stats;
+
+    printf("TestProfilerHandlerTableFull\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    otProfilerReset(instance);
+    otProfilerSetEnabled(instance, true);
+
+    for (uint16_t i = 0; i < kMaxHandlers + kNumExtra; i++)
+    {
+        otProfilerRecordPlatformHandler(instance, &kNames[i], i);
+    }
+
+    // Other tasklet or timer handlers may have been recorded while
+    // initializing the instance, so only check the totals.
+
+    VerifyOrQuit(GetNumHandlers(*instance) == kMaxHandlers);
+    VerifyOrQuit(otProfilerGetDroppedCount(instance) >= kNumExtra);
+
+    // Existing entries are still updated when the table is full.
+
+    for (uint16_t i = 0; i < kMaxHandlers + kNumExtra; i++)
+    {
+        if (!FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_PLATFORM, reinterpret_cast<uintptr_t>(&kNames[i]),
+                              stats))
+        {
+            continue;
+        }
+
+        otProfilerRecordPlatformHandler(instance, &kNames[i], 1000);
+        VerifyOrQuit(FindHandlerStats(*instance, OT_PROFILER_HANDLER_TYPE_PLATFORM,
+                                      reinterpret_cast<uintptr_t>(&kNames[i]), stats));
+        VerifyOrQuit(stats.mInvokeCount == 2);
+        VerifyOrQuit(stats.mMaxTime == 1000);
+        VerifyOrQuit(stats.mTotalTime == 1000u + i);
+    }
+
+    otProfilerReset(instance);
+    VerifyOrQuit(GetNumHandlers(*instance) == 0);
+    VerifyOrQuit(otProfilerGetDroppedCount(instance) == 0);
+
+    otProfilerSetEnabled(instance, false);
+    testFreeInstance(instance);
+}
+
+static void TestProfilerMainloop(void)
+{
+    static const uint32_t kDurations[] = {0,     99,    100,   499,   500,   999,    1000,   4999,
+                                          5000,  9999,  10000, 49999, 50000, 99999, 100000, 5000000};
+
+    static const uint32_t kExpectedHistogram[OT_PROFILER_MAINLOOP_HISTOGRAM_SIZE] = {2, 2, 2, 2, 2, 2, 2, 2};
+
+    Instance               *instance;
+    otProfilerMainloopStats stats;
+    uint64_t                total = 0;
+
+    printf("TestProfilerMainloop\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    otProfilerReset(instance);
+
+    otProfilerRecordMainloopIteration(instance, 10);
+    otProfilerGetMainloopStats(instance, &stats);
+    VerifyOrQuit(stats.mIterationCount == 0);
+
+    otProfilerSetEnabled(instance, true);
+
+    for (uint32_t duration : kDurations)
+    {
+        otProfilerRecordMainloopIteration(instance, duration);
+        total += duration;
+    }
+
+    otProfilerGetMainloopStats(instance, &stats);
+    VerifyOrQuit(stats.mIterationCount == GetArrayLength(kDurations));
+    VerifyOrQuit(stats.mMaxTime == 5000000);
+    VerifyOrQuit(stats.mTotalTime == total);
+    VerifyOrQuit(memcmp(stats.mHistogram, kExpectedHistogram, sizeof(kExpectedHistogram)) == 0);
+
+    otProfilerReset(instance);
+    otProfilerGetMainloopStats(instance, &stats);
+    VerifyOrQuit(stats.mIterationCount == 0);
+    VerifyOrQuit(stats.mMaxTime == 0);
+    VerifyOrQuit(stats.mTotalTime == 0);
+
+    otProfilerSetEnabled(instance, false);
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_PROFILER_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_PROFILER_ENABLE
+    ot::TestProfilerHandlers();
+    ot::TestProfilerHandlerTableFull();
+    ot::TestProfilerMainloop();
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
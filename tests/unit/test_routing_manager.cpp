@@ -2764,15 +2764,18 @@ void TestExtPanIdChange(void)
     static const otExtendedPanId kExtPanId4 = {{0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00}};
     static const otExtendedPanId kExtPanId5 = {{0x77, 0x88, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55}};
 
-    Ip6::Prefix          localOnLink;
-    Ip6::Prefix          oldLocalOnLink;
-    Ip6::Prefix          localOmr;
-    Ip6::Prefix          onLinkPrefix   = PrefixFromString("2000:abba:baba::", 64);
-    Ip6::Address         routerAddressA = AddressFromString("fd00::aaaa");
-    uint32_t             oldPrefixLifetime;
-    Ip6::Prefix          oldPrefixes[4];
-    otOperationalDataset dataset;
-    uint16_t             heapAllocations;
+    Ip6::Prefix                  localOnLink;
+    Ip6::Prefix                  oldLocalOnLink;
+    Ip6::Prefix                  localOmr;
+    Ip6::Prefix                  onLinkPrefix   = PrefixFromString("2000:abba:baba::", 64);
+    Ip6::Address                 routerAddressA = AddressFromString("fd00::aaaa");
+    Ip6::Address                 hostAddress    = AddressFromString("fe80::2");
+    Ip6::Nd::RouterSolicitHeader rsHeader;
+    uint32_t                     oldPrefixLifetime;
+    Ip6::Prefix                  oldPrefixes[4];
+    otOperationalDataset         dataset;
+    uint16_t                     heapAllocations;
+    uint32_t                     suppressedCount;
 
     Log("--------------------------------------------------------------------------------------------");
     Log("TestExtPanIdChange");
@@ -3039,9 +3042,22 @@ void TestExtPanIdChange(void)
 
     oldLocalOnLink = localOnLink;
 
+    // Send an RS so that an RA is sent right away. This restarts the
+    // RA beacon interval, so the next beacon is at least 165 seconds
+    // away.
+
     sRaValidated = false;
     sExpectedPio = kNoPio;
 
+    otPlatInfraIfRecvIcmp6Nd(sInstance, kInfraIfIndex, &hostAddress, reinterpret_cast<const uint8_t *>(&rsHeader),
+                             sizeof(rsHeader));
+
+    AdvanceTime(5000);
+    VerifyOrQuit(sRaValidated);
+
+    sRaValidated    = false;
+    suppressedCount = otIp6GetBorderRoutingCounters(sInstance)->mRaTxSuppressed;
+
     dataset.mExtendedPanId = kExtPanId3;
     SuccessOrQuit(otDatasetSetActive(sInstance, &dataset));
 
@@ -3050,7 +3066,18 @@ void TestExtPanIdChange(void)
     Log("Local on-link prefix changed to %s from %s", localOnLink.ToString().AsCString(),
         oldLocalOnLink.ToString().AsCString());
 
+    // Since the local on-link prefix is not advertised, the RA
+    // content does not change and its transmission is suppressed
+    // before the next RA beacon.
+
     AdvanceTime(35000);
+    VerifyOrQuit(!sRaValidated);
+    VerifyOrQuit(otIp6GetBorderRoutingCounters(sInstance)->mRaTxSuppressed > suppressedCount);
+    VerifyOrQuit(sDeprecatingPrefixes.IsEmpty());
+
+    // The RA is sent again at the next beacon.
+
+    AdvanceTime(kMaxRaTxInterval * 1000);
     VerifyOrQuit(sRaValidated);
     VerifyOrQuit(sDeprecatingPrefixes.IsEmpty());
 
@@ -5421,6 +5448,228 @@ void TestRdnss(void)
     FinalizeTest();
 }
 
+void TestUnchangedRaSuppression(void)
+{
+    Ip6::Prefix                      localOnLink;
+    Ip6::Prefix                      localOmr;
+    Ip6::Address                     hostAddress = AddressFromString("fe80::2");
+    Ip6::Nd::RouterSolicitHeader     rsHeader;
+    NetworkData::ExternalRouteConfig routeConfig;
+    uint32_t                         suppressedCount;
+    uint16_t                         heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestUnchangedRaSuppression");
+
+    InitTest();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start Routing Manager and wait past the initial RA transmissions.
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(true));
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOnLinkPrefix(localOnLink));
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOmrPrefix(localOmr));
+
+    sRaValidated = false;
+    sExpectedPio = kPioAdvertisingLocalOnLink;
+    sExpectedRios.Clear();
+    sExpectedRios.Add(localOmr);
+
+    AdvanceTime(100000);
+
+    VerifyOrQuit(sRaValidated);
+    VerifyOrQuit(sExpectedRios.SawAll());
+
+    suppressedCount = otIp6GetBorderRoutingCounters(sInstance)->mRaTxSuppressed;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Add an external route to Network Data. This triggers a routing
+    // policy evaluation, but the prepared RA is unchanged and should
+    // not be sent.
+
+    routeConfig.Clear();
+    routeConfig.SetPrefix(PrefixFromString("2000:1234:5678::", 64));
+    routeConfig.mStable = true;
+
+    SuccessOrQuit(otBorderRouterAddRoute(sInstance, &routeConfig));
+    SuccessOrQuit(otBorderRouterRegister(sInstance));
+
+    sRaValidated = false;
+    AdvanceTime(10000);
+
+    VerifyOrQuit(!sRaValidated);
+    VerifyOrQuit(otIp6GetBorderRoutingCounters(sInstance)->mRaTxSuppressed > suppressedCount);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // A received RS must always be answered, even when unchanged.
+
+    otPlatInfraIfRecvIcmp6Nd(sInstance, kInfraIfIndex, &hostAddress, reinterpret_cast<const uint8_t *>(&rsHeader),
+                             sizeof(rsHeader));
+
+    AdvanceTime(5000);
+    VerifyOrQuit(sRaValidated);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Trigger another unchanged evaluation and check that the periodic
+    // RA beacon is still sent on time.
+
+    SuccessOrQuit(otBorderRouterRemoveRoute(sInstance, &routeConfig.GetPrefix()));
+    SuccessOrQuit(otBorderRouterRegister(sInstance));
+
+    sRaValidated = false;
+    AdvanceTime(10000);
+    VerifyOrQuit(!sRaValidated);
+
+    AdvanceTime(200000);
+    VerifyOrQuit(sRaValidated);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(false));
+    AdvanceTime(3000);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("End of TestUnchangedRaSuppression");
+
+    FinalizeTest();
+}
+
+uint16_t CountDiscoveredRouters(void)
+{
+    BorderRouter::PrefixTableIterator iter;
+    BorderRouter::RouterEntry         entry;
+    uint16_t                          count = 0;
+
+    sInstance->Get<BorderRouter::RxRaTracker>().InitIterator(iter);
+
+    while (sInstance->Get<BorderRouter::RxRaTracker>().GetNextRouterEntry(iter, entry) == kErrorNone)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+uint16_t CountDiscoveredPrefixes(void)
+{
+    BorderRouter::PrefixTableIterator iter;
+    BorderRouter::PrefixTableEntry    entry;
+    uint16_t                          count = 0;
+
+    sInstance->Get<BorderRouter::RxRaTracker>().InitIterator(iter);
+
+    while (sInstance->Get<BorderRouter::RxRaTracker>().GetNextPrefixTableEntry(iter, entry) == kErrorNone)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void TestManyRouters(void)
+{
+    static constexpr uint16_t        kNumRouters = 12;
+    static constexpr RoutePreference kPrfMed     = NetworkData::kRoutePreferenceMedium;
+
+    Ip6::Prefix  sharedPrefix = PrefixFromString("2000:5555::", 64);
+    Ip6::Prefix  routePrefixes[kNumRouters];
+    Ip6::Address routerAddresses[kNumRouters];
+    Ip6::Prefix  localOnLink;
+    Ip6::Prefix  localOmr;
+    uint16_t     heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestManyRouters");
+
+    InitTest();
+
+    for (uint16_t i = 0; i < kNumRouters; i++)
+    {
+        routePrefixes[i]                        = PrefixFromString("2000:1234::", 64);
+        routePrefixes[i].mPrefix.mFields.m16[2] = BigEndian::HostSwap16(i + 1);
+
+        routerAddresses[i]                = AddressFromString("fd00::1000");
+        routerAddresses[i].mFields.m16[7] = BigEndian::HostSwap16(0x1000 + i);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start Routing Manager.
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(true));
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOnLinkPrefix(localOnLink));
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().GetOmrPrefix(localOmr));
+
+    sRaValidated = false;
+    sExpectedPio = kPioAdvertisingLocalOnLink;
+    sExpectedRios.Clear();
+    sExpectedRios.Add(localOmr);
+
+    AdvanceTime(30000);
+
+    VerifyOrQuit(sRaValidated);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send RAs from all routers, each with its own route prefix and
+    // a shared one. Send them twice and check that the existing
+    // router entries are updated.
+
+    for (uint8_t round = 0; round < 2; round++)
+    {
+        for (uint16_t i = 0; i < kNumRouters; i++)
+        {
+            SendRouterAdvert(routerAddresses[i],
+                             {Rio(routePrefixes[i], kValidLitime, kPrfMed), Rio(sharedPrefix, kValidLitime, kPrfMed)});
+        }
+
+        AdvanceTime(10000);
+
+        VerifyOrQuit(CountDiscoveredRouters() == kNumRouters);
+        VerifyOrQuit(CountDiscoveredPrefixes() == 2 * kNumRouters);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove all prefixes from every other router. Validate that
+    // these routers are removed and the remaining ones are still
+    // found when they send a new RA.
+
+    for (uint16_t i = 0; i < kNumRouters; i += 2)
+    {
+        SendRouterAdvert(routerAddresses[i], {Rio(routePrefixes[i], 0, kPrfMed), Rio(sharedPrefix, 0, kPrfMed)});
+    }
+
+    AdvanceTime(10000);
+
+    VerifyOrQuit(CountDiscoveredRouters() == kNumRouters / 2);
+    VerifyOrQuit(CountDiscoveredPrefixes() == kNumRouters);
+
+    for (uint16_t i = 0; i < kNumRouters; i++)
+    {
+        SendRouterAdvert(routerAddresses[i], {Rio(routePrefixes[i], kValidLitime, kPrfMed)});
+    }
+
+    AdvanceTime(10000);
+
+    VerifyOrQuit(CountDiscoveredRouters() == kNumRouters);
+    VerifyOrQuit(CountDiscoveredPrefixes() == kNumRouters + kNumRouters / 2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    SuccessOrQuit(sInstance->Get<BorderRouter::RoutingManager>().SetEnabled(false));
+    VerifyDiscoveredRoutersIsEmpty();
+    AdvanceTime(3000);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    Log("End of TestManyRouters");
+
+    FinalizeTest();
+}
+
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
 } // namespace ot
@@ -5456,6 +5705,8 @@ int main(void)
     ot::TestDhcp6PdConflict();
 #endif
     ot::TestRdnss();
+    ot::TestUnchangedRaSuppression();
+    ot::TestManyRouters();
 
     printf("All tests passed\n");
 #else
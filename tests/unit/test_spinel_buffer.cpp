@@ -852,6 +852,67 @@ void TestBuffer(void)
 
     printf(" -- PASS\n");
 
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\n Test 16: Test OutFrameGetChunk() and OutFrameSkip()");
+    printf("\nIterations: ");
+
+    for (j = 0; j < kTestIterationAttemps; j++)
+    {
+        Spinel::Buffer::Priority priority;
+        const uint8_t           *chunk;
+        uint16_t                 chunkLength;
+        uint8_t                  frame[kTestFrame1Size];
+
+        printf("*");
+        priority = ((j % 2) == 0) ? Spinel::Buffer::kPriorityLow : Spinel::Buffer::kPriorityHigh;
+
+        // Add a frame of varying length first so that the frames
+        // being read wrap around the end of the buffer.
+        ncpBuffer.InFrameBegin(priority);
+        SuccessOrQuit(ncpBuffer.InFrameFeedData(sHexText, static_cast<uint16_t>(1 + j % sizeof(sHexText))));
+        SuccessOrQuit(ncpBuffer.InFrameEnd());
+        SuccessOrQuit(ncpBuffer.OutFrameRemove());
+
+        WriteTestFrame1(ncpBuffer, priority);
+        SuccessOrQuit(ncpBuffer.OutFrameBegin());
+        readOffset = 0;
+
+        while ((chunkLength = ncpBuffer.OutFrameGetChunk(chunk)) != 0)
+        {
+            VerifyOrQuit(chunk != nullptr);
+            VerifyOrQuit(readOffset + chunkLength <= sizeof(frame), "Chunk exceeds the frame length.");
+
+            memcpy(frame + readOffset, chunk, chunkLength);
+            readOffset += chunkLength;
+            VerifyOrQuit(ncpBuffer.OutFrameSkip(chunkLength) == chunkLength);
+        }
+
+        VerifyOrQuit(ncpBuffer.OutFrameHasEnded());
+        VerifyOrQuit(ncpBuffer.OutFrameGetChunk(chunk) == 0);
+        VerifyOrQuit(chunk == nullptr);
+        VerifyOrQuit(readOffset == kTestFrame1Size, "Read len does not match expected length.");
+
+        readOffset = 0;
+        VerifyOrQuit(memcmp(frame + readOffset, sMottoText, sizeof(sMottoText)) == 0);
+        readOffset += sizeof(sMottoText);
+        VerifyOrQuit(memcmp(frame + readOffset, sMysteryText, sizeof(sMysteryText)) == 0);
+        readOffset += sizeof(sMysteryText);
+        VerifyOrQuit(memcmp(frame + readOffset, sMottoText, sizeof(sMottoText)) == 0);
+        readOffset += sizeof(sMottoText);
+        VerifyOrQuit(memcmp(frame + readOffset, sHelloText, sizeof(sHelloText)) == 0);
+
+        // Skip over the content spanning a message and the next segment.
+        SuccessOrQuit(ncpBuffer.OutFrameBegin());
+        VerifyOrQuit(ncpBuffer.OutFrameSkip(sizeof(sMottoText) + sizeof(sMysteryText) + 3) ==
+                     sizeof(sMottoText) + sizeof(sMysteryText) + 3);
+        ReadAndVerifyContent(ncpBuffer, sMottoText + 3, sizeof(sMottoText) - 3);
+        VerifyOrQuit(ncpBuffer.OutFrameSkip(kTestFrame1Size) == sizeof(sHelloText));
+        VerifyOrQuit(ncpBuffer.OutFrameHasEnded());
+        SuccessOrQuit(ncpBuffer.OutFrameRemove());
+    }
+
+    printf(" -- PASS\n");
+
     testFreeInstance(sInstance);
 }
 
@@ -608,11 +608,12 @@ void TestSrpServerReject(void)
 
 void TestSrpServerIgnore(void)
 {
-    Srp::Server         *srpServer;
-    Srp::Client         *srpClient;
-    Srp::Client::Service service1;
-    Srp::Client::Service service2;
-    uint16_t             heapAllocations;
+    Srp::Server           *srpServer;
+    Srp::Client           *srpClient;
+    Srp::Client::Service   service1;
+    Srp::Client::Service   service2;
+    uint16_t               heapAllocations;
+    otSrpServerUpdateStats updateStats;
 
     Log("--------------------------------------------------------------------------------------------");
     Log("TestSrpServerIgnore");
@@ -676,6 +677,17 @@ void TestSrpServerIgnore(void)
 
     VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
 
+    // The ignored update should have stayed pending until it timed
+    // out. The client may have already retried, so at most one update
+    // can be pending at this point.
+
+    srpServer->GetUpdateStats(updateStats);
+    VerifyOrQuit(updateStats.mNumPending <= 1);
+    VerifyOrQuit(updateStats.mMaxNumPending == 1);
+    VerifyOrQuit(updateStats.mNumRejectedBusy == 0);
+    VerifyOrQuit(updateStats.mMaxLatency > 0);
+    VerifyOrQuit(updateStats.mAvgLatency == updateStats.mMaxLatency);
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Register a second service, validate that update handler is
     // again called and update is still ignored.
@@ -1201,7 +1213,7 @@ void TestSrpClientDelayedResponse(void)
     Log("End of TestSrpClientDelayedResponse");
 }
 
-void TestSrpClientSingleServiceMode(void)
+void TestSrpClientPartialMode(void)
 {
     static constexpr uint16_t kNumServices = 5;
     static constexpr uint16_t kServerPort  = 53535;
@@ -1213,7 +1225,7 @@ void TestSrpClientSingleServiceMode(void)
     Dns::Name::LabelBuffer serviceInstnaces[kNumServices];
 
     Log("--------------------------------------------------------------------------------------------");
-    Log("TestSrpClientSingleServiceMode");
+    Log("TestSrpClientPartialMode");
 
     InitTest();
 
@@ -1229,6 +1241,7 @@ void TestSrpClientSingleServiceMode(void)
         uint16_t          secondMsgId;
         uint16_t          firstMsgLength;
         uint16_t          numServices;
+        uint16_t          numPartialServices;
         Message          *response;
         Dns::UpdateHeader header;
 
@@ -1304,19 +1317,20 @@ void TestSrpClientSingleServiceMode(void)
 
         //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
         // Register a fifth service, causing the SRP update to exceed
-        // the MTU limit. The client should now enter "single service
-        // mode" and register services one by one.
+        // the MTU limit. The client should now enter "partial mode"
+        // and include as many services as fit in the message.
 
         SuccessOrQuit(srpClient->AddService(services[4]));
 
         AdvanceTime(60 * 1000);
         VerifyOrQuit(sServerRxCount > 1);
         VerifyOrQuit(sServerLastMsgId != firstMsgId);
-        VerifyOrQuit(sServerLastMsgLength < firstMsgLength);
+        VerifyOrQuit(sServerLastMsgLength <= firstMsgLength);
 
         secondMsgId = sServerLastMsgId;
 
-        // Check that only one service is included in the message.
+        // Check that more than one (but not all) services are
+        // included in the message.
 
         numServices = 0;
 
@@ -1338,7 +1352,9 @@ void TestSrpClientSingleServiceMode(void)
             }
         }
 
-        VerifyOrQuit(numServices == 1);
+        VerifyOrQuit(numServices > 1);
+        VerifyOrQuit(numServices < kNumServices);
+        numPartialServices = numServices;
 
         //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
         // Now send a response from server accepting the registration.
@@ -1357,8 +1373,8 @@ void TestSrpClientSingleServiceMode(void)
         sServerRxCount = 0;
         AdvanceTime(10);
 
-        // Check that exactly one service is successfully
-        // registered.
+        // Check that all services included in the message are
+        // successfully registered.
 
         numServices = 0;
 
@@ -1380,7 +1396,7 @@ void TestSrpClientSingleServiceMode(void)
             }
         }
 
-        VerifyOrQuit(numServices == 1);
+        VerifyOrQuit(numServices == numPartialServices);
 
         //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
         // Wait for the client to register the remaining services and
@@ -1412,7 +1428,7 @@ void TestSrpClientSingleServiceMode(void)
             }
         }
 
-        VerifyOrQuit(numServices == 1);
+        VerifyOrQuit(numServices == numPartialServices);
     }
 
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1421,7 +1437,7 @@ void TestSrpClientSingleServiceMode(void)
     Log("Finalizing OT instance");
     FinalizeTest();
 
-    Log("End of TestSrpClientSingleServiceMode");
+    Log("End of TestSrpClientPartialMode");
 }
 
 #endif // OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
@@ -1494,6 +1510,211 @@ void TestSrpServerAddressModeForceAdd(void)
     Log("End of TestSrpServerAddressModeForceAdd");
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES > 0
+
+static uint16_t sRawRxCount;
+static uint16_t sRawRxLength;
+static uint8_t  sRawRxBuffer[1280];
+
+void HandleRawUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    VerifyOrQuit(aContext == nullptr);
+    VerifyOrQuit(aMessage != nullptr);
+    VerifyOrQuit(aMessageInfo != nullptr);
+
+    sRawRxLength = AsCoreType(aMessage).ReadBytes(0, sRawRxBuffer, sizeof(sRawRxBuffer));
+    sRawRxCount++;
+
+    Log("HandleRawUdpReceive(), message-len:%u", sRawRxLength);
+}
+
+void TestSrpServerMaxPendingUpdates(void)
+{
+    static constexpr uint16_t kFakeServerPort = 53535;
+    static constexpr uint16_t kFirstPeerPort  = 40000;
+    static constexpr uint16_t kMaxPending     = OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES;
+
+    Srp::Server           *srpServer;
+    Srp::Client           *srpClient;
+    Ip6::SockAddr          sockAddr;
+    Message               *message;
+    Dns::UpdateHeader      header;
+    uint8_t                update[sizeof(sRawRxBuffer)];
+    uint16_t               updateLength;
+    otSrpServerUpdateStats updateStats;
+    uint16_t               heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerMaxPendingUpdates");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Capture a signed SRP update from the client using a socket
+    // acting as SRP server.
+
+    {
+        Ip6::Udp::Socket fakeServer(*sInstance, HandleRawUdpReceive, nullptr);
+
+        SuccessOrQuit(fakeServer.Open(Ip6::kNetifThreadInternal));
+        SuccessOrQuit(fakeServer.Bind(kFakeServerPort));
+
+        sockAddr.SetAddress(sInstance->Get<Mle::Mle>().GetMeshLocalRloc());
+        sockAddr.SetPort(kFakeServerPort);
+        SuccessOrQuit(srpClient->Start(sockAddr));
+
+        SuccessOrQuit(srpClient->SetHostName(kHostName));
+        SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+        sRawRxCount = 0;
+        AdvanceTime(1 * 1000);
+        VerifyOrQuit(sRawRxCount >= 1);
+
+        memcpy(update, sRawRxBuffer, sRawRxLength);
+        updateLength = sRawRxLength;
+
+        srpClient->ClearHostAndServices();
+        srpClient->Stop();
+
+        SuccessOrQuit(fakeServer.Close());
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server with an update handler which never responds,
+    // so received updates stay pending until they time out.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    sUpdateHandlerMode = kIgnore;
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    sockAddr.SetPort(srpServer->GetPort());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send the captured update from different source ports so that
+    // each one is a new update on the server. Fill the pending queue.
+
+    for (uint16_t i = 0; i < kMaxPending; i++)
+    {
+        Ip6::Udp::Socket peer(*sInstance, HandleRawUdpReceive, nullptr);
+
+        SuccessOrQuit(peer.Open(Ip6::kNetifThreadInternal));
+        SuccessOrQuit(peer.Bind(kFirstPeerPort + i));
+
+        message = peer.NewMessage();
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(update, updateLength));
+        SuccessOrQuit(peer.SendTo(*message, sockAddr));
+
+        sProcessedUpdateCallback = false;
+        AdvanceTime(1);
+        VerifyOrQuit(sProcessedUpdateCallback);
+
+        SuccessOrQuit(peer.Close());
+    }
+
+    srpServer->GetUpdateStats(updateStats);
+    VerifyOrQuit(updateStats.mNumPending == kMaxPending);
+    VerifyOrQuit(updateStats.mMaxNumPending == kMaxPending);
+    VerifyOrQuit(updateStats.mNumRejectedBusy == 0);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send one more update. Validate that it is rejected right away
+    // with a `ServerFailure` response and counted as busy.
+
+    {
+        Ip6::Udp::Socket peer(*sInstance, HandleRawUdpReceive, nullptr);
+
+        SuccessOrQuit(peer.Open(Ip6::kNetifThreadInternal));
+        SuccessOrQuit(peer.Bind(kFirstPeerPort + kMaxPending));
+
+        message = peer.NewMessage();
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(update, updateLength));
+        SuccessOrQuit(peer.SendTo(*message, sockAddr));
+
+        sRawRxCount              = 0;
+        sProcessedUpdateCallback = false;
+        AdvanceTime(10);
+
+        VerifyOrQuit(!sProcessedUpdateCallback);
+        VerifyOrQuit(sRawRxCount == 1);
+        VerifyOrQuit(sRawRxLength >= sizeof(header));
+
+        memcpy(&header, sRawRxBuffer, sizeof(header));
+        VerifyOrQuit(header.GetType() == Dns::UpdateHeader::kTypeResponse);
+        VerifyOrQuit(header.GetResponseCode() == Dns::UpdateHeader::kResponseServerFailure);
+
+        SuccessOrQuit(peer.Close());
+    }
+
+    srpServer->GetUpdateStats(updateStats);
+    VerifyOrQuit(updateStats.mNumPending == kMaxPending);
+    VerifyOrQuit(updateStats.mNumRejectedBusy == 1);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Wait for the pending updates to time out. Validate that a new
+    // update is accepted again.
+
+    AdvanceTime(5 * 1000);
+
+    srpServer->GetUpdateStats(updateStats);
+    VerifyOrQuit(updateStats.mNumPending == 0);
+
+    {
+        Ip6::Udp::Socket peer(*sInstance, HandleRawUdpReceive, nullptr);
+
+        SuccessOrQuit(peer.Open(Ip6::kNetifThreadInternal));
+        SuccessOrQuit(peer.Bind(kFirstPeerPort + kMaxPending + 1));
+
+        message = peer.NewMessage();
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(update, updateLength));
+        SuccessOrQuit(peer.SendTo(*message, sockAddr));
+
+        sProcessedUpdateCallback = false;
+        AdvanceTime(10);
+        VerifyOrQuit(sProcessedUpdateCallback);
+
+        SuccessOrQuit(peer.Close());
+    }
+
+    srpServer->GetUpdateStats(updateStats);
+    VerifyOrQuit(updateStats.mNumPending == 1);
+    VerifyOrQuit(updateStats.mNumRejectedBusy == 1);
+
+    AdvanceTime(5 * 1000);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server and validate all heap allocations are freed.
+
+    sUpdateHandlerMode = kAccept;
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerMaxPendingUpdates");
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES > 0
+
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
 
 void TestSrpServerFastStartMode(void)
@@ -1625,9 +1846,12 @@ int main(void)
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     ot::TestUpdateLeaseShortVariant();
     ot::TestSrpClientDelayedResponse();
-    ot::TestSrpClientSingleServiceMode();
+    ot::TestSrpClientPartialMode();
 #endif
     ot::TestSrpServerAddressModeForceAdd();
+#if OPENTHREAD_CONFIG_SRP_SERVER_MAX_PENDING_UPDATES > 0
+    ot::TestSrpServerMaxPendingUpdates();
+#endif
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     ot::TestSrpServerFastStartMode();
 #endif
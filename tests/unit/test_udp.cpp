@@ -0,0 +1,537 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/message.hpp"
+#include "instance/instance.hpp"
+#include "net/udp6.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static const void *sReceivedContext = nullptr;
+static uint16_t    sReceivedCount   = 0;
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sReceivedContext = aContext;
+    sReceivedCount++;
+}
+
+class UnitTester
+{
+public:
+    typedef Ip6::Udp::SocketHandle SocketHandle;
+
+    static uint8_t BucketOf(uint16_t aPort) { return Ip6::Udp::BucketIndexFor(aPort); }
+
+    static uint8_t BucketOf(const SocketHandle &aSocket) { return BucketOf(aSocket.GetSockName().mPort); }
+
+    static uint16_t FindFreePortInBucket(const Ip6::Udp &aUdp, uint8_t aBucket, uint16_t aStartPort)
+    {
+        uint16_t port = aStartPort;
+
+        while ((BucketOf(port) != aBucket) || aUdp.IsPortInUse(port) || Ip6::Udp::IsPortReserved(port))
+        {
+            port++;
+        }
+
+        return port;
+    }
+
+    static void VerifyBuckets(const Ip6::Udp &aUdp)
+    {
+        // Verifies that the sockets in `mSockets` are grouped by
+        // bucket in increasing bucket order and that each entry in
+        // `mSocketBuckets[]` points to the first socket of its group
+        // (or is `nullptr` for an empty bucket).
+
+        bool                seen[Ip6::Udp::kNumSocketBuckets];
+        const SocketHandle *prev = nullptr;
+
+        memset(seen, 0, sizeof(seen));
+
+        for (const SocketHandle *socket = aUdp.mSockets.GetHead(); socket != nullptr; socket = socket->GetNext())
+        {
+            uint8_t bucket = BucketOf(*socket);
+
+            if ((prev == nullptr) || (BucketOf(*prev) != bucket))
+            {
+                VerifyOrQuit((prev == nullptr) || (BucketOf(*prev) < bucket));
+                VerifyOrQuit(!seen[bucket]);
+                VerifyOrQuit(aUdp.mSocketBuckets[bucket] == socket);
+                seen[bucket] = true;
+            }
+
+            VerifyOrQuit(aUdp.IsOpen(*socket));
+            prev = socket;
+        }
+
+        for (uint8_t bucket = 0; bucket < Ip6::Udp::kNumSocketBuckets; bucket++)
+        {
+            if (!seen[bucket])
+            {
+                VerifyOrQuit(aUdp.mSocketBuckets[bucket] == nullptr);
+            }
+        }
+    }
+
+    template <uint16_t kLength>
+    static void VerifyBucketStartsWith(const Ip6::Udp &aUdp, uint8_t aBucket, const SocketHandle *(&aSockets)[kLength])
+    {
+        // Verifies that the bucket group starts with the given sockets
+        // in order. The group may contain other (older) sockets opened
+        // by the OpenThread instance itself after these.
+
+        const SocketHandle *socket = aUdp.mSocketBuckets[aBucket];
+
+        for (const SocketHandle *expected : aSockets)
+        {
+            VerifyOrQuit(socket == expected);
+            VerifyOrQuit(BucketOf(*socket) == aBucket);
+            socket = socket->GetNext();
+        }
+    }
+
+    static bool IsInBucketGroup(const Ip6::Udp &aUdp, const SocketHandle &aSocket, uint8_t aBucket)
+    {
+        bool found = false;
+
+        for (const SocketHandle *socket = aUdp.mSocketBuckets[aBucket]; Ip6::Udp::IsInBucket(socket, aBucket);
+             socket = socket->GetNext())
+        {
+            if (socket == &aSocket)
+            {
+                found = true;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+    static void TestUdpSocketBuckets(void)
+    {
+        static constexpr uint16_t kStartPort = 1000;
+
+        Instance *instance;
+        Ip6::Udp *udp;
+        uint8_t   bucket;
+        uint8_t   otherBucket;
+        uint16_t  port1;
+        uint16_t  port2;
+        uint16_t  port3;
+        uint16_t  port4;
+
+        printf("TestUdpSocketBuckets\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        udp = &instance->Get<Ip6::Udp>();
+
+        {
+            Ip6::Udp::Socket socket1(*instance, HandleUdpReceive, &socket1);
+            Ip6::Udp::Socket socket2(*instance, HandleUdpReceive, &socket2);
+            Ip6::Udp::Socket socket3(*instance, HandleUdpReceive, &socket3);
+            Ip6::Udp::Socket socket4(*instance, HandleUdpReceive, &socket4);
+
+            VerifyBuckets(*udp);
+
+            bucket      = BucketOf(kStartPort);
+            otherBucket = (bucket + 1) % Ip6::Udp::kNumSocketBuckets;
+
+            port1 = FindFreePortInBucket(*udp, bucket, kStartPort);
+            port2 = FindFreePortInBucket(*udp, bucket, port1 + 1);
+            port3 = FindFreePortInBucket(*udp, bucket, port2 + 1);
+            port4 = FindFreePortInBucket(*udp, otherBucket, kStartPort);
+
+            VerifyOrQuit(port1 != port2 && port2 != port3);
+            VerifyOrQuit(BucketOf(port4) != bucket);
+
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // Open and bind sockets to ports sharing the same bucket and to
+            // a port in a different bucket.
+
+            VerifyOrQuit(!udp->IsOpen(socket1));
+
+            SuccessOrQuit(socket1.Open(Ip6::kNetifThreadInternal));
+            VerifyOrQuit(udp->IsOpen(socket1));
+            VerifyBuckets(*udp);
+
+            SuccessOrQuit(socket1.Bind(port1));
+            SuccessOrQuit(socket2.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(socket2.Bind(port2));
+            SuccessOrQuit(socket3.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(socket3.Bind(port3));
+            SuccessOrQuit(socket4.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(socket4.Bind(port4));
+
+            VerifyBuckets(*udp);
+
+            VerifyOrQuit(udp->IsOpen(socket1));
+            VerifyOrQuit(udp->IsOpen(socket2));
+            VerifyOrQuit(udp->IsOpen(socket3));
+            VerifyOrQuit(udp->IsOpen(socket4));
+
+            VerifyOrQuit(udp->IsPortInUse(port1));
+            VerifyOrQuit(udp->IsPortInUse(port2));
+            VerifyOrQuit(udp->IsPortInUse(port3));
+            VerifyOrQuit(udp->IsPortInUse(port4));
+
+            // The most recently bound socket is the head of the bucket.
+            {
+                const SocketHandle *expected[] = {&socket3, &socket2, &socket1};
+
+                VerifyBucketStartsWith(*udp, bucket, expected);
+            }
+
+            VerifyOrQuit(udp->mSocketBuckets[otherBucket] == &socket4);
+            VerifyOrQuit(!IsInBucketGroup(*udp, socket4, bucket));
+            VerifyOrQuit(!IsInBucketGroup(*udp, socket1, otherBucket));
+
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // Close the middle entry of the bucket.
+
+            SuccessOrQuit(socket2.Close());
+            VerifyOrQuit(!udp->IsOpen(socket2));
+            VerifyOrQuit(!udp->IsPortInUse(port2));
+            VerifyBuckets(*udp);
+
+            {
+                const SocketHandle *expected[] = {&socket3, &socket1};
+
+                VerifyBucketStartsWith(*udp, bucket, expected);
+            }
+
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // Close the head entry of the bucket.
+
+            SuccessOrQuit(socket2.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(socket2.Bind(port2));
+
+            {
+                const SocketHandle *expected[] = {&socket2, &socket3, &socket1};
+
+                VerifyBucketStartsWith(*udp, bucket, expected);
+            }
+
+            SuccessOrQuit(socket2.Close());
+            VerifyOrQuit(!udp->IsOpen(socket2));
+            VerifyBuckets(*udp);
+
+            {
+                const SocketHandle *expected[] = {&socket3, &socket1};
+
+                VerifyBucketStartsWith(*udp, bucket, expected);
+            }
+
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // Close the tail entry of the bucket (`socket1` is the last of
+            // the sockets bound by the test and may be followed by other
+            // sockets of the instance or by the next bucket's group).
+
+            SuccessOrQuit(socket2.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(socket2.Bind(port2));
+
+            SuccessOrQuit(socket1.Close());
+            VerifyOrQuit(!udp->IsOpen(socket1));
+            VerifyOrQuit(!udp->IsPortInUse(port1));
+            VerifyBuckets(*udp);
+
+            {
+                const SocketHandle *expected[] = {&socket2, &socket3};
+
+                VerifyBucketStartsWith(*udp, bucket, expected);
+            }
+
+            VerifyOrQuit(udp->mSocketBuckets[otherBucket] == &socket4);
+
+            // Closing an already closed socket is a no-op.
+            SuccessOrQuit(socket1.Close());
+            VerifyBuckets(*udp);
+
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // Re-bind an open socket to a port in a different bucket.
+
+            SuccessOrQuit(socket3.Bind(FindFreePortInBucket(*udp, otherBucket, port4 + 1)));
+            VerifyOrQuit(udp->IsOpen(socket3));
+            VerifyOrQuit(!udp->IsPortInUse(port3));
+            VerifyOrQuit(!IsInBucketGroup(*udp, socket3, bucket));
+            VerifyOrQuit(udp->mSocketBuckets[otherBucket] == &socket3);
+            VerifyOrQuit(udp->mSocketBuckets[bucket] == &socket2);
+            VerifyBuckets(*udp);
+
+            SuccessOrQuit(socket2.Close());
+            SuccessOrQuit(socket3.Close());
+            SuccessOrQuit(socket4.Close());
+            VerifyBuckets(*udp);
+
+            VerifyOrQuit(!IsInBucketGroup(*udp, socket2, bucket));
+            VerifyOrQuit(!IsInBucketGroup(*udp, socket3, otherBucket));
+            VerifyOrQuit(!IsInBucketGroup(*udp, socket4, otherBucket));
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void TestUdpEphemeralPortBind(void)
+    {
+        Instance *instance;
+        Ip6::Udp *udp;
+        uint16_t  nextPort;
+        uint8_t   ephemeralBucket;
+
+        printf("TestUdpEphemeralPortBind\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        udp = &instance->Get<Ip6::Udp>();
+
+        {
+            Ip6::Udp::Socket socket1(*instance, HandleUdpReceive, &socket1);
+            Ip6::Udp::Socket socket2(*instance, HandleUdpReceive, &socket2);
+
+            // An opened but unbound socket is indexed under port zero.
+
+            SuccessOrQuit(socket1.Open(Ip6::kNetifThreadInternal));
+            VerifyOrQuit(!socket1.IsBound());
+            VerifyOrQuit(udp->IsOpen(socket1));
+            VerifyOrQuit(IsInBucketGroup(*udp, socket1, BucketOf(0)));
+            VerifyBuckets(*udp);
+
+            // Bind to an ephemeral port, the socket moves to the bucket
+            // of the allocated port.
+
+            SuccessOrQuit(socket1.Bind());
+            VerifyOrQuit(socket1.IsBound());
+            VerifyOrQuit(socket1.GetSockName().mPort >= Ip6::Udp::kDynamicPortMin);
+            VerifyOrQuit(udp->IsOpen(socket1));
+            VerifyOrQuit(udp->IsPortInUse(socket1.GetSockName().mPort));
+
+            ephemeralBucket = BucketOf(socket1);
+            VerifyOrQuit(udp->mSocketBuckets[ephemeralBucket] == &socket1);
+
+            if (ephemeralBucket != BucketOf(0))
+            {
+                VerifyOrQuit(!IsInBucketGroup(*udp, socket1, BucketOf(0)));
+            }
+
+            VerifyBuckets(*udp);
+
+            // Bind a socket to the next ephemeral port candidate and
+            // verify that the ephemeral port allocation skips it.
+
+            nextPort = udp->mEphemeralPort + 1;
+
+            while (Ip6::Udp::IsPortReserved(nextPort) || udp->IsPortInUse(nextPort))
+            {
+                nextPort++;
+            }
+
+            SuccessOrQuit(socket2.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(socket2.Bind(nextPort));
+            VerifyOrQuit(udp->IsPortInUse(nextPort));
+
+            SuccessOrQuit(socket1.Close());
+            VerifyOrQuit(!udp->IsOpen(socket1));
+            VerifyBuckets(*udp);
+
+            SuccessOrQuit(socket1.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(socket1.Bind());
+            VerifyOrQuit(socket1.GetSockName().mPort != nextPort);
+            VerifyOrQuit(udp->mSocketBuckets[BucketOf(socket1)] == &socket1);
+            VerifyBuckets(*udp);
+
+            // `IsOpen()` looks up the socket in the bucket of its port. A
+            // closed socket is no longer found while the other socket
+            // remains open.
+
+            SuccessOrQuit(socket2.Close());
+            VerifyOrQuit(!udp->IsOpen(socket2));
+            VerifyOrQuit(!udp->IsPortInUse(nextPort));
+            VerifyOrQuit(udp->IsOpen(socket1));
+
+            SuccessOrQuit(socket1.Close());
+            VerifyOrQuit(!udp->IsOpen(socket1));
+            VerifyBuckets(*udp);
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void SendToUdp(Instance &aInstance, const Ip6::Address &aSockAddr, uint16_t aSockPort)
+    {
+        Message         *message;
+        Ip6::MessageInfo messageInfo;
+        Ip6::Address     peerAddr;
+
+        SuccessOrQuit(peerAddr.FromString("fd00::1234"));
+
+        messageInfo.SetSockAddr(aSockAddr);
+        messageInfo.SetSockPort(aSockPort);
+        messageInfo.SetPeerAddr(peerAddr);
+        messageInfo.SetPeerPort(1234);
+
+        message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Append<uint32_t>(0x12345678));
+
+        sReceivedContext = nullptr;
+        sReceivedCount   = 0;
+
+        aInstance.Get<Ip6::Udp>().HandlePayload(*message, messageInfo);
+
+        message->Free();
+    }
+
+    static void TestUdpReceivePriority(void)
+    {
+        static constexpr uint16_t kStartPort = 2000;
+
+        Instance     *instance;
+        Ip6::Udp     *udp;
+        Ip6::Address  specificAddr;
+        Ip6::Address  otherAddr;
+        Ip6::SockAddr sockAddr;
+        uint16_t      port;
+        uint16_t      otherPort;
+
+        printf("TestUdpReceivePriority\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        udp = &instance->Get<Ip6::Udp>();
+
+        SuccessOrQuit(specificAddr.FromString("ff03::fc"));
+        SuccessOrQuit(otherAddr.FromString("ff03::fd"));
+
+        {
+            Ip6::Udp::Socket wildcardSocket(*instance, HandleUdpReceive, &wildcardSocket);
+            Ip6::Udp::Socket specificSocket(*instance, HandleUdpReceive, &specificSocket);
+            Ip6::Udp::Socket unboundSocket(*instance, HandleUdpReceive, &unboundSocket);
+            Ip6::Udp::Socket sameBucketSocket(*instance, HandleUdpReceive, &sameBucketSocket);
+
+            port      = FindFreePortInBucket(*udp, BucketOf(kStartPort), kStartPort);
+            otherPort = FindFreePortInBucket(*udp, BucketOf(port), port + 1);
+
+            // The wildcard socket is bound to the port with an
+            // unspecified address and opened first.
+
+            SuccessOrQuit(wildcardSocket.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(wildcardSocket.Bind(port));
+
+            SendToUdp(*instance, specificAddr, port);
+            VerifyOrQuit(sReceivedCount == 1);
+            VerifyOrQuit(sReceivedContext == &wildcardSocket);
+
+            // An unbound socket and a socket bound to another port in the
+            // same bucket never receive messages for `port`.
+
+            SuccessOrQuit(unboundSocket.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(sameBucketSocket.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(sameBucketSocket.Bind(otherPort));
+            VerifyOrQuit(udp->mSocketBuckets[BucketOf(port)] == &sameBucketSocket);
+
+            SendToUdp(*instance, specificAddr, port);
+            VerifyOrQuit(sReceivedCount == 1);
+            VerifyOrQuit(sReceivedContext == &wildcardSocket);
+
+            SendToUdp(*instance, specificAddr, otherPort);
+            VerifyOrQuit(sReceivedCount == 1);
+            VerifyOrQuit(sReceivedContext == &sameBucketSocket);
+
+            // A socket bound to the same port and a specific address
+            // takes precedence over the wildcard socket for that address.
+
+            sockAddr.SetAddress(specificAddr);
+            sockAddr.mPort = port;
+
+            SuccessOrQuit(specificSocket.Open(Ip6::kNetifThreadInternal));
+            SuccessOrQuit(specificSocket.Bind(sockAddr));
+            VerifyBuckets(*udp);
+
+            SendToUdp(*instance, specificAddr, port);
+            VerifyOrQuit(sReceivedCount == 1);
+            VerifyOrQuit(sReceivedContext == &specificSocket);
+
+            // Messages to other addresses still go to the wildcard socket.
+
+            SendToUdp(*instance, otherAddr, port);
+            VerifyOrQuit(sReceivedCount == 1);
+            VerifyOrQuit(sReceivedContext == &wildcardSocket);
+
+            // No socket is bound to a third port of the same bucket, so
+            // nothing is received.
+
+            SendToUdp(*instance, specificAddr, FindFreePortInBucket(*udp, BucketOf(port), otherPort + 1));
+            VerifyOrQuit(sReceivedCount == 0);
+
+            // After closing the specific socket, the wildcard socket
+            // receives again.
+
+            SuccessOrQuit(specificSocket.Close());
+            VerifyBuckets(*udp);
+
+            SendToUdp(*instance, specificAddr, port);
+            VerifyOrQuit(sReceivedCount == 1);
+            VerifyOrQuit(sReceivedContext == &wildcardSocket);
+
+            SuccessOrQuit(wildcardSocket.Close());
+            SuccessOrQuit(unboundSocket.Close());
+            SuccessOrQuit(sameBucketSocket.Close());
+            VerifyBuckets(*udp);
+
+            SendToUdp(*instance, specificAddr, port);
+            VerifyOrQuit(sReceivedCount == 0);
+        }
+
+        testFreeInstance(instance);
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::UnitTester::TestUdpSocketBuckets();
+    ot::UnitTester::TestUdpEphemeralPortBind();
+    ot::UnitTester::TestUdpReceivePriority();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -110,6 +110,11 @@
 #define MBEDTLS_SSL_KEEP_PEER_CERTIFICATE
 #endif
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_SESSION_TICKET_ENABLE
+#define MBEDTLS_SSL_SESSION_TICKETS
+#define MBEDTLS_SSL_TICKET_C
+#endif
+
 #define MBEDTLS_KEY_EXCHANGE_ECJPAKE_ENABLED
 
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
@@ -171,6 +176,10 @@
 #define MBEDTLS_ECP_WINDOW_SIZE            2 /**< Maximum window size used */
 #define MBEDTLS_ECP_FIXED_POINT_OPTIM      0 /**< Enable fixed-point speed-up */
 
+#if OPENTHREAD_CONFIG_SECURE_TRANSPORT_HANDSHAKE_MAX_ECP_OPS
+#define MBEDTLS_ECP_RESTARTABLE
+#endif
+
 // ==============================================================================
 // Platform configuration
 // ==============================================================================
@@ -52,9 +52,10 @@
  * samkumar: The FreeBSD implementation supports many congestion control
  * algorithms, each represented by a struct. Each tcpcb has a pointer to the
  * relevant congestion control struct, and the congestion control structs are
- * themselves part of an intrusive linked list. TCPlp hardcodes the congestion
- * control algorithm to New Reno, so the fields corresponding to maintaining
- * the global linked list are removed.
+ * themselves part of an intrusive linked list. TCPlp lets the host set the
+ * congestion control struct of each TCB (New Reno by default) instead of
+ * using a registry of loadable modules, so the fields corresponding to
+ * maintaining the global linked list are removed.
  */
 
 #ifndef TCPLP_NETINET_CC_H_
@@ -64,6 +65,7 @@
 #include "tcp.h"
 
 extern const struct cc_algo newreno_cc_algo;
+extern const struct cc_algo vegas_cc_algo;
 
 /*
  * Wrapper around transport structs that contain same-named congestion
@@ -154,8 +156,7 @@ struct cc_algo {
 };
 
 /* Macro to obtain the CC algo's struct ptr. */
-//#define	CC_ALGO(tp)	((tp)->cc_algo)
-#define CC_ALGO(tp) (&newreno_cc_algo) // samkumar: This allows the #defines in cc_newreno.c to work as intended
+#define	CC_ALGO(tp)	((tp)->cc_algo)
 
 /* Macro to obtain the CC algo's data ptr. */
 #define	CC_DATA(tp)	((tp)->ccv->cc_data)
@@ -0,0 +1,172 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Delay-based congestion control, after TCP Vegas (Brakmo and Peterson).
+ *
+ * On a multi-hop 802.15.4 mesh most segment losses are caused by the
+ * (bursty) link layer rather than by queue overflow, so a loss-based
+ * algorithm keeps collapsing its window while a full window still fills
+ * the forwarding queues along the path. This algorithm instead estimates,
+ * once per round trip, how many segments of the window are queued in the
+ * network:
+ *
+ *   diff = cwnd * (rtt - base_rtt) / rtt     (in segments)
+ *
+ * where base_rtt is the lowest RTT observed on the connection. The window
+ * grows while fewer than alpha segments are queued, and shrinks when more
+ * than beta segments are queued. During slow start, the window stops
+ * doubling once more than gamma segments are queued.
+ *
+ * Loss recovery (fast retransmit, SACK recovery, RTO) and restart after
+ * idle are handled the same way as in New Reno.
+ */
+
+#include "../cc.h"
+#include "../tcp.h"
+#include "../tcp_seq.h"
+#include "../tcp_var.h"
+#include "cc_module.h"
+
+#include "../tcp_const.h"
+
+/* Thresholds on the number of queued segments. */
+enum {
+	VEGAS_ALPHA = 1,
+	VEGAS_BETA = 3,
+	VEGAS_GAMMA = 1
+};
+
+static uint32_t min(uint32_t a, uint32_t b) { return (a < b) ? a : b; }
+
+static void	vegas_ack_received(struct cc_var *ccv, uint16_t type);
+static void	vegas_after_idle(struct cc_var *ccv);
+static void	vegas_cong_signal(struct cc_var *ccv, uint32_t type);
+static void	vegas_conn_init(struct cc_var *ccv);
+static void	vegas_post_recovery(struct cc_var *ccv);
+
+const struct cc_algo vegas_cc_algo = {
+	.name = "vegas",
+	.ack_received = vegas_ack_received,
+	.after_idle = vegas_after_idle,
+	.cong_signal = vegas_cong_signal,
+	.conn_init = vegas_conn_init,
+	.post_recovery = vegas_post_recovery,
+};
+
+static void
+vegas_conn_init(struct cc_var *ccv)
+{
+	CCV(ccv, cc_rtt_mark) = CCV(ccv, snd_max);
+}
+
+static uint32_t
+vegas_reduced_cwnd(struct cc_var *ccv)
+{
+	uint32_t maxseg = CCV(ccv, t_maxseg);
+	uint32_t cw = CCV(ccv, snd_cwnd);
+
+	return (cw > 3 * maxseg) ? (cw - maxseg) : (2 * maxseg);
+}
+
+static void
+vegas_ack_received(struct cc_var *ccv, uint16_t type)
+{
+	uint32_t rtt;
+	uint32_t base_rtt;
+	uint32_t diff;
+	uint32_t maxseg = CCV(ccv, t_maxseg);
+
+	/*
+	 * Fall back to New Reno until there is an RTT sample, and for
+	 * anything other than a regular ACK outside of loss recovery.
+	 */
+	if (type != CC_ACK || IN_RECOVERY(CCV(ccv, t_flags)) ||
+	    CCV(ccv, t_srtt) == 0 || CCV(ccv, t_rttlow) == 0) {
+		newreno_cc_algo.ack_received(ccv, type);
+		return;
+	}
+
+	if (CCV(ccv, snd_cwnd) <= CCV(ccv, snd_ssthresh)) {
+		/* Slow start grows the window on every ACK, as New Reno does. */
+		newreno_cc_algo.ack_received(ccv, type);
+	}
+
+	/* The queueing estimate is only updated once per round trip. */
+	if (SEQ_LT(ccv->curack, CCV(ccv, cc_rtt_mark)))
+		return;
+
+	CCV(ccv, cc_rtt_mark) = CCV(ccv, snd_max);
+
+	rtt = ((uint32_t) CCV(ccv, t_srtt)) >> TCP_RTT_SHIFT;
+	base_rtt = (uint32_t) CCV(ccv, t_rttlow);
+
+	if (rtt <= base_rtt)
+		diff = 0;
+	else
+		diff = (CCV(ccv, snd_cwnd) / maxseg) * (rtt - base_rtt) / rtt;
+
+	if (CCV(ccv, snd_cwnd) <= CCV(ccv, snd_ssthresh)) {
+		/*
+		 * Leave slow start once the path starts to queue, continuing in
+		 * congestion avoidance with a slightly reduced window.
+		 */
+		if (diff > VEGAS_GAMMA) {
+			CCV(ccv, snd_cwnd) = vegas_reduced_cwnd(ccv);
+			CCV(ccv, snd_ssthresh) = CCV(ccv, snd_cwnd) - 1;
+		}
+	} else if (diff < VEGAS_ALPHA) {
+		if (ccv->flags & CCF_CWND_LIMITED) {
+			CCV(ccv, snd_cwnd) = min(CCV(ccv, snd_cwnd) + maxseg,
+			    ((uint32_t) TCP_MAXWIN) << CCV(ccv, snd_scale));
+		}
+	} else if (diff > VEGAS_BETA) {
+		CCV(ccv, snd_cwnd) = vegas_reduced_cwnd(ccv);
+	}
+}
+
+static void
+vegas_after_idle(struct cc_var *ccv)
+{
+	newreno_cc_algo.after_idle(ccv);
+}
+
+static void
+vegas_cong_signal(struct cc_var *ccv, uint32_t type)
+{
+	newreno_cc_algo.cong_signal(ccv, type);
+}
+
+static void
+vegas_post_recovery(struct cc_var *ccv)
+{
+	newreno_cc_algo.post_recovery(ccv);
+
+	/* Start a new round, the RTT measured during recovery is inflated. */
+	CCV(ccv, cc_rtt_mark) = CCV(ccv, snd_max);
+}
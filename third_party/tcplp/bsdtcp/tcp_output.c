@@ -381,6 +381,16 @@ after_sack_rexmit:
 	      (tp->t_tfo_client_cookie_len == 0)) ||*/
 	     (flags & TH_RST)))
 		len = 0;
+	/*
+	 * The host may hold back new data while earlier segments of this
+	 * connection are still waiting in its (link layer) send queue.
+	 * Retransmissions, persist probes, and SYN/RST segments are never held
+	 * back. The host calls tcplp_output once the queue drains.
+	 */
+	if (len > 0 && sack_rxmit == 0 && SEQ_GEQ(tp->snd_nxt, tp->snd_max) &&
+	    (flags & (TH_SYN | TH_RST)) == 0 &&
+	    (tp->t_flags & TF_FORCEDATA) == 0 && tcplp_sys_output_paced(tp))
+		len = 0;
 	if (len <= 0) {
 		/*
 		 * If FIN has been sent but not acked,
@@ -1212,6 +1222,9 @@ send:
 	 */
 	/* samkumar: I've replaced the call to ip6_output with the following. */
 	otMessageWrite(message, 0, outbuf, sizeof(struct tcphdr) + optlen);
+	if (len > 0)
+		tcplp_sys_output_data_segment(tp, message,
+		    sack_rxmit || SEQ_LT(tp->snd_nxt, tp->snd_max));
 	tcplp_sys_send_message(tp->instance, message, &ip6info);
 
 out:
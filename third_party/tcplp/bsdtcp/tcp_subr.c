@@ -102,11 +102,9 @@ void initialize_tcb(struct tcpcb* tp) {
 	tp->reass_fin_index = -1;
 
 	/*
-	 * samkumar: Only New Reno congestion control is implemented at the moment,
-	 * so there's no need to record the congestion control algorithm used for
-	 * each TCB.
+	 * samkumar: The congestion control algorithm (CC_ALGO(tp)) is chosen by
+	 * the host and is not cleared above, so it is not set here.
 	 */
-	// CC_ALGO(tp) = CC_DEFAULT();
 	// tp->ccv->type = IPPROTO_TCP;
 	tp->ccv->ccvc.tcp = tp;
 
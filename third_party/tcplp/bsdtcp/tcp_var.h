@@ -187,6 +187,13 @@ struct tcpcb {
 
 	struct tcpcb_listen* accepted_from;
 
+	/*
+	 * Congestion control algorithm of this connection. It is chosen by the
+	 * host and, like the fields above, it is kept when the TCB is
+	 * reinitialized.
+	 */
+	const struct cc_algo* cc_algo;
+
 	struct lbufhead sendbuf;
 	struct cbufhead recvbuf;
 	uint8_t* reassbmp;
@@ -252,6 +259,7 @@ struct tcpcb {
 					 */
 //	uint64_t	snd_spare2;		/* unused */
 	tcp_seq	snd_recover;		/* for use in NewReno Fast Recovery */
+	tcp_seq	cc_rtt_mark;		/* snd_max when current cc round began */
 
 	uint32_t	t_maxopd;		/* mss plus options */
 
@@ -332,7 +340,6 @@ struct tcpcb {
 //	int	t_rcvoopack;		/* out-of-order packets received */
 //	void	*t_toe;			/* TOE pcb pointer */
 	int32_t	t_bytes_acked;		/* # bytes acked during current RTT */
-//	struct cc_algo	*cc_algo;	/* congestion control algorithm */
 	struct cc_var	ccv[1];		/* congestion control specific vars */
 #if 0
 	struct osd	*osd;		/* storage for Khelp module data */
@@ -70,6 +70,8 @@ struct tcplp_signals
 otMessage *   tcplp_sys_new_message(otInstance *aInstance);
 void          tcplp_sys_free_message(otInstance *aInstance, otMessage *aMessage);
 void          tcplp_sys_send_message(otInstance *aInstance, otMessage *aMessage, otMessageInfo *aMessageInfo);
+bool          tcplp_sys_output_paced(struct tcpcb *aTcb);
+void          tcplp_sys_output_data_segment(struct tcpcb *aTcb, otMessage *aMessage, bool aRetransmit);
 uint32_t      tcplp_sys_get_ticks();
 uint32_t      tcplp_sys_get_millis();
 void          tcplp_sys_set_timer(struct tcpcb *aTcb, uint8_t aTimerFlag, uint32_t aDelay);